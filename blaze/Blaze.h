@@ -6615,6 +6615,35 @@ namespace blaze {}
 // whether streaming is beneficial or hurtful for performance.
 //
 //
+// \n \section huge_pages Huge Pages
+//
+// Large vectors and matrices that are backed by default 4 KiB pages cause a steady stream of TLB
+// misses in the memory-bound kernels. On Linux systems, \b Blaze can therefore allocate all memory
+// blocks above a certain size threshold as 2 MiB-aligned mappings that are backed by transparent
+// huge pages. This huge page allocation mode is disabled by default and can be enabled via the
+// configuration file <em>./blaze/config/HugePages.h</em>, which provides the according compile
+// time switches and the size threshold:
+
+   \code
+   #define BLAZE_USE_HUGE_PAGES 1
+   #define BLAZE_USE_HUGETLBFS 0
+
+   const size_t hugePageThreshold = 16777216UL;
+   \endcode
+
+// In case \c BLAZE_USE_HUGETLBFS is set to 1, the memory is first requested from the explicitly
+// reserved huge pages of the hugetlbfs. The outcome for a particular vector or matrix can be
+// inspected via the hugePageStatus() function:
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+   blaze::HugePageStatus status = blaze::hugePageStatus( A.data() );
+   \endcode
+
+// Possible results are \c blaze::noHugePages, \c blaze::transparentHugePages, and
+// \c blaze::hugetlbPages.
+//
+//
 // \n <center> Previous: \ref intra_statement_optimization </center>
 */
 //*************************************************************************************************
@@ -41,11 +41,15 @@
 //*************************************************************************************************
 
 #include <blaze/math/Accuracy.h>
+#include <blaze/math/AssemblyMap.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
 #include <blaze/math/Constraints.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
@@ -54,10 +58,19 @@
 #include <blaze/math/Infinity.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
+#include <blaze/math/HypersparseMatrix.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/OutOfCoreMatrix.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/Reordering.h>
+#include <blaze/math/Semiring.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/SplitCompressedMatrix.h>
+#include <blaze/math/SplitCompressedVector.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
@@ -66,6 +79,7 @@
 #include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
+#include <blaze/math/TriangularSolver.h>
 #include <blaze/math/TypeTraits.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
@@ -60,6 +60,7 @@
 #include <blaze/util/Limits.h>
 #include <blaze/util/Logging.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMap.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
@@ -67,6 +68,7 @@
 #include <blaze/util/Null.h>
 #include <blaze/util/NullType.h>
 #include <blaze/util/PointerCast.h>
+#include <blaze/util/PoolAllocator.h>
 #include <blaze/util/Policies.h>
 #include <blaze/util/PtrIterator.h>
 #include <blaze/util/PtrVector.h>
@@ -90,5 +92,6 @@
 #include <blaze/util/UniquePtr.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/Workspace.h>
 
 #endif
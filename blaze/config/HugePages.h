@@ -0,0 +1,91 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/HugePages.h
+//  \brief Configuration of the huge page allocation mode
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the (de-)activation of huge page backed allocations.
+// \ingroup config
+//
+// This compilation switch enables/disables the huge page allocation mode. In case the switch is
+// set to 1 (i.e. in case huge pages are enabled), all memory blocks of at least
+// \a hugePageThreshold bytes (see below) are allocated from the operating system as 2 MiB-aligned
+// mappings and the kernel is advised to back them with transparent huge pages (via the
+// \c madvise(MADV_HUGEPAGE) system call). This considerably reduces the number of TLB misses of
+// the memory-bound kernels operating on large vectors and matrices. In case the switch is set
+// to 0, all memory blocks are allocated via the default allocation functions. Since huge pages
+// increase the memory footprint of each large memory block by up to 2 MiB and since the kernel
+// settings for transparent huge pages differ between systems, the huge page allocation mode has
+// to be explicitly enabled. Note that huge pages are only available on Linux systems; on all
+// other systems this switch has no effect. The outcome of an allocation can be inspected via
+// the hugePageStatus() function.
+//
+// Possible settings for the huge page switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_HUGE_PAGES 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the use of the hugetlbfs.
+// \ingroup config
+//
+// In case the huge page allocation mode is enabled and this switch is set to 1, large memory
+// blocks are first requested from the pool of explicitly reserved huge pages of the hugetlbfs
+// (via \c MAP_HUGETLB). In case no reserved huge pages are available, the allocation falls back
+// to transparent huge pages. Note that the hugetlbfs requires huge pages to be reserved by the
+// system administrator (for instance via \c /proc/sys/vm/nr_hugepages).
+//
+// Possible settings for the hugetlbfs switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_HUGETLBFS 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size threshold for huge page backed allocations.
+// \ingroup config
+//
+// This setting specifies the minimum size in bytes of a memory block to be allocated as huge
+// page backed memory. Since each such memory block is rounded up to a multiple of 2 MiB, smaller
+// memory blocks are allocated via the default allocation functions.
+*/
+const size_t hugePageThreshold = 16777216UL;
+//*************************************************************************************************
+
+} // namespace blaze
@@ -1202,4 +1202,77 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assembly threshold.
+// \ingroup config
+//
+// This threshold specifies when the assembly of a sparse matrix from coordinate triplets (see
+// for instance the CompressedMatrix::assemble() function) can be executed in parallel. In case
+// the number of given triplets is larger or equal to this threshold, the operation is executed
+// in parallel. If the number of triplets is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATASSEMBLE_THRESHOLD = 65536UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This threshold specifies when a level of rows of a sparse triangular solve (see for instance
+// the TriangularSolver class template) can be executed in parallel. In case the number of rows
+// within a single level of the level schedule is larger or equal to this threshold, the level
+// is processed in parallel. If the number of rows is below this threshold the level is processed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 2048. In case the threshold is set to 0, all levels
+// are unconditionally processed in parallel.
+*/
+const size_t SMP_SMATSOLVE_THRESHOLD = 2048UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix storage order conversion threshold.
+// \ingroup config
+//
+// This threshold specifies when the conversion of a sparse matrix into the opposite storage
+// order (as for instance performed by the assignment of a row-major to a column-major
+// CompressedMatrix or by the evaluation of a sparse matrix transposition) can be executed in
+// parallel. In case the number of non-zero elements of the converted matrix is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of non-zero elements
+// is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATTRANSPOSE_THRESHOLD = 65536UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -63,27 +63,28 @@ namespace blaze {
 // This specialization of the Rand class creates random instances of DynamicMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-class Rand< DynamicMatrix<Type,SO> >
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+class Rand< DynamicMatrix<Type,SO,AT> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const DynamicMatrix<Type,SO> generate( size_t m, size_t n ) const;
+   inline const DynamicMatrix<Type,SO,AT> generate( size_t m, size_t n ) const;
 
    template< typename Arg >
-   inline const DynamicMatrix<Type,SO> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   inline const DynamicMatrix<Type,SO,AT> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( DynamicMatrix<Type,SO>& matrix ) const;
+   inline void randomize( DynamicMatrix<Type,SO,AT>& matrix ) const;
 
    template< typename Arg >
-   inline void randomize( DynamicMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   inline void randomize( DynamicMatrix<Type,SO,AT>& matrix, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -100,11 +101,12 @@ class Rand< DynamicMatrix<Type,SO> >
 // \return The generated random matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const DynamicMatrix<Type,SO>
-   Rand< DynamicMatrix<Type,SO> >::generate( size_t m, size_t n ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline const DynamicMatrix<Type,SO,AT>
+   Rand< DynamicMatrix<Type,SO,AT> >::generate( size_t m, size_t n ) const
 {
-   DynamicMatrix<Type,SO> matrix( m, n );
+   DynamicMatrix<Type,SO,AT> matrix( m, n );
    randomize( matrix );
    return matrix;
 }
@@ -123,12 +125,13 @@ inline const DynamicMatrix<Type,SO>
 // \return The generated random matrix.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename AT >   // Type of the allocator
 template< typename Arg >  // Min/max argument type
-inline const DynamicMatrix<Type,SO>
-   Rand< DynamicMatrix<Type,SO> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+inline const DynamicMatrix<Type,SO,AT>
+   Rand< DynamicMatrix<Type,SO,AT> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
 {
-   DynamicMatrix<Type,SO> matrix( m, n );
+   DynamicMatrix<Type,SO,AT> matrix( m, n );
    randomize( matrix, min, max );
    return matrix;
 }
@@ -144,8 +147,9 @@ inline const DynamicMatrix<Type,SO>
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& matrix ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void Rand< DynamicMatrix<Type,SO,AT> >::randomize( DynamicMatrix<Type,SO,AT>& matrix ) const
 {
    using blaze::randomize;
 
@@ -172,10 +176,11 @@ inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& m
 // \return void
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename AT >   // Type of the allocator
 template< typename Arg >  // Min/max argument type
-inline void Rand< DynamicMatrix<Type,SO> >::randomize( DynamicMatrix<Type,SO>& matrix,
-                                                       const Arg& min, const Arg& max ) const
+inline void Rand< DynamicMatrix<Type,SO,AT> >::randomize( DynamicMatrix<Type,SO,AT>& matrix,
+                                                          const Arg& min, const Arg& max ) const
 {
    using blaze::randomize;
 
@@ -64,27 +64,28 @@ namespace blaze {
 // This specialization of the Rand class creates random instances of DynamicVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-class Rand< DynamicVector<Type,TF> >
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+class Rand< DynamicVector<Type,TF,AT> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const DynamicVector<Type,TF> generate( size_t n ) const;
+   inline const DynamicVector<Type,TF,AT> generate( size_t n ) const;
 
    template< typename Arg >
-   inline const DynamicVector<Type,TF> generate( size_t n, const Arg& min, const Arg& max ) const;
+   inline const DynamicVector<Type,TF,AT> generate( size_t n, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( DynamicVector<Type,TF>& vector ) const;
+   inline void randomize( DynamicVector<Type,TF,AT>& vector ) const;
 
    template< typename Arg >
-   inline void randomize( DynamicVector<Type,TF>& vector, const Arg& min, const Arg& max ) const;
+   inline void randomize( DynamicVector<Type,TF,AT>& vector, const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 };
@@ -100,10 +101,11 @@ class Rand< DynamicVector<Type,TF> >
 // \return The generated random vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline const DynamicVector<Type,TF> Rand< DynamicVector<Type,TF> >::generate( size_t n ) const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline const DynamicVector<Type,TF,AT> Rand< DynamicVector<Type,TF,AT> >::generate( size_t n ) const
 {
-   DynamicVector<Type,TF> vector( n );
+   DynamicVector<Type,TF,AT> vector( n );
    randomize( vector );
    return vector;
 }
@@ -121,12 +123,13 @@ inline const DynamicVector<Type,TF> Rand< DynamicVector<Type,TF> >::generate( si
 // \return The generated random vector.
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename AT >   // Type of the allocator
 template< typename Arg >  // Min/max argument type
-inline const DynamicVector<Type,TF>
-   Rand< DynamicVector<Type,TF> >::generate( size_t n, const Arg& min, const Arg& max ) const
+inline const DynamicVector<Type,TF,AT>
+   Rand< DynamicVector<Type,TF,AT> >::generate( size_t n, const Arg& min, const Arg& max ) const
 {
-   DynamicVector<Type,TF> vector( n );
+   DynamicVector<Type,TF,AT> vector( n );
    randomize( vector, min, max );
    return vector;
 }
@@ -142,8 +145,9 @@ inline const DynamicVector<Type,TF>
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void Rand< DynamicVector<Type,TF> >::randomize( DynamicVector<Type,TF>& vector ) const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void Rand< DynamicVector<Type,TF,AT> >::randomize( DynamicVector<Type,TF,AT>& vector ) const
 {
    using blaze::randomize;
 
@@ -166,10 +170,11 @@ inline void Rand< DynamicVector<Type,TF> >::randomize( DynamicVector<Type,TF>& v
 // \return void
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename AT >   // Type of the allocator
 template< typename Arg >  // Min/max argument type
-inline void Rand< DynamicVector<Type,TF> >::randomize( DynamicVector<Type,TF>& vector,
-                                                       const Arg& min, const Arg& max ) const
+inline void Rand< DynamicVector<Type,TF,AT> >::randomize( DynamicVector<Type,TF,AT>& vector,
+                                                          const Arg& min, const Arg& max ) const
 {
    using blaze::randomize;
 
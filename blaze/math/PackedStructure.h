@@ -0,0 +1,73 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PackedStructure.h
+//  \brief Header file for the packed structure flags
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PACKEDSTRUCTURE_H_
+#define _BLAZE_MATH_PACKEDSTRUCTURE_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED STRUCTURE FLAGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Structure flags for packed matrices.
+//
+// Via these flags it is possible to specify which structure a PackedMatrix represents and thus
+// which part of the matrix is stored. A packed symmetric matrix stores the lower (row-major) or
+// upper (column-major) part of the matrix, packed lower and upper matrices store their lower and
+// upper part, respectively. The following example demonstrates the setup of a \f$ 3 \times 3 \f$
+// packed symmetric matrix that stores 6 instead of 9 elements:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+   using blaze::rowMajor;
+
+   PackedMatrix<double,packedSymmetric,rowMajor> A( 3UL );
+   \endcode
+*/
+enum PackedStructure {
+   packedSymmetric = 0,  //!< Flag for symmetric matrices.
+   packedLower     = 1,  //!< Flag for lower triangular matrices.
+   packedUpper     = 2   //!< Flag for upper triangular matrices.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
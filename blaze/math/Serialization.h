@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/serialization/MappedFile.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/serialization/VectorSerializer.h>
@@ -497,28 +497,28 @@ struct AddTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    typedef typename AddTrait< HybridMatrix<T,M,N,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct AddTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct AddTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
-   typedef typename AddTrait< MT, DynamicMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, DynamicMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct AddTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename A >
+struct AddTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
-   typedef typename AddTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< DynamicMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct AddTrait< StrictlyLowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct AddTrait< StrictlyLowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,A> >
 {
-   typedef typename AddTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, CompressedMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct AddTrait< CompressedMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename A >
+struct AddTrait< CompressedMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
-   typedef typename AddTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< CompressedMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -600,28 +600,28 @@ struct SubTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    typedef typename SubTrait< HybridMatrix<T,M,N,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SubTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct SubTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
-   typedef typename SubTrait< MT, DynamicMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, DynamicMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SubTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename A >
+struct SubTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
-   typedef typename SubTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< DynamicMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct SubTrait< StrictlyLowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct SubTrait< StrictlyLowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,A> >
 {
-   typedef typename SubTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, CompressedMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct SubTrait< CompressedMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename A >
+struct SubTrait< CompressedMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
-   typedef typename SubTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< CompressedMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -717,16 +717,16 @@ struct MultTrait< HybridVector<T,N,true>, StrictlyLowerMatrix<MT,SO,DF> >
    typedef typename MultTrait< HybridVector<T,N,true>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO, bool DF, typename T >
-struct MultTrait< StrictlyLowerMatrix<MT,SO,DF>, DynamicVector<T,false> >
+template< typename MT, bool SO, bool DF, typename T, typename A >
+struct MultTrait< StrictlyLowerMatrix<MT,SO,DF>, DynamicVector<T,false,A> >
 {
-   typedef typename MultTrait< MT, DynamicVector<T,false> >::Type  Type;
+   typedef typename MultTrait< MT, DynamicVector<T,false,A> >::Type  Type;
 };
 
-template< typename T, typename MT, bool SO, bool DF >
-struct MultTrait< DynamicVector<T,true>, StrictlyLowerMatrix<MT,SO,DF> >
+template< typename T, typename MT, bool SO, bool DF, typename A >
+struct MultTrait< DynamicVector<T,true,A>, StrictlyLowerMatrix<MT,SO,DF> >
 {
-   typedef typename MultTrait< DynamicVector<T,true>, MT >::Type  Type;
+   typedef typename MultTrait< DynamicVector<T,true,A>, MT >::Type  Type;
 };
 
 template< typename MT, bool SO, bool DF, typename T >
@@ -765,28 +765,28 @@ struct MultTrait< HybridMatrix<T,M,N,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
    typedef typename MultTrait< HybridMatrix<T,M,N,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct MultTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct MultTrait< StrictlyLowerMatrix<MT,SO1,DF>, DynamicMatrix<T,SO2,A> >
 {
-   typedef typename MultTrait< MT, DynamicMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, DynamicMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct MultTrait< DynamicMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename A >
+struct MultTrait< DynamicMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
-   typedef typename MultTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< DynamicMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, typename T, bool SO2 >
-struct MultTrait< StrictlyLowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, typename T, bool SO2, typename A >
+struct MultTrait< StrictlyLowerMatrix<MT,SO1,DF>, CompressedMatrix<T,SO2,A> >
 {
-   typedef typename MultTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF >
-struct MultTrait< CompressedMatrix<T,SO1>, StrictlyLowerMatrix<MT,SO2,DF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, typename A >
+struct MultTrait< CompressedMatrix<T,SO1,A>, StrictlyLowerMatrix<MT,SO2,DF> >
 {
-   typedef typename MultTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, typename MT2, bool SO2, bool DF2, bool NF >
@@ -390,28 +390,28 @@ struct AddTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    typedef typename AddTrait< HybridMatrix<T,M,N,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
-   typedef typename AddTrait< MT, DynamicMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, DynamicMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct AddTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename A >
+struct AddTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename AddTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< DynamicMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct AddTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2,A> >
 {
-   typedef typename AddTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename AddTrait< MT, CompressedMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct AddTrait< CompressedMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename A >
+struct AddTrait< CompressedMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename AddTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename AddTrait< CompressedMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, bool NF1, typename MT2, bool SO2, bool DF2, bool NF2 >
@@ -457,28 +457,28 @@ struct SubTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    typedef typename SubTrait< HybridMatrix<T,M,N,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
-   typedef typename SubTrait< MT, DynamicMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, DynamicMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct SubTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename A >
+struct SubTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename SubTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< DynamicMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct SubTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2,A> >
 {
-   typedef typename SubTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename SubTrait< MT, CompressedMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct SubTrait< CompressedMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename A >
+struct SubTrait< CompressedMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename SubTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename SubTrait< CompressedMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, bool NF1, typename MT2, bool SO2, bool DF2, bool NF2 >
@@ -538,16 +538,16 @@ struct MultTrait< HybridVector<T,N,true>, SymmetricMatrix<MT,SO,DF,NF> >
    typedef typename MultTrait< HybridVector<T,N,true>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO, bool DF, bool NF, typename T >
-struct MultTrait< SymmetricMatrix<MT,SO,DF,NF>, DynamicVector<T,false> >
+template< typename MT, bool SO, bool DF, bool NF, typename T, typename A >
+struct MultTrait< SymmetricMatrix<MT,SO,DF,NF>, DynamicVector<T,false,A> >
 {
-   typedef typename MultTrait< MT, DynamicVector<T,false> >::Type  Type;
+   typedef typename MultTrait< MT, DynamicVector<T,false,A> >::Type  Type;
 };
 
-template< typename T, typename MT, bool SO, bool DF, bool NF >
-struct MultTrait< DynamicVector<T,true>, SymmetricMatrix<MT,SO,DF,NF> >
+template< typename T, typename MT, bool SO, bool DF, bool NF, typename A >
+struct MultTrait< DynamicVector<T,true,A>, SymmetricMatrix<MT,SO,DF,NF> >
 {
-   typedef typename MultTrait< DynamicVector<T,true>, MT >::Type  Type;
+   typedef typename MultTrait< DynamicVector<T,true,A>, MT >::Type  Type;
 };
 
 template< typename MT, bool SO, bool DF, bool NF, typename T >
@@ -586,28 +586,28 @@ struct MultTrait< HybridMatrix<T,M,N,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
    typedef typename MultTrait< HybridMatrix<T,M,N,SO1>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, DynamicMatrix<T,SO2,A> >
 {
-   typedef typename MultTrait< MT, DynamicMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, DynamicMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct MultTrait< DynamicMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename A >
+struct MultTrait< DynamicMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename MultTrait< DynamicMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< DynamicMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
-template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2 >
-struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2> >
+template< typename MT, bool SO1, bool DF, bool NF, typename T, bool SO2, typename A >
+struct MultTrait< SymmetricMatrix<MT,SO1,DF,NF>, CompressedMatrix<T,SO2,A> >
 {
-   typedef typename MultTrait< MT, CompressedMatrix<T,SO2> >::Type  Type;
+   typedef typename MultTrait< MT, CompressedMatrix<T,SO2,A> >::Type  Type;
 };
 
-template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF >
-struct MultTrait< CompressedMatrix<T,SO1>, SymmetricMatrix<MT,SO2,DF,NF> >
+template< typename T, bool SO1, typename MT, bool SO2, bool DF, bool NF, typename A >
+struct MultTrait< CompressedMatrix<T,SO1,A>, SymmetricMatrix<MT,SO2,DF,NF> >
 {
-   typedef typename MultTrait< CompressedMatrix<T,SO1>, MT >::Type  Type;
+   typedef typename MultTrait< CompressedMatrix<T,SO1,A>, MT >::Type  Type;
 };
 
 template< typename MT1, bool SO1, bool DF1, bool NF1, typename MT2, bool SO2, bool DF2, bool NF2 >
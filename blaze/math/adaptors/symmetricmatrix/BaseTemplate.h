@@ -398,6 +398,18 @@ namespace blaze {
    A(2,4)(1,1) = -5;
    \endcode
 
+// Note that a dense SymmetricMatrix adaptor stores all \f$ N^2 \f$ blocks of the adapted matrix.
+// In order to construct and store only the \f$ N(N+1)/2 \f$ blocks of one half in a single
+// contiguous array, the PackedMatrix class template can be used instead:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::packedSymmetric;
+
+   // Definition of a 5x5 block-structured packed symmetric matrix
+   PackedMatrix< StaticMatrix<int,3UL,3UL>, packedSymmetric > B( 5 );
+   \endcode
+
 // \n \section symmetricmatrix_performance Performance Considerations
 //
 // When the symmetric property of a matrix is known beforehands using the SymmetricMatrix adaptor
@@ -106,6 +106,7 @@ class NonNumericProxy : public Proxy< NonNumericProxy<MT>, typename MT::ElementT
    //**Type definitions****************************************************************************
    /*! \cond BLAZE_INTERNAL */
    typedef typename MT::ElementType  ET;  //!< Element type of the adapted matrix.
+   typedef typename ET::PoolType     PT;  //!< Pool type of the shared values.
    /*! \endcond */
    //**********************************************************************************************
 
@@ -118,7 +119,7 @@ class NonNumericProxy : public Proxy< NonNumericProxy<MT>, typename MT::ElementT
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit inline NonNumericProxy( MT& sm, size_t i, size_t j );
+   explicit inline NonNumericProxy( MT& sm, PT& pool, size_t i, size_t j );
             inline NonNumericProxy( const NonNumericProxy& nnp );
    //@}
    //**********************************************************************************************
@@ -203,11 +204,12 @@ class NonNumericProxy : public Proxy< NonNumericProxy<MT>, typename MT::ElementT
 /*!\brief Initialization constructor for a NonNumericProxy.
 //
 // \param matrix Reference to the adapted matrix.
+// \param pool Reference to the pool of the shared values of the adapted matrix.
 // \param i The row-index of the accessed matrix element.
 // \param j The column-index of the accessed matrix element.
 */
 template< typename MT >  // Type of the adapted matrix
-inline NonNumericProxy<MT>::NonNumericProxy( MT& matrix, size_t i, size_t j )
+inline NonNumericProxy<MT>::NonNumericProxy( MT& matrix, PT& pool, size_t i, size_t j )
    : matrix_( matrix )  // Reference to the adapted matrix
    , i_     ( i )       // Row-index of the accessed matrix element
    , j_     ( j )       // Column-index of the accessed matrix element
@@ -217,7 +219,7 @@ inline NonNumericProxy<MT>::NonNumericProxy( MT& matrix, size_t i, size_t j )
 
    if( pos == matrix_.end(index) )
    {
-      const typename MT::ElementType element( ( RepresentedType() ) );
+      const typename MT::ElementType element( pool );
       matrix_.insert( i_, j_, element );
       if( i_ != j_ )
          matrix_.insert( j_, i_, element );
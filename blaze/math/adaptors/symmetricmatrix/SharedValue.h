@@ -40,12 +40,14 @@
 // Includes
 //*************************************************************************************************
 
-#include <boost/shared_ptr.hpp>
+#include <blaze/math/adaptors/symmetricmatrix/SharedValuePool.h>
 #include <blaze/math/shims/Move.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Null.h>
 
 
 namespace blaze {
@@ -62,31 +64,47 @@ namespace blaze {
 //
 // The SharedValue class template represents a single value of a symmetric matrix that is shared
 // among several positions within the symmetric matrix. Changes to the value of one position
-// are therefore applied to all positions sharing the same value.
+// are therefore applied to all positions sharing the same value. The value is stored in a slot
+// of a SharedValuePool, which is owned by the symmetric matrix. Copies of a shared value refer
+// to the same slot, which is returned to the pool as soon as the last copy is destroyed. Note
+// that the pool has to outlive all shared values referring to it. A default constructed shared
+// value does not refer to any slot and represents the default value of the given type.
 */
 template< typename Type >  // Type of the shared value
 class SharedValue
 {
  public:
    //**Type definitions****************************************************************************
-   typedef Type         ValueType;       //!< Type of the shared value.
-   typedef Type&        Reference;       //!< Reference to the shared value.
-   typedef const Type&  ConstReference;  //!< Reference-to-const to the shared value.
-   typedef Type*        Pointer;         //!< Pointer to the shared value.
-   typedef const Type*  ConstPointer;    //!< Pointer-to-const to the shared value.
+   typedef Type                   ValueType;       //!< Type of the shared value.
+   typedef Type&                  Reference;       //!< Reference to the shared value.
+   typedef const Type&            ConstReference;  //!< Reference-to-const to the shared value.
+   typedef Type*                  Pointer;         //!< Pointer to the shared value.
+   typedef const Type*            ConstPointer;    //!< Pointer-to-const to the shared value.
+   typedef SharedValuePool<Type>  PoolType;        //!< Type of the pool of shared values.
    //**********************************************************************************************
 
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
    explicit inline SharedValue();
-   explicit inline SharedValue( const Type& value );
-   // No explicitly declared copy constructor.
+   explicit inline SharedValue( PoolType& pool );
+   explicit inline SharedValue( PoolType& pool, const Type& value );
+            inline SharedValue( const SharedValue& sv );
    //@}
    //**********************************************************************************************
 
    //**Destructor**********************************************************************************
-   // No explicitly declared destructor.
+   /*!\name Destructor */
+   //@{
+   inline ~SharedValue();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operator*************************************************************************
+   /*!\name Assignment operator */
+   //@{
+   inline SharedValue& operator=( const SharedValue& sv );
+   //@}
    //**********************************************************************************************
 
    //**Access operators****************************************************************************
@@ -105,10 +123,24 @@ class SharedValue
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+   typedef typename PoolType::Slot  Slot;  //!< Type of the slots of the pool.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void release();
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   mutable boost::shared_ptr<Type> value_;  //!< The shared value.
+   PoolType* pool_;  //!< The pool of the shared value.
+   Slot*     slot_;  //!< The slot of the shared value.
+
+   static const Type default_;  //!< The default value of the given type.
    //@}
    //**********************************************************************************************
 
@@ -133,6 +165,18 @@ class SharedValue
 
 
 
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type >  // Type of the shared value
+const Type SharedValue<Type>::default_ = Type();
+
+
+
+
 //=================================================================================================
 //
 //  CONSTRUCTORS
@@ -141,25 +185,122 @@ class SharedValue
 
 //*************************************************************************************************
 /*!\brief Default constructor for a SharedValue.
+//
+// The default constructed shared value does not refer to any slot of a pool.
 */
 template< typename Type >  // Type of the shared value
 inline SharedValue<Type>::SharedValue()
-   : value_()  // The shared value
+   : pool_( NULL )  // The pool of the shared value
+   , slot_( NULL )  // The slot of the shared value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a default SharedValue within the given pool.
+//
+// \param pool The pool of the shared value.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename Type >  // Type of the shared value
+inline SharedValue<Type>::SharedValue( PoolType& pool )
+   : pool_( &pool )           // The pool of the shared value
+   , slot_( pool.acquire() )  // The slot of the shared value
 {}
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Constructor for a SharedValue.
+/*!\brief Constructor for a SharedValue within the given pool.
 //
+// \param pool The pool of the shared value.
 // \param value The value to be shared.
+// \exception std::bad_alloc Allocation failed.
 //
 // This constructor creates a shared value as a copy of the given value.
 */
 template< typename Type >  // Type of the shared value
-inline SharedValue<Type>::SharedValue( const Type& value )
-   : value_( new Type( value ) )  // The shared value
-{}
+inline SharedValue<Type>::SharedValue( PoolType& pool, const Type& value )
+   : pool_( &pool )           // The pool of the shared value
+   , slot_( pool.acquire() )  // The slot of the shared value
+{
+   try {
+      slot_->value_ = value;
+   }
+   catch( ... ) {
+      release();
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SharedValue.
+//
+// \param sv The shared value to be copied.
+//
+// The new shared value refers to the same slot as the given shared value.
+*/
+template< typename Type >  // Type of the shared value
+inline SharedValue<Type>::SharedValue( const SharedValue& sv )
+   : pool_( sv.pool_ )  // The pool of the shared value
+   , slot_( sv.slot_ )  // The slot of the shared value
+{
+   if( slot_ != NULL )
+      ++slot_->count_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SharedValue.
+*/
+template< typename Type >  // Type of the shared value
+inline SharedValue<Type>::~SharedValue()
+{
+   release();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SharedValue.
+//
+// \param sv The shared value to be copied.
+// \return Reference to the assigned shared value.
+//
+// After the assignment, the shared value refers to the same slot as the given shared value.
+*/
+template< typename Type >  // Type of the shared value
+inline SharedValue<Type>& SharedValue<Type>::operator=( const SharedValue& sv )
+{
+   if( sv.slot_ != NULL )
+      ++sv.slot_->count_;
+
+   release();
+
+   pool_ = sv.pool_;
+   slot_ = sv.slot_;
+
+   return *this;
+}
 //*************************************************************************************************
 
 
@@ -179,9 +320,8 @@ inline SharedValue<Type>::SharedValue( const Type& value )
 template< typename Type >  // Type of the shared value
 inline typename SharedValue<Type>::Reference SharedValue<Type>::operator*()
 {
-   if( !value_ )
-      value_.reset( new Type() );
-   return *value_;
+   BLAZE_INTERNAL_ASSERT( slot_ != NULL, "Uninitialized shared value detected" );
+   return slot_->value_;
 }
 //*************************************************************************************************
 
@@ -194,9 +334,7 @@ inline typename SharedValue<Type>::Reference SharedValue<Type>::operator*()
 template< typename Type >  // Type of the shared value
 inline typename SharedValue<Type>::ConstReference SharedValue<Type>::operator*() const
 {
-   if( !value_ )
-      value_.reset( new Type() );
-   return *value_;
+   return ( slot_ != NULL )?( slot_->value_ ):( default_ );
 }
 //*************************************************************************************************
 
@@ -217,7 +355,23 @@ inline typename SharedValue<Type>::ConstReference SharedValue<Type>::operator*()
 template< typename Type >  // Type of the shared value
 inline typename SharedValue<Type>::Pointer SharedValue<Type>::base() const
 {
-   return value_.get();
+   return ( slot_ != NULL )?( &slot_->value_ ):( NULL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing the reference to the slot of the shared value.
+//
+// \return void
+//
+// In case this is the last reference to the slot, the slot is returned to the pool.
+*/
+template< typename Type >  // Type of the shared value
+inline void SharedValue<Type>::release()
+{
+   if( slot_ != NULL && --slot_->count_ == 0UL )
+      pool_->release( slot_ );
 }
 //*************************************************************************************************
 
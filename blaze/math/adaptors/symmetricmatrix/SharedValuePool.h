@@ -0,0 +1,294 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/adaptors/symmetricmatrix/SharedValuePool.h
+//  \brief Header file for the SharedValuePool class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ADAPTORS_SYMMETRICMATRIX_SHAREDVALUEPOOL_H_
+#define _BLAZE_MATH_ADAPTORS_SYMMETRICMATRIX_SHAREDVALUEPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pool for the shared values of a sparse symmetric matrix.
+// \ingroup symmetric_matrix
+//
+// The SharedValuePool class template provides the storage for all values of a sparse symmetric
+// matrix with non-numeric element type. The values are stored in slots within few contiguous
+// chunks of memory instead of a separate dynamic memory allocation per value. Each slot holds a
+// single value and the number of matrix elements that refer to it (i.e. the elements \f$ a_{ij} \f$
+// and \f$ a_{ji} \f$ map to the same slot). Released slots are reset to the default value and
+// recycled for subsequent values. Since chunks are never moved, the address of a value remains
+// valid as long as its slot is in use.
+*/
+template< typename Type >  // Type of the shared values
+class SharedValuePool : private NonCopyable
+{
+ public:
+   //**Slot struct definition**********************************************************************
+   /*!\brief Storage slot for a single shared value.
+   */
+   struct Slot
+   {
+      Type   value_;  //!< The shared value.
+      size_t count_;  //!< The number of references to the shared value.
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SharedValuePool();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SharedValuePool();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size    () const;
+   inline size_t capacity() const;
+   inline Slot*  acquire ();
+   inline void   release ( Slot* slot );
+   inline void   reserve ( size_t n );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constants***********************************************************************************
+   static const size_t minChunk = 16UL;  //!< The minimum number of slots of a chunk.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Slot*> chunks_;    //!< The chunks of the pool.
+   std::vector<Slot*> free_;      //!< The currently unused slots.
+   size_t             capacity_;  //!< The total number of slots.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SharedValuePool.
+*/
+template< typename Type >  // Type of the shared values
+inline SharedValuePool<Type>::SharedValuePool()
+   : chunks_  ()       // The chunks of the pool
+   , free_    ()       // The currently unused slots
+   , capacity_( 0UL )  // The total number of slots
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SharedValuePool.
+//
+// All values of the pool have to be released before the pool is destroyed.
+*/
+template< typename Type >  // Type of the shared values
+inline SharedValuePool<Type>::~SharedValuePool()
+{
+   BLAZE_INTERNAL_ASSERT( free_.size() == capacity_, "Unreleased shared value detected" );
+
+   for( size_t i=0UL; i<chunks_.size(); ++i ) {
+      delete [] chunks_[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of values currently in use.
+//
+// \return The number of values currently in use.
+*/
+template< typename Type >  // Type of the shared values
+inline size_t SharedValuePool<Type>::size() const
+{
+   return capacity_ - free_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of slots of the pool.
+//
+// \return The total number of slots.
+*/
+template< typename Type >  // Type of the shared values
+inline size_t SharedValuePool<Type>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a slot for a new shared value.
+//
+// \return Pointer to the slot with a single reference and a default value.
+// \exception std::bad_alloc Allocation failed.
+//
+// In case no unused slot is available, the capacity of the pool is doubled by a new chunk.
+*/
+template< typename Type >  // Type of the shared values
+inline typename SharedValuePool<Type>::Slot* SharedValuePool<Type>::acquire()
+{
+   if( free_.empty() )
+      reserve( std::max( capacity_, size_t( minChunk ) ) );
+
+   Slot* const slot( free_.back() );
+   free_.pop_back();
+   slot->count_ = 1UL;
+
+   return slot;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing a slot that is no longer referenced.
+//
+// \param slot The slot to be released.
+// \return void
+//
+// The value of the released slot is reset to the default value.
+*/
+template< typename Type >  // Type of the shared values
+inline void SharedValuePool<Type>::release( Slot* slot )
+{
+   BLAZE_INTERNAL_ASSERT( slot->count_ == 0UL, "Referenced shared value detected" );
+
+   slot->value_ = Type();
+   free_.push_back( slot );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum number of unused slots of the pool.
+//
+// \param n The minimum number of unused slots.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function guarantees that at least \a n values can be acquired without further memory
+// allocation. The missing slots are allocated in a single contiguous chunk.
+*/
+template< typename Type >  // Type of the shared values
+inline void SharedValuePool<Type>::reserve( size_t n )
+{
+   if( n <= free_.size() ) return;
+
+   const size_t slots( n - free_.size() );
+
+   free_.reserve( capacity_ + slots );
+   chunks_.reserve( chunks_.size() + 1UL );
+
+   Slot* const chunk( new Slot[slots] );
+   chunks_.push_back( chunk );
+
+   for( size_t i=slots; i>0UL; --i ) {
+      chunk[i-1UL].count_ = 0UL;
+      free_.push_back( chunk+i-1UL );
+   }
+
+   capacity_ += slots;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
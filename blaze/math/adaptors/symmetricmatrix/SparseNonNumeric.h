@@ -80,6 +80,7 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
 #include <blaze/util/Unused.h>
 
 
@@ -112,6 +113,9 @@ class SymmetricMatrix<MT,SO,false,false>
 
    //! Rebound matrix type for shared values.
    typedef typename MT::template Rebind< SharedValue<ET> >::Other  MatrixType;
+
+   //! Pool type for the shared values.
+   typedef typename SharedValue<ET>::PoolType  PoolType;
    //**********************************************************************************************
 
  public:
@@ -593,7 +597,8 @@ class SymmetricMatrix<MT,SO,false,false>
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   MatrixType matrix_;  //!< The adapted sparse matrix.
+   UniquePtr<PoolType> pool_;    //!< The pool of the shared values.
+   MatrixType          matrix_;  //!< The adapted sparse matrix.
    //@}
    //**********************************************************************************************
 
@@ -637,7 +642,8 @@ class SymmetricMatrix<MT,SO,false,false>
 template< typename MT  // Type of the adapted sparse matrix
         , bool SO >    // Storage order of the adapted sparse matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix()
-   : matrix_()  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_()                  // The adapted sparse matrix
 {
    BLAZE_INTERNAL_ASSERT( isSquare( matrix_ ), "Non-square symmetric matrix detected" );
 }
@@ -656,7 +662,8 @@ inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix()
 template< typename MT  // Type of the adapted sparse matrix
         , bool SO >    // Storage order of the adapted sparse matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( size_t n )
-   : matrix_( n, n )  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_( n, n )            // The adapted sparse matrix
 {
    BLAZE_CONSTRAINT_MUST_BE_RESIZABLE( MT );
 
@@ -678,7 +685,8 @@ inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( size_t n )
 template< typename MT  // Type of the adapted sparse matrix
         , bool SO >    // Storage order of the adapted sparse matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( size_t n, size_t nonzeros )
-   : matrix_( n, n, nonzeros )  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_( n, n, nonzeros )  // The adapted sparse matrix
 {
    BLAZE_CONSTRAINT_MUST_BE_RESIZABLE( MT );
 
@@ -702,7 +710,8 @@ inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( size_t n, size_t non
 template< typename MT  // Type of the adapted sparse matrix
         , bool SO >    // Storage order of the adapted sparse matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( size_t n, const std::vector<size_t>& nonzeros )
-   : matrix_( n, n, nonzeros )  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_( n, n, nonzeros )  // The adapted sparse matrix
 {
    BLAZE_CONSTRAINT_MUST_BE_RESIZABLE( MT );
 
@@ -721,7 +730,8 @@ inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( size_t n, const std:
 template< typename MT  // Type of the adapted sparse matrix
         , bool SO >    // Storage order of the adapted sparse matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( const SymmetricMatrix& m )
-   : matrix_()  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_()                  // The adapted sparse matrix
 {
    using blaze::resize;
 
@@ -748,7 +758,8 @@ template< typename MT     // Type of the adapted sparse matrix
         , bool SO >       // Storage order of the adapted sparse matrix
 template< typename MT2 >  // Type of the foreign matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( const Matrix<MT2,SO>& m )
-   : matrix_()  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_()                  // The adapted sparse matrix
 {
    using blaze::resize;
 
@@ -783,7 +794,8 @@ template< typename MT     // Type of the adapted sparse matrix
         , bool SO >       // Storage order of the adapted sparse matrix
 template< typename MT2 >  // Type of the foreign matrix
 inline SymmetricMatrix<MT,SO,false,false>::SymmetricMatrix( const Matrix<MT2,!SO>& m )
-   : matrix_()  // The adapted sparse matrix
+   : pool_  ( new PoolType() )  // The pool of the shared values
+   , matrix_()                  // The adapted sparse matrix
 {
    using blaze::resize;
 
@@ -832,7 +844,7 @@ inline typename SymmetricMatrix<MT,SO,false,false>::Reference
    BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
 
-   return Reference( matrix_, i, j );
+   return Reference( matrix_, *pool_, i, j );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -1626,7 +1638,7 @@ template< typename MT  // Type of the adapted sparse matrix
 inline typename SymmetricMatrix<MT,SO,false,false>::Iterator
    SymmetricMatrix<MT,SO,false,false>::set( size_t i, size_t j, const ElementType& value )
 {
-   SharedValue<ET> shared( value );
+   SharedValue<ET> shared( *pool_, value );
 
    if( i != j )
       matrix_.set( j, i, shared );
@@ -1657,7 +1669,7 @@ template< typename MT  // Type of the adapted sparse matrix
 inline typename SymmetricMatrix<MT,SO,false,false>::Iterator
    SymmetricMatrix<MT,SO,false,false>::insert( size_t i, size_t j, const ElementType& value )
 {
-   SharedValue<ET> shared( value );
+   SharedValue<ET> shared( *pool_, value );
 
    if( i != j )
       matrix_.insert( j, i, shared );
@@ -1966,6 +1978,7 @@ inline void SymmetricMatrix<MT,SO,false,false>::swap( SymmetricMatrix& m ) /* th
 {
    using std::swap;
 
+   pool_.swap( m.pool_ );
    swap( matrix_, m.matrix_ );
 }
 /*! \endcond */
@@ -2209,7 +2222,7 @@ template< typename MT  // Type of the adapted sparse matrix
         , bool SO >    // Storage order of the adapted sparse matrix
 inline void SymmetricMatrix<MT,SO,false,false>::append( size_t i, size_t j, const ElementType& value, bool check )
 {
-   SharedValue<ET> shared( value );
+   SharedValue<ET> shared( *pool_, value );
 
    matrix_.append( i, j, shared, check );
    if( i != j && ( !check || !isDefault( value ) ) )
@@ -2351,10 +2364,12 @@ void SymmetricMatrix<MT,SO,false,false>::assign( DenseMatrix<MT2,SO>& rhs )
       matrix_.reserve( i, nonzeros[i] );
    }
 
+   pool_->reserve( ( sum + rows() ) / 2UL );
+
    for( size_t i=0UL; i<rows(); ++i ) {
       for( size_t j=i; j<columns(); ++j ) {
          if( !isDefault( (~rhs)(i,j) ) ) {
-            SharedValue<ET> shared;
+            SharedValue<ET> shared( *pool_ );
             move( *shared, (~rhs)(i,j) );
             matrix_.append( i, j, shared, false );
             if( i != j )
@@ -2402,10 +2417,12 @@ void SymmetricMatrix<MT,SO,false,false>::assign( const DenseMatrix<MT2,SO>& rhs
       matrix_.reserve( i, nonzeros[i] );
    }
 
+   pool_->reserve( ( sum + rows() ) / 2UL );
+
    for( size_t i=0UL; i<rows(); ++i ) {
       for( size_t j=i; j<columns(); ++j ) {
          if( !isDefault( (~rhs)(i,j) ) ) {
-            const SharedValue<ET> shared( (~rhs)(i,j) );
+            const SharedValue<ET> shared( *pool_, (~rhs)(i,j) );
             matrix_.append( i, j, shared, false );
             if( i != j )
                matrix_.append( j, i, shared, false );
@@ -2452,10 +2469,12 @@ void SymmetricMatrix<MT,SO,false,false>::assign( SparseMatrix<MT2,SO>& rhs )
       matrix_.reserve( i, nonzeros[i] );
    }
 
+   pool_->reserve( ( sum + rows() ) / 2UL );
+
    for( size_t i=0UL; i<rows(); ++i ) {
       for( typename MT2::Iterator it=(~rhs).lowerBound(i,i); it!=(~rhs).end(i); ++it ) {
          if( !isDefault( it->value() ) ) {
-            SharedValue<ET> shared;
+            SharedValue<ET> shared( *pool_ );
             move( *shared, it->value() );
             matrix_.append( i, it->index(), shared, false );
             if( i != it->index() )
@@ -2503,10 +2522,12 @@ void SymmetricMatrix<MT,SO,false,false>::assign( const SparseMatrix<MT2,SO>& rhs
       matrix_.reserve( i, nonzeros[i] );
    }
 
+   pool_->reserve( ( sum + rows() ) / 2UL );
+
    for( size_t i=0UL; i<rows(); ++i ) {
       for( typename MT2::ConstIterator it=(~rhs).lowerBound(i,i); it!=(~rhs).end(i); ++it ) {
          if( !isDefault( it->value() ) ) {
-            const SharedValue<ET> shared( it->value() );
+            const SharedValue<ET> shared( *pool_, it->value() );
             matrix_.append( i, it->index(), shared, false );
             if( i != it->index() )
                matrix_.append( it->index(), i, shared, false );
@@ -0,0 +1,741 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CustomIterator.h
+//  \brief Header file for the CustomIterator class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//
+//  * The names of its contributors may not be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CUSTOMITERATOR_H_
+#define _BLAZE_MATH_DENSE_CUSTOMITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of an iterator for custom vectors and matrices.
+// \ingroup math
+//
+// The CustomIterator represents a random-access iterator over the elements of a CustomVector
+// or over a specific row/column of a CustomMatrix. In contrast to the DenseIterator it is aware
+// of the alignment (\a AF) and padding (\a PF) guarantees of the underlying memory: Intrinsic
+// loads are only performed aligned in case the memory is aligned and in case the memory is not
+// padded the final, partial intrinsic element is assembled from the remaining elements instead
+// of being read beyond the end of the vector or row/column.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+class CustomIterator
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>              IT;           //!< Intrinsic trait for the element type.
+   typedef typename RemoveConst<Type>::Type  ElementType;  //!< Non-constant type of the elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef Type                             ValueType;         //!< Type of the underlying elements.
+   typedef Type*                            PointerType;       //!< Pointer return type.
+   typedef Type&                            ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+
+   //! Intrinsic type of the elements.
+   typedef typename IntrinsicTrait<Type>::Type  IntrinsicType;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CustomIterator();
+   explicit inline CustomIterator( Type* ptr, Type* end );
+
+   template< typename Other >
+   inline CustomIterator( const CustomIterator<Other,AF,PF>& it );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline CustomIterator& operator+=( ptrdiff_t inc );
+   inline CustomIterator& operator-=( ptrdiff_t inc );
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   inline CustomIterator&      operator++();
+   inline const CustomIterator operator++( int );
+   inline CustomIterator&      operator--();
+   inline const CustomIterator operator--( int );
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline ReferenceType operator[]( size_t index ) const;
+   inline ReferenceType operator* () const;
+   inline PointerType   operator->() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline PointerType base() const;
+   inline PointerType end () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline const IntrinsicType load () const;
+   inline const IntrinsicType loadu() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline const IntrinsicType loadRest() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PointerType ptr_;  //!< Pointer to the current element.
+   PointerType end_;  //!< Pointer one past the last element of the vector/row/column.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the CustomIterator class.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>::CustomIterator()
+   : ptr_( NULL )  // Pointer to the current element
+   , end_( NULL )  // Pointer one past the last element
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomIterator class.
+//
+// \param ptr Pointer to the initial element.
+// \param end Pointer one past the last element of the vector/row/column.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>::CustomIterator( Type* ptr, Type* end )
+   : ptr_( ptr )  // Pointer to the current element
+   , end_( end )  // Pointer one past the last element
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different CustomIterator instances.
+//
+// \param it The foreign CustomIterator instance to be copied.
+*/
+template< typename Type    // Type of the elements
+        , bool AF          // Alignment flag
+        , bool PF >        // Padding flag
+template< typename Other >  // Type of the foreign elements
+inline CustomIterator<Type,AF,PF>::CustomIterator( const CustomIterator<Other,AF,PF>& it )
+   : ptr_( it.base() )  // Pointer to the current element
+   , end_( it.end()  )  // Pointer one past the last element
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return Reference to the incremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator+=( ptrdiff_t inc )
+{
+   ptr_ += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return Reference to the decremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator-=( ptrdiff_t dec )
+{
+   ptr_ -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator++()
+{
+   ++ptr_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> CustomIterator<Type,AF,PF>::operator++( int )
+{
+   return CustomIterator( ptr_++, end_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator--()
+{
+   --ptr_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> CustomIterator<Type,AF,PF>::operator--( int )
+{
+   return CustomIterator( ptr_--, end_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the underlying elements.
+//
+// \param index Access index.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::ReferenceType
+   CustomIterator<Type,AF,PF>::operator[]( size_t index ) const
+{
+   return ptr_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Reference to the current element.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::ReferenceType
+   CustomIterator<Type,AF,PF>::operator*() const
+{
+   return *ptr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Pointer to the element at the current iterator position.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::PointerType
+   CustomIterator<Type,AF,PF>::operator->() const
+{
+   return ptr_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level access to the underlying member of the iterator.
+//
+// \return Pointer to the current memory location.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::PointerType CustomIterator<Type,AF,PF>::base() const
+{
+   return ptr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the end of the underlying vector/row/column.
+//
+// \return Pointer one past the last element of the vector/row/column.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::PointerType CustomIterator<Type,AF,PF>::end() const
+{
+   return end_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Aligned load of the intrinsic element at the current iterator position.
+//
+// \return The loaded intrinsic element.
+//
+// This function performs an aligned load of the intrinsic element of the current element. In
+// case the underlying memory is not guaranteed to be aligned, an unaligned load is performed
+// instead. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const typename CustomIterator<Type,AF,PF>::IntrinsicType CustomIterator<Type,AF,PF>::load() const
+{
+   if( !PF && end_ - ptr_ < ptrdiff_t( IT::size ) ) {
+      return loadRest();
+   }
+   else if( AF ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( ptr_ ), "Invalid alignment detected" );
+      return blaze::load( ptr_ );
+   }
+   else {
+      return blaze::loadu( ptr_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of the intrinsic element at the current iterator position.
+//
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of the intrinsic element of the current element.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const typename CustomIterator<Type,AF,PF>::IntrinsicType CustomIterator<Type,AF,PF>::loadu() const
+{
+   if( !PF && end_ - ptr_ < ptrdiff_t( IT::size ) ) {
+      return loadRest();
+   }
+   else {
+      return blaze::loadu( ptr_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of the final, partial intrinsic element of unpadded memory.
+//
+// \return The loaded intrinsic element.
+//
+// This function assembles the intrinsic element at the current iterator position from the
+// remaining elements up to the end of the vector/row/column. The missing values are filled
+// with default values.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const typename CustomIterator<Type,AF,PF>::IntrinsicType
+   CustomIterator<Type,AF,PF>::loadRest() const
+{
+   const size_t rest( end_ - ptr_ );
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t i=0UL; i<rest; ++i )
+      array[i] = ptr_[i];
+   for( size_t i=rest; i<IT::size; ++i )
+      array[i] = ElementType();
+   return blaze::load( array.data() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomIterator operators */
+//@{
+template< typename T1, bool AF, bool PF, typename T2 >
+inline bool operator==( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, bool AF, bool PF, typename T2 >
+inline bool operator!=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, bool AF, bool PF, typename T2 >
+inline bool operator<( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, bool AF, bool PF, typename T2 >
+inline bool operator>( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, bool AF, bool PF, typename T2 >
+inline bool operator<=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, bool AF, bool PF, typename T2 >
+inline bool operator>=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename Type, bool AF, bool PF >
+inline const CustomIterator<Type,AF,PF> operator+( const CustomIterator<Type,AF,PF>& it, ptrdiff_t inc );
+
+template< typename Type, bool AF, bool PF >
+inline const CustomIterator<Type,AF,PF> operator+( ptrdiff_t inc, const CustomIterator<Type,AF,PF>& it );
+
+template< typename Type, bool AF, bool PF >
+inline const CustomIterator<Type,AF,PF> operator-( const CustomIterator<Type,AF,PF>& it, ptrdiff_t inc );
+
+template< typename Type, bool AF, bool PF >
+inline ptrdiff_t operator-( const CustomIterator<Type,AF,PF>& lhs, const CustomIterator<Type,AF,PF>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator==( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() == rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator!=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() != rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator<( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() < rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator>( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() > rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is less or equal, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator<=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() <= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename T1    // Element type of the left-hand side iterator
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , typename T2 >  // Element type of the right-hand side iterator
+inline bool operator>=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() >= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a CustomIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> operator+( const CustomIterator<Type,AF,PF>& it, ptrdiff_t inc ) {
+   return CustomIterator<Type,AF,PF>( it.base() + inc, it.end() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a CustomIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> operator+( ptrdiff_t inc, const CustomIterator<Type,AF,PF>& it )
+{
+   return CustomIterator<Type,AF,PF>( it.base() + inc, it.end() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a CustomIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> operator-( const CustomIterator<Type,AF,PF>& it, ptrdiff_t dec )
+{
+   return CustomIterator<Type,AF,PF>( it.base() - dec, it.end() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline ptrdiff_t operator-( const CustomIterator<Type,AF,PF>& lhs, const CustomIterator<Type,AF,PF>& rhs )
+{
+   return lhs.base() - rhs.base();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2257 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CustomVector.h
+//  \brief Header file for the implementation of a customizable vector
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CUSTOMVECTOR_H_
+#define _BLAZE_MATH_DENSE_CUSTOMVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/CustomIterator.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/views/AlignmentFlag.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Streaming.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup custom_vector CustomVector
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a customizable vector.
+// \ingroup custom_vector
+//
+// The CustomVector class template provides the functionality to represent an external array of
+// elements of arbitrary type and a fixed size as a native Blaze dense vector data structure.
+// Thus in contrast to all other dense vector types a custom vector does not perform any kind
+// of memory allocation by itself, but it is provided with an existing array of element during
+// construction. A custom vector can therefore be considered an alias to the existing array.
+//
+// The type of the elements, the properties of the given array of elements and the transpose
+// flag of the vector can be specified via the following four template parameters:
+
+   \code
+   template< typename Type, bool AF, bool PF, bool TF >
+   class CustomVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. CustomVector can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - AF  : specifies whether the represented, external arrays are properly aligned with
+//          respect to the available instruction set (SSE, AVX, ...) or not
+//          (\a blaze::aligned or \a blaze::unaligned).
+//  - PF  : specifies whether the represented, external arrays are properly padded with
+//          respect to the available instruction set (SSE, AVX, ...) or not
+//          (\a blaze::padded or \a blaze::unpadded).
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//
+// The following examples give an impression of several possible types of custom vectors:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+
+   // Definition of a custom column vector for unaligned, unpadded integer arrays
+   typedef CustomVector<int,unaligned,unpadded,columnVector>  UnalignedUnpadded;
+
+   // Definition of a custom column vector for unaligned but padded 'float' arrays
+   typedef CustomVector<float,unaligned,padded,columnVector>  UnalignedPadded;
+
+   // Definition of a custom row vector for aligned, unpadded 'double' arrays
+   typedef CustomVector<double,aligned,unpadded,rowVector>  AlignedUnpadded;
+
+   // Definition of a custom row vector for aligned, padded 'complex<double>' arrays
+   typedef CustomVector<complex<double>,aligned,padded,columnVector>  AlignedPadded;
+   \endcode
+
+// \n \section customvector_special_properties Special Properties of Custom Vectors
+//
+// In comparison with the remaining Blaze dense vector types CustomVector has several special
+// characteristics. All of these result from the fact that a custom vector is not performing
+// any kind of memory allocation, but instead is given an existing array of elements. The
+// following sections discuss all of these characteristics:
+//
+//  -# <b>\ref customvector_memory_management</b>
+//  -# <b>\ref customvector_copy_operations</b>
+//  -# <b>\ref customvector_alignment</b>
+//  -# <b>\ref customvector_padding</b>
+//
+// \n \subsection customvector_memory_management Memory Management
+//
+// The CustomVector class template acts as an adaptor for an existing array of elements. As such
+// it provides everything that is required to use the array just like a native Blaze dense vector
+// data structure. However, this flexibility comes with the price that the user of a custom vector
+// is responsible for the resource management. The custom vector neither allocates nor releases
+// the given array, i.e. the array has to outlive all custom vectors that refer to it:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   std::vector<int> vec( 5UL );
+   CustomVector<int,unaligned,unpadded> a( &vec[0], 5UL );  // Adapts the memory of 'vec'
+   \endcode
+
+// \n \subsection customvector_copy_operations Copy Operations
+//
+// As with all dense vectors it is possible to copy construct a custom vector. However, a custom
+// vector is an alias to its array of elements and therefore the copy construction results in
+// a shallow copy: The new custom vector refers to the same array as the original one. In
+// contrast, all assignment operations are deep copies that write into the adapted array. Since
+// a custom vector cannot be resized, the size of the right-hand side operand has to match:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::DynamicVector;
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   typedef CustomVector<int,unaligned,unpadded>  CustomType;
+
+   int array1[5] = { 1, 2, 3, 4, 5 };
+   int array2[5] = { 0, 0, 0, 0, 0 };
+
+   CustomType a( array1, 5UL );   // Adapts 'array1'
+   CustomType b( a );             // Shallow copy: Also adapts 'array1'
+   CustomType c( array2, 5UL );   // Adapts 'array2'
+
+   c = a;      // Deep copy: 'array2' now contains the values of 'array1'
+   b[2] = 0;   // Also changes a[2] and array1[2]
+
+   DynamicVector<int> d( 3UL );
+   c = d;      // Size mismatch: Throws a std::invalid_argument exception
+   \endcode
+
+// \n \subsection customvector_alignment Alignment
+//
+// In case the custom vector is specified as \a aligned the passed array must be guaranteed to
+// be aligned according to the requirements of the used instruction set (SSE, AVX, ...). For
+// instance, if AVX is active an array of integers must be 32-bit aligned. In case the given
+// array is not properly aligned, a \a std::invalid_argument exception is thrown:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::aligned;
+   using blaze::unpadded;
+
+   int* array = blaze::allocate<int>( 5UL );  // Needs to be 32-bit aligned
+   CustomVector<int,aligned,unpadded> a( array, 5UL );
+   // ...
+   blaze::deallocate( array );
+   \endcode
+
+// In case the vector is specified as \a unaligned, the array may start at an arbitrary address
+// and all intrinsic loads and stores are performed unaligned.
+//
+// \n \subsection customvector_padding Padding
+//
+// Adding padding elements to the end of an array can have a significant impact on performance,
+// since the vectorized kernels can then process the final elements by a full intrinsic operation
+// instead of having to assemble them element by element:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::aligned;
+   using blaze::padded;
+
+   // Creating padded custom vectors of size 3 and a capacity of 4
+   double* array = blaze::allocate<double>( 4UL );
+   CustomVector<double,aligned,padded> a( array, 3UL, 4UL );
+   \endcode
+
+// In case the vector is specified as \a padded, the given array must provide enough elements to
+// hold a multiple of the number of values per intrinsic element (in the example 4 for AVX). In
+// case the capacity is insufficient, a \a std::invalid_argument exception is thrown. Note that
+// the custom vector initializes all padding elements to zero since the padding elements take
+// part in the vectorized computations. Padding elements that already are zero are not written,
+// which makes it possible to adapt read-only memory (as for instance a read-only memory mapped
+// file). In case the vector is specified as \a unpadded, the final partial intrinsic element is
+// assembled from the remaining elements and no element beyond the specified size is ever
+// accessed.
+//
+// \n \section customvector_arithmetic_operations Arithmetic Operations
+//
+// A CustomVector can be used in all arithmetic operations that any other dense vector can be
+// used in and takes part in all vectorized and parallel (SMP) kernels. The result of an
+// arithmetic operation with a custom vector is a DynamicVector:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::DynamicVector;
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   typedef CustomVector<double,unaligned,unpadded>  CustomType;
+
+   double array1[3] = { 1.0, 2.0, 3.0 };
+   double array2[3] = { 4.0, 5.0, 6.0 };
+
+   CustomType a( array1, 3UL );
+   CustomType b( array2, 3UL );
+
+   DynamicVector<double> c( a + b );  // Addition of two custom vectors
+   b += 2.0 * a;                      // In-place update of 'array2'
+   \endcode
+*/
+template< typename Type                     // Data type of the vector
+        , bool AF                           // Alignment flag
+        , bool PF                           // Padding flag
+        , bool TF = defaultTransposeFlag >  // Transpose flag
+class CustomVector : public DenseVector< CustomVector<Type,AF,PF,TF>, TF >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the vector element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CustomVector<Type,AF,PF,TF>     This;            //!< Type of this CustomVector instance.
+   typedef DynamicVector<Type,TF>          ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicVector<Type,!TF>         TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                            ElementType;     //!< Type of the vector elements.
+   typedef typename IT::Type               IntrinsicType;   //!< Intrinsic type of the vector elements.
+   typedef const Type&                     ReturnType;      //!< Return type for expression template evaluations
+   typedef const CustomVector&             CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                           Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&                     ConstReference;  //!< Reference to a constant vector value.
+   typedef Type*                           Pointer;         //!< Pointer to a non-constant vector value.
+   typedef const Type*                     ConstPointer;    //!< Pointer to a constant vector value.
+   typedef CustomIterator<Type,AF,PF>        Iterator;        //!< Iterator over non-constant elements.
+   typedef CustomIterator<const Type,AF,PF>  ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CustomVector with different data/element type.
+   */
+   template< typename ET >  // Data type of the other vector
+   struct Rebind {
+      typedef CustomVector<ET,AF,PF,TF>  Other;  //!< The type of the other CustomVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the vector is involved
+       in can be optimized via intrinsics. In case the element type of the vector is an intrinsic
+       data type, the \a vectorizable compilation flag is set to \a true, otherwise it is set to
+       \a false. */
+   enum { vectorizable = IsVectorizable<Type>::value };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CustomVector();
+   explicit inline CustomVector( Type* ptr, size_t n );
+   explicit inline CustomVector( Type* ptr, size_t n, size_t nn );
+
+   inline CustomVector( const CustomVector& v );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index );
+   inline ConstReference operator[]( size_t index ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   inline Iterator       begin ();
+   inline ConstIterator  begin () const;
+   inline ConstIterator  cbegin() const;
+   inline Iterator       end   ();
+   inline ConstIterator  end   () const;
+   inline ConstIterator  cend  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename Other, size_t N >
+   inline CustomVector& operator=( const Other (&array)[N] );
+
+                           inline CustomVector& operator= ( const Type& rhs );
+                           inline CustomVector& operator= ( const CustomVector& rhs );
+   template< typename VT > inline CustomVector& operator= ( const Vector<VT,TF>& rhs );
+   template< typename VT > inline CustomVector& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline CustomVector& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline CustomVector& operator*=( const Vector<VT,TF>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CustomVector >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CustomVector >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        size() const;
+                              inline size_t        capacity() const;
+                              inline size_t        nonZeros() const;
+                              inline void          reset();
+                              inline void          reset( Type* ptr, size_t n );
+                              inline void          reset( Type* ptr, size_t n, size_t nn );
+                              inline void          clear();
+   template< typename Other > inline CustomVector& scale( const Other& scalar );
+                              inline void          swap( CustomVector& v ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct VectorizedAssign {
+      enum { value = vectorizable && VT::vectorizable &&
+                     IsSame<Type,typename VT::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct VectorizedAddAssign {
+      enum { value = vectorizable && VT::vectorizable &&
+                     IsSame<Type,typename VT::ElementType>::value &&
+                     IntrinsicTrait<Type>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct VectorizedSubAssign {
+      enum { value = vectorizable && VT::vectorizable &&
+                     IsSame<Type,typename VT::ElementType>::value &&
+                     IntrinsicTrait<Type>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct VectorizedMultAssign {
+      enum { value = vectorizable && VT::vectorizable &&
+                     IsSame<Type,typename VT::ElementType>::value &&
+                     IntrinsicTrait<Type>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   BLAZE_ALWAYS_INLINE IntrinsicType load ( size_t index ) const;
+   BLAZE_ALWAYS_INLINE IntrinsicType loadu( size_t index ) const;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const IntrinsicType& value );
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const IntrinsicType& value );
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const IntrinsicType& value );
+
+   template< typename VT >
+   inline typename DisableIf< VectorizedAssign<VT> >::Type
+      assign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename EnableIf< VectorizedAssign<VT> >::Type
+      assign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT > inline void assign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename DisableIf< VectorizedAddAssign<VT> >::Type
+      addAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename EnableIf< VectorizedAddAssign<VT> >::Type
+      addAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename DisableIf< VectorizedSubAssign<VT> >::Type
+      subAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename EnableIf< VectorizedSubAssign<VT> >::Type
+      subAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename DisableIf< VectorizedMultAssign<VT> >::Type
+      multAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT >
+   inline typename EnableIf< VectorizedMultAssign<VT> >::Type
+      multAssign( const DenseVector<VT,TF>& rhs );
+
+   template< typename VT > inline void multAssign( const SparseVector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void setup( Type* ptr, size_t n, size_t nn );
+
+   inline IntrinsicType loadRest ( size_t index ) const;
+   inline void          storeRest( size_t index, const IntrinsicType& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;      //!< The size/dimension of the custom vector.
+   size_t capacity_;  //!< The number of accessible elements of the external array.
+   Type* v_;          //!< The custom array of elements.
+                      /*!< Access to the array of elements is gained via the subscript operator.
+                           The order of the elements is
+                           \f[\left(\begin{array}{*{5}{c}}
+                           0 & 1 & 2 & \cdots & N-1 \\
+                           \end{array}\right)\f] */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CustomVector.
+//
+// The default constructor creates an empty custom vector that does not refer to any array.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,AF,PF,TF>::CustomVector()
+   : size_    ( 0UL )   // The size/dimension of the vector
+   , capacity_( 0UL )   // The number of accessible elements of the array
+   , v_       ( NULL )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a custom vector of size \a n.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the custom vector.
+// \exception std::invalid_argument Invalid setup of custom vector.
+//
+// This constructor creates a custom vector of size \a n for the given array of elements. The
+// capacity of the array is assumed to be \a n. The constructor fails if ...
+//
+//  - ... the passed pointer is NULL but \a n is not zero;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer is not properly
+//    aligned according to the available instruction set (SSE, AVX, ...);
+//  - ... the padding flag \a PF is set to \a padded, but \a n is not a multiple of the number
+//    of values per intrinsic element.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,AF,PF,TF>::CustomVector( Type* ptr, size_t n )
+   : size_    ( 0UL )   // The size/dimension of the vector
+   , capacity_( 0UL )   // The number of accessible elements of the array
+   , v_       ( NULL )  // The custom array of elements
+{
+   setup( ptr, n, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a custom vector of size \a n and capacity \a nn.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the custom vector.
+// \param nn The total number of elements in the array including padding elements.
+// \exception std::invalid_argument Invalid setup of custom vector.
+//
+// This constructor creates a custom vector of size \a n for the given array of \a nn elements.
+// The constructor fails if ...
+//
+//  - ... the passed pointer is NULL but \a n is not zero;
+//  - ... \a nn is smaller than \a n;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer is not properly
+//    aligned according to the available instruction set (SSE, AVX, ...);
+//  - ... the padding flag \a PF is set to \a padded, but the capacity \a nn is insufficient to
+//    hold a multiple of the number of values per intrinsic element.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown. In case the vector is
+// padded, all padding elements are initialized to zero.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,AF,PF,TF>::CustomVector( Type* ptr, size_t n, size_t nn )
+   : size_    ( 0UL )   // The size/dimension of the vector
+   , capacity_( 0UL )   // The number of accessible elements of the array
+   , v_       ( NULL )  // The custom array of elements
+{
+   setup( ptr, n, nn );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CustomVector.
+//
+// \param v Vector to be copied.
+//
+// The copy constructor initializes the custom vector as an exact copy of the given custom
+// vector. Note that since a custom vector is an alias to its array of elements, the copy
+// refers to the same array as the given vector (shallow copy).
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,AF,PF,TF>::CustomVector( const CustomVector& v )
+   : size_    ( v.size_ )      // The size/dimension of the vector
+   , capacity_( v.capacity_ )  // The number of accessible elements of the array
+   , v_       ( v.v_ )         // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::Reference
+   CustomVector<Type,AF,PF,TF>::operator[]( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return v_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::ConstReference
+   CustomVector<Type,AF,PF,TF>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
+   return v_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the adapted array of elements of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::Pointer CustomVector<Type,AF,PF,TF>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the adapted array of elements of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::ConstPointer CustomVector<Type,AF,PF,TF>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the custom vector.
+//
+// \return Iterator to the first element of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::Iterator CustomVector<Type,AF,PF,TF>::begin()
+{
+   return Iterator( v_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the custom vector.
+//
+// \return Iterator to the first element of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::ConstIterator CustomVector<Type,AF,PF,TF>::begin() const
+{
+   return ConstIterator( v_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the custom vector.
+//
+// \return Iterator to the first element of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::ConstIterator CustomVector<Type,AF,PF,TF>::cbegin() const
+{
+   return ConstIterator( v_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the custom vector.
+//
+// \return Iterator just past the last element of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::Iterator CustomVector<Type,AF,PF,TF>::end()
+{
+   return Iterator( v_+size_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the custom vector.
+//
+// \return Iterator just past the last element of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::ConstIterator CustomVector<Type,AF,PF,TF>::end() const
+{
+   return ConstIterator( v_+size_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the custom vector.
+//
+// \return Iterator just past the last element of the custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::ConstIterator CustomVector<Type,AF,PF,TF>::cend() const
+{
+   return ConstIterator( v_+size_, v_+size_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Array assignment to all vector elements.
+//
+// \param array N-dimensional array for the assignment.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Invalid array size.
+//
+// This assignment operator offers the option to directly set all elements of the vector:
+
+   \code
+   double array[4];
+   const double init[4] = { 1, 2, 3 };
+   blaze::CustomVector<double,unaligned,unpadded> v( array, 4UL );
+   v = init;
+   \endcode
+
+// The vector is assigned the values from the given array. Missing values are initialized with
+// default values (as e.g. the fourth element in the example). In case the size of the given
+// array does not match the size of the vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool AF         // Alignment flag
+        , bool PF         // Padding flag
+        , bool TF >       // Transpose flag
+template< typename Other  // Data type of the initialization array
+        , size_t N >      // Dimension of the initialization array
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator=( const Other (&array)[N] )
+{
+   if( size_ != N )
+      throw std::invalid_argument( "Invalid array size" );
+
+   for( size_t i=0UL; i<N; ++i )
+      v_[i] = array[i];
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all vector elements.
+//
+// \param rhs Scalar value to be assigned to all vector elements.
+// \return Reference to the assigned vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator=( const Type& rhs )
+{
+   for( size_t i=0UL; i<size_; ++i )
+      v_[i] = rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CustomVector.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The vector is initialized as a copy of the given vector. In contrast to the copy constructor
+// the elements of the given vector are copied into the adapted array (deep copy). In case the
+// current sizes of the two vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator=( const CustomVector& rhs )
+{
+   if( rhs.size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The vector is initialized as a copy of the given vector. In case the current sizes of the two
+// vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side vector
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename VT::ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      if( IsSparseVector<VT>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side vector
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator+=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename VT::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector
+//        (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side vector
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator-=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename VT::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the vector.
+// \return Reference to the vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side vector
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::operator*=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( this ) || IsSparseVector<VT>::value ) {
+      const ResultType tmp( *this * (~rhs) );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpMultAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a vector and
+//        a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CustomVector<Type,AF,PF,TF> >::Type&
+   CustomVector<Type,AF,PF,TF>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a vector by a scalar value
+//        (\f$ \vec{a}/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the vector.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the vector
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CustomVector<Type,AF,PF,TF> >::Type&
+   CustomVector<Type,AF,PF,TF>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size/dimension of the vector.
+//
+// \return The size of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline size_t CustomVector<Type,AF,PF,TF>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the vector.
+//
+// \return The capacity of the vector.
+//
+// The capacity of a custom vector corresponds to the number of accessible elements of the
+// adapted array including all padding elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline size_t CustomVector<Type,AF,PF,TF>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the vector.
+//
+// \return The number of non-zero elements in the vector.
+//
+// Note that the number of non-zero elements is always less than or equal to the current size
+// of the vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline size_t CustomVector<Type,AF,PF,TF>::nonZeros() const
+{
+   size_t nonzeros( 0 );
+
+   for( size_t i=0UL; i<size_; ++i ) {
+      if( !isDefault( v_[i] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::reset()
+{
+   using blaze::clear;
+   for( size_t i=0UL; i<size_; ++i )
+      clear( v_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the custom vector and replaces the array of elements with the given array.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the custom vector.
+// \return void
+// \exception std::invalid_argument Invalid setup of custom vector.
+//
+// This function resets the custom vector to the given array of elements of size \a n. The
+// function fails for the same reasons as the according constructor. In all failure cases a
+// \a std::invalid_argument exception is thrown and the vector remains unchanged.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::reset( Type* ptr, size_t n )
+{
+   setup( ptr, n, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the custom vector and replaces the array of elements with the given array.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the custom vector.
+// \param nn The total number of elements in the array including padding elements.
+// \return void
+// \exception std::invalid_argument Invalid setup of custom vector.
+//
+// This function resets the custom vector to the given array of \a nn elements. The function
+// fails for the same reasons as the according constructor. In all failure cases a
+// \a std::invalid_argument exception is thrown and the vector remains unchanged.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::reset( Type* ptr, size_t n, size_t nn )
+{
+   setup( ptr, n, nn );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the vector.
+//
+// \return void
+//
+// After the clear() function, the size of the vector is 0 and the vector no longer refers to
+// the previously adapted array of elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::clear()
+{
+   size_     = 0UL;
+   capacity_ = 0UL;
+   v_        = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the vector by the scalar value \a scalar (\f$ \vec{a}*=s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the scalar value
+inline CustomVector<Type,AF,PF,TF>& CustomVector<Type,AF,PF,TF>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<size_; ++i )
+      v_[i] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vectors.
+//
+// \param v The vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+//
+// This function swaps the adapted arrays of the two custom vectors. The elements of the arrays
+// are not modified.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::swap( CustomVector& v ) /* throw() */
+{
+   std::swap( size_, v.size_ );
+   std::swap( capacity_, v.capacity_ );
+   std::swap( v_, v.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the custom vector for the given array of elements.
+//
+// \param ptr The array of elements to be used by the vector.
+// \param n The number of array elements to be used by the custom vector.
+// \param nn The total number of elements in the array including padding elements.
+// \return void
+// \exception std::invalid_argument Invalid setup of custom vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::setup( Type* ptr, size_t n, size_t nn )
+{
+   if( ptr == NULL && n != 0UL )
+      throw std::invalid_argument( "Invalid array of elements" );
+
+   if( nn < n )
+      throw std::invalid_argument( "Invalid capacity of custom vector" );
+
+   if( AF && vectorizable && ptr != NULL && !checkAlignment( ptr ) )
+      throw std::invalid_argument( "Invalid alignment detected" );
+
+   if( PF && vectorizable && nn < n + ( IT::size - ( n % IT::size ) ) % IT::size )
+      throw std::invalid_argument( "Insufficient capacity for padded vector" );
+
+   size_     = n;
+   capacity_ = nn;
+   v_        = ptr;
+
+   if( PF && IsVectorizable<Type>::value ) {
+      for( size_t i=size_; i<capacity_; ++i )
+         if( !isDefault( v_[i] ) ) v_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of the final, partial intrinsic element of an unpadded vector.
+//
+// \param index Access index of the final intrinsic element.
+// \return The loaded intrinsic element.
+//
+// This function assembles the intrinsic element at the given index from the remaining vector
+// elements. The missing values are filled with default values.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline typename CustomVector<Type,AF,PF,TF>::IntrinsicType
+   CustomVector<Type,AF,PF,TF>::loadRest( size_t index ) const
+{
+   using blaze::load;
+
+   const size_t rest( size_ - index );
+
+   AlignedArray<Type,IT::size> array;
+   for( size_t i=0UL; i<rest; ++i )
+      array[i] = v_[index+i];
+   for( size_t i=rest; i<IT::size; ++i )
+      array[i] = Type();
+   return load( array.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of the final, partial intrinsic element of an unpadded vector.
+//
+// \param index Access index of the final intrinsic element.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function only stores the values of the given intrinsic element that correspond to
+// existing vector elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void CustomVector<Type,AF,PF,TF>::storeRest( size_t index, const IntrinsicType& value )
+{
+   using blaze::store;
+
+   const size_t rest( size_ - index );
+
+   AlignedArray<Type,IT::size> array;
+   store( array.data(), value );
+   for( size_t i=0UL; i<rest; ++i )
+      v_[index+i] = array[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomVector<Type,AF,PF,TF>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomVector<Type,AF,PF,TF>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is properly aligned in memory.
+//
+// \return \a true in case the vector is aligned, \a false if not.
+//
+// This function returns whether the vector is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of the vector are guaranteed to conform to the alignment
+// restrictions of the element type \a Type.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline bool CustomVector<Type,AF,PF,TF>::isAligned() const
+{
+   return AF;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline bool CustomVector<Type,AF,PF,TF>::canSMPAssign() const
+{
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of an intrinsic element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \return The loaded intrinsic element.
+//
+// This function performs a load of a specific intrinsic element of the dense vector. In case
+// the vector is aligned the load is performed aligned, else an unaligned load is performed.
+// The index must be smaller than the number of vector elements and it must be a multiple of
+// the number of values inside the intrinsic element. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE typename CustomVector<Type,AF,PF,TF>::IntrinsicType
+   CustomVector<Type,AF,PF,TF>::load( size_t index ) const
+{
+   using blaze::load;
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_          , "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL, "Invalid vector access index" );
+
+   if( !PF && index + IT::size > size_ )
+      return loadRest( index );
+   else if( AF )
+      return load( v_+index );
+   else
+      return loadu( v_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of an intrinsic element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of a specific intrinsic element of the dense vector.
+// The index must be smaller than the number of vector elements. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE typename CustomVector<Type,AF,PF,TF>::IntrinsicType
+   CustomVector<Type,AF,PF,TF>::loadu( size_t index ) const
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( !PF || index + IT::size <= capacity_, "Invalid vector access index" );
+
+   if( !PF && index + IT::size > size_ )
+      return loadRest( index );
+   else
+      return loadu( v_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of an intrinsic element of the vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs a store of a specific intrinsic element of the dense vector. In case
+// the vector is aligned the store is performed aligned, else an unaligned store is performed.
+// The index must be smaller than the number of vector elements and it must be a multiple of
+// the number of values inside the intrinsic element. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE void CustomVector<Type,AF,PF,TF>::store( size_t index, const IntrinsicType& value )
+{
+   using blaze::store;
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_          , "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL, "Invalid vector access index" );
+
+   if( !PF && index + IT::size > size_ )
+      storeRest( index, value );
+   else if( AF )
+      store( v_+index, value );
+   else
+      storeu( v_+index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of an intrinsic element of the dense vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific intrinsic element of the dense vector.
+// The index must be smaller than the number of vector elements. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE void CustomVector<Type,AF,PF,TF>::storeu( size_t index, const IntrinsicType& value )
+{
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( !PF || index + IT::size <= capacity_, "Invalid vector access index" );
+
+   if( !PF && index + IT::size > size_ )
+      storeRest( index, value );
+   else
+      storeu( v_+index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Non-temporal store of an intrinsic element of the dense vector.
+//
+// \param index Access index. The index must be smaller than the number of vector elements.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs a non-temporal store of a specific intrinsic element of the dense
+// vector. Since non-temporal stores require aligned memory, in case the vector is unaligned
+// a regular unaligned store is performed. The index must be smaller than the number of vector
+// elements and it must be a multiple of the number of values inside the intrinsic element.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+BLAZE_ALWAYS_INLINE void CustomVector<Type,AF,PF,TF>::stream( size_t index, const IntrinsicType& value )
+{
+   using blaze::stream;
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( index < size_          , "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL, "Invalid vector access index" );
+
+   if( !PF && index + IT::size > size_ )
+      storeRest( index, value );
+   else if( AF )
+      stream( v_+index, value );
+   else
+      storeu( v_+index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] = (~rhs)[i    ];
+      v_[i+1UL] = (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] = (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   if( AF && useStreaming && size_ > ( cacheSize/( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   {
+      for( size_t i=0UL; i<size_; i+=IT::size ) {
+         stream( i, (~rhs).load(i) );
+      }
+   }
+   else
+   {
+      const size_t ipos( size_ & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+      typename VT::ConstIterator it( (~rhs).begin() );
+      for( size_t i=0UL; i<ipos; i+=IT::size*4UL ) {
+         store( i             , it.load() ); it += IT::size;
+         store( i+IT::size    , it.load() ); it += IT::size;
+         store( i+IT::size*2UL, it.load() ); it += IT::size;
+         store( i+IT::size*3UL, it.load() ); it += IT::size;
+      }
+      for( size_t i=ipos; i<size_; i+=IT::size, it+=IT::size ) {
+         store( i, it.load() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void CustomVector<Type,AF,PF,TF>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   for( typename VT::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] += (~rhs)[i    ];
+      v_[i+1UL] += (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] += (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t ipos( size_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+   typename VT::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size*4UL ) {
+      store( i             , load(i             ) + it.load() ); it += IT::size;
+      store( i+IT::size    , load(i+IT::size    ) + it.load() ); it += IT::size;
+      store( i+IT::size*2UL, load(i+IT::size*2UL) + it.load() ); it += IT::size;
+      store( i+IT::size*3UL, load(i+IT::size*3UL) + it.load() ); it += IT::size;
+   }
+   for( size_t i=ipos; i<size_; i+=IT::size, it+=IT::size ) {
+      store( i, load(i) + it.load() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void CustomVector<Type,AF,PF,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   for( typename VT::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] -= (~rhs)[i    ];
+      v_[i+1UL] -= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] -= (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t ipos( size_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+   typename VT::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size*4UL ) {
+      store( i             , load(i             ) - it.load() ); it += IT::size;
+      store( i+IT::size    , load(i+IT::size    ) - it.load() ); it += IT::size;
+      store( i+IT::size*2UL, load(i+IT::size*2UL) - it.load() ); it += IT::size;
+      store( i+IT::size*3UL, load(i+IT::size*3UL) - it.load() ); it += IT::size;
+   }
+   for( size_t i=ipos; i<size_; i+=IT::size, it+=IT::size ) {
+      store( i, load(i) - it.load() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void CustomVector<Type,AF,PF,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   for( typename VT::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] -= element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      v_[i    ] *= (~rhs)[i    ];
+      v_[i+1UL] *= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      v_[ipos] *= (~rhs)[ipos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename CustomVector<Type,AF,PF,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >::Type
+   CustomVector<Type,AF,PF,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t ipos( size_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+   typename VT::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size*4UL ) {
+      store( i             , load(i             ) * it.load() ); it += IT::size;
+      store( i+IT::size    , load(i+IT::size    ) * it.load() ); it += IT::size;
+      store( i+IT::size*2UL, load(i+IT::size*2UL) * it.load() ); it += IT::size;
+      store( i+IT::size*3UL, load(i+IT::size*3UL) * it.load() ); it += IT::size;
+   }
+   for( size_t i=ipos; i<size_; i+=IT::size, it+=IT::size ) {
+      store( i, load(i) * it.load() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void CustomVector<Type,AF,PF,TF>::multAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const ResultType tmp( serial( *this ) );
+
+   reset();
+
+   for( typename VT::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      v_[element->index()] = tmp[element->index()] * element->value();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CUSTOMVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomVector operators */
+//@{
+template< typename Type, bool AF, bool PF, bool TF >
+inline void reset( CustomVector<Type,AF,PF,TF>& v );
+
+template< typename Type, bool AF, bool PF, bool TF >
+inline void clear( CustomVector<Type,AF,PF,TF>& v );
+
+template< typename Type, bool AF, bool PF, bool TF >
+inline bool isDefault( const CustomVector<Type,AF,PF,TF>& v );
+
+template< typename Type, bool AF, bool PF, bool TF >
+inline void swap( CustomVector<Type,AF,PF,TF>& a, CustomVector<Type,AF,PF,TF>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given custom vector.
+// \ingroup custom_vector
+//
+// \param v The custom vector to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void reset( CustomVector<Type,AF,PF,TF>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given custom vector.
+// \ingroup custom_vector
+//
+// \param v The custom vector to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void clear( CustomVector<Type,AF,PF,TF>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given custom vector is in default state.
+// \ingroup custom_vector
+//
+// \param v The custom vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the custom vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline bool isDefault( const CustomVector<Type,AF,PF,TF>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom vectors.
+// \ingroup custom_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+inline void swap( CustomVector<Type,AF,PF,TF>& a, CustomVector<Type,AF,PF,TF>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASCONSTDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool AF, bool PF, bool TF >
+struct HasConstDataAccess< CustomVector<T,AF,PF,TF> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASMUTABLEDATAACCESS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool AF, bool PF, bool TF >
+struct HasMutableDataAccess< CustomVector<T,AF,PF,TF> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTORTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool AF, bool PF, bool TF >
+struct SubvectorTrait< CustomVector<T1,AF,PF,TF> >
+{
+   typedef DynamicVector<T1,TF>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -76,6 +76,7 @@
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -111,11 +112,12 @@ namespace blaze {
 // \ingroup dynamic_matrix
 //
 // The DynamicMatrix class template is the representation of an arbitrary sized matrix with
-// \f$ M \times N \f$ dynamically allocated elements of arbitrary type. The type of the elements
-// and the storage order of the matrix can be specified via the two template parameters:
+// \f$ M \times N \f$ dynamically allocated elements of arbitrary type. The type of the elements,
+// the storage order of the matrix, and the allocator of the elements can be specified via the
+// three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename AT >
    class DynamicMatrix;
    \endcode
 
@@ -123,6 +125,10 @@ namespace blaze {
 //          non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
+//  - AT  : specifies the allocator of the matrix elements. The allocator has to model the
+//          allocator concept of the standard library and has to provide memory that is aligned
+//          according to the alignment restrictions of the element type. The default value is
+//          blaze::AlignedAllocator.
 //
 // Depending on the storage order, the matrix elements are either stored in a row-wise fashion
 // or in a column-wise fashion. Given the 2x3 matrix
@@ -183,8 +189,9 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the matrix
-        , bool SO = defaultStorageOrder >  // Storage order
-class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename AT >                    // Type of the allocator
+class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO,AT>, SO >
 {
  private:
    //**Type definitions****************************************************************************
@@ -193,20 +200,21 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
 
  public:
    //**Type definitions****************************************************************************
-   typedef DynamicMatrix<Type,SO>     This;            //!< Type of this DynamicMatrix instance.
-   typedef This                       ResultType;      //!< Result type for expression template evaluations.
-   typedef DynamicMatrix<Type,!SO>    OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef DynamicMatrix<Type,!SO>    TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                       ElementType;     //!< Type of the matrix elements.
-   typedef typename IT::Type          IntrinsicType;   //!< Intrinsic type of the matrix elements.
-   typedef const Type&                ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                CompositeType;   //!< Data type for composite expression templates.
-   typedef Type&                      Reference;       //!< Reference to a non-constant matrix value.
-   typedef const Type&                ConstReference;  //!< Reference to a constant matrix value.
-   typedef Type*                      Pointer;         //!< Pointer to a non-constant matrix value.
-   typedef const Type*                ConstPointer;    //!< Pointer to a constant matrix value.
-   typedef DenseIterator<Type>        Iterator;        //!< Iterator over non-constant elements.
-   typedef DenseIterator<const Type>  ConstIterator;   //!< Iterator over constant elements.
+   typedef DynamicMatrix<Type,SO,AT>   This;            //!< Type of this DynamicMatrix instance.
+   typedef This                        ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO,AT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO,AT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                        ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type           IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                 CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                       Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                 ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                       Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                 ConstPointer;    //!< Pointer to a constant matrix value.
+   typedef DenseIterator<Type>         Iterator;        //!< Iterator over non-constant elements.
+   typedef DenseIterator<const Type>   ConstIterator;   //!< Iterator over constant elements.
+   typedef AT                          AllocatorType;   //!< Type of the allocator of the matrix elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -214,7 +222,8 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef DynamicMatrix<ET,SO>  Other;  //!< The type of the other DynamicMatrix.
+      typedef typename AT::BLAZE_TEMPLATE rebind<ET>::other  OtherAllocator;  //!< Allocator type of the other DynamicMatrix.
+      typedef DynamicMatrix<ET,SO,OtherAllocator>            Other;           //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -237,8 +246,9 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    /*!\name Constructors */
    //@{
                               explicit inline DynamicMatrix();
-                              explicit inline DynamicMatrix( size_t m, size_t n );
-                              explicit inline DynamicMatrix( size_t m, size_t n, const Type& init );
+                              explicit inline DynamicMatrix( const AT& alloc );
+                              explicit inline DynamicMatrix( size_t m, size_t n, const AT& alloc = AT() );
+                              explicit inline DynamicMatrix( size_t m, size_t n, const Type& init, const AT& alloc = AT() );
    template< typename Other > explicit inline DynamicMatrix( size_t m, size_t n, const Other* array );
 
    template< typename Other, size_t M, size_t N >
@@ -304,6 +314,7 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
                               inline size_t         columns() const;
                               inline size_t         spacing() const;
                               inline size_t         capacity() const;
+                              inline AT             getAllocator() const;
                               inline size_t         capacity( size_t i ) const;
                               inline size_t         nonZeros() const;
                               inline size_t         nonZeros( size_t i ) const;
@@ -420,13 +431,39 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
    //@}
    //**********************************************************************************************
 
+   //**struct Memory******************************************************************************
+   /*!\brief The allocator of the matrix elements and the maximum capacity of the matrix.
+   //
+   // The allocator is stored as base class in order to exploit the empty base optimization,
+   // i.e. a stateless allocator does not increase the size of the matrix.
+   */
+   struct Memory : public AT
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the allocator and the capacity.
+      //
+      // \param alloc The allocator of the matrix elements.
+      // \param capacity The maximum capacity of the matrix.
+      */
+      explicit inline Memory( const AT& alloc, size_t capacity )
+         : AT       ( alloc    )  // The allocator of the matrix elements
+         , capacity_( capacity )  // The maximum capacity of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t capacity_;  //!< The maximum capacity of the matrix.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    size_t m_;                //!< The current number of rows of the matrix.
    size_t n_;                //!< The current number of columns of the matrix.
    size_t nn_;               //!< The alignment adjusted number of columns.
-   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Memory alloc_;            //!< The allocator and the maximum capacity of the matrix.
    Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
                              /*!< Access to the matrix elements is gained via the subscript or
                                   function call operator. In case of row-major order the memory
@@ -464,13 +501,32 @@ class DynamicMatrix : public DenseMatrix< DynamicMatrix<Type,SO>, SO >
 /*!\brief The default constructor for DynamicMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix()
-   : m_       ( 0UL  )  // The current number of rows of the matrix
-   , n_       ( 0UL  )  // The current number of columns of the matrix
-   , nn_      ( 0UL  )  // The alignment adjusted number of columns
-   , capacity_( 0UL  )  // The maximum capacity of the matrix
-   , v_       ( NULL )  // The matrix elements
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix()
+   : m_       ( 0UL  )       // The current number of rows of the matrix
+   , n_       ( 0UL  )       // The current number of columns of the matrix
+   , nn_      ( 0UL  )       // The alignment adjusted number of columns
+   , alloc_   ( AT(), 0UL )  // The allocator and capacity of the matrix
+   , v_       ( NULL )       // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix using the given allocator.
+//
+// \param alloc The allocator for the matrix elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( const AT& alloc )
+   : m_       ( 0UL  )        // The current number of rows of the matrix
+   , n_       ( 0UL  )        // The current number of columns of the matrix
+   , nn_      ( 0UL  )        // The alignment adjusted number of columns
+   , alloc_   ( alloc, 0UL )  // The allocator and capacity of the matrix
+   , v_       ( NULL )        // The matrix elements
 {}
 //*************************************************************************************************
 
@@ -480,18 +536,20 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix()
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the matrix elements.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
 //          element initialization is performed!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( size_t m, size_t n, const AT& alloc )
+   : m_       ( m )                                          // The current number of rows of the matrix
+   , n_       ( n )                                          // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n ) )                         // The alignment adjusted number of columns
+   , alloc_   ( alloc, m_*nn_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( alloc, alloc_.capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
@@ -509,17 +567,19 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
+// \param alloc The allocator for the matrix elements.
 //
 // All matrix elements are initialized with the specified value.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( size_t m, size_t n, const Type& init, const AT& alloc )
+   : m_       ( m )                                          // The current number of rows of the matrix
+   , n_       ( n )                                          // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n ) )                         // The alignment adjusted number of columns
+   , alloc_   ( alloc, m_*nn_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( alloc, alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n_; ++j )
@@ -558,14 +618,15 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* array )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( size_t m, size_t n, const Other* array )
+   : m_       ( m )                                         // The current number of rows of the matrix
+   , n_       ( n )                                         // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n ) )                        // The alignment adjusted number of columns
+   , alloc_   ( AT(), m_*nn_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n; ++j )
@@ -602,16 +663,17 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* a
 // the example).
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename AT >   // Type of the allocator
 template< typename Other  // Data type of the initialization array
         , size_t M        // Number of rows of the initialization array
         , size_t N >      // Number of columns of the initialization array
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
-   : m_       ( M )                            // The current number of rows of the matrix
-   , n_       ( N )                            // The current number of columns of the matrix
-   , nn_      ( adjustColumns( N ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( const Other (&array)[M][N] )
+   : m_       ( M )                                         // The current number of rows of the matrix
+   , n_       ( N )                                         // The current number of columns of the matrix
+   , nn_      ( adjustColumns( N ) )                        // The alignment adjusted number of columns
+   , alloc_   ( AT(), m_*nn_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t i=0UL; i<M; ++i ) {
       for( size_t j=0UL; j<N; ++j )
@@ -635,17 +697,18 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[M][N] )
 // and in order to enable/facilitate NRV optimization.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
-   : m_       ( m.m_  )                        // The current number of rows of the matrix
-   , n_       ( m.n_  )                        // The current number of columns of the matrix
-   , nn_      ( m.nn_ )                        // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
-{
-   BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
-
-   for( size_t i=0UL; i<capacity_; ++i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( const DynamicMatrix& m )
+   : m_       ( m.m_  )                                         // The current number of rows of the matrix
+   , n_       ( m.n_  )                                         // The current number of columns of the matrix
+   , nn_      ( m.nn_ )                                         // The alignment adjusted number of columns
+   , alloc_   ( m.alloc_, m_*nn_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( m.alloc_, alloc_.capacity_ ) )  // The matrix elements
+{
+   BLAZE_INTERNAL_ASSERT( alloc_.capacity_ <= m.alloc_.capacity_, "Invalid capacity estimation" );
+
+   for( size_t i=0UL; i<alloc_.capacity_; ++i )
       v_[i] = m.v_[i];
 }
 //*************************************************************************************************
@@ -657,15 +720,16 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
 // \param m Matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the foreign matrix
         , bool SO2 >     // Storage order of the foreign matrix
-inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
-   : m_       ( (~m).rows() )                  // The current number of rows of the matrix
-   , n_       ( (~m).columns() )               // The current number of columns of the matrix
-   , nn_      ( adjustColumns( n_ ) )          // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+inline DynamicMatrix<Type,SO,AT>::DynamicMatrix( const Matrix<MT,SO2>& m )
+   : m_       ( (~m).rows() )                               // The current number of rows of the matrix
+   , n_       ( (~m).columns() )                            // The current number of columns of the matrix
+   , nn_      ( adjustColumns( n_ ) )                       // The alignment adjusted number of columns
+   , alloc_   ( AT(), m_*nn_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m_; ++i ) {
       for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
@@ -691,10 +755,11 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
 /*!\brief The destructor for DynamicMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>::~DynamicMatrix()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, alloc_.capacity_ );
 }
 //*************************************************************************************************
 
@@ -715,9 +780,10 @@ inline DynamicMatrix<Type,SO>::~DynamicMatrix()
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Reference
-   DynamicMatrix<Type,SO>::operator()( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::Reference
+   DynamicMatrix<Type,SO,AT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -734,9 +800,10 @@ inline typename DynamicMatrix<Type,SO>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstReference
-   DynamicMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstReference
+   DynamicMatrix<Type,SO,AT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -758,8 +825,9 @@ inline typename DynamicMatrix<Type,SO>::ConstReference
 // member function.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Pointer DynamicMatrix<Type,SO>::data()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::Pointer DynamicMatrix<Type,SO,AT>::data()
 {
    return v_;
 }
@@ -779,8 +847,9 @@ inline typename DynamicMatrix<Type,SO>::Pointer DynamicMatrix<Type,SO>::data()
 // member function.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstPointer DynamicMatrix<Type,SO>::data() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstPointer DynamicMatrix<Type,SO,AT>::data() const
 {
    return v_;
 }
@@ -796,8 +865,9 @@ inline typename DynamicMatrix<Type,SO>::ConstPointer DynamicMatrix<Type,SO>::dat
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Pointer DynamicMatrix<Type,SO>::data( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::Pointer DynamicMatrix<Type,SO,AT>::data( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return v_ + i*nn_;
@@ -814,8 +884,9 @@ inline typename DynamicMatrix<Type,SO>::Pointer DynamicMatrix<Type,SO>::data( si
 // This function returns a pointer to the internal storage for the elements in row/column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstPointer DynamicMatrix<Type,SO>::data( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstPointer DynamicMatrix<Type,SO,AT>::data( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return v_ + i*nn_;
@@ -835,9 +906,10 @@ inline typename DynamicMatrix<Type,SO>::ConstPointer DynamicMatrix<Type,SO>::dat
 // to the first element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Iterator
-   DynamicMatrix<Type,SO>::begin( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::Iterator
+   DynamicMatrix<Type,SO,AT>::begin( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return Iterator( v_ + i*nn_ );
@@ -857,9 +929,10 @@ inline typename DynamicMatrix<Type,SO>::Iterator
 // to the first element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::begin( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstIterator
+   DynamicMatrix<Type,SO,AT>::begin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ );
@@ -879,9 +952,10 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // to the first element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::cbegin( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstIterator
+   DynamicMatrix<Type,SO,AT>::cbegin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ );
@@ -901,9 +975,10 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // returns an iterator just past the last element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::Iterator
-   DynamicMatrix<Type,SO>::end( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::Iterator
+   DynamicMatrix<Type,SO,AT>::end( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return Iterator( v_ + i*nn_ + n_ );
@@ -923,9 +998,10 @@ inline typename DynamicMatrix<Type,SO>::Iterator
 // returns an iterator just past the last element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::end( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstIterator
+   DynamicMatrix<Type,SO,AT>::end( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ + n_ );
@@ -945,9 +1021,10 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // returns an iterator just past the last element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename DynamicMatrix<Type,SO>::ConstIterator
-   DynamicMatrix<Type,SO>::cend( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename DynamicMatrix<Type,SO,AT>::ConstIterator
+   DynamicMatrix<Type,SO,AT>::cend( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
    return ConstIterator( v_ + i*nn_ + n_ );
@@ -985,11 +1062,12 @@ inline typename DynamicMatrix<Type,SO>::ConstIterator
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename AT >   // Type of the allocator
 template< typename Other  // Data type of the initialization array
         , size_t M        // Number of rows of the initialization array
         , size_t N >      // Number of columns of the initialization array
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&array)[M][N] )
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator=( const Other (&array)[M][N] )
 {
    resize( M, N, false );
 
@@ -1009,8 +1087,9 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Other (&
 // \return Reference to the assigned matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( Type rhs )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator=( Type rhs )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
@@ -1031,8 +1110,9 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( Type rhs )
 // copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicMatrix& rhs )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator=( const DynamicMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -1054,13 +1134,15 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const DynamicM
 // copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( ~rhs );
+      DynamicMatrix tmp( alloc_ );
+      tmp = ~rhs;
       swap( tmp );
    }
    else {
@@ -1086,10 +1168,11 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<M
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -1118,10 +1201,11 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator+=( const Matrix<
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -1150,15 +1234,17 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator-=( const Matrix<
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::operator*=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   DynamicMatrix tmp( *this * (~rhs) );
+   DynamicMatrix tmp( alloc_ );
+   tmp = *this * (~rhs);
    swap( tmp );
 
    return *this;
@@ -1174,10 +1260,11 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator*=( const Matrix<
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO> >::Type&
-   DynamicMatrix<Type,SO>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO,AT> >::Type&
+   DynamicMatrix<Type,SO,AT>::operator*=( Other rhs )
 {
    smpAssign( *this, (*this) * rhs );
    return *this;
@@ -1193,10 +1280,11 @@ inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO> >::Type&
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO> >::Type&
-   DynamicMatrix<Type,SO>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO,AT> >::Type&
+   DynamicMatrix<Type,SO,AT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -1220,8 +1308,9 @@ inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,SO> >::Type&
 // \return The number of rows of the matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::rows() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::rows() const
 {
    return m_;
 }
@@ -1234,8 +1323,9 @@ inline size_t DynamicMatrix<Type,SO>::rows() const
 // \return The number of columns of the matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::columns() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::columns() const
 {
    return n_;
 }
@@ -1253,8 +1343,9 @@ inline size_t DynamicMatrix<Type,SO>::columns() const
 // \a columnMajor the function returns the spacing between two columns.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::spacing() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::spacing() const
 {
    return nn_;
 }
@@ -1267,10 +1358,26 @@ inline size_t DynamicMatrix<Type,SO>::spacing() const
 // \return The capacity of the matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::capacity() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::capacity() const
 {
-   return capacity_;
+   return alloc_.capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the allocator of the matrix elements.
+//
+// \return The allocator of the matrix elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline AT DynamicMatrix<Type,SO,AT>::getAllocator() const
+{
+   return alloc_;
 }
 //*************************************************************************************************
 
@@ -1287,8 +1394,9 @@ inline size_t DynamicMatrix<Type,SO>::capacity() const
 // of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::capacity( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::capacity( size_t i ) const
 {
    UNUSED_PARAMETER( i );
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
@@ -1303,8 +1411,9 @@ inline size_t DynamicMatrix<Type,SO>::capacity( size_t i ) const
 // \return The number of non-zero elements in the dense matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::nonZeros() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1330,8 +1439,9 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros() const
 // the number of non-zero elements in column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1353,8 +1463,9 @@ inline size_t DynamicMatrix<Type,SO>::nonZeros( size_t i ) const
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reset()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,AT>::reset()
 {
    using blaze::clear;
 
@@ -1377,8 +1488,9 @@ inline void DynamicMatrix<Type,SO>::reset()
 // Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reset( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,AT>::reset( size_t i )
 {
    using blaze::clear;
 
@@ -1397,8 +1509,9 @@ inline void DynamicMatrix<Type,SO>::reset( size_t i )
 // After the clear() function, the size of the matrix is 0.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::clear()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,AT>::clear()
 {
    resize( 0UL, 0UL, false );
 }
@@ -1440,8 +1553,9 @@ inline void DynamicMatrix<Type,SO>::clear()
                               \f]
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+void DynamicMatrix<Type,SO,AT>::resize( size_t m, size_t n, bool preserve )
 {
    using blaze::min;
 
@@ -1451,7 +1565,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate<Type>( alloc_, m*nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1460,14 +1574,14 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
             v[i*nn+j] = v_[i*nn_+j];
 
       std::swap( v_, v );
-      deallocate( v );
-      capacity_ = m*nn;
+      deallocate( alloc_, v, alloc_.capacity_ );
+      alloc_.capacity_ = m*nn;
    }
-   else if( m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+   else if( m*nn > alloc_.capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( alloc_, m*nn );
       std::swap( v_, v );
-      deallocate( v );
-      capacity_ = m*nn;
+      deallocate( alloc_, v, alloc_.capacity_ );
+      alloc_.capacity_ = m*nn;
    }
 
    if( IsVectorizable<Type>::value ) {
@@ -1498,8 +1612,9 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // initialized!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,AT>::extend( size_t m, size_t n, bool preserve )
 {
    resize( m_+m, n_+n, preserve );
 }
@@ -1516,26 +1631,27 @@ inline void DynamicMatrix<Type,SO>::extend( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements are preserved.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,AT>::reserve( size_t elements )
 {
-   if( elements > capacity_ )
+   if( elements > alloc_.capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( alloc_, elements );
 
       // Initializing the new array
-      std::copy( v_, v_+capacity_, tmp );
+      std::copy( v_, v_+alloc_.capacity_, tmp );
 
       if( IsVectorizable<Type>::value ) {
-         for( size_t i=capacity_; i<elements; ++i )
+         for( size_t i=alloc_.capacity_; i<elements; ++i )
             tmp[i] = Type();
       }
 
       // Replacing the old array
       std::swap( tmp, v_ );
-      deallocate( tmp );
-      capacity_ = elements;
+      deallocate( alloc_, tmp, alloc_.capacity_ );
+      alloc_.capacity_ = elements;
    }
 }
 //*************************************************************************************************
@@ -1547,10 +1663,12 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::transpose()
 {
-   DynamicMatrix tmp( trans(*this) );
+   DynamicMatrix tmp( alloc_ );
+   tmp = trans(*this);
    swap( tmp );
    return *this;
 }
@@ -1564,9 +1682,10 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scalar )
+inline DynamicMatrix<Type,SO,AT>& DynamicMatrix<Type,SO,AT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( size_t j=0UL; j<n_; ++j )
@@ -1585,13 +1704,14 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::scale( const Other& scala
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) /* throw() */
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void DynamicMatrix<Type,SO,AT>::swap( DynamicMatrix& m ) /* throw() */
 {
    std::swap( m_ , m.m_  );
    std::swap( n_ , m.n_  );
    std::swap( nn_, m.nn_ );
-   std::swap( capacity_, m.capacity_ );
+   std::swap( alloc_, m.alloc_ );
    std::swap( v_ , m.v_  );
 }
 //*************************************************************************************************
@@ -1604,8 +1724,9 @@ inline void DynamicMatrix<Type,SO>::swap( DynamicMatrix& m ) /* throw() */
 // \return The adjusted number of columns.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t DynamicMatrix<Type,SO>::adjustColumns( size_t minColumns ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t DynamicMatrix<Type,SO,AT>::adjustColumns( size_t minColumns ) const
 {
    if( IsVectorizable<Type>::value )
       return minColumns + ( IT::size - ( minColumns % IT::size ) ) % IT::size;
@@ -1633,9 +1754,10 @@ inline size_t DynamicMatrix<Type,SO>::adjustColumns( size_t minColumns ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,SO>::canAlias( const Other* alias ) const
+inline bool DynamicMatrix<Type,SO,AT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1653,9 +1775,10 @@ inline bool DynamicMatrix<Type,SO>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,SO>::isAliased( const Other* alias ) const
+inline bool DynamicMatrix<Type,SO,AT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1672,8 +1795,9 @@ inline bool DynamicMatrix<Type,SO>::isAliased( const Other* alias ) const
 // to the alignment restrictions of the element type \a Type.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::isAligned() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,AT>::isAligned() const
 {
    return true;
 }
@@ -1691,8 +1815,9 @@ inline bool DynamicMatrix<Type,SO>::isAligned() const
 // rows and/or columns of the matrix).
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool DynamicMatrix<Type,SO>::canSMPAssign() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline bool DynamicMatrix<Type,SO,AT>::canSMPAssign() const
 {
    return ( rows() > SMP_DMATASSIGN_THRESHOLD );
 }
@@ -1715,9 +1840,10 @@ inline bool DynamicMatrix<Type,SO>::canSMPAssign() const
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::IntrinsicType
-   DynamicMatrix<Type,SO>::load( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,AT>::IntrinsicType
+   DynamicMatrix<Type,SO,AT>::load( size_t i, size_t j ) const
 {
    using blaze::load;
 
@@ -1749,9 +1875,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::IntrinsicType
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::IntrinsicType
-   DynamicMatrix<Type,SO>::loadu( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO,AT>::IntrinsicType
+   DynamicMatrix<Type,SO,AT>::loadu( size_t i, size_t j ) const
 {
    using blaze::loadu;
 
@@ -1783,9 +1910,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,SO>::IntrinsicType
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::store( size_t i, size_t j, const IntrinsicType& value )
+   DynamicMatrix<Type,SO,AT>::store( size_t i, size_t j, const IntrinsicType& value )
 {
    using blaze::store;
 
@@ -1818,9 +1946,10 @@ BLAZE_ALWAYS_INLINE void
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::storeu( size_t i, size_t j, const IntrinsicType& value )
+   DynamicMatrix<Type,SO,AT>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
    using blaze::storeu;
 
@@ -1852,9 +1981,10 @@ BLAZE_ALWAYS_INLINE void
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,SO>::stream( size_t i, size_t j, const IntrinsicType& value )
+   DynamicMatrix<Type,SO,AT>::stream( size_t i, size_t j, const IntrinsicType& value )
 {
    using blaze::stream;
 
@@ -1882,10 +2012,11 @@ BLAZE_ALWAYS_INLINE void
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
-   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,SO,AT>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   DynamicMatrix<Type,SO,AT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -1918,10 +2049,11 @@ inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
-   DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+inline typename EnableIf< typename DynamicMatrix<Type,SO,AT>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   DynamicMatrix<Type,SO,AT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::store;
    using blaze::stream;
@@ -1971,9 +2103,10 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::assign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2009,9 +2142,10 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2035,9 +2169,10 @@ inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2063,10 +2198,11 @@ inline void DynamicMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
-   DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,SO,AT>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   DynamicMatrix<Type,SO,AT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2114,10 +2250,11 @@ inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
-   DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline typename EnableIf< typename DynamicMatrix<Type,SO,AT>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   DynamicMatrix<Type,SO,AT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -2167,9 +2304,10 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2217,9 +2355,10 @@ inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2243,9 +2382,10 @@ inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::addAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2271,10 +2411,11 @@ inline void DynamicMatrix<Type,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
-   DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,SO,AT>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   DynamicMatrix<Type,SO,AT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2322,10 +2463,11 @@ inline typename DisableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
-   DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline typename EnableIf< typename DynamicMatrix<Type,SO,AT>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   DynamicMatrix<Type,SO,AT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -2375,9 +2517,10 @@ inline typename EnableIf< typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2425,9 +2568,10 @@ inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2451,9 +2595,10 @@ inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
+inline void DynamicMatrix<Type,SO,AT>::subAssign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2487,8 +2632,9 @@ inline void DynamicMatrix<Type,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
 // This specialization of DynamicMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the matrix
-class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, true >
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+class DynamicMatrix<Type,true,AT> : public DenseMatrix< DynamicMatrix<Type,true,AT>, true >
 {
  private:
    //**Type definitions****************************************************************************
@@ -2497,20 +2643,21 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
 
  public:
    //**Type definitions****************************************************************************
-   typedef DynamicMatrix<Type,true>   This;            //!< Type of this DynamicMatrix instance.
-   typedef This                       ResultType;      //!< Result type for expression template evaluations.
-   typedef DynamicMatrix<Type,false>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef DynamicMatrix<Type,false>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                       ElementType;     //!< Type of the matrix elements.
-   typedef typename IT::Type          IntrinsicType;   //!< Intrinsic type of the matrix elements.
-   typedef const Type&                ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                CompositeType;   //!< Data type for composite expression templates.
-   typedef Type&                      Reference;       //!< Reference to a non-constant matrix value.
-   typedef const Type&                ConstReference;  //!< Reference to a constant matrix value.
-   typedef Type*                      Pointer;         //!< Pointer to a non-constant matrix value.
-   typedef const Type*                ConstPointer;    //!< Pointer to a constant matrix value.
-   typedef DenseIterator<Type>        Iterator;        //!< Iterator over non-constant elements.
-   typedef DenseIterator<const Type>  ConstIterator;   //!< Iterator over constant elements.
+   typedef DynamicMatrix<Type,true,AT>   This;            //!< Type of this DynamicMatrix instance.
+   typedef This                          ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,false,AT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,false,AT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                          ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type             IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                         Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                   ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                         Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                   ConstPointer;    //!< Pointer to a constant matrix value.
+   typedef DenseIterator<Type>           Iterator;        //!< Iterator over non-constant elements.
+   typedef DenseIterator<const Type>     ConstIterator;   //!< Iterator over constant elements.
+   typedef AT                            AllocatorType;   //!< Type of the allocator of the matrix elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -2518,7 +2665,8 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef DynamicMatrix<ET,true>  Other;  //!< The type of the other DynamicMatrix.
+      typedef typename AT::BLAZE_TEMPLATE rebind<ET>::other  OtherAllocator;  //!< Allocator type of the other DynamicMatrix.
+      typedef DynamicMatrix<ET,true,OtherAllocator>          Other;           //!< The type of the other DynamicMatrix.
    };
    //**********************************************************************************************
 
@@ -2541,8 +2689,9 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    /*!\name Constructors */
    //@{
                               explicit inline DynamicMatrix();
-                              explicit inline DynamicMatrix( size_t m, size_t n );
-                              explicit inline DynamicMatrix( size_t m, size_t n, const Type& init );
+                              explicit inline DynamicMatrix( const AT& alloc );
+                              explicit inline DynamicMatrix( size_t m, size_t n, const AT& alloc = AT() );
+                              explicit inline DynamicMatrix( size_t m, size_t n, const Type& init, const AT& alloc = AT() );
    template< typename Other > explicit inline DynamicMatrix( size_t m, size_t n, const Other* array );
 
    template< typename Other, size_t M, size_t N >
@@ -2608,6 +2757,7 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
                               inline size_t         columns() const;
                               inline size_t         spacing() const;
                               inline size_t         capacity() const;
+                              inline AT             getAllocator() const;
                               inline size_t         capacity( size_t j ) const;
                               inline size_t         nonZeros() const;
                               inline size_t         nonZeros( size_t j ) const;
@@ -2718,13 +2868,39 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
    //@}
    //**********************************************************************************************
 
+   //**struct Memory******************************************************************************
+   /*!\brief The allocator of the matrix elements and the maximum capacity of the matrix.
+   //
+   // The allocator is stored as base class in order to exploit the empty base optimization,
+   // i.e. a stateless allocator does not increase the size of the matrix.
+   */
+   struct Memory : public AT
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the allocator and the capacity.
+      //
+      // \param alloc The allocator of the matrix elements.
+      // \param capacity The maximum capacity of the matrix.
+      */
+      explicit inline Memory( const AT& alloc, size_t capacity )
+         : AT       ( alloc    )  // The allocator of the matrix elements
+         , capacity_( capacity )  // The maximum capacity of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t capacity_;  //!< The maximum capacity of the matrix.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    size_t m_;                //!< The current number of rows of the matrix.
    size_t mm_;               //!< The alignment adjusted number of rows.
    size_t n_;                //!< The current number of columns of the matrix.
-   size_t capacity_;         //!< The maximum capacity of the matrix.
+   Memory alloc_;            //!< The allocator and the maximum capacity of the matrix.
    Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
                              /*!< Access to the matrix elements is gained via the subscript or
                                   function call operator. In case of row-major order the memory
@@ -2761,13 +2937,33 @@ class DynamicMatrix<Type,true> : public DenseMatrix< DynamicMatrix<Type,true>, t
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for DynamicMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix()
-   : m_       ( 0UL  )  // The current number of rows of the matrix
-   , mm_      ( 0UL  )  // The alignment adjusted number of rows
-   , n_       ( 0UL  )  // The current number of columns of the matrix
-   , capacity_( 0UL  )  // The maximum capacity of the matrix
-   , v_       ( NULL )  // The matrix elements
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix()
+   : m_       ( 0UL  )       // The current number of rows of the matrix
+   , mm_      ( 0UL  )       // The alignment adjusted number of rows
+   , n_       ( 0UL  )       // The current number of columns of the matrix
+   , alloc_   ( AT(), 0UL )  // The allocator and capacity of the matrix
+   , v_       ( NULL )       // The matrix elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an empty matrix using the given allocator.
+//
+// \param alloc The allocator for the matrix elements.
+*/
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( const AT& alloc )
+   : m_       ( 0UL  )        // The current number of rows of the matrix
+   , mm_      ( 0UL  )        // The alignment adjusted number of rows
+   , n_       ( 0UL  )        // The current number of columns of the matrix
+   , alloc_   ( alloc, 0UL )  // The allocator and capacity of the matrix
+   , v_       ( NULL )        // The matrix elements
 {}
 /*! \endcond */
 //*************************************************************************************************
@@ -2779,17 +2975,19 @@ inline DynamicMatrix<Type,true>::DynamicMatrix()
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the matrix elements.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
 //          element initialization is performed!
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( size_t m, size_t n, const AT& alloc )
+   : m_       ( m )                                          // The current number of rows of the matrix
+   , mm_      ( adjustRows( m ) )                            // The alignment adjusted number of rows
+   , n_       ( n )                                          // The current number of columns of the matrix
+   , alloc_   ( alloc, mm_*n_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( alloc, alloc_.capacity_ ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
@@ -2809,16 +3007,18 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
+// \param alloc The allocator for the matrix elements.
 //
 // All matrix elements are initialized with the specified value.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( size_t m, size_t n, const Type& init, const AT& alloc )
+   : m_       ( m )                                          // The current number of rows of the matrix
+   , mm_      ( adjustRows( m ) )                            // The alignment adjusted number of rows
+   , n_       ( n )                                          // The current number of columns of the matrix
+   , alloc_   ( alloc, mm_*n_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( alloc, alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n_; ++j ) {
       for( size_t i=0UL; i<m_; ++i )
@@ -2858,14 +3058,15 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
 // from the given array. Note that it is expected that the given \a array has at least \a m by
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other* array )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( size_t m, size_t n, const Other* array )
+   : m_       ( m )                                         // The current number of rows of the matrix
+   , mm_      ( adjustRows( m ) )                           // The alignment adjusted number of rows
+   , n_       ( n )                                         // The current number of columns of the matrix
+   , alloc_   ( AT(), mm_*n_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n; ++j ) {
       for( size_t i=0UL; i<m; ++i )
@@ -2903,16 +3104,17 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other*
 // the given array. Missing values are initialized with default values (as e.g. the value 6 in
 // the example).
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename Other   // Data type of the initialization array
         , size_t M         // Number of rows of the initialization array
         , size_t N >       // Number of columns of the initialization array
-inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
-   : m_       ( M )                            // The current number of rows of the matrix
-   , mm_      ( adjustRows( M ) )              // The alignment adjusted number of rows
-   , n_       ( N )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( const Other (&array)[M][N] )
+   : m_       ( M )                                         // The current number of rows of the matrix
+   , mm_      ( adjustRows( M ) )                           // The alignment adjusted number of rows
+   , n_       ( N )                                         // The current number of columns of the matrix
+   , alloc_   ( AT(), mm_*n_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t j=0UL; j<N; ++j ) {
       for( size_t i=0UL; i<M; ++i )
@@ -2937,17 +3139,18 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[M][N] )
 // The copy constructor is explicitly defined due to the required dynamic memory management
 // and in order to enable/facilitate NRV optimization.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
-   : m_       ( m.m_  )                        // The current number of rows of the matrix
-   , mm_      ( m.mm_ )                        // The alignment adjusted number of rows
-   , n_       ( m.n_  )                        // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( const DynamicMatrix& m )
+   : m_       ( m.m_  )                                         // The current number of rows of the matrix
+   , mm_      ( m.mm_ )                                         // The alignment adjusted number of rows
+   , n_       ( m.n_  )                                         // The current number of columns of the matrix
+   , alloc_   ( m.alloc_, mm_*n_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( m.alloc_, alloc_.capacity_ ) )  // The matrix elements
 {
-   BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
+   BLAZE_INTERNAL_ASSERT( alloc_.capacity_ <= m.alloc_.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
+   for( size_t i=0UL; i<alloc_.capacity_; ++i )
       v_[i] = m.v_[i];
 }
 /*! \endcond */
@@ -2960,15 +3163,16 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
 //
 // \param m Matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the foreign matrix
         , bool SO >        // Storage order of the foreign matrix
-inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
-   : m_       ( (~m).rows() )                  // The current number of rows of the matrix
-   , mm_      ( adjustRows( m_ ) )             // The alignment adjusted number of rows
-   , n_       ( (~m).columns() )               // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+inline DynamicMatrix<Type,true,AT>::DynamicMatrix( const Matrix<MT,SO>& m )
+   : m_       ( (~m).rows() )                               // The current number of rows of the matrix
+   , mm_      ( adjustRows( m_ ) )                          // The alignment adjusted number of rows
+   , n_       ( (~m).columns() )                            // The current number of columns of the matrix
+   , alloc_   ( AT(), mm_*n_ )                              // The allocator and capacity of the matrix
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n_; ++j ) {
       for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
@@ -2995,10 +3199,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for DynamicMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>::~DynamicMatrix()
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>::~DynamicMatrix()
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, alloc_.capacity_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3020,9 +3225,10 @@ inline DynamicMatrix<Type,true>::~DynamicMatrix()
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Reference
-   DynamicMatrix<Type,true>::operator()( size_t i, size_t j )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::Reference
+   DynamicMatrix<Type,true,AT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -3040,9 +3246,10 @@ inline typename DynamicMatrix<Type,true>::Reference
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstReference
-   DynamicMatrix<Type,true>::operator()( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstReference
+   DynamicMatrix<Type,true,AT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
@@ -3064,8 +3271,9 @@ inline typename DynamicMatrix<Type,true>::ConstReference
 // elements within a column are given by the \c columns() member functions, the total number
 // of elements including padding is given by the \c spacing() member function.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Pointer DynamicMatrix<Type,true>::data()
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::Pointer DynamicMatrix<Type,true,AT>::data()
 {
    return v_;
 }
@@ -3085,8 +3293,9 @@ inline typename DynamicMatrix<Type,true>::Pointer DynamicMatrix<Type,true>::data
 // elements within a column are given by the \c columns() member functions, the total number
 // of elements including padding is given by the \c spacing() member function.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstPointer DynamicMatrix<Type,true>::data() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstPointer DynamicMatrix<Type,true,AT>::data() const
 {
    return v_;
 }
@@ -3103,8 +3312,9 @@ inline typename DynamicMatrix<Type,true>::ConstPointer DynamicMatrix<Type,true>:
 //
 // This function returns a pointer to the internal storage for the elements in column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Pointer DynamicMatrix<Type,true>::data( size_t j )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::Pointer DynamicMatrix<Type,true,AT>::data( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return v_ + j*mm_;
@@ -3122,8 +3332,9 @@ inline typename DynamicMatrix<Type,true>::Pointer DynamicMatrix<Type,true>::data
 //
 // This function returns a pointer to the internal storage for the elements in column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstPointer DynamicMatrix<Type,true>::data( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstPointer DynamicMatrix<Type,true,AT>::data( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return v_ + j*mm_;
@@ -3139,9 +3350,10 @@ inline typename DynamicMatrix<Type,true>::ConstPointer DynamicMatrix<Type,true>:
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Iterator
-   DynamicMatrix<Type,true>::begin( size_t j )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::Iterator
+   DynamicMatrix<Type,true,AT>::begin( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return Iterator( v_ + j*mm_ );
@@ -3157,9 +3369,10 @@ inline typename DynamicMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::begin( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstIterator
+   DynamicMatrix<Type,true,AT>::begin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ );
@@ -3175,9 +3388,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::cbegin( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstIterator
+   DynamicMatrix<Type,true,AT>::cbegin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ );
@@ -3193,9 +3407,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::Iterator
-   DynamicMatrix<Type,true>::end( size_t j )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::Iterator
+   DynamicMatrix<Type,true,AT>::end( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return Iterator( v_ + j*mm_ + m_ );
@@ -3211,9 +3426,10 @@ inline typename DynamicMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::end( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstIterator
+   DynamicMatrix<Type,true,AT>::end( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ + m_ );
@@ -3229,9 +3445,10 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename DynamicMatrix<Type,true>::ConstIterator
-   DynamicMatrix<Type,true>::cend( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline typename DynamicMatrix<Type,true,AT>::ConstIterator
+   DynamicMatrix<Type,true,AT>::cend( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid dense matrix column access index" );
    return ConstIterator( v_ + j*mm_ + m_ );
@@ -3270,11 +3487,12 @@ inline typename DynamicMatrix<Type,true>::ConstIterator
 // The matrix is resized accoring to the size of the array and assigned the values of the given
 // array. Missing values are initialized with default values (as e.g. the value 6 in the example).
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename Other   // Data type of the initialization array
         , size_t M         // Number of rows of the initialization array
         , size_t N >       // Number of columns of the initialization array
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Other (&array)[M][N] )
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator=( const Other (&array)[M][N] )
 {
    resize( M, N, false );
 
@@ -3295,8 +3513,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Othe
 // \param rhs Scalar value to be assigned to all matrix elements.
 // \return Reference to the assigned matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( Type rhs )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator=( Type rhs )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
@@ -3318,8 +3537,9 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( Type rhs )
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const DynamicMatrix& rhs )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator=( const DynamicMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -3342,13 +3562,15 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Dyna
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matrix<MT,SO>& rhs )
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( ~rhs );
+      DynamicMatrix tmp( alloc_ );
+      tmp = ~rhs;
       swap( tmp );
    }
    else {
@@ -3375,10 +3597,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matr
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator+=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -3408,10 +3631,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator+=( const Mat
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator-=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -3441,15 +3665,17 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator-=( const Mat
 // In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator*=( const Matrix<MT,SO>& rhs )
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::operator*=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   DynamicMatrix tmp( *this * (~rhs) );
+   DynamicMatrix tmp( alloc_ );
+   tmp = *this * (~rhs);
    swap( tmp );
 
    return *this;
@@ -3466,10 +3692,11 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator*=( const Mat
 // \param rhs The right-hand side scalar value for the multiplication.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true> >::Type&
-   DynamicMatrix<Type,true>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true,AT> >::Type&
+   DynamicMatrix<Type,true,AT>::operator*=( Other rhs )
 {
    smpAssign( *this, (*this) * rhs );
    return *this;
@@ -3486,10 +3713,11 @@ inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true> >::Type&
 // \param rhs The right-hand side scalar value for the division.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true> >::Type&
-   DynamicMatrix<Type,true>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true,AT> >::Type&
+   DynamicMatrix<Type,true,AT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -3514,8 +3742,9 @@ inline typename EnableIf< IsNumeric<Other>, DynamicMatrix<Type,true> >::Type&
 //
 // \return The number of rows of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::rows() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::rows() const
 {
    return m_;
 }
@@ -3529,8 +3758,9 @@ inline size_t DynamicMatrix<Type,true>::rows() const
 //
 // \return The number of columns of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::columns() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::columns() const
 {
    return n_;
 }
@@ -3547,8 +3777,9 @@ inline size_t DynamicMatrix<Type,true>::columns() const
 // This function returns the spacing between the beginning of two column, i.e. the total number
 // of elements of a column.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::spacing() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::spacing() const
 {
    return mm_;
 }
@@ -3562,10 +3793,27 @@ inline size_t DynamicMatrix<Type,true>::spacing() const
 //
 // \return The capacity of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::capacity() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::capacity() const
 {
-   return capacity_;
+   return alloc_.capacity_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a copy of the allocator of the matrix elements.
+//
+// \return The allocator of the matrix elements.
+*/
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline AT DynamicMatrix<Type,true,AT>::getAllocator() const
+{
+   return alloc_;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3578,8 +3826,9 @@ inline size_t DynamicMatrix<Type,true>::capacity() const
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t DynamicMatrix<Type,true>::capacity( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::capacity( size_t j ) const
 {
    UNUSED_PARAMETER( j );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3595,8 +3844,9 @@ inline size_t DynamicMatrix<Type,true>::capacity( size_t j ) const
 //
 // \return The number of non-zero elements in the dense matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::nonZeros() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -3618,8 +3868,9 @@ inline size_t DynamicMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3642,8 +3893,9 @@ inline size_t DynamicMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reset()
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline void DynamicMatrix<Type,true,AT>::reset()
 {
    using blaze::clear;
 
@@ -3665,8 +3917,9 @@ inline void DynamicMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void DynamicMatrix<Type,true>::reset( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void DynamicMatrix<Type,true,AT>::reset( size_t j )
 {
    using blaze::clear;
 
@@ -3686,8 +3939,9 @@ inline void DynamicMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the matrix is 0.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::clear()
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline void DynamicMatrix<Type,true,AT>::clear()
 {
    resize( 0UL, 0UL, false );
 }
@@ -3730,8 +3984,9 @@ inline void DynamicMatrix<Type,true>::clear()
                               \end{array}\right)
                               \f]
 */
-template< typename Type >  // Data type of the matrix
-void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+void DynamicMatrix<Type,true,AT>::resize( size_t m, size_t n, bool preserve )
 {
    using blaze::min;
 
@@ -3741,7 +3996,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate<Type>( alloc_, mm*n );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -3750,14 +4005,14 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
             v[i+j*mm] = v_[i+j*mm_];
 
       std::swap( v_, v );
-      deallocate( v );
-      capacity_ = mm*n;
+      deallocate( alloc_, v, alloc_.capacity_ );
+      alloc_.capacity_ = mm*n;
    }
-   else if( mm*n > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+   else if( mm*n > alloc_.capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( alloc_, mm*n );
       std::swap( v_, v );
-      deallocate( v );
-      capacity_ = mm*n;
+      deallocate( alloc_, v, alloc_.capacity_ );
+      alloc_.capacity_ = mm*n;
    }
 
    if( IsVectorizable<Type>::value ) {
@@ -3789,8 +4044,9 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // values, the \a preserve flag can be set to \a true. However, new matrix elements are not
 // initialized!
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::extend( size_t m, size_t n, bool preserve )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline void DynamicMatrix<Type,true,AT>::extend( size_t m, size_t n, bool preserve )
 {
    resize( m_+m, n_+n, preserve );
 }
@@ -3808,26 +4064,27 @@ inline void DynamicMatrix<Type,true>::extend( size_t m, size_t n, bool preserve
 // This function increases the capacity of the dense matrix to at least \a elements elements.
 // The current values of the matrix elements are preserved.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::reserve( size_t elements )
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline void DynamicMatrix<Type,true,AT>::reserve( size_t elements )
 {
-   if( elements > capacity_ )
+   if( elements > alloc_.capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( alloc_, elements );
 
       // Initializing the new array
-      std::copy( v_, v_+capacity_, tmp );
+      std::copy( v_, v_+alloc_.capacity_, tmp );
 
       if( IsVectorizable<Type>::value ) {
-         for( size_t i=capacity_; i<elements; ++i )
+         for( size_t i=alloc_.capacity_; i<elements; ++i )
             tmp[i] = Type();
       }
 
       // Replacing the old array
       std::swap( tmp, v_ );
-      deallocate( tmp );
-      capacity_ = elements;
+      deallocate( alloc_, tmp, alloc_.capacity_ );
+      alloc_.capacity_ = elements;
    }
 }
 /*! \endcond */
@@ -3840,10 +4097,12 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::transpose()
 {
-   DynamicMatrix tmp( trans(*this) );
+   DynamicMatrix tmp( alloc_ );
+   tmp = trans(*this);
    swap( tmp );
    return *this;
 }
@@ -3858,9 +4117,10 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 // \param scalar The scalar value for the matrix scaling.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& scalar )
+inline DynamicMatrix<Type,true,AT>& DynamicMatrix<Type,true,AT>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( size_t i=0UL; i<m_; ++i )
@@ -3880,13 +4140,14 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::scale( const Other& s
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type >  // Data type of the matrix
-inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) /* throw() */
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline void DynamicMatrix<Type,true,AT>::swap( DynamicMatrix& m ) /* throw() */
 {
    std::swap( m_ , m.m_  );
    std::swap( mm_, m.mm_ );
    std::swap( n_ , m.n_  );
-   std::swap( capacity_, m.capacity_ );
+   std::swap( alloc_, m.alloc_ );
    std::swap( v_ , m.v_  );
 }
 /*! \endcond */
@@ -3900,8 +4161,9 @@ inline void DynamicMatrix<Type,true>::swap( DynamicMatrix& m ) /* throw() */
 // \param minRows The minimum necessary number of rows.
 // \return The adjusted number of rows.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t DynamicMatrix<Type,true>::adjustRows( size_t minRows ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline size_t DynamicMatrix<Type,true,AT>::adjustRows( size_t minRows ) const
 {
    if( IsVectorizable<Type>::value )
       return minRows + ( IT::size - ( minRows % IT::size ) ) % IT::size;
@@ -3930,9 +4192,10 @@ inline size_t DynamicMatrix<Type,true>::adjustRows( size_t minRows ) const
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,true>::canAlias( const Other* alias ) const
+inline bool DynamicMatrix<Type,true,AT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -3951,9 +4214,10 @@ inline bool DynamicMatrix<Type,true>::canAlias( const Other* alias ) const
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicMatrix<Type,true>::isAliased( const Other* alias ) const
+inline bool DynamicMatrix<Type,true,AT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -3971,8 +4235,9 @@ inline bool DynamicMatrix<Type,true>::isAliased( const Other* alias ) const
 // whether the beginning and the end of each column of the matrix are guaranteed to conform to
 // the alignment restrictions of the element type \a Type.
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::isAligned() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline bool DynamicMatrix<Type,true,AT>::isAligned() const
 {
    return true;
 }
@@ -3991,8 +4256,9 @@ inline bool DynamicMatrix<Type,true>::isAligned() const
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the matrix
-inline bool DynamicMatrix<Type,true>::canSMPAssign() const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+inline bool DynamicMatrix<Type,true,AT>::canSMPAssign() const
 {
    return ( columns() > SMP_DMATASSIGN_THRESHOLD );
 }
@@ -4015,9 +4281,10 @@ inline bool DynamicMatrix<Type,true>::canSMPAssign() const
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::IntrinsicType
-   DynamicMatrix<Type,true>::load( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,AT>::IntrinsicType
+   DynamicMatrix<Type,true,AT>::load( size_t i, size_t j ) const
 {
    using blaze::load;
 
@@ -4049,9 +4316,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::IntrinsicType
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
-BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::IntrinsicType
-   DynamicMatrix<Type,true>::loadu( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true,AT>::IntrinsicType
+   DynamicMatrix<Type,true,AT>::loadu( size_t i, size_t j ) const
 {
    using blaze::loadu;
 
@@ -4083,9 +4351,10 @@ BLAZE_ALWAYS_INLINE typename DynamicMatrix<Type,true>::IntrinsicType
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::store( size_t i, size_t j, const IntrinsicType& value )
+   DynamicMatrix<Type,true,AT>::store( size_t i, size_t j, const IntrinsicType& value )
 {
    using blaze::store;
 
@@ -4118,9 +4387,10 @@ BLAZE_ALWAYS_INLINE void
 // used internally for the performance optimized evaluation of expression templates. Calling
 // this function explicitly might result in erroneous results and/or in compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::storeu( size_t i, size_t j, const IntrinsicType& value )
+   DynamicMatrix<Type,true,AT>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
    using blaze::storeu;
 
@@ -4153,9 +4423,10 @@ BLAZE_ALWAYS_INLINE void
 // templates. Calling this function explicitly might result in erroneous results and/or in
 // compilation errors.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 BLAZE_ALWAYS_INLINE void
-   DynamicMatrix<Type,true>::stream( size_t i, size_t j, const IntrinsicType& value )
+   DynamicMatrix<Type,true,AT>::stream( size_t i, size_t j, const IntrinsicType& value )
 {
    using blaze::stream;
 
@@ -4184,10 +4455,11 @@ BLAZE_ALWAYS_INLINE void
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
-   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,true,AT>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   DynamicMatrix<Type,true,AT>::assign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4221,10 +4493,11 @@ inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vec
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
-   DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
+inline typename EnableIf< typename DynamicMatrix<Type,true,AT>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   DynamicMatrix<Type,true,AT>::assign( const DenseMatrix<MT,true>& rhs )
 {
    using blaze::store;
    using blaze::stream;
@@ -4275,9 +4548,10 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+inline void DynamicMatrix<Type,true,AT>::assign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4314,9 +4588,10 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void DynamicMatrix<Type,true,AT>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4341,9 +4616,10 @@ inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void DynamicMatrix<Type,true,AT>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4370,10 +4646,11 @@ inline void DynamicMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
-   DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,true,AT>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   DynamicMatrix<Type,true,AT>::addAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4422,10 +4699,11 @@ inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vec
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
-   DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+inline typename EnableIf< typename DynamicMatrix<Type,true,AT>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   DynamicMatrix<Type,true,AT>::addAssign( const DenseMatrix<MT,true>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -4476,9 +4754,10 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+inline void DynamicMatrix<Type,true,AT>::addAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4527,9 +4806,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,true>& rhs )
+inline void DynamicMatrix<Type,true,AT>::addAssign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4554,9 +4834,10 @@ inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,false>& rhs )
+inline void DynamicMatrix<Type,true,AT>::addAssign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4583,10 +4864,11 @@ inline void DynamicMatrix<Type,true>::addAssign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
-   DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+inline typename DisableIf< typename DynamicMatrix<Type,true,AT>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   DynamicMatrix<Type,true,AT>::subAssign( const DenseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4636,10 +4918,11 @@ inline typename DisableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vec
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
-   DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+inline typename EnableIf< typename DynamicMatrix<Type,true,AT>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   DynamicMatrix<Type,true,AT>::subAssign( const DenseMatrix<MT,true>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -4690,9 +4973,10 @@ inline typename EnableIf< typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE Vect
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+inline void DynamicMatrix<Type,true,AT>::subAssign( const DenseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4741,9 +5025,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,true>& rhs )
+inline void DynamicMatrix<Type,true,AT>::subAssign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4768,9 +5053,10 @@ inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,false>& rhs )
+inline void DynamicMatrix<Type,true,AT>::subAssign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4800,23 +5086,23 @@ inline void DynamicMatrix<Type,true>::subAssign( const SparseMatrix<MT,false>& r
 //*************************************************************************************************
 /*!\name DynamicMatrix operators */
 //@{
-template< typename Type, bool SO >
-inline void reset( DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename AT >
+inline void reset( DynamicMatrix<Type,SO,AT>& m );
 
-template< typename Type, bool SO >
-inline void reset( DynamicMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename AT >
+inline void reset( DynamicMatrix<Type,SO,AT>& m, size_t i );
 
-template< typename Type, bool SO >
-inline void clear( DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename AT >
+inline void clear( DynamicMatrix<Type,SO,AT>& m );
 
-template< typename Type, bool SO >
-inline bool isDefault( const DynamicMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename AT >
+inline bool isDefault( const DynamicMatrix<Type,SO,AT>& m );
 
-template< typename Type, bool SO >
-inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) /* throw() */;
+template< typename Type, bool SO, typename AT >
+inline void swap( DynamicMatrix<Type,SO,AT>& a, DynamicMatrix<Type,SO,AT>& b ) /* throw() */;
 
-template< typename Type, bool SO >
-inline void move( DynamicMatrix<Type,SO>& dst, DynamicMatrix<Type,SO>& src ) /* throw() */;
+template< typename Type, bool SO, typename AT >
+inline void move( DynamicMatrix<Type,SO,AT>& dst, DynamicMatrix<Type,SO,AT>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -4829,8 +5115,9 @@ inline void move( DynamicMatrix<Type,SO>& dst, DynamicMatrix<Type,SO>& src ) /*
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( DynamicMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void reset( DynamicMatrix<Type,SO,AT>& m )
 {
    m.reset();
 }
@@ -4851,8 +5138,9 @@ inline void reset( DynamicMatrix<Type,SO>& m )
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( DynamicMatrix<Type,SO>& m, size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void reset( DynamicMatrix<Type,SO,AT>& m, size_t i )
 {
    m.reset( i );
 }
@@ -4867,8 +5155,9 @@ inline void reset( DynamicMatrix<Type,SO>& m, size_t i )
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void clear( DynamicMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void clear( DynamicMatrix<Type,SO,AT>& m )
 {
    m.clear();
 }
@@ -4894,8 +5183,9 @@ inline void clear( DynamicMatrix<Type,SO>& m )
    \endcode
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const DynamicMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline bool isDefault( const DynamicMatrix<Type,SO,AT>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -4912,8 +5202,9 @@ inline bool isDefault( const DynamicMatrix<Type,SO>& m )
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) /* throw() */
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void swap( DynamicMatrix<Type,SO,AT>& a, DynamicMatrix<Type,SO,AT>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -4930,8 +5221,9 @@ inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) /* thro
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void move( DynamicMatrix<Type,SO>& dst, DynamicMatrix<Type,SO>& src ) /* throw() */
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void move( DynamicMatrix<Type,SO,AT>& dst, DynamicMatrix<Type,SO,AT>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -4948,8 +5240,8 @@ inline void move( DynamicMatrix<Type,SO>& dst, DynamicMatrix<Type,SO>& src ) /*
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct HasConstDataAccess< DynamicMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename A >
+struct HasConstDataAccess< DynamicMatrix<T,SO,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -4968,8 +5260,8 @@ struct HasConstDataAccess< DynamicMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct HasMutableDataAccess< DynamicMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename A >
+struct HasMutableDataAccess< DynamicMatrix<T,SO,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -4988,8 +5280,8 @@ struct HasMutableDataAccess< DynamicMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< DynamicMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename A >
+struct IsResizable< DynamicMatrix<T,SO,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -5008,62 +5300,62 @@ struct IsResizable< DynamicMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< DynamicMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct AddTrait< DynamicMatrix<T1,SO,A1>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct AddTrait< DynamicMatrix<T1,SO1,A1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< DynamicMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct AddTrait< DynamicMatrix<T1,SO,A1>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct AddTrait< DynamicMatrix<T1,SO1,A1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct AddTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
 };
@@ -5081,62 +5373,62 @@ struct AddTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< DynamicMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct SubTrait< DynamicMatrix<T1,SO,A1>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct SubTrait< DynamicMatrix<T1,SO1,A1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< DynamicMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct SubTrait< DynamicMatrix<T1,SO,A1>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct SubTrait< DynamicMatrix<T1,SO1,A1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, DynamicMatrix<T2,SO,A2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, false >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct SubTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
 };
@@ -5154,94 +5446,94 @@ struct SubTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, T2 >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< T1, DynamicMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A2 >
+struct MultTrait< T1, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< DynamicMatrix<T1,SO>, StaticVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, StaticVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< StaticVector<T1,N,true>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename A2 >
+struct MultTrait< StaticVector<T1,N,true>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< DynamicMatrix<T1,SO>, HybridVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, HybridVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< HybridVector<T1,N,true>, DynamicMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename A2 >
+struct MultTrait< HybridVector<T1,N,true>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, DynamicVector<T2,false,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A1, typename A2 >
+struct MultTrait< DynamicVector<T1,true,A1>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, CompressedVector<T2,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A2 >
+struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
@@ -5259,8 +5551,8 @@ struct MultTrait< DynamicMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct DivTrait< DynamicMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename A1 >
+struct DivTrait< DynamicMatrix<T1,SO,A1>, T2 >
 {
    typedef DynamicMatrix< typename DivTrait<T1,T2>::Type , SO >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
@@ -5279,8 +5571,8 @@ struct DivTrait< DynamicMatrix<T1,SO>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MathTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct MathTrait< DynamicMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
    typedef DynamicMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
@@ -5299,10 +5591,10 @@ struct MathTrait< DynamicMatrix<T1,SO>, DynamicMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct SubmatrixTrait< DynamicMatrix<T1,SO> >
+template< typename T1, bool SO, typename A1 >
+struct SubmatrixTrait< DynamicMatrix<T1,SO,A1> >
 {
-   typedef DynamicMatrix<T1,SO>  Type;
+   typedef DynamicMatrix<T1,SO,A1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5318,10 +5610,10 @@ struct SubmatrixTrait< DynamicMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct RowTrait< DynamicMatrix<T1,SO> >
+template< typename T1, bool SO, typename A1 >
+struct RowTrait< DynamicMatrix<T1,SO,A1> >
 {
-   typedef DynamicVector<T1,true>  Type;
+   typedef DynamicVector<T1,true,A1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5337,10 +5629,10 @@ struct RowTrait< DynamicMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct ColumnTrait< DynamicMatrix<T1,SO> >
+template< typename T1, bool SO, typename A1 >
+struct ColumnTrait< DynamicMatrix<T1,SO,A1> >
 {
-   typedef DynamicVector<T1,false>  Type;
+   typedef DynamicVector<T1,false,A1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
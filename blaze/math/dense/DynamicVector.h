@@ -68,6 +68,7 @@
 #include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -102,11 +103,12 @@ namespace blaze {
 // \ingroup dynamic_vector
 //
 // The DynamicVector class template is the representation of an arbitrary sized vector with
-// dynamically allocated elements of arbitrary type. The type of the elements and the transpose
-// flag of the vector can be specified via the two template parameters:
+// dynamically allocated elements of arbitrary type. The type of the elements, the transpose
+// flag of the vector, and the allocator of the elements can be specified via the three template
+// parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename AT >
    class DynamicVector;
    \endcode
 
@@ -114,6 +116,10 @@ namespace blaze {
 //          non-cv-qualified, non-reference, non-pointer element type.
 //  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
 //          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - AT  : specifies the allocator of the vector elements. The allocator has to model the
+//          allocator concept of the standard library and has to provide memory that is aligned
+//          according to the alignment restrictions of the element type. The default value is
+//          blaze::AlignedAllocator.
 //
 // These contiguously stored elements can be directly accessed with the subscript operator. The
 // numbering of the vector elements is
@@ -159,8 +165,9 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
-class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename AT >                     // Type of the allocator
+class DynamicVector : public DenseVector< DynamicVector<Type,TF,AT>, TF >
 {
  private:
    //**Type definitions****************************************************************************
@@ -169,9 +176,9 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
 
  public:
    //**Type definitions****************************************************************************
-   typedef DynamicVector<Type,TF>     This;            //!< Type of this DynamicVector instance.
+   typedef DynamicVector<Type,TF,AT>   This;            //!< Type of this DynamicVector instance.
    typedef This                       ResultType;      //!< Result type for expression template evaluations.
-   typedef DynamicVector<Type,!TF>    TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef DynamicVector<Type,!TF,AT>  TransposeType;   //!< Transpose type for expression template evaluations.
    typedef Type                       ElementType;     //!< Type of the vector elements.
    typedef typename IT::Type          IntrinsicType;   //!< Intrinsic type of the vector elements.
    typedef const Type&                ReturnType;      //!< Return type for expression template evaluations
@@ -182,6 +189,7 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    typedef const Type*                ConstPointer;    //!< Pointer to a constant vector value.
    typedef DenseIterator<Type>        Iterator;        //!< Iterator over non-constant elements.
    typedef DenseIterator<const Type>  ConstIterator;   //!< Iterator over constant elements.
+   typedef AT                         AllocatorType;   //!< Type of the allocator of the vector elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -189,7 +197,8 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    */
    template< typename ET >  // Data type of the other vector
    struct Rebind {
-      typedef DynamicVector<ET,TF>  Other;  //!< The type of the other DynamicVector.
+      typedef typename AT::BLAZE_TEMPLATE rebind<ET>::other  OtherAllocator;  //!< Allocator type of the other DynamicVector.
+      typedef DynamicVector<ET,TF,OtherAllocator>            Other;           //!< The type of the other DynamicVector.
    };
    //**********************************************************************************************
 
@@ -212,8 +221,9 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    /*!\name Constructors */
    //@{
                               explicit inline DynamicVector();
-                              explicit inline DynamicVector( size_t n );
-                              explicit inline DynamicVector( size_t n, const Type& init );
+                              explicit inline DynamicVector( const AT& alloc );
+                              explicit inline DynamicVector( size_t n, const AT& alloc = AT() );
+                              explicit inline DynamicVector( size_t n, const Type& init, const AT& alloc = AT() );
    template< typename Other > explicit inline DynamicVector( size_t n, const Other* array );
 
    template< typename Other, size_t N >
@@ -275,6 +285,7 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    //@{
                               inline size_t         size() const;
                               inline size_t         capacity() const;
+                              inline AT             getAllocator() const;
                               inline size_t         nonZeros() const;
                               inline void           reset();
                               inline void           clear();
@@ -401,11 +412,37 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
    //@}
    //**********************************************************************************************
 
+   //**struct Memory******************************************************************************
+   /*!\brief The allocator of the vector elements and the maximum capacity of the vector.
+   //
+   // The allocator is stored as base class in order to exploit the empty base optimization,
+   // i.e. a stateless allocator does not increase the size of the vector.
+   */
+   struct Memory : public AT
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the allocator and the capacity.
+      //
+      // \param alloc The allocator of the vector elements.
+      // \param capacity The maximum capacity of the vector.
+      */
+      explicit inline Memory( const AT& alloc, size_t capacity )
+         : AT       ( alloc    )  // The allocator of the vector elements
+         , capacity_( capacity )  // The maximum capacity of the vector
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t capacity_;  //!< The maximum capacity of the vector.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    size_t size_;             //!< The current size/dimension of the vector.
-   size_t capacity_;         //!< The maximum capacity of the vector.
+   Memory alloc_;            //!< The allocator and the maximum capacity of the vector.
    Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated vector elements.
                              /*!< Access to the vector elements is gained via the subscript operator.
                                   The order of the elements is
@@ -439,11 +476,28 @@ class DynamicVector : public DenseVector< DynamicVector<Type,TF>, TF >
 /*!\brief The default constructor for DynamicVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector()
-   : size_    ( 0UL )   // The current size/dimension of the vector
-   , capacity_( 0UL )   // The maximum capacity of the vector
-   , v_       ( NULL )  // The vector elements
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>::DynamicVector()
+   : size_    ( 0UL )        // The current size/dimension of the vector
+   , alloc_   ( AT(), 0UL )  // The allocator and capacity of the vector
+   , v_       ( NULL )       // The vector elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty vector using the given allocator.
+//
+// \param alloc The allocator for the vector elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>::DynamicVector( const AT& alloc )
+   : size_    ( 0UL )         // The current size/dimension of the vector
+   , alloc_   ( alloc, 0UL )  // The allocator and capacity of the vector
+   , v_       ( NULL )        // The vector elements
 {}
 //*************************************************************************************************
 
@@ -452,19 +506,21 @@ inline DynamicVector<Type,TF>::DynamicVector()
 /*!\brief Constructor for a vector of size \a n. No element initialization is performed!
 //
 // \param n The size of the vector.
+// \param alloc The allocator for the vector elements.
 //
 // \b Note: This constructor is only responsible to allocate the required dynamic memory. No
 //          element initialization is performed!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( size_t n )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>::DynamicVector( size_t n, const AT& alloc )
+   : size_    ( n )                                          // The current size/dimension of the vector
+   , alloc_   ( alloc, adjustCapacity( n ) )                 // The allocator and capacity of the vector
+   , v_       ( allocate<Type>( alloc, alloc_.capacity_ ) )  // The vector elements
 {
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=size_; i<capacity_; ++i )
+      for( size_t i=size_; i<alloc_.capacity_; ++i )
          v_[i] = Type();
    }
 }
@@ -476,21 +532,23 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 //
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
+// \param alloc The allocator for the vector elements.
 //
 // All vector elements are initialized with the specified value.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>::DynamicVector( size_t n, const Type& init, const AT& alloc )
+   : size_    ( n )                                          // The current size/dimension of the vector
+   , alloc_   ( alloc, adjustCapacity( n ) )                 // The allocator and capacity of the vector
+   , v_       ( allocate<Type>( alloc, alloc_.capacity_ ) )  // The vector elements
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = init;
 
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=size_; i<capacity_; ++i )
+      for( size_t i=size_; i<alloc_.capacity_; ++i )
          v_[i] = Type();
    }
 }
@@ -518,18 +576,19 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
 // \a n elements. Providing an array with less elements results in undefined behavior!
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the initialization array
-inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+inline DynamicVector<Type,TF,AT>::DynamicVector( size_t n, const Other* array )
+   : size_    ( n )                                         // The current size/dimension of the vector
+   , alloc_   ( AT(), adjustCapacity( n ) )                 // The allocator and capacity of the vector
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The vector elements
 {
    for( size_t i=0UL; i<n; ++i )
       v_[i] = array[i];
 
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=n; i<capacity_; ++i )
+      for( size_t i=n; i<alloc_.capacity_; ++i )
          v_[i] = Type();
    }
 }
@@ -554,19 +613,20 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
 // the example).
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename AT >   // Type of the allocator
 template< typename Other  // Data type of the initialization array
         , size_t N >      // Dimension of the initialization array
-inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
-   : size_    ( N )                            // The current size/dimension of the vector
-   , capacity_( adjustCapacity( N ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+inline DynamicVector<Type,TF,AT>::DynamicVector( const Other (&array)[N] )
+   : size_    ( N )                                         // The current size/dimension of the vector
+   , alloc_   ( AT(), adjustCapacity( N ) )                 // The allocator and capacity of the vector
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The vector elements
 {
    for( size_t i=0UL; i<N; ++i )
       v_[i] = array[i];
 
    if( IsVectorizable<Type>::value ) {
-      for( size_t i=N; i<capacity_; ++i )
+      for( size_t i=N; i<alloc_.capacity_; ++i )
          v_[i] = Type();
    }
 }
@@ -582,15 +642,16 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[N] )
 // and in order to enable/facilitate NRV optimization.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
-   : size_    ( v.size_ )                      // The current size/dimension of the vector
-   , capacity_( adjustCapacity( v.size_ ) )    // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>::DynamicVector( const DynamicVector& v )
+   : size_    ( v.size_ )                                       // The current size/dimension of the vector
+   , alloc_   ( v.alloc_, adjustCapacity( v.size_ ) )           // The allocator and capacity of the vector
+   , v_       ( allocate<Type>( v.alloc_, alloc_.capacity_ ) )  // The vector elements
 {
-   BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
+   BLAZE_INTERNAL_ASSERT( alloc_.capacity_ <= v.alloc_.capacity_, "Invalid capacity estimation" );
 
-   for( size_t i=0UL; i<capacity_; ++i )
+   for( size_t i=0UL; i<alloc_.capacity_; ++i )
       v_[i] = v.v_[i];
 }
 //*************************************************************************************************
@@ -602,15 +663,16 @@ inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
 // \param v Vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the foreign vector
-inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
-   : size_    ( (~v).size() )                  // The current size/dimension of the vector
-   , capacity_( adjustCapacity( size_ ) )      // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+inline DynamicVector<Type,TF,AT>::DynamicVector( const Vector<VT,TF>& v )
+   : size_    ( (~v).size() )                               // The current size/dimension of the vector
+   , alloc_   ( AT(), adjustCapacity( size_ ) )             // The allocator and capacity of the vector
+   , v_       ( allocate<Type>( AT(), alloc_.capacity_ ) )  // The vector elements
 {
    for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
-               i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
+               i<( IsVectorizable<Type>::value ? alloc_.capacity_ : size_ ); ++i ) {
       v_[i] = Type();
    }
 
@@ -631,10 +693,11 @@ inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
 /*!\brief The destructor for DynamicVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>::~DynamicVector()
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>::~DynamicVector()
 {
-   deallocate( v_ );
+   deallocate( alloc_, v_, alloc_.capacity_ );
 }
 //*************************************************************************************************
 
@@ -654,9 +717,10 @@ inline DynamicVector<Type,TF>::~DynamicVector()
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Reference
-   DynamicVector<Type,TF>::operator[]( size_t index )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::Reference
+   DynamicVector<Type,TF,AT>::operator[]( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
    return v_[index];
@@ -671,9 +735,10 @@ inline typename DynamicVector<Type,TF>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstReference
-   DynamicVector<Type,TF>::operator[]( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::ConstReference
+   DynamicVector<Type,TF,AT>::operator[]( size_t index ) const
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid vector access index" );
    return v_[index];
@@ -689,8 +754,9 @@ inline typename DynamicVector<Type,TF>::ConstReference
 // This function returns a pointer to the internal storage of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Pointer DynamicVector<Type,TF>::data()
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::Pointer DynamicVector<Type,TF,AT>::data()
 {
    return v_;
 }
@@ -705,8 +771,9 @@ inline typename DynamicVector<Type,TF>::Pointer DynamicVector<Type,TF>::data()
 // This function returns a pointer to the internal storage of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstPointer DynamicVector<Type,TF>::data() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::ConstPointer DynamicVector<Type,TF,AT>::data() const
 {
    return v_;
 }
@@ -719,8 +786,9 @@ inline typename DynamicVector<Type,TF>::ConstPointer DynamicVector<Type,TF>::dat
 // \return Iterator to the first element of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::begin()
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::Iterator DynamicVector<Type,TF,AT>::begin()
 {
    return Iterator( v_ );
 }
@@ -733,8 +801,9 @@ inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::begin()
 // \return Iterator to the first element of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::begin() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::ConstIterator DynamicVector<Type,TF,AT>::begin() const
 {
    return ConstIterator( v_ );
 }
@@ -747,8 +816,9 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::be
 // \return Iterator to the first element of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cbegin() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::ConstIterator DynamicVector<Type,TF,AT>::cbegin() const
 {
    return ConstIterator( v_ );
 }
@@ -761,8 +831,9 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cb
 // \return Iterator just past the last element of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::end()
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::Iterator DynamicVector<Type,TF,AT>::end()
 {
    return Iterator( v_ + size_ );
 }
@@ -775,8 +846,9 @@ inline typename DynamicVector<Type,TF>::Iterator DynamicVector<Type,TF>::end()
 // \return Iterator just past the last element of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::end() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::ConstIterator DynamicVector<Type,TF,AT>::end() const
 {
    return ConstIterator( v_ + size_ );
 }
@@ -789,8 +861,9 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::en
 // \return Iterator just past the last element of the dynamic vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::cend() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline typename DynamicVector<Type,TF,AT>::ConstIterator DynamicVector<Type,TF,AT>::cend() const
 {
    return ConstIterator( v_ + size_ );
 }
@@ -824,10 +897,11 @@ inline typename DynamicVector<Type,TF>::ConstIterator DynamicVector<Type,TF>::ce
 // example).
 */
 template< typename Type   // Data type of the vector
-        , bool TF >       // Transpose flag
+        , bool TF         // Transpose flag
+        , typename AT >   // Type of the allocator
 template< typename Other  // Data type of the initialization array
         , size_t N >      // Dimension of the initialization array
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&array)[N] )
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator=( const Other (&array)[N] )
 {
    resize( N, false );
 
@@ -846,8 +920,9 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Other (&
 // \return Reference to the assigned vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rhs )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator=( const Type& rhs )
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = rhs;
@@ -866,8 +941,9 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Type& rh
 // copy of this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicVector& rhs )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator=( const DynamicVector& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -888,12 +964,14 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const DynamicV
 // The vector is resized according to the given vector and initialized as a copy of this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<VT,TF>& rhs )
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).canAlias( this ) ) {
-      DynamicVector tmp( ~rhs );
+      DynamicVector tmp( alloc_ );
+      tmp = ~rhs;
       swap( tmp );
    }
    else {
@@ -919,9 +997,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator=( const Vector<V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator+=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
@@ -951,9 +1030,10 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator+=( const Vector<
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator-=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
@@ -983,15 +1063,17 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator-=( const Vector<
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side vector
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<VT,TF>& rhs )
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::operator*=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
    if( (~rhs).canAlias( this ) || IsSparseVector<VT>::value ) {
-      DynamicVector<Type,TF> tmp( *this * (~rhs) );
+      DynamicVector<Type,TF,AT> tmp( alloc_ );
+      tmp = *this * (~rhs);
       swap( tmp );
    }
    else {
@@ -1011,10 +1093,11 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::operator*=( const Vector<
 // \return Reference to the vector.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF> >::Type&
-   DynamicVector<Type,TF>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF,AT> >::Type&
+   DynamicVector<Type,TF,AT>::operator*=( Other rhs )
 {
    smpAssign( *this, (*this) * rhs );
    return *this;
@@ -1032,10 +1115,11 @@ inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF> >::Type&
 // \b Note: A division by zero is only checked by an user assert.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF> >::Type&
-   DynamicVector<Type,TF>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF,AT> >::Type&
+   DynamicVector<Type,TF,AT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -1059,8 +1143,9 @@ inline typename EnableIf< IsNumeric<Other>, DynamicVector<Type,TF> >::Type&
 // \return The size of the vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::size() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,AT>::size() const
 {
    return size_;
 }
@@ -1073,10 +1158,26 @@ inline size_t DynamicVector<Type,TF>::size() const
 // \return The capacity of the vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::capacity() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,AT>::capacity() const
+{
+   return alloc_.capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the allocator of the vector elements.
+//
+// \return The allocator of the vector elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline AT DynamicVector<Type,TF,AT>::getAllocator() const
 {
-   return capacity_;
+   return alloc_;
 }
 //*************************************************************************************************
 
@@ -1090,8 +1191,9 @@ inline size_t DynamicVector<Type,TF>::capacity() const
 // of the vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::nonZeros() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,AT>::nonZeros() const
 {
    size_t nonzeros( 0 );
 
@@ -1111,8 +1213,9 @@ inline size_t DynamicVector<Type,TF>::nonZeros() const
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::reset()
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void DynamicVector<Type,TF,AT>::reset()
 {
    using blaze::clear;
    for( size_t i=0UL; i<size_; ++i )
@@ -1129,8 +1232,9 @@ inline void DynamicVector<Type,TF>::reset()
 // After the clear() function, the size of the vector is 0.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::clear()
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void DynamicVector<Type,TF,AT>::clear()
 {
    resize( 0UL, false );
 }
@@ -1167,14 +1271,15 @@ inline void DynamicVector<Type,TF>::clear()
                               \f]
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void DynamicVector<Type,TF,AT>::resize( size_t n, bool preserve )
 {
-   if( n > capacity_ )
+   if( n > alloc_.capacity_ )
    {
       // Allocating a new array
       const size_t newCapacity( adjustCapacity( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( alloc_, newCapacity );
 
       // Initializing the new array
       if( preserve ) {
@@ -1188,8 +1293,8 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 
       // Replacing the old array
       std::swap( v_, tmp );
-      deallocate( tmp );
-      capacity_ = newCapacity;
+      deallocate( alloc_, tmp, alloc_.capacity_ );
+      alloc_.capacity_ = newCapacity;
    }
    else if( IsVectorizable<Type>::value && n < size_ )
    {
@@ -1215,8 +1320,9 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
 // the \a preserve flag can be set to \a true. However, new vector elements are not initialized!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::extend( size_t n, bool preserve )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void DynamicVector<Type,TF,AT>::extend( size_t n, bool preserve )
 {
    resize( size_+n, preserve );
 }
@@ -1233,14 +1339,15 @@ inline void DynamicVector<Type,TF>::extend( size_t n, bool preserve )
 // values of the vector elements are preserved.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::reserve( size_t n )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void DynamicVector<Type,TF,AT>::reserve( size_t n )
 {
-   if( n > capacity_ )
+   if( n > alloc_.capacity_ )
    {
       // Allocating a new array
       const size_t newCapacity( adjustCapacity( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( alloc_, newCapacity );
 
       // Initializing the new array
       std::copy( v_, v_+size_, tmp );
@@ -1252,8 +1359,8 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 
       // Replacing the old array
       std::swap( tmp, v_ );
-      deallocate( tmp );
-      capacity_ = newCapacity;
+      deallocate( alloc_, tmp, alloc_.capacity_ );
+      alloc_.capacity_ = newCapacity;
    }
 }
 //*************************************************************************************************
@@ -1266,9 +1373,10 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
 // \return Reference to the vector.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scalar )
+inline DynamicVector<Type,TF,AT>& DynamicVector<Type,TF,AT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] *= scalar;
@@ -1285,11 +1393,12 @@ inline DynamicVector<Type,TF>& DynamicVector<Type,TF>::scale( const Other& scala
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) /* throw() */
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void DynamicVector<Type,TF,AT>::swap( DynamicVector& v ) /* throw() */
 {
    std::swap( size_, v.size_ );
-   std::swap( capacity_, v.capacity_ );
+   std::swap( alloc_, v.alloc_ );
    std::swap( v_, v.v_ );
 }
 //*************************************************************************************************
@@ -1302,8 +1411,9 @@ inline void DynamicVector<Type,TF>::swap( DynamicVector& v ) /* throw() */
 // \return The new capacity.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t DynamicVector<Type,TF>::adjustCapacity( size_t minCapacity ) const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline size_t DynamicVector<Type,TF,AT>::adjustCapacity( size_t minCapacity ) const
 {
    if( IsVectorizable<Type>::value )
       return minCapacity + ( IT::size - ( minCapacity % IT::size ) ) % IT::size;
@@ -1331,9 +1441,10 @@ inline size_t DynamicVector<Type,TF>::adjustCapacity( size_t minCapacity ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicVector<Type,TF>::canAlias( const Other* alias ) const
+inline bool DynamicVector<Type,TF,AT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1351,9 +1462,10 @@ inline bool DynamicVector<Type,TF>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool DynamicVector<Type,TF>::isAliased( const Other* alias ) const
+inline bool DynamicVector<Type,TF,AT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1370,8 +1482,9 @@ inline bool DynamicVector<Type,TF>::isAliased( const Other* alias ) const
 // restrictions of the element type \a Type.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::isAligned() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline bool DynamicVector<Type,TF,AT>::isAligned() const
 {
    return true;
 }
@@ -1389,8 +1502,9 @@ inline bool DynamicVector<Type,TF>::isAligned() const
 // vector).
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool DynamicVector<Type,TF>::canSMPAssign() const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline bool DynamicVector<Type,TF,AT>::canSMPAssign() const
 {
    return ( size() > SMP_DVECASSIGN_THRESHOLD );
 }
@@ -1411,16 +1525,17 @@ inline bool DynamicVector<Type,TF>::canSMPAssign() const
 // compilation errors.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::IntrinsicType
-   DynamicVector<Type,TF>::load( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,AT>::IntrinsicType
+   DynamicVector<Type,TF,AT>::load( size_t index ) const
 {
    using blaze::load;
 
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
    BLAZE_INTERNAL_ASSERT( index            <  size_    , "Invalid vector access index" );
-   BLAZE_INTERNAL_ASSERT( index + IT::size <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + IT::size <= alloc_.capacity_, "Invalid vector access index" );
    BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL      , "Invalid vector access index" );
 
    return load( v_+index );
@@ -1442,16 +1557,17 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::IntrinsicType
 // compilation errors.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::IntrinsicType
-   DynamicVector<Type,TF>::loadu( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF,AT>::IntrinsicType
+   DynamicVector<Type,TF,AT>::loadu( size_t index ) const
 {
    using blaze::loadu;
 
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
    BLAZE_INTERNAL_ASSERT( index            <  size_    , "Invalid vector access index" );
-   BLAZE_INTERNAL_ASSERT( index + IT::size <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + IT::size <= alloc_.capacity_, "Invalid vector access index" );
 
    return loadu( v_+index );
 }
@@ -1473,15 +1589,16 @@ BLAZE_ALWAYS_INLINE typename DynamicVector<Type,TF>::IntrinsicType
 // compilation errors.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF>::store( size_t index, const IntrinsicType& value )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF,AT>::store( size_t index, const IntrinsicType& value )
 {
    using blaze::store;
 
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
    BLAZE_INTERNAL_ASSERT( index            <  size_    , "Invalid vector access index" );
-   BLAZE_INTERNAL_ASSERT( index + IT::size <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + IT::size <= alloc_.capacity_, "Invalid vector access index" );
    BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL      , "Invalid vector access index" );
 
    store( v_+index, value );
@@ -1504,15 +1621,16 @@ BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF>::store( size_t index, const Intr
 // errors.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF>::storeu( size_t index, const IntrinsicType& value )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF,AT>::storeu( size_t index, const IntrinsicType& value )
 {
    using blaze::storeu;
 
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
    BLAZE_INTERNAL_ASSERT( index            <  size_    , "Invalid vector access index" );
-   BLAZE_INTERNAL_ASSERT( index + IT::size <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + IT::size <= alloc_.capacity_, "Invalid vector access index" );
 
    storeu( v_+index, value );
 }
@@ -1534,15 +1652,16 @@ BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF>::storeu( size_t index, const Int
 // and/or in compilation errors.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF>::stream( size_t index, const IntrinsicType& value )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF,AT>::stream( size_t index, const IntrinsicType& value )
 {
    using blaze::stream;
 
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
 
    BLAZE_INTERNAL_ASSERT( index            <  size_    , "Invalid vector access index" );
-   BLAZE_INTERNAL_ASSERT( index + IT::size <= capacity_, "Invalid vector access index" );
+   BLAZE_INTERNAL_ASSERT( index + IT::size <= alloc_.capacity_, "Invalid vector access index" );
    BLAZE_INTERNAL_ASSERT( index % IT::size == 0UL      , "Invalid vector access index" );
 
    stream( v_+index, value );
@@ -1562,10 +1681,11 @@ BLAZE_ALWAYS_INLINE void DynamicVector<Type,TF>::stream( size_t index, const Int
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >::Type
-   DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+inline typename DisableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1594,10 +1714,11 @@ inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAssign<VT> >::Type
-   DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+inline typename EnableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::assign( const DenseVector<VT,TF>& rhs )
 {
    using blaze::store;
    using blaze::stream;
@@ -1644,9 +1765,10 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+inline void DynamicVector<Type,TF,AT>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1668,10 +1790,11 @@ inline void DynamicVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >::Type
-   DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+inline typename DisableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1700,10 +1823,11 @@ inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >::Type
-   DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+inline typename EnableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedAddAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -1741,9 +1865,10 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+inline void DynamicVector<Type,TF,AT>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1765,10 +1890,11 @@ inline void DynamicVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >::Type
-   DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+inline typename DisableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1797,10 +1923,11 @@ inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >::Type
-   DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+inline typename EnableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedSubAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -1838,9 +1965,10 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+inline void DynamicVector<Type,TF,AT>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1862,10 +1990,11 @@ inline void DynamicVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >::Type
-   DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+inline typename DisableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::multAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1894,10 +2023,11 @@ inline typename DisableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vecto
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side dense vector
-inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >::Type
-   DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+inline typename EnableIf< typename DynamicVector<Type,TF,AT>::BLAZE_TEMPLATE VectorizedMultAssign<VT> >::Type
+   DynamicVector<Type,TF,AT>::multAssign( const DenseVector<VT,TF>& rhs )
 {
    using blaze::load;
    using blaze::store;
@@ -1935,9 +2065,10 @@ inline typename EnableIf< typename DynamicVector<Type,TF>::BLAZE_TEMPLATE Vector
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void DynamicVector<Type,TF>::multAssign( const SparseVector<VT,TF>& rhs )
+inline void DynamicVector<Type,TF,AT>::multAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1962,20 +2093,20 @@ inline void DynamicVector<Type,TF>::multAssign( const SparseVector<VT,TF>& rhs )
 //*************************************************************************************************
 /*!\name DynamicVector operators */
 //@{
-template< typename Type, bool TF >
-inline void reset( DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename AT >
+inline void reset( DynamicVector<Type,TF,AT>& v );
 
-template< typename Type, bool TF >
-inline void clear( DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename AT >
+inline void clear( DynamicVector<Type,TF,AT>& v );
 
-template< typename Type, bool TF >
-inline bool isDefault( const DynamicVector<Type,TF>& v );
+template< typename Type, bool TF, typename AT >
+inline bool isDefault( const DynamicVector<Type,TF,AT>& v );
 
-template< typename Type, bool TF >
-inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) /* throw() */;
+template< typename Type, bool TF, typename AT >
+inline void swap( DynamicVector<Type,TF,AT>& a, DynamicVector<Type,TF,AT>& b ) /* throw() */;
 
-template< typename Type, bool TF >
-inline void move( DynamicVector<Type,TF>& dst, DynamicVector<Type,TF>& src ) /* throw() */;
+template< typename Type, bool TF, typename AT >
+inline void move( DynamicVector<Type,TF,AT>& dst, DynamicVector<Type,TF,AT>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -1988,8 +2119,9 @@ inline void move( DynamicVector<Type,TF>& dst, DynamicVector<Type,TF>& src ) /*
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( DynamicVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void reset( DynamicVector<Type,TF,AT>& v )
 {
    v.reset();
 }
@@ -2004,8 +2136,9 @@ inline void reset( DynamicVector<Type,TF>& v )
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( DynamicVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void clear( DynamicVector<Type,TF,AT>& v )
 {
    v.clear();
 }
@@ -2030,8 +2163,9 @@ inline void clear( DynamicVector<Type,TF>& v )
    \endcode
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const DynamicVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline bool isDefault( const DynamicVector<Type,TF,AT>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -2048,8 +2182,9 @@ inline bool isDefault( const DynamicVector<Type,TF>& v )
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) /* throw() */
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void swap( DynamicVector<Type,TF,AT>& a, DynamicVector<Type,TF,AT>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -2066,8 +2201,9 @@ inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) /* thro
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void move( DynamicVector<Type,TF>& dst, DynamicVector<Type,TF>& src ) /* throw() */
+        , bool TF        // Transpose flag
+        , typename AT >  // Type of the allocator
+inline void move( DynamicVector<Type,TF,AT>& dst, DynamicVector<Type,TF,AT>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -2084,8 +2220,8 @@ inline void move( DynamicVector<Type,TF>& dst, DynamicVector<Type,TF>& src ) /*
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct HasConstDataAccess< DynamicVector<T,TF> > : public TrueType
+template< typename T, bool TF, typename A >
+struct HasConstDataAccess< DynamicVector<T,TF,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -2104,8 +2240,8 @@ struct HasConstDataAccess< DynamicVector<T,TF> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct HasMutableDataAccess< DynamicVector<T,TF> > : public TrueType
+template< typename T, bool TF, typename A >
+struct HasMutableDataAccess< DynamicVector<T,TF,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -2124,8 +2260,8 @@ struct HasMutableDataAccess< DynamicVector<T,TF> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< DynamicVector<T,TF> > : public TrueType
+template< typename T, bool TF, typename A >
+struct IsResizable< DynamicVector<T,TF,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -2144,32 +2280,32 @@ struct IsResizable< DynamicVector<T,TF> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename A1 >
+struct AddTrait< DynamicVector<T1,TF,A1>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A2 >
+struct AddTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename A1 >
+struct AddTrait< DynamicVector<T1,TF,A1>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A2 >
+struct AddTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1, typename A2 >
+struct AddTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
@@ -2187,32 +2323,32 @@ struct AddTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename A1 >
+struct SubTrait< DynamicVector<T1,TF,A1>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A2 >
+struct SubTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename A1 >
+struct SubTrait< DynamicVector<T1,TF,A1>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A2 >
+struct SubTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1, typename A2 >
+struct SubTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
@@ -2230,106 +2366,106 @@ struct SubTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, T2 >
+template< typename T1, bool TF, typename T2, typename A1 >
+struct MultTrait< DynamicVector<T1,TF,A1>, T2 >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, TF >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool TF >
-struct MultTrait< T1, DynamicVector<T2,TF> >
+template< typename T1, typename T2, bool TF, typename A2 >
+struct MultTrait< T1, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, TF >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicVector<T1,TF,A1>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename MultTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,false>, StaticVector<T2,N,true> >
+template< typename T1, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicVector<T1,false,A1>, StaticVector<T2,N,true> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,true>, StaticVector<T2,N,false> >
+template< typename T1, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, StaticVector<T2,N,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A2 >
+struct MultTrait< StaticVector<T1,N,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef StaticVector< typename MultTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,false>, DynamicVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename A2 >
+struct MultTrait< StaticVector<T1,N,false>, DynamicVector<T2,true,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,true>, DynamicVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename A2 >
+struct MultTrait< StaticVector<T1,N,true>, DynamicVector<T2,false,A2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicVector<T1,TF,A1>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename MultTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,false>, HybridVector<T2,N,true> >
+template< typename T1, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicVector<T1,false,A1>, HybridVector<T2,N,true> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< DynamicVector<T1,true>, HybridVector<T2,N,false> >
+template< typename T1, typename T2, size_t N, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, HybridVector<T2,N,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename A2 >
+struct MultTrait< HybridVector<T1,N,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef HybridVector< typename MultTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,false>, DynamicVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename A2 >
+struct MultTrait< HybridVector<T1,N,false>, DynamicVector<T2,true,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,true>, DynamicVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename A2 >
+struct MultTrait< HybridVector<T1,N,true>, DynamicVector<T2,false,A2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1, typename A2 >
+struct MultTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,false>, DynamicVector<T2,true> >
+template< typename T1, typename T2, typename A1, typename A2 >
+struct MultTrait< DynamicVector<T1,false,A1>, DynamicVector<T2,true,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,true>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename A1, typename A2 >
+struct MultTrait< DynamicVector<T1,true,A1>, DynamicVector<T2,false,A2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
@@ -2347,8 +2483,8 @@ struct MultTrait< DynamicVector<T1,true>, DynamicVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, typename T2 >
-struct CrossTrait< DynamicVector<T1,false>, StaticVector<T2,3UL,false> >
+template< typename T1, typename T2, typename A1 >
+struct CrossTrait< DynamicVector<T1,false,A1>, StaticVector<T2,3UL,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2357,8 +2493,8 @@ struct CrossTrait< DynamicVector<T1,false>, StaticVector<T2,3UL,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< StaticVector<T1,3UL,false>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename A2 >
+struct CrossTrait< StaticVector<T1,3UL,false>, DynamicVector<T2,false,A2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2367,8 +2503,8 @@ struct CrossTrait< StaticVector<T1,3UL,false>, DynamicVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct CrossTrait< DynamicVector<T1,false>, HybridVector<T2,N,false> >
+template< typename T1, typename T2, size_t N, typename A1 >
+struct CrossTrait< DynamicVector<T1,false,A1>, HybridVector<T2,N,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2377,8 +2513,8 @@ struct CrossTrait< DynamicVector<T1,false>, HybridVector<T2,N,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct CrossTrait< HybridVector<T1,N,false>, DynamicVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename A2 >
+struct CrossTrait< HybridVector<T1,N,false>, DynamicVector<T2,false,A2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2387,8 +2523,8 @@ struct CrossTrait< HybridVector<T1,N,false>, DynamicVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< DynamicVector<T1,false>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename A1, typename A2 >
+struct CrossTrait< DynamicVector<T1,false,A1>, DynamicVector<T2,false,A2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2410,8 +2546,8 @@ struct CrossTrait< DynamicVector<T1,false>, DynamicVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< DynamicVector<T1,TF>, T2 >
+template< typename T1, bool TF, typename T2, typename A1 >
+struct DivTrait< DynamicVector<T1,TF,A1>, T2 >
 {
    typedef DynamicVector< typename DivTrait<T1,T2>::Type, TF >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
@@ -2430,8 +2566,8 @@ struct DivTrait< DynamicVector<T1,TF>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MathTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1, typename A2 >
+struct MathTrait< DynamicVector<T1,TF,A1>, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename MathTrait<T1,T2>::HighType, TF >  HighType;
    typedef DynamicVector< typename MathTrait<T1,T2>::LowType , TF >  LowType;
@@ -2450,10 +2586,10 @@ struct MathTrait< DynamicVector<T1,TF>, DynamicVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF >
-struct SubvectorTrait< DynamicVector<T1,TF> >
+template< typename T1, bool TF, typename A1 >
+struct SubvectorTrait< DynamicVector<T1,TF,A1> >
 {
-   typedef DynamicVector<T1,TF>  Type;
+   typedef DynamicVector<T1,TF,A1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/PackedStructure.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Types.h>
 
 
@@ -51,10 +53,13 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class DynamicVector;
-template< typename, bool > class DynamicMatrix;
+template< typename, bool, bool, bool > class CustomMatrix;
+template< typename, bool, bool, bool > class CustomVector;
+template< typename T, bool, typename = AlignedAllocator<T> > class DynamicVector;
+template< typename T, bool, typename = AlignedAllocator<T> > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, PackedStructure, bool > class PackedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 
@@ -0,0 +1,732 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/OutOfCoreMatrix.h
+//  \brief Header file for the implementation of an out-of-core dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_OUTOFCOREMATRIX_H_
+#define _BLAZE_MATH_DENSE_OUTOFCOREMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  include <fcntl.h>
+#  include <io.h>
+#  include <sys/stat.h>
+#else
+#  include <fcntl.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <stdexcept>
+#include <string>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/MappedFile.h>
+#include <blaze/math/views/AlignmentFlag.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup out_of_core_matrix OutOfCoreMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Disk-resident dense matrix that is processed tile by tile.
+// \ingroup out_of_core_matrix
+//
+// The OutOfCoreMatrix class template provides access to a dense matrix that is stored in a file
+// in the memory mapped file format (see the writeMappedFile() function and \ref math_mapped_file)
+// and that might exceed the available main memory. The type of the elements and the storage
+// order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class OutOfCoreMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. OutOfCoreMatrix can be used with any
+//          numeric element type. It must match the element type of the file.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          It must match the storage order of the file. The default value is blaze::rowMajor.
+//
+// An out-of-core matrix is never completely loaded into memory. Instead, the matrix is divided
+// into tiles of consecutive rows (row-major matrices) or consecutive columns (column-major
+// matrices), each of which is stored contiguously in the file. The stream() function loads one
+// tile after another into an aligned and padded buffer and passes it as CustomMatrix to the given
+// operation. The tiles are double buffered: while the operation works on the current tile, the
+// next tile is read by a background thread, which overlaps the I/O with the computation. The
+// multiply() functions use this mechanism to compute matrix/vector and matrix/matrix products
+// with the in-core product kernels:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::OutOfCoreMatrix<double,rowMajor> A( "matrix.bin" );
+
+   blaze::DynamicVector<double> x( A.columns(), 1.0 ), y;
+   multiply( A, x, y );  // y = A * x
+
+   blaze::DynamicMatrix<double> B( A.columns(), 8UL, 1.0 ), C;
+   multiply( A, B, C );  // C = A * B
+   \endcode
+
+// The size of the tiles can be specified as the number of rows/columns per tile. By default,
+// a tile spans about \a defaultTileBytes bytes. Since two tiles are kept in memory, the memory
+// consumption of an out-of-core computation is about twice the tile size.
+*/
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder >   // Storage order
+class OutOfCoreMatrix : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type                                   ElementType;  //!< Type of the matrix elements.
+   typedef CustomMatrix<Type,aligned,padded,SO>  TileType;     //!< Type of a single tile.
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   //! The default size of a single tile in bytes (32 MiB).
+   static const size_t defaultTileBytes = 33554432UL;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline OutOfCoreMatrix( const std::string& file, size_t tileSize=0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~OutOfCoreMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows()     const;
+   inline size_t columns()  const;
+   inline size_t spacing()  const;
+   inline size_t tileSize() const;
+   inline size_t tiles()    const;
+
+   template< typename OP >
+   inline void stream( OP& op ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class TileReader********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Asynchronous loading of a single tile.
+   */
+   struct TileReader
+   {
+      //**Constructor******************************************************************************
+      inline TileReader( const OutOfCoreMatrix& matrix, size_t tile, Type* buffer, bool& failed )
+         : matrix_( matrix )  // The out-of-core matrix
+         , tile_  ( tile   )  // The index of the tile to be read
+         , buffer_( buffer )  // The target buffer
+         , failed_( failed )  // The error flag
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      inline void operator()() {
+         try {
+            matrix_.readTile( tile_, buffer_ );
+         }
+         catch( ... ) {
+            failed_ = true;
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const OutOfCoreMatrix& matrix_;  //!< The out-of-core matrix.
+      size_t tile_;                    //!< The index of the tile to be read.
+      Type*  buffer_;                  //!< The target buffer.
+      bool&  failed_;                  //!< The error flag.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t outer() const;
+   inline void   readTile ( size_t tile, Type* buffer ) const;
+   inline void   readBlock( void* buffer, size_t bytes, uint64_t offset ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   int    fd_;        //!< The file descriptor of the matrix file.
+   size_t m_;         //!< The current number of rows of the matrix.
+   size_t n_;         //!< The current number of columns of the matrix.
+   size_t nn_;        //!< The number of elements between two rows/columns.
+   size_t tileSize_;  //!< The number of rows/columns per tile.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OutOfCoreMatrix class template.
+//
+// \param file The name of the matrix file.
+// \param tileSize The number of rows/columns per tile (0 for the default tile size).
+// \exception std::runtime_error Invalid matrix file.
+//
+// This constructor opens the given file and validates its header. In case the file cannot be
+// opened or in case it does not contain a dense matrix of the according element type and
+// storage order, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline OutOfCoreMatrix<Type,SO>::OutOfCoreMatrix( const std::string& file, size_t tileSize )
+   : fd_      ( -1  )  // The file descriptor of the matrix file
+   , m_       ( 0UL )  // The current number of rows of the matrix
+   , n_       ( 0UL )  // The current number of columns of the matrix
+   , nn_      ( 0UL )  // The number of elements between two rows/columns
+   , tileSize_( 0UL )  // The number of rows/columns per tile
+{
+#if defined(_MSC_VER)
+   fd_ = _open( file.c_str(), _O_RDONLY | _O_BINARY );
+#else
+   fd_ = open( file.c_str(), O_RDONLY );
+#endif
+
+   if( fd_ == -1 )
+      throw std::runtime_error( "File could not be opened" );
+
+   try {
+#if defined(_MSC_VER)
+      struct _stati64 info;
+      if( _fstati64( fd_, &info ) != 0 )
+#else
+      struct stat info;
+      if( fstat( fd_, &info ) != 0 )
+#endif
+         throw std::runtime_error( "File could not be opened" );
+
+      byte header[MappedFile::headerSize] = {};
+      const uint64_t filesize( info.st_size );
+
+      if( filesize >= MappedFile::headerSize ) {
+         readBlock( header, MappedFile::headerSize, 0UL );
+      }
+
+      uint64_t m( 0UL ), n( 0UL ), nn( 0UL );
+      MappedFile::readHeader<Type>( header, filesize, MappedFile::matrixKind, SO, m, n, nn );
+
+      m_  = m;
+      n_  = n;
+      nn_ = nn;
+   }
+   catch( ... ) {
+#if defined(_MSC_VER)
+      _close( fd_ );
+#else
+      close( fd_ );
+#endif
+      throw;
+   }
+
+   if( tileSize == 0UL && nn_ > 0UL )
+      tileSize = defaultTileBytes / ( nn_ * sizeof(Type) );
+
+   tileSize_ = ( tileSize == 0UL )?( 1UL ):( ( tileSize < outer() )?( tileSize ):( outer() ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for OutOfCoreMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline OutOfCoreMatrix<Type,SO>::~OutOfCoreMatrix()
+{
+#if defined(_MSC_VER)
+   _close( fd_ );
+#else
+   close( fd_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t OutOfCoreMatrix<Type,SO>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t OutOfCoreMatrix<Type,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t OutOfCoreMatrix<Type,SO>::spacing() const
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns per tile.
+//
+// \return The number of rows (row-major matrices) or columns (column-major matrices) per tile.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t OutOfCoreMatrix<Type,SO>::tileSize() const
+{
+   return tileSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of tiles of the matrix.
+//
+// \return The number of tiles of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t OutOfCoreMatrix<Type,SO>::tiles() const
+{
+   return ( outer() + tileSize_ - 1UL ) / tileSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Streaming of all tiles of the matrix through the given operation.
+//
+// \param op The operation to be applied to all tiles.
+// \return void
+// \exception std::runtime_error Tile could not be read.
+//
+// This function loads all tiles of the matrix in order and calls the given operation for each
+// of them as
+
+   \code
+   op( tile, offset );
+   \endcode
+
+// where \a tile is a TileType (i.e. an aligned and padded CustomMatrix) referring to the loaded
+// rows/columns and \a offset is the index of the first row (row-major matrices) or the first
+// column (column-major matrices) of the tile. The next tile is read asynchronously while the
+// operation works on the current tile. Note that the tile refers to an internal buffer that is
+// reused for the subsequent tiles. In case a tile cannot be read, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename OP >  // Type of the operation
+inline void OutOfCoreMatrix<Type,SO>::stream( OP& op ) const
+{
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   const size_t tiles( this->tiles() );
+
+   DynamicVector<Type> buffer1( tileSize_*nn_ );
+   DynamicVector<Type> buffer2( ( tiles > 1UL )?( tileSize_*nn_ ):( 0UL ) );
+   Type* buffers[2] = { buffer1.data(), buffer2.data() };
+
+   readTile( 0UL, buffers[0] );
+
+   for( size_t k=0UL; k<tiles; ++k )
+   {
+      bool failed( false );
+      UniquePtr<boost::thread> reader;
+
+      if( k+1UL < tiles ) {
+         const TileReader task( *this, k+1UL, buffers[(k+1UL)%2UL], failed );
+         reader.reset( new boost::thread( task ) );
+      }
+
+      const size_t offset( k*tileSize_ );
+      const size_t size  ( ( offset+tileSize_ < outer() )?( tileSize_ ):( outer()-offset ) );
+
+      try {
+         const TileType tile( buffers[k%2UL], ( SO )?( m_ ):( size ), ( SO )?( size ):( n_ ), nn_ );
+         op( tile, offset );
+      }
+      catch( ... ) {
+         if( reader.get() != NULL )
+            reader->join();
+         throw;
+      }
+
+      if( reader.get() != NULL )
+         reader->join();
+
+      if( failed )
+         throw std::runtime_error( "Tile could not be read" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major matrices) or columns (column-major matrices).
+//
+// \return The outer dimension of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t OutOfCoreMatrix<Type,SO>::outer() const
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a single tile from the matrix file.
+//
+// \param tile The index of the tile.
+// \param buffer The target buffer.
+// \return void
+// \exception std::runtime_error Tile could not be read.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void OutOfCoreMatrix<Type,SO>::readTile( size_t tile, Type* buffer ) const
+{
+   const size_t first( tile*tileSize_ );
+   const size_t size ( ( first+tileSize_ < outer() )?( tileSize_ ):( outer()-first ) );
+
+   readBlock( buffer, size*nn_*sizeof(Type),
+              MappedFile::headerSize + uint64_t( first )*nn_*sizeof(Type) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a contiguous block of bytes from the matrix file.
+//
+// \param buffer The target buffer.
+// \param bytes The number of bytes to be read.
+// \param offset The position of the first byte within the file.
+// \return void
+// \exception std::runtime_error Tile could not be read.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void OutOfCoreMatrix<Type,SO>::readBlock( void* buffer, size_t bytes, uint64_t offset ) const
+{
+   char* data( static_cast<char*>( buffer ) );
+
+   while( bytes > 0UL )
+   {
+#if defined(_MSC_VER)
+      const unsigned int chunk( ( bytes < 1073741824UL )?( bytes ):( 1073741824UL ) );
+      const int result( ( _lseeki64( fd_, offset, SEEK_SET ) == -1 )?( -1 )
+                                                                   :( _read( fd_, data, chunk ) ) );
+#else
+      const ssize_t result( pread( fd_, data, bytes, offset ) );
+#endif
+
+      if( result <= 0 )
+         throw std::runtime_error( "Tile could not be read" );
+
+      data   += result;
+      offset += result;
+      bytes  -= result;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name OutOfCoreMatrix functions */
+//@{
+template< typename Type, bool SO, typename VT1, typename VT2 >
+inline void multiply( const OutOfCoreMatrix<Type,SO>& A,
+                      const DenseVector<VT1,false>& x, DenseVector<VT2,false>& y );
+
+template< typename Type, bool SO, typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void multiply( const OutOfCoreMatrix<Type,SO>& A,
+                      const DenseMatrix<MT1,SO1>& B, DenseMatrix<MT2,SO2>& C );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tile operation for the out-of-core multiplication of a matrix and a dense vector or
+//        a dense matrix.
+// \ingroup out_of_core_matrix
+//
+// For row-major tiles, the according part of the target is assigned the product of the tile
+// and the right-hand side operand. For column-major tiles, the product of the tile and the
+// according part of the right-hand side operand is added to the target.
+*/
+template< typename TT    // Type of the target vector/matrix
+        , typename RT >  // Type of the right-hand side vector/matrix
+struct OutOfCoreMultiplication
+{
+   //**Constructor*********************************************************************************
+   inline OutOfCoreMultiplication( TT& target, const RT& rhs )
+      : target_( target )  // The target vector/matrix
+      , rhs_   ( rhs    )  // The right-hand side vector/matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator for row-major tiles**************************************************
+   template< typename Type >
+   inline void operator()( const CustomMatrix<Type,aligned,padded,rowMajor>& tile,
+                           size_t offset ) {
+      assign( target_, tile, offset, rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**Function call operator for column-major tiles***********************************************
+   template< typename Type >
+   inline void operator()( const CustomMatrix<Type,aligned,padded,columnMajor>& tile,
+                           size_t offset ) {
+      addAssign( target_, tile, offset, rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**Vector kernels******************************************************************************
+   template< typename MT, typename VT1, typename VT2 >
+   static inline void assign( DenseVector<VT1,false>& y, const MT& tile, size_t offset,
+                              const DenseVector<VT2,false>& x ) {
+      subvector( ~y, offset, tile.rows() ) = tile * (~x);
+   }
+
+   template< typename MT, typename VT1, typename VT2 >
+   static inline void addAssign( DenseVector<VT1,false>& y, const MT& tile, size_t offset,
+                                 const DenseVector<VT2,false>& x ) {
+      ~y += tile * subvector( ~x, offset, tile.columns() );
+   }
+   //**********************************************************************************************
+
+   //**Matrix kernels******************************************************************************
+   template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+   static inline void assign( DenseMatrix<MT1,SO1>& C, const MT& tile, size_t offset,
+                              const DenseMatrix<MT2,SO2>& B ) {
+      submatrix( ~C, offset, 0UL, tile.rows(), (~C).columns() ) = tile * (~B);
+   }
+
+   template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+   static inline void addAssign( DenseMatrix<MT1,SO1>& C, const MT& tile, size_t offset,
+                                 const DenseMatrix<MT2,SO2>& B ) {
+      ~C += tile * submatrix( ~B, offset, 0UL, tile.columns(), (~B).columns() );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   TT&       target_;  //!< The target vector/matrix.
+   const RT& rhs_;     //!< The right-hand side vector/matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication of a matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup out_of_core_matrix
+//
+// \param A The out-of-core matrix.
+// \param x The right-hand side dense vector.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Tile could not be read.
+//
+// This function computes the product of the given out-of-core matrix and the dense vector \a x
+// tile by tile and stores the result in \a y, which is resized accordingly. In case the size of
+// \a x doesn't match the number of columns of \a A, a \a std::invalid_argument exception is
+// thrown. Note that \a x and \a y must not refer to the same vector.
+*/
+template< typename Type  // Data type of the out-of-core matrix
+        , bool SO        // Storage order of the out-of-core matrix
+        , typename VT1   // Type of the right-hand side dense vector
+        , typename VT2 > // Type of the target dense vector
+inline void multiply( const OutOfCoreMatrix<Type,SO>& A,
+                      const DenseVector<VT1,false>& x, DenseVector<VT2,false>& y )
+{
+   if( (~x).size() != A.columns() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   resize( ~y, A.rows(), false );
+
+   if( SO || A.columns() == 0UL )
+      reset( ~y );
+
+   OutOfCoreMultiplication<VT2,VT1> op( ~y, ~x );
+   A.stream( op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication of a matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup out_of_core_matrix
+//
+// \param A The out-of-core matrix.
+// \param B The right-hand side dense matrix.
+// \param C The target dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Tile could not be read.
+//
+// This function computes the product of the given out-of-core matrix and the dense matrix \a B
+// tile by tile and stores the result in \a C, which is resized accordingly. In case the number
+// of rows of \a B doesn't match the number of columns of \a A, a \a std::invalid_argument
+// exception is thrown. Note that \a B and \a C must not refer to the same matrix.
+*/
+template< typename Type  // Data type of the out-of-core matrix
+        , bool SO        // Storage order of the out-of-core matrix
+        , typename MT1   // Type of the right-hand side dense matrix
+        , bool SO1       // Storage order of the right-hand side dense matrix
+        , typename MT2   // Type of the target dense matrix
+        , bool SO2 >     // Storage order of the target dense matrix
+inline void multiply( const OutOfCoreMatrix<Type,SO>& A,
+                      const DenseMatrix<MT1,SO1>& B, DenseMatrix<MT2,SO2>& C )
+{
+   if( (~B).rows() != A.columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   resize( ~C, A.rows(), (~B).columns(), false );
+
+   if( SO || A.columns() == 0UL )
+      reset( ~C );
+
+   OutOfCoreMultiplication<MT2,MT1> op( ~C, ~B );
+   A.stream( op );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
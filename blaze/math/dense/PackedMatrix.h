@@ -0,0 +1,2946 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Header file for the implementation of a packed symmetric/triangular dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/PackedProxy.h>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/PackedStructure.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/traits/ColumnExprTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowExprTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of symmetric and triangular matrices in packed storage.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template is the representation of a square \f$ N \times N \f$ symmetric,
+// lower triangular or upper triangular matrix that only stores the \f$ N(N+1)/2 \f$ elements of
+// one half of the matrix. In comparison to a SymmetricMatrix, LowerMatrix or UpperMatrix adaptor
+// on top of a DynamicMatrix it therefore requires only half of the memory and only half of the
+// memory bandwidth in all operations it is involved in. The type of the elements, the structure
+// and the storage order of the matrix can be specified via the three template parameters:
+
+   \code
+   template< typename Type, PackedStructure PS, bool SO >
+   class PackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. PackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - PS  : specifies the structure of the matrix (blaze::packedSymmetric, blaze::packedLower or
+//          blaze::packedUpper).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The elements are stored line by line (i.e. row by row in case of row-major order and column
+// by column in case of column-major order), where each line only contains the elements of the
+// stored half. Thus all elements of a single line are stored contiguously, which enables
+// vectorized kernels for all matrix/vector and matrix/matrix multiplications. A symmetric matrix
+// stores its lower part in case of row-major order and its upper part in case of column-major
+// order, which results in the same memory layout for both storage orders. The following example
+// demonstrates the packed storage of a \f$ 3 \times 3 \f$ row-major lower matrix:
+
+                          \f[\left(\begin{array}{*{3}{c}}
+                          1 & 0 & 0 \\
+                          2 & 3 & 0 \\
+                          4 & 5 & 6 \\
+                          \end{array}\right)
+                          \Longrightarrow
+                          \left(\begin{array}{*{6}{c}}
+                          1 & 2 & 3 & 4 & 5 & 6 \\
+                          \end{array}\right)\f]
+
+// A PackedMatrix can be used in all arithmetic operations that any other dense matrix can be
+// used in. Since it is a symmetric, lower or upper matrix, it also takes part in all optimizations
+// for these kinds of matrices. The result of an arithmetic operation with a packed matrix is a
+// DynamicMatrix:
+
+   \code
+   using blaze::PackedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+
+   PackedMatrix<double,packedSymmetric> S( 1000UL );  // Packed symmetric 1000x1000 matrix
+   PackedMatrix<double,packedLower> L( 1000UL );      // Packed lower 1000x1000 matrix
+   DynamicVector<double> x( 1000UL ), y;
+   DynamicMatrix<double> B( 1000UL, 50UL ), C;
+   // ... Initialization
+
+   y = S * x;  // Vectorized packed symmetric matrix/dense vector multiplication
+   C = L * B;  // Vectorized packed lower matrix/dense matrix multiplication
+   \endcode
+
+// All elements of the stored half of the matrix can be accessed and modified via the function
+// call operator. In case of a symmetric matrix, a modification of an element also changes the
+// according element of the other half. In case of a triangular matrix, the elements of the other
+// half are zero. An attempt to modify these elements results in a \a std::invalid_argument
+// exception. Assignments to a packed matrix are only successful if the given matrix has the
+// according structure. Otherwise a \a std::invalid_argument exception is thrown:
+
+   \code
+   PackedMatrix<int,packedLower> A( 3UL );
+   A = 0;
+
+   A(2,0) = 1;  // Valid modification of a lower element
+   A(0,2) = 1;  // Invalid modification of an upper element; results in an exception!
+
+   DynamicMatrix<int> D( 3UL, 3UL, 1 );
+   A = D;  // Invalid assignment of a non-lower matrix; results in an exception!
+   \endcode
+
+// PackedMatrix can also be used for block-structured symmetric matrices. In contrast to a
+// SymmetricMatrix adaptor on top of a DynamicMatrix, only the \f$ N(N+1)/2 \f$ blocks of the
+// stored half are constructed, all of which are stored in a single contiguous array. Note that
+// all blocks of a symmetric matrix are shared between the two halves, i.e. the block at position
+// \f$ (i,j) \f$ is identical to the block at position \f$ (j,i) \f$:
+
+   \code
+   using blaze::StaticMatrix;
+
+   // Definition of a 5x5 block-structured packed symmetric matrix
+   PackedMatrix< StaticMatrix<double,3UL,3UL>, packedSymmetric > B( 5UL );
+
+   // Manipulating the blocks (2,4) and (4,2)
+   B(2,4)(1,1) = -5.0;
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , PackedStructure PS               // Structure of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class PackedMatrix : public DenseMatrix< PackedMatrix<Type,PS,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the layout of the matrix lines.
+   /*! In case the stored part of line \a k consists of the elements \f$ [0..k] \f$ of the line
+       (lower row-major, upper column-major and symmetric matrices), \a shortLines is set to 1.
+       In case the stored part consists of the elements \f$ [k..N-1] \f$ (upper row-major and
+       lower column-major matrices), \a shortLines is set to 0. */
+   enum { shortLines = ( PS == packedSymmetric ) ||
+                       ( PS == packedLower && !SO ) || ( PS == packedUpper && SO ) };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef PackedMatrix<Type,PS,SO>  This;            //!< Type of this PackedMatrix instance.
+   typedef DynamicMatrix<Type,SO>    ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>   OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>   TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                      ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type         IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&               ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&               CompositeType;   //!< Data type for composite expression templates.
+   typedef PackedProxy<Type>         Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&               ConstReference;  //!< Reference to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef PackedMatrix<ET,PS,SO>  Other;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ElementIterator class definition************************************************************
+   /*!\brief Iterator over the elements of a single row/column of the packed matrix.
+   */
+   template< typename MatrixType       // Type of the packed matrix
+           , typename ReferenceType >  // Type of the element references
+   class ElementIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef ReferenceType                    PointerType;       //!< Pointer return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the ElementIterator class.
+      */
+      inline ElementIterator()
+         : matrix_( NULL )  // Reference to the packed matrix
+         , row_   ( 0UL  )  // The current row index of the iterator
+         , column_( 0UL  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ElementIterator class.
+      //
+      // \param matrix The packed matrix.
+      // \param row Initial row index of the iterator.
+      // \param column Initial column index of the iterator.
+      */
+      inline ElementIterator( MatrixType& matrix, size_t row, size_t column )
+         : matrix_( &matrix )  // Reference to the packed matrix
+         , row_   ( row     )  // The current row index of the iterator
+         , column_( column  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different ElementIterator instances.
+      //
+      // \param it The element iterator to be copied.
+      */
+      template< typename MatrixType2, typename ReferenceType2 >
+      inline ElementIterator( const ElementIterator<MatrixType2,ReferenceType2>& it )
+         : matrix_( it.matrix_ )  // Reference to the packed matrix
+         , row_   ( it.row_    )  // The current row index of the iterator
+         , column_( it.column_ )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ElementIterator& operator+=( size_t inc ) {
+         ( SO )?( row_ += inc ):( column_ += inc );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ElementIterator& operator-=( size_t dec ) {
+         ( SO )?( row_ -= dec ):( column_ -= dec );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ElementIterator& operator++() {
+         ( SO )?( ++row_ ):( ++column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ElementIterator operator++( int ) {
+         const ElementIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ElementIterator& operator--() {
+         ( SO )?( --row_ ):( --column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ElementIterator operator--( int ) {
+         const ElementIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)( row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ == rhs.row_ ):( column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ != rhs.row_ ):( column_ != rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ < rhs.row_ ):( column_ < rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ > rhs.row_ ):( column_ > rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ <= rhs.row_ ):( column_ <= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ >= rhs.row_ ):( column_ >= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ElementIterator& rhs ) const {
+         return ( SO )?( row_ - rhs.row_ ):( column_ - rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an ElementIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ElementIterator operator+( const ElementIterator& it, size_t inc ) {
+         ElementIterator tmp( it );
+         tmp += inc;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and an ElementIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ElementIterator operator+( size_t inc, const ElementIterator& it ) {
+         ElementIterator tmp( it );
+         tmp += inc;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between an ElementIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ElementIterator operator-( const ElementIterator& it, size_t dec ) {
+         ElementIterator tmp( it );
+         tmp -= dec;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< Reference to the packed matrix.
+      size_t      row_;     //!< The current row index of the iterator.
+      size_t      column_;  //!< The current column index of the iterator.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2, typename ReferenceType2 > friend class ElementIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef ElementIterator<This,Reference>             Iterator;       //!< Iterator over non-constant elements.
+   typedef ElementIterator<const This,ConstReference>  ConstIterator;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows/columns of a packed matrix are not
+       stored with a common spacing, the \a vectorizable compilation flag is always set to
+       \a false. Vectorization is instead provided by the matrix/vector and matrix/matrix
+       multiplication kernels of the packed matrix. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a packed matrix cannot be split into submatrices, the flag is always
+       set to \a false. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                           explicit inline PackedMatrix();
+                           explicit inline PackedMatrix( size_t n );
+                           explicit inline PackedMatrix( size_t n, const Type& init );
+                                    inline PackedMatrix( const PackedMatrix& m );
+   template< typename MT, bool SO2 > inline PackedMatrix( const Matrix<MT,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline PackedMatrix& operator= ( const Type& rhs );
+                                     inline PackedMatrix& operator= ( const PackedMatrix& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline PackedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, PackedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, PackedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        capacity() const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          clear();
+                                     void          resize( size_t n, bool preserve=true );
+   template< typename Other > inline PackedMatrix& scale( const Other& scalar );
+                              inline void          swap( PackedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the compile time check of the structure of a matrix.
+   template< typename MT >
+   struct HasStructure {
+      enum { value = ( PS == packedSymmetric && IsSymmetric<MT>::value ) ||
+                     ( PS == packedLower     && IsLower<MT>::value     ) ||
+                     ( PS == packedUpper     && IsUpper<MT>::value     ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename T1, typename T2 >
+   struct VectorizedUpdate {
+      enum { value = IsVectorizable<Type>::value && T1::vectorizable && T2::vectorizable &&
+                     IsSame<Type,typename T1::ElementType>::value &&
+                     IsSame<Type,typename T2::ElementType>::value &&
+                     IT::addition && IT::subtraction && IT::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename T1, typename T2 >
+   struct VectorizedPanelUpdate {
+      enum { value = VectorizedUpdate<T1,T2>::value &&
+                     IsRowMajorMatrix<T1>::value && IsRowMajorMatrix<T2>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void assign   ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+
+   template< typename VT1, typename VT2 >
+   inline void assignProduct( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x ) const;
+
+   template< typename VT1, typename VT2 >
+   inline void addAssignProduct( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x ) const;
+
+   template< typename VT1, typename VT2 >
+   inline void subAssignProduct( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void assignProduct( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void addAssignProduct( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void subAssignProduct( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t packedSize( size_t n );
+   static inline size_t offset    ( size_t k, size_t n );
+
+   inline size_t index   ( size_t i, size_t j ) const;
+   inline bool   isStored( size_t i, size_t j ) const;
+
+   template< typename MT > static inline bool hasStructure( const MT& m );
+
+   template< bool SUB, typename VT1, typename VT2 >
+   inline typename DisableIf< VectorizedUpdate<VT1,VT2> >::Type
+      multiplyVector( VT1& y, const VT2& x ) const;
+
+   template< bool SUB, typename VT1, typename VT2 >
+   inline typename EnableIf< VectorizedUpdate<VT1,VT2> >::Type
+      multiplyVector( VT1& y, const VT2& x ) const;
+
+   template< bool SUB, typename MT1, typename MT2 >
+   inline typename DisableIf< VectorizedPanelUpdate<MT1,MT2> >::Type
+      multiplyMatrix( MT1& C, const MT2& B ) const;
+
+   template< bool SUB, typename MT1, typename MT2 >
+   inline typename EnableIf< VectorizedPanelUpdate<MT1,MT2> >::Type
+      multiplyMatrix( MT1& C, const MT2& B ) const;
+
+   template< bool SUB, size_t W, typename MT1, typename MT2 >
+   inline void multiplyPanel( MT1& C, const MT2& B, size_t j ) const;
+
+   template< bool SUB, typename VT1, typename VT2 >
+   static inline typename DisableIf< VectorizedUpdate<VT1,VT2> >::Type
+      update( VT1& y, const Type& a, const VT2& x );
+
+   template< bool SUB, typename VT1, typename VT2 >
+   static inline typename EnableIf< VectorizedUpdate<VT1,VT2> >::Type
+      update( VT1& y, const Type& a, const VT2& x );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   size_t capacity_;         //!< The maximum number of stored elements of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated elements of the stored half.
+                             /*!< The elements are stored line by line, where each line only
+                                  contains the elements of the stored half. */
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, PackedStructure PS, bool SO >
+const Type PackedMatrix<Type,PS,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>::PackedMatrix()
+   : n_       ( 0UL  )  // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum number of stored elements of the matrix
+   , v_       ( NULL )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a packed matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// \b Note: This constructor is only responsible to allocate the required dynamic memory. No
+//          element initialization is performed!
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>::PackedMatrix( size_t n )
+   : n_       ( n                          )  // The current number of rows and columns of the matrix
+   , capacity_( packedSize( n )            )  // The maximum number of stored elements of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all \f$ n \times n \f$ matrix elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the elements of the stored half of the matrix.
+//
+// All elements of the stored half of the matrix are initialized with the specified value.
+// In case of a triangular matrix, the elements of the other half remain zero.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>::PackedMatrix( size_t n, const Type& init )
+   : n_       ( n                          )  // The current number of rows and columns of the matrix
+   , capacity_( packedSize( n )            )  // The maximum number of stored elements of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{
+   std::fill( v_, v_+capacity_, init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>::PackedMatrix( const PackedMatrix& m )
+   : n_       ( m.n_                       )  // The current number of rows and columns of the matrix
+   , capacity_( packedSize( n_ )           )  // The maximum number of stored elements of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// The matrix is initialized as a copy of the given matrix. In case the given matrix is not
+// a square matrix or doesn't have the structure of the packed matrix (i.e. is not symmetric,
+// lower or upper, respectively), a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the foreign matrix
+        , bool SO2 >          // Storage order of the foreign matrix
+inline PackedMatrix<Type,PS,SO>::PackedMatrix( const Matrix<MT,SO2>& m )
+   : n_       ( (~m).rows()     )  // The current number of rows and columns of the matrix
+   , capacity_( packedSize( n_ ) )  // The maximum number of stored elements of the matrix
+   , v_       ( NULL            )  // The matrix elements
+{
+   if( (~m).rows() != (~m).columns() )
+      throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+   if( IsComputation<MT>::value )
+   {
+      const typename MT::ResultType tmp( ~m );
+
+      if( !hasStructure( tmp ) )
+         throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+      v_ = allocate<Type>( capacity_ );
+
+      if( IsSparseMatrix<MT>::value )
+         reset();
+
+      assign( tmp );
+   }
+   else
+   {
+      if( !hasStructure( ~m ) )
+         throw std::invalid_argument( "Invalid setup of packed matrix" );
+
+      v_ = allocate<Type>( capacity_ );
+
+      if( IsSparseMatrix<MT>::value )
+         reset();
+
+      assign( ~m );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for PackedMatrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>::~PackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed matrix element.
+//
+// The function call operator returns a proxy to the accessed element. In case of a symmetric
+// matrix, both \f$ A(i,j) \f$ and \f$ A(j,i) \f$ refer to the same stored element. In case of
+// a triangular matrix, the proxy to an element of the other half of the matrix can be read,
+// but any attempt to modify the element results in a \a std::invalid_argument exception.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::Reference
+   PackedMatrix<Type,PS,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return Reference( isStored( i, j ) ? v_+index( i, j ) : NULL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::ConstReference
+   PackedMatrix<Type,PS,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+
+   return ( isStored( i, j ) )?( v_[index( i, j )] ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::Iterator
+   PackedMatrix<Type,PS,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( Iterator( *this, 0UL, i ) ):( Iterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::ConstIterator
+   PackedMatrix<Type,PS,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, 0UL, i ) ):( ConstIterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::ConstIterator
+   PackedMatrix<Type,PS,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, 0UL, i ) ):( ConstIterator( *this, i, 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::Iterator
+   PackedMatrix<Type,PS,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( Iterator( *this, n_, i ) ):( Iterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::ConstIterator
+   PackedMatrix<Type,PS,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, n_, i ) ):( ConstIterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline typename PackedMatrix<Type,PS,SO>::ConstIterator
+   PackedMatrix<Type,PS,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+   return ( SO )?( ConstIterator( *this, n_, i ) ):( ConstIterator( *this, i, n_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all elements of the stored half of the matrix.
+//
+// \param rhs Scalar value to be assigned to the elements of the stored half of the matrix.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>& PackedMatrix<Type,PS,SO>::operator=( const Type& rhs )
+{
+   std::fill( v_, v_+packedSize( n_ ), rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given packed matrix and initialized as a copy of
+// this matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline PackedMatrix<Type,PS,SO>& PackedMatrix<Type,PS,SO>::operator=( const PackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+packedSize( n_ ), v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given matrix and initialized as a copy of this matrix.
+// In case the given matrix is not a square matrix or doesn't have the structure of the packed
+// matrix (i.e. is not symmetric, lower or upper, respectively), a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side matrix
+        , bool SO2 >          // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PS,SO>& PackedMatrix<Type,PS,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != (~rhs).columns() )
+      throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+   if( IsComputation<MT>::value || (~rhs).canAlias( this ) )
+   {
+      const typename MT::ResultType tmp( ~rhs );
+
+      if( !hasStructure( tmp ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      resize( tmp.rows(), false );
+
+      if( IsSparseMatrix<MT>::value )
+         reset();
+
+      assign( tmp );
+   }
+   else
+   {
+      if( !hasStructure( ~rhs ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      resize( (~rhs).rows(), false );
+
+      if( IsSparseMatrix<MT>::value )
+         reset();
+
+      assign( ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown. Also, in case the given matrix doesn't have the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side matrix
+        , bool SO2 >          // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PS,SO>& PackedMatrix<Type,PS,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( IsComputation<MT>::value || (~rhs).canAlias( this ) )
+   {
+      const typename MT::ResultType tmp( ~rhs );
+
+      if( !hasStructure( tmp ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      addAssign( tmp );
+   }
+   else
+   {
+      if( !hasStructure( ~rhs ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      addAssign( ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown. Also, in case the given matrix doesn't have the structure of the packed matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side matrix
+        , bool SO2 >          // Storage order of the right-hand side matrix
+inline PackedMatrix<Type,PS,SO>& PackedMatrix<Type,PS,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( IsComputation<MT>::value || (~rhs).canAlias( this ) )
+   {
+      const typename MT::ResultType tmp( ~rhs );
+
+      if( !hasStructure( tmp ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      subAssign( tmp );
+   }
+   else
+   {
+      if( !hasStructure( ~rhs ) )
+         throw std::invalid_argument( "Invalid assignment to packed matrix" );
+
+      subAssign( ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename Other >    // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, PackedMatrix<Type,PS,SO> >::Type&
+   PackedMatrix<Type,PS,SO>::operator*=( Other rhs )
+{
+   return scale( rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename Other >    // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, PackedMatrix<Type,PS,SO> >::Type&
+   PackedMatrix<Type,PS,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   const size_t size( packedSize( n_ ) );
+   for( size_t k=0UL; k<size; ++k )
+      v_[k] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::rows() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of stored elements of the packed matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the packed matrix.
+//
+// In case of a symmetric matrix, all non-zero elements of both halves of the matrix are counted.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n_; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      const size_t row   ( SO ? l : i );
+      const size_t column( SO ? i : l );
+      if( isStored( row, column ) && !isDefault( v_[index( row, column )] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline void PackedMatrix<Type,PS,SO>::reset()
+{
+   using blaze::reset;
+
+   const size_t size( packedSize( n_ ) );
+   for( size_t k=0UL; k<size; ++k )
+      reset( v_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline void PackedMatrix<Type,PS,SO>::clear()
+{
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to the given size. During this operation, new dynamic
+// memory may be allocated in case the capacity of the matrix is too small. Note that this
+// function may invalidate all existing views (iterators, proxies, ...) on the matrix if it
+// is used to enlarge the matrix. Additionally, the resize operation potentially changes all
+// matrix elements. In order to preserve the old matrix values, the \a preserve flag can be
+// set to \a true. However, new matrix elements are not initialized!
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+void PackedMatrix<Type,PS,SO>::resize( size_t n, bool preserve )
+{
+   if( n == n_ ) return;
+
+   const size_t size( packedSize( n ) );
+
+   // In case the lines start with their first element, the packed lines of the smaller matrix
+   // are a prefix of the packed lines of the larger matrix
+   if( shortLines && size <= capacity_ ) {
+      n_ = n;
+      return;
+   }
+
+   if( preserve || size > capacity_ )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( size );
+
+      if( preserve )
+      {
+         const size_t min( ( n < n_ )?( n ):( n_ ) );
+
+         if( shortLines ) {
+            std::copy( v_, v_+packedSize( min ), v );
+         }
+         else for( size_t k=0UL; k<min; ++k ) {
+            std::copy( v_+offset( k, n_ )+k, v_+offset( k, n_ )+min, v+offset( k, n )+k );
+         }
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = size;
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename Other >    // Data type of the scalar value
+inline PackedMatrix<Type,PS,SO>& PackedMatrix<Type,PS,SO>::scale( const Other& scalar )
+{
+   const size_t size( packedSize( n_ ) );
+   for( size_t k=0UL; k<size; ++k )
+      v_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline void PackedMatrix<Type,PS,SO>::swap( PackedMatrix& m ) /* throw() */
+{
+   std::swap( n_       , m.n_        );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_       , m.v_        );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of a packed \f$ n \times n \f$ matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The number of stored elements.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::packedSize( size_t n )
+{
+   return ( n * ( n+1UL ) ) / 2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the given row/column within the packed array of elements.
+//
+// \param k The index of the row/column.
+// \param n The number of rows and columns of the matrix.
+// \return The offset of the row/column.
+//
+// The returned offset is chosen such that the element with the row/column index \a l of line
+// \a k is located at the position \a offset+l in the packed array of elements.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::offset( size_t k, size_t n )
+{
+   if( shortLines )
+      return ( k * ( k+1UL ) ) / 2UL;
+   else
+      return ( k * ( 2UL*n-k-1UL ) ) / 2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the stored element (i,j) within the packed array of elements.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the element.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline size_t PackedMatrix<Type,PS,SO>::index( size_t i, size_t j ) const
+{
+   BLAZE_INTERNAL_ASSERT( isStored( i, j ), "Invalid access to non-stored element" );
+
+   if( PS == packedSymmetric )
+      return ( i < j )?( offset( j, n_ ) + i ):( offset( i, n_ ) + j );
+   else if( SO )
+      return offset( j, n_ ) + i;
+   else
+      return offset( i, n_ ) + j;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element (i,j) is part of the stored half of the matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is stored, \a false if it is zero by definition.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline bool PackedMatrix<Type,PS,SO>::isStored( size_t i, size_t j ) const
+{
+   return ( PS == packedSymmetric ) ||
+          ( PS == packedLower && j <= i ) ||
+          ( PS == packedUpper && i <= j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given matrix has the structure of the packed matrix.
+//
+// \param m The matrix to be checked.
+// \return \a true in case the matrix is symmetric, lower or upper, respectively, \a false if not.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT >       // Type of the matrix
+inline bool PackedMatrix<Type,PS,SO>::hasStructure( const MT& m )
+{
+   if( PS == packedSymmetric )
+      return isSymmetric( m );
+   else if( PS == packedLower )
+      return isLower( m );
+   else
+      return isUpper( m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename Other >    // Data type of the foreign expression
+inline bool PackedMatrix<Type,PS,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename Other >    // Data type of the foreign expression
+inline bool PackedMatrix<Type,PS,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// Since the rows/columns of a packed matrix don't start at aligned positions, the function
+// always returns \a false.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline bool PackedMatrix<Type,PS,SO>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// Since a packed matrix cannot be split into submatrices, the function always returns \a false.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline bool PackedMatrix<Type,PS,SO>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side dense matrix
+        , bool SO2 >          // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PS,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   // In case of a symmetric matrix, the half of the right-hand side matrix that is stored
+   // contiguously is traversed; otherwise the stored half is traversed line by line
+   const bool trans( ( PS == packedSymmetric )?( SO2 ):( SO ) );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      Type* const line( v_+offset( k, n_ ) );
+      const size_t lbegin( shortLines ? 0UL : k );
+      const size_t lend  ( shortLines ? k+1UL : n_ );
+
+      for( size_t l=lbegin; l<lend; ++l ) {
+         line[l] = ( trans )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side sparse matrix
+        , bool SO2 >          // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PS,SO>::assign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef typename MT::ConstIterator  RhsConstIterator;
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( RhsConstIterator element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( ( PS == packedSymmetric )?( j <= i ):( isStored( i, j ) ) )
+            v_[index( i, j )] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side dense matrix
+        , bool SO2 >          // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PS,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const bool trans( ( PS == packedSymmetric )?( SO2 ):( SO ) );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      Type* const line( v_+offset( k, n_ ) );
+      const size_t lbegin( shortLines ? 0UL : k );
+      const size_t lend  ( shortLines ? k+1UL : n_ );
+
+      for( size_t l=lbegin; l<lend; ++l ) {
+         line[l] += ( trans )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side sparse matrix
+        , bool SO2 >          // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PS,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef typename MT::ConstIterator  RhsConstIterator;
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( RhsConstIterator element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( ( PS == packedSymmetric )?( j <= i ):( isStored( i, j ) ) )
+            v_[index( i, j )] += element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side dense matrix
+        , bool SO2 >          // Storage order of the right-hand side dense matrix
+inline void PackedMatrix<Type,PS,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const bool trans( ( PS == packedSymmetric )?( SO2 ):( SO ) );
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      Type* const line( v_+offset( k, n_ ) );
+      const size_t lbegin( shortLines ? 0UL : k );
+      const size_t lend  ( shortLines ? k+1UL : n_ );
+
+      for( size_t l=lbegin; l<lend; ++l ) {
+         line[l] -= ( trans )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT         // Type of the right-hand side sparse matrix
+        , bool SO2 >          // Storage order of the right-hand side sparse matrix
+inline void PackedMatrix<Type,PS,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   typedef typename MT::ConstIterator  RhsConstIterator;
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( RhsConstIterator element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( ( PS == packedSymmetric )?( j <= i ):( isStored( i, j ) ) )
+            v_[index( i, j )] -= element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the product of the packed matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix/
+// dense vector multiplication expression templates. The product is computed by a single pass
+// over the stored half of the matrix. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline void PackedMatrix<Type,PS,SO>::assignProduct( DenseVector<VT1,false>& y,
+                                                     const DenseVector<VT2,false>& x ) const
+{
+   using blaze::reset;
+
+   BLAZE_INTERNAL_ASSERT( (~y).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+
+   if( !IsNumeric<Type>::value ) {
+      (~y).assign( *this * ~x );
+      return;
+   }
+
+   reset( ~y );
+   multiplyVector<false>( ~y, ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment of the product of the packed matrix and a dense vector
+//        (\f$ \vec{y}+=A*\vec{x} \f$).
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix/
+// dense vector multiplication expression templates. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline void PackedMatrix<Type,PS,SO>::addAssignProduct( DenseVector<VT1,false>& y,
+                                                        const DenseVector<VT2,false>& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+
+   if( !IsNumeric<Type>::value ) {
+      (~y).addAssign( *this * ~x );
+      return;
+   }
+
+   multiplyVector<false>( ~y, ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment of the product of the packed matrix and a dense vector
+//        (\f$ \vec{y}-=A*\vec{x} \f$).
+//
+// \param y The target left-hand side dense vector.
+// \param x The right-hand side dense vector operand.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix/
+// dense vector multiplication expression templates. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline void PackedMatrix<Type,PS,SO>::subAssignProduct( DenseVector<VT1,false>& y,
+                                                        const DenseVector<VT2,false>& x ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == n_, "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == n_, "Invalid vector size" );
+
+   if( !IsNumeric<Type>::value ) {
+      (~y).subAssign( *this * ~x );
+      return;
+   }
+
+   multiplyVector<true>( ~y, ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the product of the packed matrix and a dense matrix (\f$ C=A*B \f$).
+//
+// \param C The target left-hand side dense matrix.
+// \param B The right-hand side dense matrix operand.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix/
+// dense matrix multiplication expression templates. The product is computed by a single pass
+// over the stored half of the matrix. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT1        // Type of the left-hand side target matrix
+        , bool SO1            // Storage order of the left-hand side target matrix
+        , typename MT2        // Type of the right-hand side matrix operand
+        , bool SO2 >          // Storage order of the right-hand side matrix operand
+inline void PackedMatrix<Type,PS,SO>::assignProduct( DenseMatrix<MT1,SO1>& C,
+                                                     const DenseMatrix<MT2,SO2>& B ) const
+{
+   using blaze::reset;
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+
+   if( !IsNumeric<Type>::value ) {
+      (~C).assign( *this * ~B );
+      return;
+   }
+
+   reset( ~C );
+   multiplyMatrix<false>( ~C, ~B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment of the product of the packed matrix and a dense matrix
+//        (\f$ C+=A*B \f$).
+//
+// \param C The target left-hand side dense matrix.
+// \param B The right-hand side dense matrix operand.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix/
+// dense matrix multiplication expression templates. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT1        // Type of the left-hand side target matrix
+        , bool SO1            // Storage order of the left-hand side target matrix
+        , typename MT2        // Type of the right-hand side matrix operand
+        , bool SO2 >          // Storage order of the right-hand side matrix operand
+inline void PackedMatrix<Type,PS,SO>::addAssignProduct( DenseMatrix<MT1,SO1>& C,
+                                                        const DenseMatrix<MT2,SO2>& B ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+
+   if( !IsNumeric<Type>::value ) {
+      (~C).addAssign( *this * ~B );
+      return;
+   }
+
+   multiplyMatrix<false>( ~C, ~B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment of the product of the packed matrix and a dense matrix
+//        (\f$ C-=A*B \f$).
+//
+// \param C The target left-hand side dense matrix.
+// \param B The right-hand side dense matrix operand.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally by the dense matrix/
+// dense matrix multiplication expression templates. Calling this function explicitly might
+// result in erroneous results and/or in compilation errors.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< typename MT1        // Type of the left-hand side target matrix
+        , bool SO1            // Storage order of the left-hand side target matrix
+        , typename MT2        // Type of the right-hand side matrix operand
+        , bool SO2 >          // Storage order of the right-hand side matrix operand
+inline void PackedMatrix<Type,PS,SO>::subAssignProduct( DenseMatrix<MT1,SO1>& C,
+                                                        const DenseMatrix<MT2,SO2>& B ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).rows()    == n_            , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+
+   if( !IsNumeric<Type>::value ) {
+      (~C).subAssign( *this * ~B );
+      return;
+   }
+
+   multiplyMatrix<true>( ~C, ~B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default kernel for the multiplication of the packed matrix with a dense vector.
+//
+// \param y The target dense vector.
+// \param x The dense vector operand.
+// \return void
+//
+// This function adds (or subtracts in case \a SUB is set to \a true) the product of the packed
+// matrix and the dense vector \a x to the dense vector \a y. Every stored element of the matrix
+// is loaded exactly once. In case of a symmetric matrix, each stored element contributes to
+// both \f$ y_i \f$ and \f$ y_j \f$.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the product
+        , typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline typename DisableIf< typename PackedMatrix<Type,PS,SO>::BLAZE_TEMPLATE VectorizedUpdate<VT1,VT2> >::Type
+   PackedMatrix<Type,PS,SO>::multiplyVector( VT1& y, const VT2& x ) const
+{
+   typedef typename VT1::ElementType  ET;
+
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const Type* const line( v_+offset( k, n_ ) );
+
+      if( PS == packedSymmetric )
+      {
+         ET tmp = ET();
+         for( size_t l=0UL; l<k; ++l ) {
+            tmp += line[l] * x[l];
+            if( SUB ) y[l] -= line[l] * x[k];
+            else      y[l] += line[l] * x[k];
+         }
+         tmp += line[k] * x[k];
+         if( SUB ) y[k] -= tmp;
+         else      y[k] += tmp;
+      }
+      else if( !SO )
+      {
+         const size_t lbegin( shortLines ? 0UL : k );
+         const size_t lend  ( shortLines ? k+1UL : n_ );
+
+         ET tmp = ET();
+         for( size_t l=lbegin; l<lend; ++l ) {
+            tmp += line[l] * x[l];
+         }
+         if( SUB ) y[k] -= tmp;
+         else      y[k] += tmp;
+      }
+      else
+      {
+         const size_t lbegin( shortLines ? 0UL : k );
+         const size_t lend  ( shortLines ? k+1UL : n_ );
+
+         for( size_t l=lbegin; l<lend; ++l ) {
+            if( SUB ) y[l] -= line[l] * x[k];
+            else      y[l] += line[l] * x[k];
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized kernel for the multiplication of the packed matrix with a dense vector.
+//
+// \param y The target dense vector.
+// \param x The dense vector operand.
+// \return void
+//
+// This function adds (or subtracts in case \a SUB is set to \a true) the product of the packed
+// matrix and the dense vector \a x to the dense vector \a y. Since the elements of every row/
+// column are stored contiguously, all inner loops are vectorized. In case of a symmetric
+// matrix, the dot product with the stored part of line \a k and the update of \a y with the
+// mirrored elements are fused in a single loop such that every stored element is loaded
+// exactly once.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the product
+        , typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline typename EnableIf< typename PackedMatrix<Type,PS,SO>::BLAZE_TEMPLATE VectorizedUpdate<VT1,VT2> >::Type
+   PackedMatrix<Type,PS,SO>::multiplyVector( VT1& y, const VT2& x ) const
+{
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const Type* const line( v_+offset( k, n_ ) );
+
+      if( PS == packedSymmetric )
+      {
+         const size_t lpos( k & size_t(-IT::size) );
+         const IntrinsicType xk( set( x[k] ) );
+         IntrinsicType xmm;
+         size_t l( 0UL );
+
+         for( ; l<lpos; l+=IT::size ) {
+            const IntrinsicType a( loadu( line+l ) );
+            xmm = xmm + a * x.load(l);
+            if( SUB ) y.store( l, y.load(l) - a * xk );
+            else      y.store( l, y.load(l) + a * xk );
+         }
+
+         Type tmp( sum( xmm ) );
+         for( ; l<k; ++l ) {
+            tmp += line[l] * x[l];
+            if( SUB ) y[l] -= line[l] * x[k];
+            else      y[l] += line[l] * x[k];
+         }
+         tmp += line[k] * x[k];
+         if( SUB ) y[k] -= tmp;
+         else      y[k] += tmp;
+      }
+      else
+      {
+         const size_t lbegin( shortLines ? 0UL : k );
+         const size_t lend  ( shortLines ? k+1UL : n_ );
+         const size_t lalign( min( lend, ( lbegin + IT::size - 1UL ) & size_t(-IT::size) ) );
+         const size_t lpos  ( lend & size_t(-IT::size) );
+         size_t l( lbegin );
+
+         if( !SO )
+         {
+            Type tmp = Type();
+            for( ; l<lalign; ++l ) {
+               tmp += line[l] * x[l];
+            }
+
+            IntrinsicType xmm;
+            for( ; l<lpos; l+=IT::size ) {
+               xmm = xmm + loadu( line+l ) * x.load(l);
+            }
+
+            tmp += sum( xmm );
+            for( ; l<lend; ++l ) {
+               tmp += line[l] * x[l];
+            }
+
+            if( SUB ) y[k] -= tmp;
+            else      y[k] += tmp;
+         }
+         else
+         {
+            for( ; l<lalign; ++l ) {
+               if( SUB ) y[l] -= line[l] * x[k];
+               else      y[l] += line[l] * x[k];
+            }
+
+            const IntrinsicType xk( set( x[k] ) );
+            for( ; l<lpos; l+=IT::size ) {
+               if( SUB ) y.store( l, y.load(l) - loadu( line+l ) * xk );
+               else      y.store( l, y.load(l) + loadu( line+l ) * xk );
+            }
+
+            for( ; l<lend; ++l ) {
+               if( SUB ) y[l] -= line[l] * x[k];
+               else      y[l] += line[l] * x[k];
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default kernel for the multiplication of the packed matrix with a dense matrix.
+//
+// \param C The target dense matrix.
+// \param B The dense matrix operand.
+// \return void
+//
+// This function adds (or subtracts in case \a SUB is set to \a true) the product of the packed
+// matrix and the dense matrix \a B to the dense matrix \a C. In case \a C is a row-major matrix,
+// every stored element \f$ a_{ij} \f$ is loaded exactly once and is used to update row \a i of
+// \a C with row \a j of \a B (and additionally row \a j of \a C with row \a i of \a B in case
+// of a symmetric matrix). In case \a C is a column-major matrix, the product is computed column
+// by column by means of the matrix/vector multiplication kernel.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the product
+        , typename MT1        // Type of the left-hand side target matrix
+        , typename MT2 >      // Type of the right-hand side matrix operand
+inline typename DisableIf< typename PackedMatrix<Type,PS,SO>::BLAZE_TEMPLATE VectorizedPanelUpdate<MT1,MT2> >::Type
+   PackedMatrix<Type,PS,SO>::multiplyMatrix( MT1& C, const MT2& B ) const
+{
+   if( IsRowMajorMatrix<MT1>::value )
+   {
+      typedef typename RowExprTrait<MT1>::Type        CRow;
+      typedef typename RowExprTrait<const MT2>::Type  BRow;
+
+      for( size_t k=0UL; k<n_; ++k )
+      {
+         const Type* const line( v_+offset( k, n_ ) );
+         const size_t lbegin( shortLines ? 0UL : k );
+         const size_t lend  ( shortLines ? k+1UL : n_ );
+
+         for( size_t l=lbegin; l<lend; ++l )
+         {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+
+            CRow ci( row( C, i ) );
+            const BRow bj( row( B, j ) );
+            update<SUB>( ci, line[l], bj );
+
+            if( PS == packedSymmetric && i != j ) {
+               CRow cj( row( C, j ) );
+               const BRow bi( row( B, i ) );
+               update<SUB>( cj, line[l], bi );
+            }
+         }
+      }
+   }
+   else
+   {
+      typedef typename ColumnExprTrait<MT1>::Type        CColumn;
+      typedef typename ColumnExprTrait<const MT2>::Type  BColumn;
+
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         CColumn cj( column( C, j ) );
+         const BColumn bj( column( B, j ) );
+         multiplyVector<SUB>( cj, bj );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized kernel for the multiplication of the packed matrix with a dense matrix.
+//
+// \param C The target row-major dense matrix.
+// \param B The row-major dense matrix operand.
+// \return void
+//
+// This function adds (or subtracts in case \a SUB is set to \a true) the product of the packed
+// matrix and the dense matrix \a B to the dense matrix \a C. The columns of \a B and \a C are
+// processed in panels of up to two intrinsic vectors, which are kept in registers while the
+// stored elements of the packed matrix are traversed line by line. Remaining columns that do
+// not fill an intrinsic vector are handled by the matrix/vector multiplication kernel.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the product
+        , typename MT1        // Type of the left-hand side target matrix
+        , typename MT2 >      // Type of the right-hand side matrix operand
+inline typename EnableIf< typename PackedMatrix<Type,PS,SO>::BLAZE_TEMPLATE VectorizedPanelUpdate<MT1,MT2> >::Type
+   PackedMatrix<Type,PS,SO>::multiplyMatrix( MT1& C, const MT2& B ) const
+{
+   typedef typename ColumnExprTrait<MT1>::Type        CColumn;
+   typedef typename ColumnExprTrait<const MT2>::Type  BColumn;
+
+   const size_t N   ( B.columns() );
+   const size_t jpos( N & size_t(-IT::size) );
+   size_t j( 0UL );
+
+   for( ; (j+IT::size*2UL) <= jpos; j+=IT::size*2UL ) {
+      multiplyPanel<SUB,2UL>( C, B, j );
+   }
+   for( ; j<jpos; j+=IT::size ) {
+      multiplyPanel<SUB,1UL>( C, B, j );
+   }
+   for( ; j<N; ++j ) {
+      CColumn cj( column( C, j ) );
+      const BColumn bj( column( B, j ) );
+      multiplyVector<SUB>( cj, bj );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of the packed matrix with a panel of a row-major dense matrix.
+//
+// \param C The target row-major dense matrix.
+// \param B The row-major dense matrix operand.
+// \param j The index of the first column of the panel.
+// \return void
+//
+// This function updates the columns \f$ [j..j+W*IT::size) \f$ of \a C with the product of the
+// packed matrix and the corresponding columns of \a B. In case the stored lines are rows (or
+// the matrix is symmetric), the panels of two consecutive rows of \a C are accumulated in
+// registers such that every loaded panel of \a B is used twice. In case the stored lines are
+// columns (and for the mirrored part of a symmetric matrix), the panel of row \a k of \a B is
+// kept in registers and is used to update the rows of \a C.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the product
+        , size_t W            // Number of intrinsic vectors per panel row
+        , typename MT1        // Type of the left-hand side target matrix
+        , typename MT2 >      // Type of the right-hand side matrix operand
+inline void PackedMatrix<Type,PS,SO>::multiplyPanel( MT1& C, const MT2& B, size_t j ) const
+{
+   size_t k( 0UL );
+
+   if( PS == packedSymmetric || !SO )
+   {
+      for( ; shortLines && (k+2UL) <= n_; k+=2UL )
+      {
+         const Type* const line1( v_+offset( k    , n_ ) );
+         const Type* const line2( v_+offset( k+1UL, n_ ) );
+
+         IntrinsicType xmm1[W], xmm2[W], bk1[W], bk2[W];
+         if( PS == packedSymmetric ) {
+            for( size_t w=0UL; w<W; ++w ) {
+               bk1[w] = B.load( k    , j+w*IT::size );
+               bk2[w] = B.load( k+1UL, j+w*IT::size );
+            }
+         }
+
+         for( size_t l=0UL; l<k; ++l )
+         {
+            const IntrinsicType a1( set( line1[l] ) );
+            const IntrinsicType a2( set( line2[l] ) );
+
+            for( size_t w=0UL; w<W; ++w ) {
+               const IntrinsicType b( B.load( l, j+w*IT::size ) );
+               xmm1[w] = xmm1[w] + a1 * b;
+               xmm2[w] = xmm2[w] + a2 * b;
+            }
+
+            if( PS == packedSymmetric ) {
+               for( size_t w=0UL; w<W; ++w ) {
+                  const IntrinsicType tmp( a1 * bk1[w] + a2 * bk2[w] );
+                  if( SUB ) C.store( l, j+w*IT::size, C.load( l, j+w*IT::size ) - tmp );
+                  else      C.store( l, j+w*IT::size, C.load( l, j+w*IT::size ) + tmp );
+               }
+            }
+         }
+
+         {
+            const IntrinsicType a1( set( line1[k] ) );
+            const IntrinsicType a2( set( line2[k] ) );
+            const IntrinsicType a3( set( line2[k+1UL] ) );
+
+            for( size_t w=0UL; w<W; ++w ) {
+               const IntrinsicType b1( B.load( k    , j+w*IT::size ) );
+               const IntrinsicType b2( B.load( k+1UL, j+w*IT::size ) );
+               xmm1[w] = xmm1[w] + a1 * b1;
+               xmm2[w] = xmm2[w] + a2 * b1 + a3 * b2;
+               if( PS == packedSymmetric )
+                  xmm1[w] = xmm1[w] + a2 * b2;
+            }
+         }
+
+         for( size_t w=0UL; w<W; ++w ) {
+            if( SUB ) {
+               C.store( k    , j+w*IT::size, C.load( k    , j+w*IT::size ) - xmm1[w] );
+               C.store( k+1UL, j+w*IT::size, C.load( k+1UL, j+w*IT::size ) - xmm2[w] );
+            }
+            else {
+               C.store( k    , j+w*IT::size, C.load( k    , j+w*IT::size ) + xmm1[w] );
+               C.store( k+1UL, j+w*IT::size, C.load( k+1UL, j+w*IT::size ) + xmm2[w] );
+            }
+         }
+      }
+   }
+
+   for( ; k<n_; ++k )
+   {
+      const Type* const line( v_+offset( k, n_ ) );
+      const size_t lbegin( shortLines ? 0UL : k );
+      const size_t lend  ( shortLines ? k+1UL : n_ );
+
+      IntrinsicType bk[W];
+      if( PS == packedSymmetric || SO ) {
+         for( size_t w=0UL; w<W; ++w )
+            bk[w] = B.load( k, j+w*IT::size );
+      }
+
+      if( PS == packedSymmetric || !SO )
+      {
+         IntrinsicType xmm[W];
+
+         for( size_t l=lbegin; l<lend; ++l )
+         {
+            const IntrinsicType a( set( line[l] ) );
+
+            for( size_t w=0UL; w<W; ++w )
+               xmm[w] = xmm[w] + a * B.load( l, j+w*IT::size );
+
+            if( PS == packedSymmetric && l != k ) {
+               for( size_t w=0UL; w<W; ++w ) {
+                  if( SUB ) C.store( l, j+w*IT::size, C.load( l, j+w*IT::size ) - a * bk[w] );
+                  else      C.store( l, j+w*IT::size, C.load( l, j+w*IT::size ) + a * bk[w] );
+               }
+            }
+         }
+
+         for( size_t w=0UL; w<W; ++w ) {
+            if( SUB ) C.store( k, j+w*IT::size, C.load( k, j+w*IT::size ) - xmm[w] );
+            else      C.store( k, j+w*IT::size, C.load( k, j+w*IT::size ) + xmm[w] );
+         }
+      }
+      else
+      {
+         for( size_t l=lbegin; l<lend; ++l )
+         {
+            const IntrinsicType a( set( line[l] ) );
+
+            for( size_t w=0UL; w<W; ++w ) {
+               if( SUB ) C.store( l, j+w*IT::size, C.load( l, j+w*IT::size ) - a * bk[w] );
+               else      C.store( l, j+w*IT::size, C.load( l, j+w*IT::size ) + a * bk[w] );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default kernel for the scaled update of a dense vector (\f$ \vec{y}+=a*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param a The scalar factor.
+// \param x The dense vector operand.
+// \return void
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the scaled vector
+        , typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline typename DisableIf< typename PackedMatrix<Type,PS,SO>::BLAZE_TEMPLATE VectorizedUpdate<VT1,VT2> >::Type
+   PackedMatrix<Type,PS,SO>::update( VT1& y, const Type& a, const VT2& x )
+{
+   const size_t n( x.size() );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( SUB ) y[j] -= a * x[j];
+      else      y[j] += a * x[j];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized kernel for the scaled update of a dense vector (\f$ \vec{y}+=a*\vec{x} \f$).
+//
+// \param y The target dense vector.
+// \param a The scalar factor.
+// \param x The dense vector operand.
+// \return void
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+template< bool SUB            // Compilation switch for a subtraction of the scaled vector
+        , typename VT1        // Type of the left-hand side target vector
+        , typename VT2 >      // Type of the right-hand side vector operand
+inline typename EnableIf< typename PackedMatrix<Type,PS,SO>::BLAZE_TEMPLATE VectorizedUpdate<VT1,VT2> >::Type
+   PackedMatrix<Type,PS,SO>::update( VT1& y, const Type& a, const VT2& x )
+{
+   const size_t n( x.size() );
+   const size_t jpos( n & size_t(-IT::size) );
+   const IntrinsicType factor( set( a ) );
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=IT::size ) {
+      if( SUB ) y.store( j, y.load(j) - factor * x.load(j) );
+      else      y.store( j, y.load(j) + factor * x.load(j) );
+   }
+
+   for( ; j<n; ++j ) {
+      if( SUB ) y[j] -= a * x[j];
+      else      y[j] += a * x[j];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename Type, PackedStructure PS, bool SO >
+inline void reset( PackedMatrix<Type,PS,SO>& m );
+
+template< typename Type, PackedStructure PS, bool SO >
+inline void clear( PackedMatrix<Type,PS,SO>& m );
+
+template< typename Type, PackedStructure PS, bool SO >
+inline bool isDefault( const PackedMatrix<Type,PS,SO>& m );
+
+template< typename Type, PackedStructure PS, bool SO >
+inline void swap( PackedMatrix<Type,PS,SO>& a, PackedMatrix<Type,PS,SO>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline void reset( PackedMatrix<Type,PS,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline void clear( PackedMatrix<Type,PS,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+//
+// This function checks whether the matrix is in default state. For instance, in case the
+// matrix is instantiated for a built-in integral or floating point data type, the function
+// returns \a true in case all matrix elements are 0 and \a false in case any matrix element
+// is not 0.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline bool isDefault( const PackedMatrix<Type,PS,SO>& m )
+{
+   return m.nonZeros() == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type       // Data type of the matrix
+        , PackedStructure PS  // Structure of the matrix
+        , bool SO >           // Storage order
+inline void swap( PackedMatrix<Type,PS,SO>& a, PackedMatrix<Type,PS,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsSymmetric< PackedMatrix<T,packedSymmetric,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsLower< PackedMatrix<T,packedLower,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsUpper< PackedMatrix<T,packedUpper,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPACKED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedStructure PS, bool SO >
+struct IsPacked< PackedMatrix<T,PS,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PackedStructure PS, bool SO >
+struct IsResizable< PackedMatrix<T,PS,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedStructure PS, bool SO >
+struct SubmatrixTrait< PackedMatrix<T1,PS,SO> >
+{
+   typedef DynamicMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedStructure PS, bool SO >
+struct RowTrait< PackedMatrix<T1,PS,SO> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, PackedStructure PS, bool SO >
+struct ColumnTrait< PackedMatrix<T1,PS,SO> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,856 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedProxy.h
+//  \brief Header file for the PackedProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+#define _BLAZE_MATH_DENSE_PACKEDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <ostream>
+#include <stdexcept>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for packed triangular matrices.
+// \ingroup packed_matrix
+//
+// The PackedProxy provides controlled access to the elements of a non-const packed triangular
+// matrix. Since a packed triangular matrix only stores the elements of its lower or upper part,
+// the elements of the opposite part do not exist in memory. The proxy represents these elements
+// as default values and rejects any attempt to modify them. The following example illustrates
+// this by means of a \f$ 3 \times 3 \f$ packed lower matrix:
+
+   \code
+   // Creating a 3x3 packed lower matrix
+   blaze::PackedMatrix<int,blaze::packedLower> A( 3UL );
+
+   A(0,0) = -2;  //        ( -2 0 0 )
+   A(1,0) =  3;  // => A = (  3 0 0 )
+   A(2,1) =  5;  //        (  0 5 0 )
+
+   A(0,2) =  7;  // Invalid assignment to a restricted element; results in an exception!
+   \endcode
+*/
+template< typename Type >  // Type of the represented element
+class PackedProxy : public Proxy< PackedProxy<Type>, Type >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type   RepresentedType;  //!< Type of the represented matrix element.
+   typedef Type&  RawReference;     //!< Reference to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedProxy( Type* value );
+            inline PackedProxy( const PackedProxy& pp );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const PackedProxy& operator= ( const PackedProxy& pp ) const;
+   template< typename T > inline const PackedProxy& operator= ( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator+=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator-=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator*=( const T& value ) const;
+   template< typename T > inline const PackedProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline RawReference get()          const;
+   inline bool         isRestricted() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RawReference() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* const value_;  //!< Pointer to the accessed matrix element.
+                        /*!< In case the proxy represents an element that is not stored by the
+                             packed matrix, the pointer is set to NULL. */
+   mutable Type zero_;  //!< Default value for the representation of restricted elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a PackedProxy.
+//
+// \param value Pointer to the accessed matrix element (NULL for restricted elements).
+*/
+template< typename Type >  // Type of the represented element
+inline PackedProxy<Type>::PackedProxy( Type* value )
+   : value_( value )   // Pointer to the accessed matrix element
+   , zero_ ( Type() )  // Default value for the representation of restricted elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+*/
+template< typename Type >  // Type of the represented element
+inline PackedProxy<Type>::PackedProxy( const PackedProxy& pp )
+   : value_( pp.value_ )  // Pointer to the accessed matrix element
+   , zero_ ( Type()    )  // Default value for the representation of restricted elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// In case the proxy represents a restricted matrix element, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Type of the represented element
+inline const PackedProxy<Type>& PackedProxy<Type>::operator=( const PackedProxy& pp ) const
+{
+   if( value_ == NULL )
+      throw std::invalid_argument( "Invalid assignment to restricted matrix element" );
+
+   *value_ = pp.get();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// In case the proxy represents a restricted matrix element, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Type of the represented element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator=( const T& value ) const
+{
+   if( value_ == NULL )
+      throw std::invalid_argument( "Invalid assignment to restricted matrix element" );
+
+   *value_ = value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// In case the proxy represents a restricted matrix element, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Type of the represented element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator+=( const T& value ) const
+{
+   if( value_ == NULL )
+      throw std::invalid_argument( "Invalid assignment to restricted matrix element" );
+
+   *value_ += value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// In case the proxy represents a restricted matrix element, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Type of the represented element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator-=( const T& value ) const
+{
+   if( value_ == NULL )
+      throw std::invalid_argument( "Invalid assignment to restricted matrix element" );
+
+   *value_ -= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// In case the proxy represents a restricted matrix element, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Type of the represented element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator*=( const T& value ) const
+{
+   if( value_ == NULL )
+      throw std::invalid_argument( "Invalid assignment to restricted matrix element" );
+
+   *value_ *= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+//
+// In case the proxy represents a restricted matrix element, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Type of the represented element
+template< typename T >     // Type of the right-hand side value
+inline const PackedProxy<Type>& PackedProxy<Type>::operator/=( const T& value ) const
+{
+   if( value_ == NULL )
+      throw std::invalid_argument( "Invalid assignment to restricted matrix element" );
+
+   *value_ /= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type >  // Type of the represented element
+inline typename PackedProxy<Type>::RawReference PackedProxy<Type>::get() const
+{
+   return ( value_ != NULL )?( *value_ ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the proxy represents a restricted matrix element..
+//
+// \return \a true in case access to the matrix element is restricted, \a false if not.
+*/
+template< typename Type >  // Type of the represented element
+inline bool PackedProxy<Type>::isRestricted() const
+{
+   return ( value_ == NULL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type >  // Type of the represented element
+inline PackedProxy<Type>::operator RawReference() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedProxy operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator==( const PackedProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator==( const T& lhs, const PackedProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator!=( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator!=( const PackedProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator!=( const T& lhs, const PackedProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator<( const PackedProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator<( const T& lhs, const PackedProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator>( const PackedProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator>( const T& lhs, const PackedProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<=( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator<=( const PackedProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator<=( const T& lhs, const PackedProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>=( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator>=( const PackedProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator>=( const T& lhs, const PackedProxy<Type>& rhs );
+
+template< typename Type >
+inline std::ostream& operator<<( std::ostream& os, const PackedProxy<Type>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two PackedProxy objects.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if both referenced values are equal, \a false if they are not.
+*/
+template< typename T1, typename T2 >
+inline bool operator==( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs )
+{
+   return ( lhs.get() == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between a PackedProxy object and an object of different type.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are equal, \a false if they are not.
+*/
+template< typename Type, typename T >
+inline bool operator==( const PackedProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between an object of different type and a PackedProxy object.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the other object and the referenced value are equal, \a false if they are not.
+*/
+template< typename T, typename Type >
+inline bool operator==( const T& lhs, const PackedProxy<Type>& rhs )
+{
+   return ( lhs == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two PackedProxy objects.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if both referenced values are not equal, \a false if they are.
+*/
+template< typename T1, typename T2 >
+inline bool operator!=( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs )
+{
+   return ( lhs.get() != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between a PackedProxy object and an object of different type.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are not equal, \a false if they are.
+*/
+template< typename Type, typename T >
+inline bool operator!=( const PackedProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() != rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inquality comparison between an object of different type and a PackedProxy object.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the other object and the referenced value are not equal, \a false if they are.
+*/
+template< typename T, typename Type >
+inline bool operator!=( const T& lhs, const PackedProxy<Type>& rhs )
+{
+   return ( lhs != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two PackedProxy objects.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator<( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs )
+{
+   return ( lhs.get() < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between a PackedProxy object and an object of different type.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator<( const PackedProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between an object of different type and a PackedProxy object.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side other object is smaller, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator<( const T& lhs, const PackedProxy<Type>& rhs )
+{
+   return ( lhs < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two PackedProxy objects.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator>( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs )
+{
+   return ( lhs.get() > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between a PackedProxy object and an object of different type.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator>( const PackedProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() > rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between an object of different type and a PackedProxy object.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side other object is greater, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator>( const T& lhs, const PackedProxy<Type>& rhs )
+{
+   return ( lhs > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two PackedProxy objects.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator<=( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs )
+{
+   return ( lhs.get() <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between a PackedProxy object and an object of different type.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator<=( const PackedProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() <= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between an object of different type and a PackedProxy object.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side other object is smaller or equal, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator<=( const T& lhs, const PackedProxy<Type>& rhs )
+{
+   return ( lhs <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two PackedProxy objects.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator>=( const PackedProxy<T1>& lhs, const PackedProxy<T2>& rhs )
+{
+   return ( lhs.get() >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between a PackedProxy object and an object of different type.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side PackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator>=( const PackedProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() >= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between an object of different type and a PackedProxy object.
+// \ingroup packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side PackedProxy object.
+// \return \a true if the left-hand side other object is greater or equal, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator>=( const T& lhs, const PackedProxy<Type>& rhs )
+{
+   return ( lhs >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for proxies on packed triangular matrices.
+// \ingroup packed_matrix
+//
+// \param os Reference to the output stream.
+// \param proxy Reference to a constant proxy object.
+// \return Reference to the output stream.
+*/
+template< typename Type >
+inline std::ostream& operator<<( std::ostream& os, const PackedProxy<Type>& proxy )
+{
+   return os << proxy.get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedProxy global functions */
+//@{
+template< typename Type >
+inline void reset( const PackedProxy<Type>& proxy );
+
+template< typename Type >
+inline void clear( const PackedProxy<Type>& proxy );
+
+template< typename Type >
+inline bool isDefault( const PackedProxy<Type>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value.
+*/
+template< typename Type >
+inline void reset( const PackedProxy<Type>& proxy )
+{
+   using blaze::reset;
+
+   reset( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state.
+*/
+template< typename Type >
+inline void clear( const PackedProxy<Type>& proxy )
+{
+   using blaze::clear;
+
+   clear( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup packed_matrix
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename Type >
+inline bool isDefault( const PackedProxy<Type>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
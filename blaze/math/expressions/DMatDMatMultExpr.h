@@ -77,6 +77,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
@@ -162,10 +163,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
        evaluation strategy. In case the target matrix is column-major and either of the
        two matrix operands is symmetric, \a value is set to 1 and an optimized evaluation
        strategy is selected. Otherwise \a value is set to 0 and the default strategy is
-       chosen. */
+       chosen. Packed left-hand side operands are excluded since their multiplication
+       kernel directly handles column-major target matrices. */
    template< typename T1, typename T2, typename T3 >
    struct CanExploitSymmetry {
-      enum { value = IsColumnMajorMatrix<T1>::value &&
+      enum { value = IsColumnMajorMatrix<T1>::value && !IsPacked<T2>::value &&
                      ( IsSymmetric<T2>::value || IsSymmetric<T3>::value ) };
    };
    /*! \endcond */
@@ -560,7 +562,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
@@ -571,6 +574,32 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense matrices (packed matrices)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the assignment of a packed matrix-dense matrix multiplication to the
+   // vectorized multiplication kernel of the packed matrix, which only traverses the stored half
+   // of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.assignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general dense matrix-general dense matrix multiplication
@@ -1730,7 +1759,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
@@ -1741,6 +1771,32 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense matrices (packed matrices)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a packed matrix-dense matrix multiplication
+   // to the vectorized multiplication kernel of the packed matrix, which only traverses the stored
+   // half of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.addAssignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense matrices (general/general)*****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a general dense matrix-general dense matrix
@@ -2852,7 +2908,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
@@ -2863,6 +2920,32 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense matrices (packed matrices)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a packed matrix-dense matrix
+   // multiplication to the vectorized multiplication kernel of the packed matrix, which only
+   // traverses the stored half of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.subAssignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense matrices (general/general)**************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a general dense matrix-general dense matrix
@@ -65,6 +65,7 @@
 #include <blaze/math/traits/TSVecDMatMultExprTrait.h>
 #include <blaze/math/traits/TSVecSMatMultExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -176,10 +177,35 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! In case all three involved data types are suited for a vectorized computation of the
-       matrix multiplication, the nested \value will be set to 1, otherwise it will be 0. */
+       matrix multiplication and the right-hand side dense matrix operand is not triangular,
+       the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseRegisterBlockedKernel {
+      enum { value = !IsBlockCompressed<T2>::value &&
+                     !IsTriangular<T3>::value &&
+                     T1::vectorizable && T3::vectorizable &&
+                     IsRowMajorMatrix<T1>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case all three involved data types are suited for a vectorized computation of the
+       matrix multiplication, but the register-blocked kernel cannot be applied due to the
+       triangular structure of the right-hand side dense matrix operand, the nested \value
+       will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseVectorizedKernel {
-      enum { value = !IsDiagonal<T3>::value &&
+      enum { value = !IsBlockCompressed<T2>::value &&
+                     !UseRegisterBlockedKernel<T1,T2,T3>::value &&
+                     !IsDiagonal<T3>::value &&
                      T1::vectorizable && T3::vectorizable &&
                      IsRowMajorMatrix<T1>::value &&
                      IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
@@ -199,7 +225,9 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseOptimizedKernel {
-      enum { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum { value = !IsBlockCompressed<T2>::value &&
+                     !UseRegisterBlockedKernel<T1,T2,T3>::value &&
+                     !UseVectorizedKernel<T1,T2,T3>::value &&
                      !IsDiagonal<T3>::value &&
                      !IsResizable<typename T1::ElementType>::value &&
                      !IsResizable<ET1>::value };
@@ -214,12 +242,49 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum { value = !IsBlockCompressed<T2>::value &&
+                     !UseRegisterBlockedKernel<T1,T2,T3>::value &&
+                     !UseVectorizedKernel<T1,T2,T3>::value &&
                      !UseOptimizedKernel<T1,T2,T3>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand is a BlockCompressedMatrix and all three involved data
+       types are suited for a vectorized computation of the matrix multiplication, the nested
+       \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedBlockKernel {
+      enum { value = IsBlockCompressed<T2>::value &&
+                     !IsDiagonal<T3>::value &&
+                     T1::vectorizable && T3::vectorizable &&
+                     IsRowMajorMatrix<T1>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand is a BlockCompressedMatrix, but a vectorized computation
+       of the matrix multiplication is not possible, the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseDefaultBlockKernel {
+      enum { value = IsBlockCompressed<T2>::value &&
+                     !UseVectorizedBlockKernel<T1,T2,T3>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatDMatMultExpr<MT1,MT2>                   This;           //!< Type of this SMatDMatMultExpr instance.
@@ -724,6 +789,197 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Register-blocked assignment to row-major dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked assignment of a sparse matrix-dense matrix multiplication to
+   //        row-major dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the register-blocked row-major assignment kernel for the sparse
+   // matrix-dense matrix multiplication. Each row of the sparse matrix is applied to a group of up
+   // to four intrinsic vectors of right-hand side columns at once, whose partial results are held
+   // in registers until the entire row has been processed. Thus the sparse row is streamed only
+   // once per column group and every element of the target matrix is loaded and stored exactly
+   // once, which is particularly beneficial for tall and skinny right-hand side dense matrices.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::ConstIterator  ConstIterator;
+
+      const size_t N( B.columns() );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ConstIterator begin( A.begin(i) );
+         const ConstIterator end  ( A.end(i)   );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
+         {
+            IntrinsicType xmm1, xmm2, xmm3, xmm4;
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t k( element->index() );
+               xmm1 = xmm1 + a1 * B.load(k,j             );
+               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
+               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
+               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+            }
+
+            (~C).store( i, j             , xmm1 );
+            (~C).store( i, j+IT::size    , xmm2 );
+            (~C).store( i, j+IT::size*2UL, xmm3 );
+            (~C).store( i, j+IT::size*3UL, xmm4 );
+         }
+
+         for( ; (j+IT::size) < N; j+=IT::size*2UL )
+         {
+            IntrinsicType xmm1, xmm2;
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t k( element->index() );
+               xmm1 = xmm1 + a1 * B.load(k,j         );
+               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+            }
+
+            (~C).store( i, j         , xmm1 );
+            (~C).store( i, j+IT::size, xmm2 );
+         }
+
+         if( j < N )
+         {
+            IntrinsicType xmm1;
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               xmm1 = xmm1 + set( element->value() ) * B.load(element->index(),j);
+            }
+
+            (~C).store( i, j, xmm1 );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default block assignment to row-major dense matrices****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a block compressed matrix-dense matrix multiplication to
+   //        row-major dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the default row-major assignment kernel for the block
+   // compressed matrix-dense matrix multiplication. Each element of a block is multiplied
+   // with the according row of the dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDefaultBlockKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef typename MT4::BlockType  BlockType;
+
+      enum { BS = MT4::blockSize };
+
+      reset( ~C );
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         const BlockType* block( A.blocks() + A.blockOffset( I ) );
+         const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+         const size_t* index( A.indices() + A.blockOffset( I ) );
+
+         for( ; block!=end; ++block, ++index ) {
+            for( size_t r=0UL; r<BS; ++r ) {
+               for( size_t c=0UL; c<BS; ++c ) {
+                  const size_t k( (*index)*BS+c );
+                  for( size_t j=0UL; j<B.columns(); ++j ) {
+                     (~C)(I*BS+r,j) += (*block)(r,c) * B(k,j);
+                  }
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized block assignment to row-major dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized assignment of a block compressed matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized row-major assignment kernel for the block
+   // compressed matrix-dense matrix multiplication. For every block row of the sparse matrix
+   // the result is computed in strips of the width of a single intrinsic vector. The partial
+   // results of all rows of the block row are held in registers until all blocks of the block
+   // row have been processed, such that each element of the target matrix is written exactly
+   // once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedBlockKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::BlockType      BlockType;
+
+      enum { BS = MT4::blockSize };
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         const BlockType* const begin( A.blocks() + A.blockOffset( I ) );
+         const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+         const size_t* const indices( A.indices() + A.blockOffset( I ) );
+
+         for( size_t j=0UL; j<B.columns(); j+=IT::size )
+         {
+            IntrinsicType xmm[BS];
+            const size_t* index( indices );
+
+            for( const BlockType* block=begin; block!=end; ++block, ++index ) {
+               for( size_t c=0UL; c<BS; ++c ) {
+                  const IntrinsicType b( B.load( (*index)*BS+c, j ) );
+                  for( size_t r=0UL; r<BS; ++r ) {
+                     xmm[r] = xmm[r] + set( (*block)(r,c) ) * b;
+                  }
+               }
+            }
+
+            for( size_t r=0UL; r<BS; ++r ) {
+               (~C).store( I*BS+r, j, xmm[r] );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to column-major dense matrices*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a sparse matrix-dense matrix multiplication to column-major
@@ -1164,6 +1420,200 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Register-blocked addition assignment to row-major dense matrices****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked addition assignment of a sparse matrix-dense matrix multiplication to
+   //        row-major dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the register-blocked row-major addition assignment kernel for the
+   // sparse matrix-dense matrix multiplication. Each row of the sparse matrix is applied to a
+   // group of up to four intrinsic vectors of right-hand side columns at once, whose partial
+   // results are held in registers until the entire row has been processed. Thus the sparse row is
+   // streamed only once per column group and every element of the target matrix is loaded and
+   // stored exactly once, which is particularly beneficial for tall and skinny right-hand side
+   // dense matrices.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::ConstIterator  ConstIterator;
+
+      const size_t N( B.columns() );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ConstIterator begin( A.begin(i) );
+         const ConstIterator end  ( A.end(i)   );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
+         {
+            IntrinsicType xmm1( (~C).load(i,j             ) );
+            IntrinsicType xmm2( (~C).load(i,j+IT::size    ) );
+            IntrinsicType xmm3( (~C).load(i,j+IT::size*2UL) );
+            IntrinsicType xmm4( (~C).load(i,j+IT::size*3UL) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t k( element->index() );
+               xmm1 = xmm1 + a1 * B.load(k,j             );
+               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
+               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
+               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+            }
+
+            (~C).store( i, j             , xmm1 );
+            (~C).store( i, j+IT::size    , xmm2 );
+            (~C).store( i, j+IT::size*2UL, xmm3 );
+            (~C).store( i, j+IT::size*3UL, xmm4 );
+         }
+
+         for( ; (j+IT::size) < N; j+=IT::size*2UL )
+         {
+            IntrinsicType xmm1( (~C).load(i,j         ) );
+            IntrinsicType xmm2( (~C).load(i,j+IT::size) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t k( element->index() );
+               xmm1 = xmm1 + a1 * B.load(k,j         );
+               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+            }
+
+            (~C).store( i, j         , xmm1 );
+            (~C).store( i, j+IT::size, xmm2 );
+         }
+
+         if( j < N )
+         {
+            IntrinsicType xmm1( (~C).load(i,j) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               xmm1 = xmm1 + set( element->value() ) * B.load(element->index(),j);
+            }
+
+            (~C).store( i, j, xmm1 );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default block addition assignment to row-major dense matrices*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a block compressed matrix-dense matrix multiplication to
+   //        row-major dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the default row-major addition assignment kernel for the block
+   // compressed matrix-dense matrix multiplication. Each element of a block is multiplied
+   // with the according row of the dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDefaultBlockKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef typename MT4::BlockType  BlockType;
+
+      enum { BS = MT4::blockSize };
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         const BlockType* block( A.blocks() + A.blockOffset( I ) );
+         const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+         const size_t* index( A.indices() + A.blockOffset( I ) );
+
+         for( ; block!=end; ++block, ++index ) {
+            for( size_t r=0UL; r<BS; ++r ) {
+               for( size_t c=0UL; c<BS; ++c ) {
+                  const size_t k( (*index)*BS+c );
+                  for( size_t j=0UL; j<B.columns(); ++j ) {
+                     (~C)(I*BS+r,j) += (*block)(r,c) * B(k,j);
+                  }
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized block addition assignment to row-major dense matrices****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a block compressed matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized row-major addition assignment kernel for the block
+   // compressed matrix-dense matrix multiplication. For every block row of the sparse matrix
+   // the result is computed in strips of the width of a single intrinsic vector. The partial
+   // results of all rows of the block row are held in registers until all blocks of the block
+   // row have been processed, such that each element of the target matrix is written exactly
+   // once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedBlockKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::BlockType      BlockType;
+
+      enum { BS = MT4::blockSize };
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         const BlockType* const begin( A.blocks() + A.blockOffset( I ) );
+         const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+         const size_t* const indices( A.indices() + A.blockOffset( I ) );
+
+         for( size_t j=0UL; j<B.columns(); j+=IT::size )
+         {
+            IntrinsicType xmm[BS];
+            const size_t* index( indices );
+
+            for( const BlockType* block=begin; block!=end; ++block, ++index ) {
+               for( size_t c=0UL; c<BS; ++c ) {
+                  const IntrinsicType b( B.load( (*index)*BS+c, j ) );
+                  for( size_t r=0UL; r<BS; ++r ) {
+                     xmm[r] = xmm[r] + set( (*block)(r,c) ) * b;
+                  }
+               }
+            }
+
+            for( size_t r=0UL; r<BS; ++r ) {
+               (~C).store( I*BS+r, j, (~C).load(I*BS+r,j) + xmm[r] );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to column-major dense matrices**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a sparse matrix-dense matrix multiplication to
@@ -1551,6 +2001,200 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Register-blocked subtraction assignment to row-major dense matrices*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked subtraction assignment of a sparse matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the register-blocked row-major subtraction assignment kernel for the
+   // sparse matrix-dense matrix multiplication. Each row of the sparse matrix is applied to a
+   // group of up to four intrinsic vectors of right-hand side columns at once, whose partial
+   // results are held in registers until the entire row has been processed. Thus the sparse row is
+   // streamed only once per column group and every element of the target matrix is loaded and
+   // stored exactly once, which is particularly beneficial for tall and skinny right-hand side
+   // dense matrices.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::ConstIterator  ConstIterator;
+
+      const size_t N( B.columns() );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ConstIterator begin( A.begin(i) );
+         const ConstIterator end  ( A.end(i)   );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
+         {
+            IntrinsicType xmm1( (~C).load(i,j             ) );
+            IntrinsicType xmm2( (~C).load(i,j+IT::size    ) );
+            IntrinsicType xmm3( (~C).load(i,j+IT::size*2UL) );
+            IntrinsicType xmm4( (~C).load(i,j+IT::size*3UL) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t k( element->index() );
+               xmm1 = xmm1 - a1 * B.load(k,j             );
+               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
+               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
+               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+            }
+
+            (~C).store( i, j             , xmm1 );
+            (~C).store( i, j+IT::size    , xmm2 );
+            (~C).store( i, j+IT::size*2UL, xmm3 );
+            (~C).store( i, j+IT::size*3UL, xmm4 );
+         }
+
+         for( ; (j+IT::size) < N; j+=IT::size*2UL )
+         {
+            IntrinsicType xmm1( (~C).load(i,j         ) );
+            IntrinsicType xmm2( (~C).load(i,j+IT::size) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t k( element->index() );
+               xmm1 = xmm1 - a1 * B.load(k,j         );
+               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+            }
+
+            (~C).store( i, j         , xmm1 );
+            (~C).store( i, j+IT::size, xmm2 );
+         }
+
+         if( j < N )
+         {
+            IntrinsicType xmm1( (~C).load(i,j) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               xmm1 = xmm1 - set( element->value() ) * B.load(element->index(),j);
+            }
+
+            (~C).store( i, j, xmm1 );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default block subtraction assignment to row-major dense matrices****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a block compressed matrix-dense matrix multiplication to
+   //        row-major dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the default row-major subtraction assignment kernel for the block
+   // compressed matrix-dense matrix multiplication. Each element of a block is multiplied
+   // with the according row of the dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDefaultBlockKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef typename MT4::BlockType  BlockType;
+
+      enum { BS = MT4::blockSize };
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         const BlockType* block( A.blocks() + A.blockOffset( I ) );
+         const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+         const size_t* index( A.indices() + A.blockOffset( I ) );
+
+         for( ; block!=end; ++block, ++index ) {
+            for( size_t r=0UL; r<BS; ++r ) {
+               for( size_t c=0UL; c<BS; ++c ) {
+                  const size_t k( (*index)*BS+c );
+                  for( size_t j=0UL; j<B.columns(); ++j ) {
+                     (~C)(I*BS+r,j) -= (*block)(r,c) * B(k,j);
+                  }
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized block subtraction assignment to row-major dense matrices*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a block compressed matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized row-major subtraction assignment kernel for the block
+   // compressed matrix-dense matrix multiplication. For every block row of the sparse matrix
+   // the result is computed in strips of the width of a single intrinsic vector. The partial
+   // results of all rows of the block row are held in registers until all blocks of the block
+   // row have been processed, such that each element of the target matrix is written exactly
+   // once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedBlockKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::BlockType      BlockType;
+
+      enum { BS = MT4::blockSize };
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         const BlockType* const begin( A.blocks() + A.blockOffset( I ) );
+         const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+         const size_t* const indices( A.indices() + A.blockOffset( I ) );
+
+         for( size_t j=0UL; j<B.columns(); j+=IT::size )
+         {
+            IntrinsicType xmm[BS];
+            const size_t* index( indices );
+
+            for( const BlockType* block=begin; block!=end; ++block, ++index ) {
+               for( size_t c=0UL; c<BS; ++c ) {
+                  const IntrinsicType b( B.load( (*index)*BS+c, j ) );
+                  for( size_t r=0UL; r<BS; ++r ) {
+                     xmm[r] = xmm[r] + set( (*block)(r,c) ) * b;
+                  }
+               }
+            }
+
+            for( size_t r=0UL; r<BS; ++r ) {
+               (~C).store( I*BS+r, j, (~C).load(I*BS+r,j) - xmm[r] );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to column-major dense matrices*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a sparse matrix-dense matrix multiplication to
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <iterator>
 #include <stdexcept>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
@@ -51,15 +52,23 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SplitIterator.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHypersparse.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
@@ -69,8 +78,13 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsPointer.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -147,6 +161,113 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix type provides pointer access to its non-zero elements, the dense
+       vector type provides direct access to its data and both types have the same vectorizable
+       floating point element type, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseVectorizedKernel {
+      typedef typename T1::ConstIterator                            Iterator;
+      typedef typename std::iterator_traits<Iterator>::value_type  Element;
+      typedef typename T1::ElementType                              ET;
+      enum { value = IsPointer<Iterator>::value &&
+                     HasConstDataAccess<T2>::value &&
+                     IsSame<ET,typename T2::ElementType>::value &&
+                     IsFloatingPoint<ET>::value &&
+                     sizeof( Element ) % sizeof( ET ) == 0UL &&
+                     IntrinsicTrait<ET>::addition &&
+                     IntrinsicTrait<ET>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix type stores the values and indices of its non-zero elements in
+       separate arrays using either 64-bit (\c size_t) or 32-bit (\c uint32_t) indices, the dense
+       vector type provides direct access to its data and both types have the same vectorizable
+       floating point element type, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseSplitKernel {
+      typedef typename T1::ElementType    ET;
+      typedef typename T1::ConstIterator  Iterator;
+      enum { value = IsSplitCompressed<T1>::value &&
+                     ( IsSame< Iterator, SplitIterator<const ET,size_t>   >::value ||
+                       IsSame< Iterator, SplitIterator<const ET,uint32_t> >::value ) &&
+                     HasConstDataAccess<T2>::value &&
+                     IsSame<ET,typename T2::ElementType>::value &&
+                     IsFloatingPoint<ET>::value &&
+                     IntrinsicTrait<ET>::addition &&
+                     IntrinsicTrait<ET>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand is a SlicedEllpackMatrix that does not require an
+       intermediate evaluation and the dense vector operand is not a compound expression, the
+       nested \value will be set to 1 and the multiplication expression is evaluated chunk by
+       chunk. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseChunkKernel {
+      enum { value = !useAssign && IsSlicedEllpack<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand is a BlockCompressedMatrix that does not require an
+       intermediate evaluation and the dense vector operand is not a compound expression, the
+       nested \value will be set to 1 and the multiplication expression is evaluated block row
+       by block row. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseBlockKernel {
+      enum { value = !useAssign && IsBlockCompressed<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand is a HypersparseMatrix that does not require an
+       intermediate evaluation and the dense vector operand is not a compound expression, the
+       nested \value will be set to 1 and the multiplication expression is evaluated by only
+       traversing the non-empty rows. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseHypersparseKernel {
+      enum { value = !useAssign && IsHypersparse<MT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense vector type provides direct access to its data, both types have the
+       same vectorizable floating point element type and the chunk size of the sliced ELLPACK
+       matrix is a multiple of the number of elements per intrinsic vector, the nested \value
+       will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseVectorizedChunkKernel {
+      typedef typename T1::ElementType  ET;
+      enum { value = HasConstDataAccess<T2>::value &&
+                     IsSame<ET,typename T2::ElementType>::value &&
+                     IsFloatingPoint<ET>::value &&
+                     T1::chunkSize % IntrinsicTrait<ET>::size == 0UL &&
+                     IntrinsicTrait<ET>::addition &&
+                     IntrinsicTrait<ET>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatDVecMultExpr<MT,VT>             This;           //!< Type of this SMatDVecMultExpr instance.
@@ -203,8 +324,6 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    inline ReturnType operator[]( size_t index ) const {
       BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
 
-      typedef typename RemoveReference<MCT>::Type::ConstIterator  ConstIterator;
-
       ElementType tmp = ElementType();
 
       // Early exit
@@ -215,46 +334,7 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       if( !RequiresEvaluation<MT>::value )
       {
          MCT A( mat_ );  // Evaluation of the left-hand side sparse matrix operand
-
-         const ConstIterator end( A.end(index) );
-         ConstIterator element( A.begin(index) );
-
-         // Early exit in case row 'index' is empty
-         if( element == end )
-            return tmp;
-
-         // Calculating element 'index' for numeric data types
-         if( IsNumeric<ElementType>::value )
-         {
-            const size_t ipos( A.nonZeros(index) & size_t(-2) );
-            ElementType tmp2 = ElementType();
-
-            for( size_t i=0UL; i<ipos; i+=2UL )
-            {
-               const ElementType value1( element->value() );
-               const size_t      index1( element->index() );
-               ++element;
-               const ElementType value2( element->value() );
-               const size_t      index2( element->index() );
-               ++element;
-
-               tmp  += value1 * vec_[index1];
-               tmp2 += value2 * vec_[index2];
-            }
-            if( element!=end ) {
-               tmp += element->value() * vec_[element->index()];
-            }
-
-            tmp += tmp2;
-         }
-
-         // Calculating element 'index' for non-numeric data types
-         else {
-            tmp = element->value() * vec_[element->index()];
-            ++element;
-            for( ; element!=end; ++element )
-               tmp += element->value() * vec_[element->index()];
-         }
+         tmp = selectRowKernel( A, vec_, index );
       }
 
       // Default computation in case the left-hand side sparse matrix doesn't provide iterators
@@ -349,170 +429,1083 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
-   //**Assignment to dense vectors*****************************************************************
+   //**Default row kernel**************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
-   //        (\f$ \vec{y}=A*\vec{x} \f$).
-   // \ingroup dense_vector
+   /*!\brief Default computation of a single element of a sparse matrix-dense vector multiplication
+   //        (\f$ y_i=A_{i*}*\vec{x} \f$).
    //
-   // \param lhs The target left-hand side dense vector.
-   // \param rhs The right-hand side multiplication expression to be assigned.
-   // \return void
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the row of \a A to be multiplied.
+   // \return The resulting value.
    //
-   // This function implements the performance optimized assignment of a sparse matrix-dense
-   // vector multiplication expression to a dense vector. Due to the explicit application of
-   // the SFINAE principle, this function can only be selected by the compiler in case either
-   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
-   // side vector operand is a compound expression.
+   // This function implements the default kernel for the computation of a single element of
+   // the sparse matrix-dense vector multiplication. It is additionally used by the vectorized
+   // kernel for rows that contain too few non-zero elements to benefit from vectorization.
    */
-   template< typename VT1 >  // Type of the target dense vector
-   friend inline typename EnableIf< UseAssign<VT1> >::Type
-      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline ElementType selectDefaultRowKernel( const MT1& A, const VT1& x, size_t i )
    {
-      BLAZE_FUNCTION_TRACE;
+      typedef typename MT1::ConstIterator  ConstIterator;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+      ElementType tmp = ElementType();
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
+      const ConstIterator end( A.end(i) );
+      ConstIterator element( A.begin(i) );
 
-      if( rhs.mat_.columns() == 0UL ) {
-         reset( ~lhs );
-         return;
+      // Early exit in case row 'i' is empty
+      if( element == end )
+         return tmp;
+
+      // Calculating element 'i' for numeric data types
+      if( IsNumeric<ElementType>::value )
+      {
+         const size_t kpos( A.nonZeros(i) & size_t(-2) );
+         ElementType tmp2 = ElementType();
+
+         for( size_t k=0UL; k<kpos; k+=2UL )
+         {
+            const ElementType value1( element->value() );
+            const size_t      index1( element->index() );
+            ++element;
+            const ElementType value2( element->value() );
+            const size_t      index2( element->index() );
+            ++element;
+
+            tmp  += value1 * x[index1];
+            tmp2 += value2 * x[index2];
+         }
+         if( element!=end ) {
+            tmp += element->value() * x[element->index()];
+         }
+
+         tmp += tmp2;
       }
 
-      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
-      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+      // Calculating element 'i' for non-numeric data types
+      else {
+         tmp = element->value() * x[element->index()];
+         ++element;
+         for( ; element!=end; ++element )
+            tmp += element->value() * x[element->index()];
+      }
 
-      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
-      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+      return tmp;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-      assign( ~lhs, A * x );
+   //**Row kernel selection************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for the computation of a single element of a sparse
+   //        matrix-dense vector multiplication (\f$ y_i=A_{i*}*\vec{x} \f$).
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the row of \a A to be multiplied.
+   // \return The resulting value.
+   //
+   // This function relays to the default kernel for the computation of a single element of the
+   // sparse matrix-dense vector multiplication.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< Or< UseVectorizedKernel<MT1,VT1>, UseSplitKernel<MT1,VT1> >
+                                   , ElementType >::Type
+      selectRowKernel( const MT1& A, const VT1& x, size_t i )
+   {
+      return selectDefaultRowKernel( A, x, i );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Assignment to sparse vectors****************************************************************
+   //**Vectorized row kernel***********************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a sparse matrix-dense vector multiplication to a sparse vector
-   //        (\f$ \vec{y}=A*\vec{x} \f$).
-   // \ingroup dense_vector
+   /*!\brief Vectorized computation of a single element of a sparse matrix-dense vector
+   //        multiplication (\f$ y_i=A_{i*}*\vec{x} \f$).
    //
-   // \param lhs The target left-hand side sparse vector.
-   // \param rhs The right-hand side multiplication expression to be assigned.
-   // \return void
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the row of \a A to be multiplied.
+   // \return The resulting value.
    //
-   // This function implements the performance optimized assignment of a sparse matrix-dense
-   // vector multiplication expression to a sparse vector. Due to the explicit application of
-   // the SFINAE principle, this function can only be selected by the compiler in case either
-   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
-   // side vector operand is a compound expression.
+   // This function implements the vectorized kernel for the computation of a single element of
+   // the sparse matrix-dense vector multiplication. The values of the non-zero elements are
+   // loaded in chunks of intrinsic width and the according elements of the dense vector are
+   // gathered via their indices (by means of the AVX2 gather instructions or, if these are not
+   // available, by an emulated gather). Long rows are processed by four independent accumulators
+   // to hide the latency of the gather and addition operations, short rows are handled by the
+   // default kernel. Additionally, the first elements of the subsequent row are prefetched.
    */
-   template< typename VT1 >  // Type of the target sparse vector
-   friend inline typename EnableIf< UseAssign<VT1> >::Type
-      assign( SparseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseVectorizedKernel<MT1,VT1>, ElementType >::Type
+      selectRowKernel( const MT1& A, const VT1& x, size_t i )
    {
-      BLAZE_FUNCTION_TRACE;
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT1::ConstIterator  ConstIterator;
 
-      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
-      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
-      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+      if( i+1UL < A.rows() ) {
+         prefetch( A.begin(i+1UL) );
+      }
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+      const size_t nonzeros( A.nonZeros(i) );
 
-      const ResultType tmp( serial( rhs ) );
-      assign( ~lhs, tmp );
+      if( nonzeros < IT::size*2UL ) {
+         return selectDefaultRowKernel( A, x, i );
+      }
+
+      const ElementType* const xdata( x.data() );
+      const ConstIterator end( A.end(i) );
+      ConstIterator element( A.begin(i) );
+
+      const size_t stride( sizeof( *element ) / sizeof( ElementType ) );
+
+      IntrinsicType xmm1, xmm2, xmm3, xmm4;
+      size_t k( 0UL );
+
+      for( ; (k+IT::size*4UL) <= nonzeros; k+=IT::size*4UL ) {
+         xmm1 = xmm1 + loads( &element->value(), stride ) * gather( xdata, element );
+         element += IT::size;
+         xmm2 = xmm2 + loads( &element->value(), stride ) * gather( xdata, element );
+         element += IT::size;
+         xmm3 = xmm3 + loads( &element->value(), stride ) * gather( xdata, element );
+         element += IT::size;
+         xmm4 = xmm4 + loads( &element->value(), stride ) * gather( xdata, element );
+         element += IT::size;
+      }
+
+      for( ; (k+IT::size) <= nonzeros; k+=IT::size ) {
+         xmm1 = xmm1 + loads( &element->value(), stride ) * gather( xdata, element );
+         element += IT::size;
+      }
+
+      ElementType tmp( sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+      for( ; element!=end; ++element ) {
+         tmp += element->value() * xdata[element->index()];
+      }
+
+      return tmp;
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to dense vectors********************************************************
+   //**Split row kernel****************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a sparse matrix-dense vector multiplication to a dense vector.
-   //        (\f$ \vec{y}+=A*\vec{x} \f$).
-   // \ingroup dense_vector
+   /*!\brief Vectorized computation of a single element of a sparse matrix-dense vector
+   //        multiplication with separate value and index arrays (\f$ y_i=A_{i*}*\vec{x} \f$).
    //
-   // \param lhs The target left-hand side dense vector.
-   // \param rhs The right-hand side multiplication expression to be added.
-   // \return void
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the row of \a A to be multiplied.
+   // \return The resulting value.
    //
-   // This function implements the performance optimized addition assignment of a sparse matrix-
-   // dense vector multiplication expression to a dense vector. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case either
-   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
-   // side vector operand is a compound expression.
+   // This function implements the vectorized kernel for sparse matrices that store the values
+   // and the indices of their non-zero elements in two separate arrays (as for instance the
+   // SplitCompressedMatrix). In contrast to the strided loads of the vectorized row kernel, the
+   // values of the non-zero elements are loaded via contiguous unaligned loads and the elements
+   // of the dense vector are gathered directly from the index array.
    */
-   template< typename VT1 >  // Type of the target dense vector
-   friend inline typename EnableIf< UseAssign<VT1> >::Type
-      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSplitKernel<MT1,VT1>, ElementType >::Type
+      selectRowKernel( const MT1& A, const VT1& x, size_t i )
    {
-      BLAZE_FUNCTION_TRACE;
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT1::IndexType      IndexType;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+      const size_t nonzeros( A.nonZeros(i) );
+      const ElementType* const values ( A.values(i)  );
+      const IndexType*   const indices( A.indices(i) );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
+      if( i+1UL < A.rows() ) {
+         prefetch( A.values(i+1UL) );
+         prefetch( A.indices(i+1UL) );
+      }
 
-      if( rhs.mat_.columns() == 0UL ) {
-         return;
+      const ElementType* const xdata( x.data() );
+
+      IntrinsicType xmm1, xmm2, xmm3, xmm4;
+      size_t k( 0UL );
+
+      for( ; (k+IT::size*4UL) <= nonzeros; k+=IT::size*4UL ) {
+         xmm1 = xmm1 + loadu( values+k              ) * gather( xdata, indices+k              );
+         xmm2 = xmm2 + loadu( values+k+IT::size     ) * gather( xdata, indices+k+IT::size     );
+         xmm3 = xmm3 + loadu( values+k+IT::size*2UL ) * gather( xdata, indices+k+IT::size*2UL );
+         xmm4 = xmm4 + loadu( values+k+IT::size*3UL ) * gather( xdata, indices+k+IT::size*3UL );
       }
 
-      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
-      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+      for( ; (k+IT::size) <= nonzeros; k+=IT::size ) {
+         xmm1 = xmm1 + loadu( values+k ) * gather( xdata, indices+k );
+      }
 
-      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
-      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+      ElementType tmp( sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
 
-      addAssign( ~lhs, A * x );
+      for( ; k<nonzeros; ++k ) {
+         tmp += values[k] * xdata[indices[k]];
+      }
+
+      return tmp;
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to sparse vectors*******************************************************
-   // No special implementation for the addition assignment to sparse vectors.
+   //**Chunk row lengths***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the number of non-zero elements of all rows of a single chunk of a sliced
+   //        ELLPACK matrix.
+   //
+   // \param A The sliced ELLPACK matrix.
+   // \param c The index of the chunk of \a A.
+   // \param lengths The target array for the \a C row lengths (in the row order of the chunk).
+   // \return The number of non-zero elements of the shortest row of the chunk.
+   //
+   // The rows of the last chunk that exceed the number of rows of the matrix are empty.
+   */
+   template< typename MT1 >  // Type of the sliced ELLPACK matrix
+   static inline size_t chunkLengths( const MT1& A, size_t c, size_t* lengths )
+   {
+      const size_t C( MT1::chunkSize );
+      const size_t* const perm( A.permutation() );
+
+      size_t full( A.chunkWidth( c ) );
+
+      for( size_t r=0UL; r<C; ++r ) {
+         lengths[r] = ( c*C+r < A.rows() )?( A.nonZeros( perm[c*C+r] ) ):( 0UL );
+         full = min( full, lengths[r] );
+      }
+
+      return full;
+   }
+   /*! \endcond */
    //**********************************************************************************************
 
-   //**Subtraction assignment to dense vectors*****************************************************
+   //**Default chunk kernel************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a sparse matrix-dense vector multiplication to a dense
-   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
-   // \ingroup dense_vector
+   /*!\brief Default computation of the elements of a single chunk of a sliced ELLPACK matrix-dense
+   //        vector multiplication.
    //
-   // \param lhs The target left-hand side dense vector.
-   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param c The index of the chunk of \a A to be multiplied.
+   // \param y The target array for the \a C resulting values (in the row order of the chunk).
    // \return void
    //
-   // This function implements the performance optimized subtraction assignment of a sparse matrix-
-   // dense vector multiplication expression to a dense vector. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case either
-   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
-   // side vector operand is a compound expression.
+   // This function implements the default kernel for the computation of the results of all rows
+   // of a single chunk of a sliced ELLPACK matrix. The elements of the chunk are traversed in
+   // storage order, i.e. the k-th non-zero element of all rows is processed before the (k+1)-th
+   // non-zero elements. Up to the length of the shortest row of the chunk, all rows are processed
+   // unconditionally. Beyond, only the actual non-zero elements of each row are processed, i.e.
+   // the padding elements never contribute to the result (not even as \f$ 0 \cdot \infty \f$).
    */
-   template< typename VT1 >  // Type of the target dense vector
-   friend inline typename EnableIf< UseAssign<VT1> >::Type
-      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseVectorizedChunkKernel<MT1,VT1> >::Type
+      selectChunkKernel( const MT1& A, const VT1& x, size_t c, ElementType* y )
    {
-      BLAZE_FUNCTION_TRACE;
+      const size_t C( MT1::chunkSize );
+      const size_t width( A.chunkWidth( c ) );
+      const typename MT1::ElementType* const values( A.values() + A.chunkOffset( c ) );
+      const size_t* const indices( A.indices() + A.chunkOffset( c ) );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+      size_t lengths[MT1::chunkSize];
+      const size_t full( chunkLengths( A, c, lengths ) );
 
-      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
+      if( full == 0UL ) {
+         for( size_t r=0UL; r<C; ++r )
+            reset( y[r] );
+      }
+      else {
+         for( size_t r=0UL; r<C; ++r ) {
+            y[r] = values[r] * x[indices[r]];
+         }
+      }
 
-      if( rhs.mat_.columns() == 0UL ) {
-         return;
+      for( size_t k=1UL; k<full; ++k ) {
+         for( size_t r=0UL; r<C; ++r ) {
+            y[r] += values[k*C+r] * x[indices[k*C+r]];
+         }
       }
 
-      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
-      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+      for( size_t k=full; k<width; ++k ) {
+         for( size_t r=0UL; r<C; ++r ) {
+            if( k < lengths[r] )
+               y[r] += values[k*C+r] * x[indices[k*C+r]];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
 
-      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
-      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+   //**Vectorized chunk kernel*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized computation of the elements of a single chunk of a sliced ELLPACK
+   //        matrix-dense vector multiplication.
+   //
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param c The index of the chunk of \a A to be multiplied.
+   // \param y The target array for the \a C resulting values (in the row order of the chunk).
+   // \return void
+   //
+   // This function implements the vectorized kernel for the computation of the results of all
+   // rows of a single chunk of a sliced ELLPACK matrix. In contrast to the vectorized row kernel,
+   // the vectorization is performed across the rows of the chunk: Each intrinsic vector holds
+   // the partial results of several rows. Since the values and indices of the k-th non-zero
+   // elements of all rows of a chunk are stored contiguously, they can be loaded directly and
+   // no horizontal reduction is required. Two sets of accumulators are used to hide the latency
+   // of the gather and addition operations. The vectorized loop is restricted to the length of
+   // the shortest row of the chunk. The remaining non-zero elements of the longer rows are added
+   // individually, such that the padding elements never contribute to the result (not even as
+   // \f$ 0 \cdot \infty \f$).
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseVectorizedChunkKernel<MT1,VT1> >::Type
+      selectChunkKernel( const MT1& A, const VT1& x, size_t c, ElementType* y )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
 
-      subAssign( ~lhs, A * x );
+      enum { C = MT1::chunkSize, L = MT1::chunkSize / IT::size };
+
+      const size_t width( A.chunkWidth( c ) );
+      const ElementType* values( A.values() + A.chunkOffset( c ) );
+      const size_t* indices( A.indices() + A.chunkOffset( c ) );
+      const ElementType* const xdata( x.data() );
+
+      size_t lengths[C];
+      const size_t full( chunkLengths( A, c, lengths ) );
+
+      IntrinsicType xmm1[L], xmm2[L];
+      size_t k( 0UL );
+
+      for( ; (k+2UL) <= full; k+=2UL ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            xmm1[l] = xmm1[l] + loadu( values+l*IT::size   ) * gather( xdata, indices+l*IT::size   );
+            xmm2[l] = xmm2[l] + loadu( values+l*IT::size+C ) * gather( xdata, indices+l*IT::size+C );
+         }
+         values  += 2UL*C;
+         indices += 2UL*C;
+      }
+
+      if( k < full ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            xmm1[l] = xmm1[l] + loadu( values+l*IT::size ) * gather( xdata, indices+l*IT::size );
+         }
+         values  += C;
+         indices += C;
+         ++k;
+      }
+
+      for( size_t l=0UL; l<L; ++l ) {
+         storeu( y+l*IT::size, xmm1[l] + xmm2[l] );
+      }
+
+      for( ; k<width; ++k ) {
+         for( size_t r=0UL; r<C; ++r ) {
+            if( k < lengths[r] )
+               y[r] += values[r] * xdata[indices[r]];
+         }
+         values  += C;
+         indices += C;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block kernel********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computation of the elements of a single block row of a block compressed matrix-dense
+   //        vector multiplication.
+   //
+   // \param A The left-hand side block compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param I The index of the block row of \a A to be multiplied.
+   // \param y The target array for the \a B resulting values.
+   // \return void
+   //
+   // This function implements the kernel for the computation of the results of all rows of a
+   // single block row of a block compressed matrix. Since the block size is a compile time
+   // constant, all loops over the elements of a block can be completely unrolled. The partial
+   // results of all rows and the elements of the dense vector that are required for the current
+   // block are held in local arrays in order to keep them in registers.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline void selectBlockKernel( const MT1& A, const VT1& x, size_t I, ElementType* y )
+   {
+      typedef typename MT1::BlockType    BlockType;
+      typedef typename VT1::ElementType  ET;
+
+      enum { B = MT1::blockSize };
+
+      const BlockType* block( A.blocks() + A.blockOffset( I ) );
+      const BlockType* const end( A.blocks() + A.blockOffset( I+1UL ) );
+      const size_t* index( A.indices() + A.blockOffset( I ) );
+
+      ElementType tmp[B];
+      ET xb[B];
+
+      for( size_t r=0UL; r<B; ++r ) {
+         reset( tmp[r] );
+      }
+
+      for( ; block!=end; ++block, ++index )
+      {
+         const size_t jbegin( (*index)*B );
+
+         for( size_t c=0UL; c<B; ++c ) {
+            xb[c] = x[jbegin+c];
+         }
+
+         for( size_t r=0UL; r<B; ++r ) {
+            for( size_t c=0UL; c<B; ++c ) {
+               tmp[r] += (*block)(r,c) * xb[c];
+            }
+         }
+      }
+
+      for( size_t r=0UL; r<B; ++r ) {
+         y[r] = tmp[r];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hypersparse kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computation of a single element of a hypersparse matrix-dense vector multiplication.
+   //
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param k The position of the row within the non-empty rows of \a A.
+   // \return The resulting value.
+   //
+   // This function implements the kernel for the computation of the result of the \a k-th
+   // non-empty row of a hypersparse matrix. In contrast to the default row kernel, the row is
+   // accessed directly via its position and not via a binary search for the row index.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline ElementType selectHypersparseKernel( const MT1& A, const VT1& x, size_t k )
+   {
+      typedef typename MT1::ConstIterator  ConstIterator;
+
+      const ConstIterator end( A.nonEmptyEnd(k) );
+      ConstIterator element( A.nonEmptyBegin(k) );
+
+      BLAZE_INTERNAL_ASSERT( element != end, "Invalid empty row detected" );
+
+      ElementType tmp( element->value() * x[element->index()] );
+      ++element;
+      for( ; element!=end; ++element )
+         tmp += element->value() * x[element->index()];
+
+      return tmp;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix-dense
+   // vector multiplication expression to a dense vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case either
+   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
+   // side vector operand is a compound expression.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
+
+      if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      assign( ~lhs, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (sliced ELLPACK)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}= A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sliced ELLPACK
+   // matrix-dense vector multiplication expression to a dense vector. The results are computed
+   // chunk by chunk and are afterwards written to the according (unpermuted) rows of the target
+   // vector. Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case the left-hand side matrix operand is a SlicedEllpackMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type  MT1;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t C( MT1::chunkSize );
+      const size_t* const perm( A.permutation() );
+
+      ElementType tmp[MT1::chunkSize];
+
+      for( size_t c=0UL; c<A.chunks(); ++c )
+      {
+         selectChunkKernel( A, x, c, tmp );
+
+         const size_t rows( min( C, A.rows() - c*C ) );
+         for( size_t r=0UL; r<rows; ++r ) {
+            (~lhs)[perm[c*C+r]] = tmp[r];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (block compressed)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block compressed matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}= A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a block compressed
+   // matrix-dense vector multiplication expression to a dense vector. The results are computed
+   // block row by block row. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the left-hand side matrix operand
+   // is a BlockCompressedMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type  MT1;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t B( MT1::blockSize );
+
+      ElementType tmp[MT1::blockSize];
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         selectBlockKernel( A, x, I, tmp );
+
+         for( size_t r=0UL; r<B; ++r ) {
+            (~lhs)[I*B+r] = tmp[r];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (hypersparse)***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a hypersparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a hypersparse
+   // matrix-dense vector multiplication expression to a dense vector. Only the non-empty rows
+   // of the matrix are traversed. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the left-hand side matrix operand
+   // is a HypersparseMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseHypersparseKernel<VT1> >::Type
+      assign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      reset( ~lhs );
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k ) {
+         (~lhs)[indices[k]] = selectHypersparseKernel( A, x, k );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-dense vector multiplication to a sparse vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix-dense
+   // vector multiplication expression to a sparse vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case either
+   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
+   // side vector operand is a compound expression.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      assign( SparseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix-dense vector multiplication to a dense vector.
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sparse matrix-
+   // dense vector multiplication expression to a dense vector. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case either
+   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
+   // side vector operand is a compound expression.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      addAssign( ~lhs, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (sliced ELLPACK)***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}+= A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sliced ELLPACK
+   // matrix-dense vector multiplication expression to a dense vector. The results are computed
+   // chunk by chunk and are afterwards written to the according (unpermuted) rows of the target
+   // vector. Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case the left-hand side matrix operand is a SlicedEllpackMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type  MT1;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t C( MT1::chunkSize );
+      const size_t* const perm( A.permutation() );
+
+      ElementType tmp[MT1::chunkSize];
+
+      for( size_t c=0UL; c<A.chunks(); ++c )
+      {
+         selectChunkKernel( A, x, c, tmp );
+
+         const size_t rows( min( C, A.rows() - c*C ) );
+         for( size_t r=0UL; r<rows; ++r ) {
+            (~lhs)[perm[c*C+r]] += tmp[r];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (block compressed)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a block compressed matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+= A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a block compressed
+   // matrix-dense vector multiplication expression to a dense vector. The results are computed
+   // block row by block row. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the left-hand side matrix operand
+   // is a BlockCompressedMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type  MT1;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t B( MT1::blockSize );
+
+      ElementType tmp[MT1::blockSize];
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         selectBlockKernel( A, x, I, tmp );
+
+         for( size_t r=0UL; r<B; ++r ) {
+            (~lhs)[I*B+r] += tmp[r];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (hypersparse)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a hypersparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}+A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a hypersparse
+   // matrix-dense vector multiplication expression to a dense vector. Only the non-empty rows
+   // of the matrix are traversed. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the left-hand side matrix operand
+   // is a HypersparseMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseHypersparseKernel<VT1> >::Type
+      addAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k ) {
+         (~lhs)[indices[k]] += selectHypersparseKernel( A, x, k );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sparse matrix-
+   // dense vector multiplication expression to a dense vector. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case either
+   // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
+   // side vector operand is a compound expression.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type::ConstIterator  ConstIterator;
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      subAssign( ~lhs, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (sliced ELLPACK)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}-= A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sliced ELLPACK
+   // matrix-dense vector multiplication expression to a dense vector. The results are computed
+   // chunk by chunk and are afterwards written to the according (unpermuted) rows of the target
+   // vector. Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case the left-hand side matrix operand is a SlicedEllpackMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseChunkKernel<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type  MT1;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t C( MT1::chunkSize );
+      const size_t* const perm( A.permutation() );
+
+      ElementType tmp[MT1::chunkSize];
+
+      for( size_t c=0UL; c<A.chunks(); ++c )
+      {
+         selectChunkKernel( A, x, c, tmp );
+
+         const size_t rows( min( C, A.rows() - c*C ) );
+         for( size_t r=0UL; r<rows; ++r ) {
+            (~lhs)[perm[c*C+r]] -= tmp[r];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (block compressed)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a block compressed matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-= A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a block compressed
+   // matrix-dense vector multiplication expression to a dense vector. The results are computed
+   // block row by block row. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the left-hand side matrix operand
+   // is a BlockCompressedMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseBlockKernel<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type  MT1;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t B( MT1::blockSize );
+
+      ElementType tmp[MT1::blockSize];
+
+      for( size_t I=0UL; I<A.blockRows(); ++I )
+      {
+         selectBlockKernel( A, x, I, tmp );
+
+         for( size_t r=0UL; r<B; ++r ) {
+            (~lhs)[I*B+r] -= tmp[r];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (hypersparse)***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a hypersparse matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}-A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a hypersparse
+   // matrix-dense vector multiplication expression to a dense vector. Only the non-empty rows
+   // of the matrix are traversed. Due to the explicit application of the SFINAE principle, this
+   // function can only be selected by the compiler in case the left-hand side matrix operand
+   // is a HypersparseMatrix.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseHypersparseKernel<VT1> >::Type
+      subAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k ) {
+         (~lhs)[indices[k]] -= selectHypersparseKernel( A, x, k );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -400,15 +400,17 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
 
          while( l != lend && r != rend )
          {
-            if( l->index() < r->index() ) {
+            const size_t ri( r->index() );
+            for( ; l != lend && l->index() < ri; ++l )
                (~lhs).append( i, l->index(), l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
+            if( l == lend ) break;
+
+            const size_t li( l->index() );
+            for( ; r != rend && r->index() < li; ++r )
                (~lhs).append( i, r->index(), r->value() );
-               ++r;
-            }
-            else {
+            if( r == rend ) break;
+
+            if( li == r->index() ) {
                (~lhs).append( i, l->index(), l->value()+r->value() );
                ++l;
                ++r;
@@ -482,15 +484,17 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
 
          while( l != lend && r != rend )
          {
-            if( l->index() < r->index() ) {
+            const size_t ri( r->index() );
+            for( ; l != lend && l->index() < ri; ++l )
                ++nonzeros[l->index()];
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
+            if( l == lend ) break;
+
+            const size_t li( l->index() );
+            for( ; r != rend && r->index() < li; ++r )
                ++nonzeros[r->index()];
-               ++r;
-            }
-            else {
+            if( r == rend ) break;
+
+            if( li == r->index() ) {
                ++nonzeros[l->index()];
                ++l;
                ++r;
@@ -524,15 +528,17 @@ class SMatSMatAddExpr : public SparseMatrix< SMatSMatAddExpr<MT1,MT2>, false >
 
          while( l != lend && r != rend )
          {
-            if( l->index() < r->index() ) {
+            const size_t ri( r->index() );
+            for( ; l != lend && l->index() < ri; ++l )
                (~lhs).append( i, l->index(), l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
+            if( l == lend ) break;
+
+            const size_t li( l->index() );
+            for( ; r != rend && r->index() < li; ++r )
                (~lhs).append( i, r->index(), r->value() );
-               ++r;
-            }
-            else {
+            if( r == rend ) break;
+
+            if( li == r->index() ) {
                (~lhs).append( i, l->index(), l->value()+r->value() );
                ++l;
                ++r;
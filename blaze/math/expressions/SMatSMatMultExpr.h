@@ -43,6 +43,7 @@
 #include <algorithm>
 #include <stdexcept>
 #include <vector>
+#include <boost/thread/tss.hpp>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
@@ -56,6 +57,10 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Execute.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -366,6 +371,246 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    RightOperand rhs_;  //!< Right-hand side sparse matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**Sparse accumulators*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Accumulators for the rows of a sparse matrix-sparse matrix multiplication.
+   enum Accumulator { sortedList, hashTable, denseArray };
+
+   //! Maximum number of scalar multiplications per row for the sorted list accumulator.
+   enum { sortedListThreshold = 32 };
+
+   //! Minimum number of columns for the hash table accumulator.
+   enum { hashTableColumns = 1048576 };
+
+   //! Minimum ratio of columns to scalar multiplications per row for the hash table accumulator.
+   enum { hashTableRatio = 16 };
+
+   //! Maximum number of bytes of the accumulators retained by a thread after a multiplication.
+   enum { workspaceLimit = 1048576 };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Workspace***********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scratch memory of a single thread of a sparse matrix-sparse matrix multiplication.
+   //
+   // Every thread owns a single workspace (see the workspace() function), which is reused for
+   // all rows of all tasks and all multiplications executed by this thread. The arrays are only
+   // grown on demand, i.e. the dense arrays of size \f$ O(columns) \f$ are only allocated in case
+   // at least one row requires the dense array accumulator. In order to avoid the reset of the
+   // row markers, each pass over a set of rows is assigned a new range of marker values via the
+   // start() function. In order to bound the memory retained by idle threads, the arrays are
+   // released via the shrink() function at the end of every multiplication and every parallel
+   // task in case their total size exceeds \a workspaceLimit bytes.
+   */
+   struct Workspace
+   {
+      //**Constructor******************************************************************************
+      /*!\brief The default constructor for Workspace.
+      */
+      inline Workspace()
+         : next_( 0UL )  // The first unused row marker value
+      {}
+      //*******************************************************************************************
+
+      //**Start function***************************************************************************
+      /*!\brief Starts a new pass over the rows of a multiplication.
+      //
+      // \param rows The number of rows of the multiplication.
+      // \return The offset of the row markers of the pass.
+      //
+      // The row markers of row \a i of the pass are given by the returned offset plus \a i+1.
+      // In case the range of marker values is exhausted, all row markers are reset.
+      */
+      inline size_t start( size_t rows ) {
+         if( rows >= size_t(-1) - next_ ) {
+            std::fill( marker_.begin(), marker_.end(), 0UL );
+            next_ = 0UL;
+         }
+         const size_t offset( next_ );
+         next_ += rows;
+         return offset;
+      }
+      //*******************************************************************************************
+
+      //**Shrink function**************************************************************************
+      /*!\brief Releases the arrays of the workspace in case they exceed the workspace limit.
+      //
+      // \param flops \a true in case the number of scalar multiplications per row can be released.
+      // \return void
+      //
+      // The number of scalar multiplications per row is only released on request, since it is
+      // still in use by the calling thread while the tasks of a parallel multiplication run.
+      */
+      inline void shrink( bool flops ) {
+         const size_t bytes( sizeof( size_t ) *
+                             ( keys_.capacity() + marker_.capacity() + indices_.capacity() ) +
+                             sizeof( ElementType ) * ( values_.capacity() + row_.capacity() ) );
+         if( bytes > workspaceLimit ) {
+            std::vector<size_t>().swap( keys_ );
+            std::vector<size_t>().swap( marker_ );
+            std::vector<ElementType>().swap( values_ );
+            std::vector<size_t>().swap( indices_ );
+            std::vector<ElementType>().swap( row_ );
+            next_ = 0UL;
+         }
+         if( flops && flops_.capacity() * sizeof( size_t ) > workspaceLimit ) {
+            std::vector<size_t>().swap( flops_ );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      std::vector<size_t>      keys_;     //!< Sorted list and hash table keys.
+      std::vector<size_t>      marker_;   //!< Row markers of the dense array accumulator.
+      std::vector<ElementType> values_;   //!< Hash table and dense array values.
+      std::vector<size_t>      flops_;    //!< Number of scalar multiplications per row.
+      std::vector<size_t>      indices_;  //!< Column indices of a single row of the result.
+      std::vector<ElementType> row_;      //!< Values of a single row of the result.
+      size_t                   next_;     //!< The first unused row marker value.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Workspace access****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static boost::thread_specific_ptr<Workspace> workspace_;  //!< The workspaces of all threads.
+
+   /*!\brief Returns the workspace of the calling thread.
+   //
+   // \return Reference to the workspace of the calling thread.
+   */
+   static inline Workspace& workspace()
+   {
+      Workspace* ws( workspace_.get() );
+      if( ws == NULL ) {
+         ws = new Workspace();
+         workspace_.reset( ws );
+      }
+      return *ws;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symbolic task*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Task of the parallel symbolic phase of a sparse matrix-sparse matrix multiplication.
+   */
+   template< typename MT3    // Type of the left-hand side matrix operand
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   struct SymbolicTask
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SymbolicTask class template.
+      //
+      // \param A The left-hand side sparse matrix operand.
+      // \param B The right-hand side sparse matrix operand.
+      // \param flops The number of scalar multiplications per row.
+      // \param ranges The row ranges of all tasks.
+      // \param nonzeros The output array for the number of non-zero elements per row.
+      */
+      explicit inline SymbolicTask( const MT3& A, const MT4& B, const size_t* flops,
+                                    const size_t* ranges, size_t* nonzeros )
+         : A_       ( &A       )  // The left-hand side sparse matrix operand
+         , B_       ( &B       )  // The right-hand side sparse matrix operand
+         , flops_   ( flops    )  // The number of scalar multiplications per row
+         , ranges_  ( ranges   )  // The row ranges of all tasks
+         , nonzeros_( nonzeros )  // The number of non-zero elements per row
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Determines the number of non-zero elements of all rows of the given task.
+      //
+      // \param task The index of the task.
+      // \return void
+      */
+      inline void operator()( size_t task ) const {
+         Workspace& ws( workspace() );
+         const size_t offset( ws.start( A_->rows() ) );
+         for( size_t i=ranges_[task]; i<ranges_[task+1UL]; ++i ) {
+            nonzeros_[i] = symbolicRow( *A_, *B_, i, flops_[i], offset, ws );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const MT3*    A_;         //!< The left-hand side sparse matrix operand.
+      const MT4*    B_;         //!< The right-hand side sparse matrix operand.
+      const size_t* flops_;     //!< The number of scalar multiplications per row.
+      const size_t* ranges_;    //!< The row ranges of all tasks.
+      size_t*       nonzeros_;  //!< The number of non-zero elements per row.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Numeric task********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Task of the parallel numeric phase of a sparse matrix-sparse matrix multiplication.
+   */
+   template< typename MT3    // Type of the left-hand side matrix operand
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   struct NumericTask
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the NumericTask class template.
+      //
+      // \param A The left-hand side sparse matrix operand.
+      // \param B The right-hand side sparse matrix operand.
+      // \param flops The number of scalar multiplications per row.
+      // \param ranges The row ranges of all tasks.
+      // \param offsets The offsets of all rows within the output arrays.
+      // \param indices The output array for the column indices.
+      // \param values The output array for the values.
+      */
+      explicit inline NumericTask( const MT3& A, const MT4& B, const size_t* flops,
+                                   const size_t* ranges, const size_t* offsets,
+                                   size_t* indices, ElementType* values )
+         : A_      ( &A      )  // The left-hand side sparse matrix operand
+         , B_      ( &B      )  // The right-hand side sparse matrix operand
+         , flops_  ( flops   )  // The number of scalar multiplications per row
+         , ranges_ ( ranges  )  // The row ranges of all tasks
+         , offsets_( offsets )  // The offsets of all rows within the output arrays
+         , indices_( indices )  // The output array for the column indices
+         , values_ ( values  )  // The output array for the values
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Computes all rows of the given task.
+      //
+      // \param task The index of the task.
+      // \return void
+      */
+      inline void operator()( size_t task ) const {
+         Workspace& ws( workspace() );
+         const size_t offset( ws.start( A_->rows() ) );
+         for( size_t i=ranges_[task]; i<ranges_[task+1UL]; ++i ) {
+            const size_t bound( offsets_[i+1UL] - offsets_[i] );
+            if( bound > 0UL ) {
+               numericRow( *A_, *B_, i, flops_[i], offset, bound, ws,
+                           indices_+offsets_[i], values_+offsets_[i] );
+            }
+         }
+         ws.shrink( false );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const MT3*    A_;        //!< The left-hand side sparse matrix operand.
+      const MT4*    B_;        //!< The right-hand side sparse matrix operand.
+      const size_t* flops_;    //!< The number of scalar multiplications per row.
+      const size_t* ranges_;   //!< The row ranges of all tasks.
+      const size_t* offsets_;  //!< The offsets of all rows within the output arrays.
+      size_t*       indices_;  //!< The output array for the column indices.
+      ElementType*  values_;   //!< The output array for the values.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-sparse matrix multiplication to a dense matrix
@@ -456,7 +701,12 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    // \return void
    //
    // This function implements the performance optimized assignment of a sparse matrix-sparse
-   // matrix multiplication expression to a row-major sparse matrix.
+   // matrix multiplication expression to a row-major sparse matrix. Each row of the result is
+   // computed by a row-wise (Gustavson) kernel, which selects the accumulator of the row based
+   // on the number of scalar multiplications. In case the shared memory parallelization is
+   // active and the expression is large enough, the multiplication is performed in two phases:
+   // a parallel symbolic phase determines the exact number of non-zero elements of each row,
+   // and a parallel numeric phase computes the rows into a temporary of exactly that size.
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
@@ -466,8 +716,9 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
+      typedef typename RemoveReference<CT1>::Type  LeftOperandType;
+      typedef typename RemoveReference<CT2>::Type  RightOperandType;
+      typedef typename LeftOperandType::ConstIterator  LeftIterator;
 
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
@@ -479,91 +730,455 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
-      size_t nonzeros( 0UL );
+      const size_t m( (~lhs).rows()    );
+      const size_t n( (~lhs).columns() );
+
+      Workspace& ws( workspace() );
 
-      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
+      // Counting the number of scalar multiplications per row
+      std::vector<size_t>& flops( ws.flops_ );
+      size_t total( 0UL );
+
+      if( flops.size() < m )
+         flops.resize( m );
+
+      for( size_t i=0UL; i<m; ++i ) {
          const LeftIterator lend( A.end(i) );
+         flops[i] = 0UL;
          for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
-            nonzeros += B.nonZeros( lelem->index() );
+            flops[i] += B.nonZeros( lelem->index() );
          }
+         total += flops[i];
       }
 
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
-      }
+      const size_t threads( getNumThreads() );
 
-      (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
+      // Single-pass multiplication
+      if( threads == 1UL || total == 0UL || !rhs.canSMPAssign() ||
+          isSerialSectionActive() || isParallelSectionActive() )
+      {
+         (~lhs).reserve( ( n == 0UL || total/n < m )?( total ):( m*n ) );
 
-      // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).columns(), ElementType() );
-      std::vector<byte>        valid  ( (~lhs).columns(), 0   );
-      std::vector<size_t>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
+         const size_t offset( ws.start( m ) );
+         std::vector<size_t>&      indices( ws.indices_ );
+         std::vector<ElementType>& values ( ws.row_     );
 
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
-      {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
+         for( size_t i=0UL; i<m; ++i )
          {
-            const RightIterator rend( B.end( lelem->index() ) );
-            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            if( flops[i] > 0UL )
             {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = 1;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
+               const size_t bound( min( flops[i], n ) );
+
+               if( indices.size() < bound ) {
+                  indices.resize( bound );
+                  values.resize( bound );
                }
-               else {
-                  values[relem->index()] += lelem->value() * relem->value();
+
+               const size_t nonzeros( numericRow( A, B, i, flops[i], offset, bound, ws,
+                                                  &indices[0], &values[0] ) );
+
+               for( size_t k=0UL; k<nonzeros; ++k ) {
+                  if( !isDefault( values[k] ) )
+                     (~lhs).append( i, indices[k], values[k] );
                }
             }
+
+            (~lhs).finalize( i );
+         }
+
+         ws.shrink( true );
+         return;
+      }
+
+      // Partitioning the rows into tasks of approximately equal work
+      const size_t tasks( min( 4UL*threads, m ) );
+      std::vector<size_t> ranges( tasks+1UL, m );
+
+      ranges[0UL] = 0UL;
+
+      for( size_t i=0UL, t=1UL, work=0UL; i<m && t<tasks; ++i ) {
+         work += flops[i];
+         while( t < tasks && work*tasks >= t*total ) {
+            ranges[t] = i+1UL;
+            ++t;
+         }
+      }
+
+      // Symbolic phase: determining the exact number of non-zero elements per row
+      std::vector<size_t> offsets( m+1UL, 0UL );
+
+      smpExecute( SymbolicTask<LeftOperandType,RightOperandType>(
+                     A, B, &flops[0], &ranges[0], &offsets[1] ), tasks );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         offsets[i+1UL] += offsets[i];
+      }
+
+      // Numeric phase: computing the rows of the result into a temporary of exact size
+      const size_t capacity( offsets[m] );
+
+      std::vector<size_t>      indices( capacity );
+      std::vector<ElementType> values ( capacity );
+
+      smpExecute( NumericTask<LeftOperandType,RightOperandType>(
+                     A, B, &flops[0], &ranges[0], &offsets[0], &indices[0], &values[0] ), tasks );
+
+      // Transferring the result to the target matrix
+      (~lhs).reserve( capacity );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t k=offsets[i]; k<offsets[i+1UL]; ++k ) {
+            if( !isDefault( values[k] ) )
+               (~lhs).append( i, indices[k], values[k] );
          }
+         (~lhs).finalize( i );
+      }
+
+      ws.shrink( true );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sparse accumulator selection****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the accumulator for a single row of a sparse matrix-sparse matrix
+   //        multiplication.
+   // \ingroup sparse_matrix
+   //
+   // \param flops The number of scalar multiplications of the row.
+   // \param columns The number of columns of the result.
+   // \return The accumulator for the row.
+   //
+   // Rows with very few scalar multiplications are accumulated in a sorted list. In case the
+   // result has so many columns that a dense array of size \f$ O(columns) \f$ per task would
+   // not fit into the cache and the number of multiplications is small compared to the number
+   // of columns, the row is accumulated in a hash table of size \f$ O(flops) \f$. All other
+   // rows are accumulated in a dense array.
+   */
+   static inline Accumulator selectAccumulator( size_t flops, size_t columns )
+   {
+      if( flops <= sortedListThreshold )
+         return sortedList;
+      else if( columns >= hashTableColumns && flops*hashTableRatio < columns )
+         return hashTable;
+      else
+         return denseArray;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hash table size*****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Calculation of the size of the hash table accumulator.
+   // \ingroup sparse_matrix
+   //
+   // \param nonzeros The maximum number of non-zero elements to be stored in the hash table.
+   // \return The size of the hash table (a power of two with a load factor of at most 0.5).
+   */
+   static inline size_t hashTableSize( size_t nonzeros )
+   {
+      size_t size( 16UL );
+      while( size < nonzeros*2UL ) size *= 2UL;
+      return size;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hash function*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Hash function of the hash table accumulator.
+   // \ingroup sparse_matrix
+   //
+   // \param index The column index to be hashed.
+   // \param mask The bit mask of the hash table (size of the hash table minus one).
+   // \return The initial slot of the given index.
+   */
+   static inline size_t hashSlot( size_t index, size_t mask )
+   {
+      return ( index * 2654435761UL ) & mask;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symbolic row kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Symbolic computation of a single row of a sparse matrix-sparse matrix multiplication.
+   // \ingroup sparse_matrix
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param i The index of the row to be computed.
+   // \param flops The number of scalar multiplications of the row.
+   // \param offset The offset of the row markers of the current pass.
+   // \param ws The workspace of the calling thread.
+   // \return The exact number of non-zero elements of the row.
+   */
+   template< typename MT3    // Type of the left-hand side matrix operand
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   static size_t symbolicRow( const MT3& A, const MT4& B, size_t i, size_t flops,
+                              size_t offset, Workspace& ws )
+   {
+      typedef typename MT3::ConstIterator  LeftIterator;
+      typedef typename MT4::ConstIterator  RightIterator;
 
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
+      if( flops == 0UL )
+         return 0UL;
+
+      const LeftIterator lend( A.end(i) );
+      size_t nonzeros( 0UL );
 
-         if( nonzeros > 0UL )
+      switch( selectAccumulator( flops, B.columns() ) )
+      {
+         case sortedList:
          {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+            std::vector<size_t>& list( ws.keys_ );
 
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
+            if( list.size() < flops )
+               list.resize( flops );
 
-               for( size_t j=0UL; j<nonzeros; ++j )
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
                {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
+                  const size_t j( relem->index() );
+                  const size_t k( std::lower_bound( list.begin(), list.begin()+nonzeros, j ) - list.begin() );
+
+                  if( k == nonzeros || list[k] != j ) {
+                     std::copy_backward( list.begin()+k, list.begin()+nonzeros, list.begin()+nonzeros+1UL );
+                     list[k] = j;
+                     ++nonzeros;
                   }
+               }
+            }
+            break;
+         }
+
+         case hashTable:
+         {
+            const size_t size( hashTableSize( flops ) );
+            const size_t mask( size - 1UL );
+            const size_t empty( inf );
+
+            std::vector<size_t>& keys( ws.keys_ );
+
+            if( keys.size() < size )
+               keys.resize( size );
+            std::fill( keys.begin(), keys.begin()+size, empty );
 
-                  reset( valid [index] );
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t j( relem->index() );
+                  size_t slot( hashSlot( j, mask ) );
+
+                  while( keys[slot] != empty && keys[slot] != j )
+                     slot = ( slot + 1UL ) & mask;
+
+                  if( keys[slot] == empty ) {
+                     keys[slot] = j;
+                     ++nonzeros;
+                  }
                }
             }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
+            break;
+         }
+
+         default:
+         {
+            std::vector<size_t>& marker( ws.marker_ );
+
+            if( marker.size() < B.columns() )
+               marker.resize( B.columns(), 0UL );
+
+            const size_t mark( offset+i+1UL );
+
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+                  if( marker[relem->index()] != mark ) {
+                     marker[relem->index()] = mark;
+                     ++nonzeros;
+                  }
+               }
+            }
+            break;
+         }
+      }
+
+      return nonzeros;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Numeric row kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Numeric computation of a single row of a sparse matrix-sparse matrix multiplication.
+   // \ingroup sparse_matrix
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param i The index of the row to be computed.
+   // \param flops The number of scalar multiplications of the row.
+   // \param offset The offset of the row markers of the current pass.
+   // \param bound Upper bound for the number of non-zero elements of the row.
+   // \param ws The workspace of the calling thread.
+   // \param indices The output array for the column indices of the row.
+   // \param values The output array for the values of the row.
+   // \return The number of elements written to the output arrays.
+   //
+   // This function computes the given row of the multiplication and writes its elements in
+   // ascending column order to the given output arrays, which must provide space for at least
+   // \a bound elements. Note that the elements may contain default values due to cancellation.
+   */
+   template< typename MT3    // Type of the left-hand side matrix operand
+           , typename MT4 >  // Type of the right-hand side matrix operand
+   static size_t numericRow( const MT3& A, const MT4& B, size_t i, size_t flops, size_t offset,
+                             size_t bound, Workspace& ws, size_t* indices, ElementType* values )
+   {
+      typedef typename MT3::ConstIterator  LeftIterator;
+      typedef typename MT4::ConstIterator  RightIterator;
+
+      if( flops == 0UL )
+         return 0UL;
+
+      const LeftIterator lend( A.end(i) );
+      size_t nonzeros( 0UL );
+
+      switch( selectAccumulator( flops, B.columns() ) )
+      {
+         case sortedList:
+         {
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
                {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
+                  const size_t j( relem->index() );
+                  const size_t k( std::lower_bound( indices, indices+nonzeros, j ) - indices );
+
+                  if( k < nonzeros && indices[k] == j ) {
+                     values[k] += lelem->value() * relem->value();
                   }
+                  else {
+                     BLAZE_INTERNAL_ASSERT( nonzeros < bound, "Invalid number of non-zero elements" );
+                     std::copy_backward( indices+k, indices+nonzeros, indices+nonzeros+1UL );
+                     std::copy_backward( values+k, values+nonzeros, values+nonzeros+1UL );
+                     indices[k] = j;
+                     values [k] = lelem->value() * relem->value();
+                     ++nonzeros;
+                  }
+               }
+            }
+            break;
+         }
 
-                  reset( valid [j] );
+         case hashTable:
+         {
+            const size_t size( hashTableSize( bound ) );
+            const size_t mask( size - 1UL );
+            const size_t empty( inf );
+
+            std::vector<size_t>&      keys ( ws.keys_   );
+            std::vector<ElementType>& table( ws.values_ );
+
+            if( keys.size() < size )
+               keys.resize( size );
+            if( table.size() < size )
+               table.resize( size );
+            std::fill( keys.begin(), keys.begin()+size, empty );
+
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t j( relem->index() );
+                  size_t slot( hashSlot( j, mask ) );
+
+                  while( keys[slot] != empty && keys[slot] != j )
+                     slot = ( slot + 1UL ) & mask;
+
+                  if( keys[slot] == empty ) {
+                     keys [slot] = j;
+                     table[slot] = lelem->value() * relem->value();
+                  }
+                  else {
+                     table[slot] += lelem->value() * relem->value();
+                  }
                }
             }
 
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
+            for( size_t slot=0UL; slot<size; ++slot ) {
+               if( keys[slot] != empty ) {
+                  BLAZE_INTERNAL_ASSERT( nonzeros < bound, "Invalid number of non-zero elements" );
+                  indices[nonzeros] = keys[slot];
+                  ++nonzeros;
+               }
+            }
+
+            std::sort( indices, indices+nonzeros );
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               size_t slot( hashSlot( indices[k], mask ) );
+               while( keys[slot] != indices[k] )
+                  slot = ( slot + 1UL ) & mask;
+               values[k] = table[slot];
+            }
+            break;
          }
 
-         (~lhs).finalize( i );
+         default:
+         {
+            std::vector<size_t>&      marker( ws.marker_ );
+            std::vector<ElementType>& dense ( ws.values_ );
+
+            if( marker.size() < B.columns() )
+               marker.resize( B.columns(), 0UL );
+            if( dense.size() < B.columns() )
+               dense.resize( B.columns() );
+
+            const size_t mark( offset+i+1UL );
+            size_t minIndex( inf ), maxIndex( 0UL );
+
+            for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+               const RightIterator rend( B.end( lelem->index() ) );
+               for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t j( relem->index() );
+
+                  if( marker[j] != mark ) {
+                     BLAZE_INTERNAL_ASSERT( nonzeros < bound, "Invalid number of non-zero elements" );
+                     marker[j] = mark;
+                     dense [j] = lelem->value() * relem->value();
+                     indices[nonzeros] = j;
+                     ++nonzeros;
+                     if( j < minIndex ) minIndex = j;
+                     if( j > maxIndex ) maxIndex = j;
+                  }
+                  else {
+                     dense[j] += lelem->value() * relem->value();
+                  }
+               }
+            }
+
+            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) ) {
+               std::sort( indices, indices+nonzeros );
+            }
+            else {
+               size_t k( 0UL );
+               for( size_t j=minIndex; j<=maxIndex; ++j ) {
+                  if( marker[j] == mark )
+                     indices[k++] = j;
+               }
+            }
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               values[k] = dense[indices[k]];
+            }
+            break;
+         }
       }
+
+      return nonzeros;
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1103,6 +1718,19 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
 
 
 
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename MT1, typename MT2 >
+boost::thread_specific_ptr<typename SMatSMatMultExpr<MT1,MT2>::Workspace>
+   SMatSMatMultExpr<MT1,MT2>::workspace_;
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
@@ -52,14 +52,17 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/IndexIntersection.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHypersparse.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -129,6 +132,19 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the (evaluated) sparse matrix operand is a HypersparseMatrix, the nested \value
+       will be set to 1 and the assignment to sparse vectors only traverses the non-empty rows
+       of the matrix. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseHypersparseKernel {
+      enum { value = IsHypersparse< typename SelectType< evaluateMatrix, MRT, MT >::Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatSVecMultExpr<MT,VT>             This;           //!< Type of this SMatSVecMultExpr instance.
@@ -210,42 +226,10 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
             return res;
          }
 
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               res = melem->value() * velem->value();
-               ++melem;
-               ++velem;
-               break;
-            }
-         }
-
-         if( melem != mend && velem != vend )
-         {
-            while( true ) {
-               if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else {
-                  res += melem->value() * velem->value();
-                  ++melem;
-                  if( melem == mend ) break;
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-            }
+         if( nextMatch( melem, mend, velem, vend ) ) {
+            res = melem->value() * velem->value();
+            for( ++melem, ++velem; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+               res += melem->value() * velem->value();
          }
       }
 
@@ -311,9 +295,13 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    /*!\brief Returns an estimation for the number of non-zero elements in the sparse vector.
    //
    // \return The estimate for the number of non-zero elements in the sparse vector.
+   //
+   // Since every non-zero element of the resulting vector requires at least one non-zero element
+   // in the according row of the sparse matrix, the estimate is bounded by the number of non-zero
+   // elements of the matrix. This keeps the estimate small for huge, hypersparse matrices.
    */
    inline size_t nonZeros() const {
-      return mat_.rows();
+      return min( mat_.rows(), mat_.nonZeros() );
    }
    //**********************************************************************************************
 
@@ -435,7 +423,8 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsHypersparse<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
       typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
@@ -451,42 +440,56 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
 
          VectorIterator velem( x.begin() );
 
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               y[i] = melem->value() * velem->value();
-               ++melem;
-               ++velem;
-               break;
-            }
+         if( nextMatch( melem, mend, velem, vend ) ) {
+            y[i] = melem->value() * velem->value();
+            for( ++melem, ++velem; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+               y[i] += melem->value() * velem->value();
          }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hypersparse assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a hypersparse matrix-sparse vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup sparse_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for the hypersparse matrix-sparse vector
+   // multiplication. In contrast to the default kernel, only the non-empty rows of the matrix
+   // are traversed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsHypersparse<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
+      typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
+
+      const VectorIterator vend( x.end() );
+
+      const size_t* const indices( A.nonEmptyIndices() );
 
-         if( melem != mend && velem != vend )
-         {
-            while( true ) {
-               if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else {
-                  y[i] += melem->value() * velem->value();
-                  ++melem;
-                  if( melem == mend ) break;
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-            }
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t i( indices[k] );
+         const MatrixIterator mend ( A.nonEmptyEnd(k)   );
+         MatrixIterator       melem( A.nonEmptyBegin(k) );
+
+         VectorIterator velem( x.begin() );
+
+         if( nextMatch( melem, mend, velem, vend ) ) {
+            y[i] = melem->value() * velem->value();
+            for( ++melem, ++velem; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+               y[i] += melem->value() * velem->value();
          }
       }
    }
@@ -506,7 +509,8 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    // vector multiplication expression to a sparse vector.
    */
    template< typename VT1 >  // Type of the target sparse vector
-   friend inline void assign( SparseVector<VT1,false>& lhs, const SMatSVecMultExpr& rhs )
+   friend inline typename DisableIf< UseHypersparseKernel<VT1> >::Type
+      assign( SparseVector<VT1,false>& lhs, const SMatSVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -539,42 +543,72 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
 
          reset( accu );
 
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               accu = melem->value() * velem->value();
-               ++melem;
-               ++velem;
-               break;
-            }
+         if( nextMatch( melem, mend, velem, vend ) ) {
+            accu = melem->value() * velem->value();
+            for( ++melem, ++velem; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+               accu += melem->value() * velem->value();
          }
 
-         if( melem != mend && velem != vend )
-         {
-            while( true ) {
-               if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else {
-                  accu += melem->value() * velem->value();
-                  ++melem;
-                  if( melem == mend ) break;
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-            }
+         if( !isDefault( accu ) )
+            (~lhs).insert( i, accu );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors (hypersparse)**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a hypersparse matrix-sparse vector multiplication to a sparse vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a hypersparse matrix-
+   // sparse vector multiplication expression to a sparse vector. In contrast to the default
+   // assignment, only the non-empty rows of the matrix are traversed.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline typename EnableIf< UseHypersparseKernel<VT1> >::Type
+      assign( SparseVector<VT1,false>& lhs, const SMatSVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
+      typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
+
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side sparse vector operand
+      if( x.nonZeros() == 0UL ) return;
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      ElementType accu;
+      const VectorIterator vend( x.end() );
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t i( indices[k] );
+         const MatrixIterator mend ( A.nonEmptyEnd(k)   );
+         MatrixIterator       melem( A.nonEmptyBegin(k) );
+
+         VectorIterator velem( x.begin() );
+
+         reset( accu );
+
+         if( nextMatch( melem, mend, velem, vend ) ) {
+            accu = melem->value() * velem->value();
+            for( ++melem, ++velem; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+               accu += melem->value() * velem->value();
          }
 
          if( !isDefault( accu ) )
@@ -639,7 +673,8 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsHypersparse<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
       typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
@@ -655,23 +690,51 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
 
          VectorIterator velem( x.begin() );
 
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               y[i] += melem->value() * velem->value();
-               ++melem;
-               if( melem == mend ) break;
-               ++velem;
-               if( velem == vend ) break;
-            }
-         }
+         for( ; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+            y[i] += melem->value() * velem->value();
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hypersparse addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a hypersparse matrix-sparse vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup sparse_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for the hypersparse matrix-sparse vector
+   // multiplication. In contrast to the default kernel, only the non-empty rows of the matrix
+   // are traversed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsHypersparse<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
+      typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
+
+      const VectorIterator vend( x.end() );
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t i( indices[k] );
+         const MatrixIterator mend ( A.nonEmptyEnd(k)   );
+         MatrixIterator       melem( A.nonEmptyBegin(k) );
+
+         VectorIterator velem( x.begin() );
+
+         for( ; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+            y[i] += melem->value() * velem->value();
       }
    }
    /*! \endcond */
@@ -739,7 +802,8 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsHypersparse<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
       typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
@@ -755,23 +819,51 @@ class SMatSVecMultExpr : public SparseVector< SMatSVecMultExpr<MT,VT>, false >
 
          VectorIterator velem( x.begin() );
 
-         while( true ) {
-            if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else {
-               y[i] -= melem->value() * velem->value();
-               ++melem;
-               if( melem == mend ) break;
-               ++velem;
-               if( velem == vend ) break;
-            }
-         }
+         for( ; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+            y[i] -= melem->value() * velem->value();
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hypersparse subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a hypersparse matrix-sparse vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup sparse_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for the hypersparse matrix-sparse vector
+   // multiplication. In contrast to the default kernel, only the non-empty rows of the matrix
+   // are traversed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsHypersparse<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
+      typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
+
+      const VectorIterator vend( x.end() );
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t i( indices[k] );
+         const MatrixIterator mend ( A.nonEmptyEnd(k)   );
+         MatrixIterator       melem( A.nonEmptyBegin(k) );
+
+         VectorIterator velem( x.begin() );
+
+         for( ; nextMatch( melem, mend, velem, vend ); ++melem, ++velem )
+            y[i] -= melem->value() * velem->value();
       }
    }
    /*! \endcond */
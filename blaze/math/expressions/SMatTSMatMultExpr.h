@@ -50,6 +50,7 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/IndexIntersection.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -220,42 +221,10 @@ class SMatTSMatMultExpr : public SparseMatrix< SMatTSMatMultExpr<MT1,MT2>, false
             return tmp;
 
          // Calculating element (i,j)
-         while( true ) {
-            if( lelem->index() < relem->index() ) {
-               ++lelem;
-               if( lelem == lend ) break;
-            }
-            else if( relem->index() < lelem->index() ) {
-               ++relem;
-               if( relem == rend ) break;
-            }
-            else {
-               tmp = lelem->value() * relem->value();
-               ++lelem;
-               ++relem;
-               break;
-            }
-         }
-
-         if( lelem != lend && relem != rend )
-         {
-            while( true ) {
-               if( lelem->index() < relem->index() ) {
-                  ++lelem;
-                  if( lelem == lend ) break;
-               }
-               else if( relem->index() < lelem->index() ) {
-                  ++relem;
-                  if( relem == rend ) break;
-               }
-               else {
-                  tmp += lelem->value() * relem->value();
-                  ++lelem;
-                  if( lelem == lend ) break;
-                  ++relem;
-                  if( relem == rend ) break;
-               }
-            }
+         if( nextMatch( lelem, lend, relem, rend ) ) {
+            tmp = lelem->value() * relem->value();
+            for( ++lelem, ++relem; nextMatch( lelem, lend, relem, rend ); ++lelem, ++relem )
+               tmp += lelem->value() * relem->value();
          }
       }
 
@@ -379,16 +379,18 @@ class SVecSVecAddExpr : public SparseVector< SVecSVecAddExpr<VT1,VT2,TF>, TF >
 
       while( l != lend && r != rend )
       {
-         if( l->index() < r->index() ) {
+         const size_t ri( r->index() );
+         for( ; l != lend && l->index() < ri; ++l )
             (~lhs).append( l->index(), l->value() );
-            ++l;
-         }
-         else if( l->index() > r->index() ) {
+         if( l == lend ) break;
+
+         const size_t li( l->index() );
+         for( ; r != rend && r->index() < li; ++r )
             (~lhs).append( r->index(), r->value() );
-            ++r;
-         }
-         else {
-            (~lhs).append( l->index(), l->value() + r->value() );
+         if( r == rend ) break;
+
+         if( li == r->index() ) {
+            (~lhs).append( li, l->value() + r->value() );
             ++l;
             ++r;
          }
@@ -51,6 +51,7 @@
 #include <blaze/math/Functions.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/IndexIntersection.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
@@ -267,14 +268,8 @@ class SVecSVecMultExpr : public SparseVector< SVecSVecMultExpr<VT1,VT2,TF>, TF >
       LeftIterator  l( x.begin()  );
       RightIterator r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] = l->value() * r->value();
-            ++r;
-         }
-      }
+      for( ; nextMatch( l, lend, r, rend ); ++l, ++r )
+         (~lhs)[l->index()] = l->value() * r->value();
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -314,14 +309,8 @@ class SVecSVecMultExpr : public SparseVector< SVecSVecMultExpr<VT1,VT2,TF>, TF >
       LeftIterator  l( x.begin()  );
       RightIterator r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs).append( l->index(), l->value() * r->value() );
-            ++r;
-         }
-      }
+      for( ; nextMatch( l, lend, r, rend ); ++l, ++r )
+         (~lhs).append( l->index(), l->value() * r->value() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -361,14 +350,8 @@ class SVecSVecMultExpr : public SparseVector< SVecSVecMultExpr<VT1,VT2,TF>, TF >
       LeftIterator  l( x.begin() );
       RightIterator r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] += l->value() * r->value();
-            ++r;
-         }
-      }
+      for( ; nextMatch( l, lend, r, rend ); ++l, ++r )
+         (~lhs)[l->index()] += l->value() * r->value();
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -412,14 +395,8 @@ class SVecSVecMultExpr : public SparseVector< SVecSVecMultExpr<VT1,VT2,TF>, TF >
       LeftIterator  l( x.begin()  );
       RightIterator r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] -= l->value() * r->value();
-            ++r;
-         }
-      }
+      for( ; nextMatch( l, lend, r, rend ); ++l, ++r )
+         (~lhs)[l->index()] -= l->value() * r->value();
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -465,16 +442,11 @@ class SVecSVecMultExpr : public SparseVector< SVecSVecMultExpr<VT1,VT2,TF>, TF >
 
       size_t i( 0 );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            for( ; i<r->index(); ++i )
-               reset( (~lhs)[i] );
-            (~lhs)[l->index()] *= l->value() * r->value();
-            ++r;
-            ++i;
-         }
+      for( ; nextMatch( l, lend, r, rend ); ++l, ++r ) {
+         for( ; i<r->index(); ++i )
+            reset( (~lhs)[i] );
+         (~lhs)[l->index()] *= l->value() * r->value();
+         ++i;
       }
 
       for( ; i<rhs.size(); ++i )
@@ -77,6 +77,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
@@ -543,7 +544,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
@@ -554,6 +556,32 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense matrices (packed matrices)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the assignment of a packed matrix-dense matrix multiplication to the
+   // vectorized multiplication kernel of the packed matrix, which only traverses the stored half
+   // of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.assignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to row-major dense matrices (general/general)****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general transpose dense matrix-general dense matrix
@@ -2310,7 +2338,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
@@ -2321,6 +2350,32 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense matrices (packed matrices)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a packed matrix-dense matrix multiplication
+   // to the vectorized multiplication kernel of the packed matrix, which only traverses the stored
+   // half of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.addAssignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to row-major dense matrices (general/general)*******************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a general transpose dense matrix-general dense matrix
@@ -3990,7 +4045,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value && IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
@@ -4001,6 +4057,32 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense matrices (packed matrices)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a packed matrix-dense matrix
+   // multiplication to the vectorized multiplication kernel of the packed matrix, which only
+   // traverses the stored half of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.subAssignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to row-major dense matrices (general/general)****************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a general transpose dense matrix-general dense
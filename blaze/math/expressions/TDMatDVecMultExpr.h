@@ -68,6 +68,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTriangular.h>
@@ -496,7 +497,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsPacked<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -508,6 +510,32 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (packed matrices)***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a packed matrix-dense vector multiplication to the
+   // vectorized multiplication kernel of the packed matrix, which only traverses the stored half
+   // of the matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsPacked<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.assignProduct( y, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-dense vector multiplication
@@ -1158,7 +1186,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsPacked<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1170,6 +1199,32 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (packed matrices)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a packed matrix-dense vector multiplication
+   // to the vectorized multiplication kernel of the packed matrix, which only traverses the stored
+   // half of the matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsPacked<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.addAssignProduct( y, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense matrix-dense vector multiplication
@@ -1791,7 +1846,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsPacked<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1803,6 +1859,32 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (packed matrices)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a packed matrix-dense vector
+   // multiplication to the vectorized multiplication kernel of the packed matrix, which only
+   // traverses the stored half of the matrix.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsPacked<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      A.subAssignProduct( y, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense matrix-dense vector multiplication
@@ -75,6 +75,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsRowVector.h>
@@ -160,10 +161,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
        evaluation strategy. In case the target matrix is row-major and either of the two
        matrix operands is symmetric, \a value is set to 1 and an optimized evaluation
        strategy is selected. Otherwise \a value is set to 0 and the default strategy is
-       chosen. */
+       chosen. Packed left-hand side operands are excluded since their multiplication
+       kernel directly handles row-major target matrices. */
    template< typename T1, typename T2, typename T3 >
    struct CanExploitSymmetry {
-      enum { value = IsRowMajorMatrix<T1>::value &&
+      enum { value = IsRowMajorMatrix<T1>::value && !IsPacked<T2>::value &&
                      ( IsSymmetric<T2>::value || IsSymmetric<T3>::value ) };
    };
    /*! \endcond */
@@ -558,7 +560,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value ) ||
           ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
@@ -569,6 +572,32 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense matrices (packed matrices)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the assignment of a packed matrix-dense matrix multiplication to the
+   // vectorized multiplication kernel of the packed matrix, which only traverses the stored half
+   // of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.assignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices (general/general)**************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a general transpose dense matrix-general transpose dense matrix
@@ -1732,7 +1761,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value ) ||
           ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
@@ -1743,6 +1773,32 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense matrices (packed matrices)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed matrix-dense matrix multiplication to a dense matrix
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a packed matrix-dense matrix multiplication
+   // to the vectorized multiplication kernel of the packed matrix, which only traverses the stored
+   // half of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.addAssignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense matrices (general/general)*****************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a general transpose dense matrix-general transpose
@@ -2855,7 +2911,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< IsPacked<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT4>::value ) ||
           ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
@@ -2866,6 +2923,32 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense matrices (packed matrices)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a packed matrix-dense matrix
+   // multiplication to the vectorized multiplication kernel of the packed matrix, which only
+   // traverses the stored half of the matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< IsPacked<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      A.subAssignProduct( C, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense matrices (general/general)**************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a general transpose dense matrix-general transpose
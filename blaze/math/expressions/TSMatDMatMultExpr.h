@@ -50,6 +50,7 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
@@ -98,6 +99,7 @@
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/SelectType.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 #include <blaze/util/valuetraits/IsTrue.h>
@@ -200,6 +202,27 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target matrix is a row-major matrix, all three involved data types are suited
+       for a vectorized computation of the matrix multiplication and the right-hand side dense
+       matrix operand is not triangular, the nested \value will be set to 1, otherwise it will
+       be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseRegisterBlockedKernel {
+      enum { value = !IsTriangular<T3>::value &&
+                     T1::vectorizable && T3::vectorizable &&
+                     IsRowMajorMatrix<T1>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TSMatDMatMultExpr<MT1,MT2>          This;           //!< Type of this TSMatDMatMultExpr instance.
@@ -415,6 +438,30 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense matrices (kernel selection)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an assignment of a transpose sparse matrix-dense matrix
+   //        multiplication to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      if( B.columns() <= IntrinsicTrait<ElementType>::size*4UL )
+         selectRegisterBlockedAssignKernel( C, A, B );
+      else
+         selectDefaultAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense matrices********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose sparse matrix-dense matrix multiplication
@@ -434,7 +481,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
-      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -509,7 +556,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline typename EnableIf< UseOptimizedKernel<MT3,MT4,MT5> >::Type
-      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -580,6 +627,113 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default register-blocked assignment to dense matrices***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default register-blocked assignment of a transpose sparse matrix-dense matrix
+   //        multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of a transpose sparse
+   // matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectRegisterBlockedAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectDefaultAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Register-blocked assignment to row-major dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked assignment of a transpose sparse matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the register-blocked assignment of a transpose sparse matrix-dense
+   // matrix multiplication expression to a row-major dense matrix. The kernel is selected for
+   // right-hand side dense matrices with up to four intrinsic vectors per row: The according row
+   // of the dense matrix is held in registers while the matching column of the sparse matrix is
+   // traversed, such that every column of the sparse matrix is streamed only once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectRegisterBlockedAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT4::ConstIterator  ConstIterator;
+
+      reset( C );
+
+      const size_t N( B.columns() );
+
+      for( size_t k=0UL; k<A.columns(); ++k )
+      {
+         const ConstIterator begin( A.begin(k) );
+         const ConstIterator end  ( A.end(k)   );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
+         {
+            const IntrinsicType b1( B.load(k,j             ) );
+            const IntrinsicType b2( B.load(k,j+IT::size    ) );
+            const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
+            const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t i( element->index() );
+               C.store( i, j             , C.load(i,j             ) + a1 * b1 );
+               C.store( i, j+IT::size    , C.load(i,j+IT::size    ) + a1 * b2 );
+               C.store( i, j+IT::size*2UL, C.load(i,j+IT::size*2UL) + a1 * b3 );
+               C.store( i, j+IT::size*3UL, C.load(i,j+IT::size*3UL) + a1 * b4 );
+            }
+         }
+
+         for( ; (j+IT::size) < N; j+=IT::size*2UL )
+         {
+            const IntrinsicType b1( B.load(k,j         ) );
+            const IntrinsicType b2( B.load(k,j+IT::size) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t i( element->index() );
+               C.store( i, j         , C.load(i,j         ) + a1 * b1 );
+               C.store( i, j+IT::size, C.load(i,j+IT::size) + a1 * b2 );
+            }
+         }
+
+         if( j < N )
+         {
+            const IntrinsicType b1( B.load(k,j) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const size_t i( element->index() );
+               C.store( i, j, C.load(i,j) + set( element->value() ) * b1 );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-dense matrix multiplication to a sparse matrix
@@ -686,6 +840,30 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense matrices (kernel selection)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an addition assignment of a transpose sparse matrix-dense
+   //        matrix multiplication to a dense matrix (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      if( B.columns() <= IntrinsicTrait<ElementType>::size*4UL )
+         selectRegisterBlockedAddAssignKernel( C, A, B );
+      else
+         selectDefaultAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense matrices***********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose sparse matrix-dense matrix multiplication
@@ -704,7 +882,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
-      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -773,7 +951,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline typename EnableIf< UseOptimizedKernel<MT3,MT4,MT5> >::Type
-      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -838,6 +1016,112 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default register-blocked addition assignment to dense matrices******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default register-blocked addition assignment of a transpose sparse matrix-dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the addition assignment of a transpose
+   // sparse matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectRegisterBlockedAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectDefaultAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Register-blocked addition assignment to row-major dense matrices****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked addition assignment of a transpose sparse matrix-dense matrix
+   //        multiplication to row-major dense matrices (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the register-blocked addition assignment of a transpose sparse
+   // matrix-dense matrix multiplication expression to a row-major dense matrix. The kernel is
+   // selected for right-hand side dense matrices with up to four intrinsic vectors per row: The
+   // according row of the dense matrix is held in registers while the matching column of the
+   // sparse matrix is traversed, such that every column of the sparse matrix is streamed only
+   // once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectRegisterBlockedAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT4::ConstIterator  ConstIterator;
+
+      const size_t N( B.columns() );
+
+      for( size_t k=0UL; k<A.columns(); ++k )
+      {
+         const ConstIterator begin( A.begin(k) );
+         const ConstIterator end  ( A.end(k)   );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
+         {
+            const IntrinsicType b1( B.load(k,j             ) );
+            const IntrinsicType b2( B.load(k,j+IT::size    ) );
+            const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
+            const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t i( element->index() );
+               C.store( i, j             , C.load(i,j             ) + a1 * b1 );
+               C.store( i, j+IT::size    , C.load(i,j+IT::size    ) + a1 * b2 );
+               C.store( i, j+IT::size*2UL, C.load(i,j+IT::size*2UL) + a1 * b3 );
+               C.store( i, j+IT::size*3UL, C.load(i,j+IT::size*3UL) + a1 * b4 );
+            }
+         }
+
+         for( ; (j+IT::size) < N; j+=IT::size*2UL )
+         {
+            const IntrinsicType b1( B.load(k,j         ) );
+            const IntrinsicType b2( B.load(k,j+IT::size) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t i( element->index() );
+               C.store( i, j         , C.load(i,j         ) + a1 * b1 );
+               C.store( i, j+IT::size, C.load(i,j+IT::size) + a1 * b2 );
+            }
+         }
+
+         if( j < N )
+         {
+            const IntrinsicType b1( B.load(k,j) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const size_t i( element->index() );
+               C.store( i, j, C.load(i,j) + set( element->value() ) * b1 );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring addition assignment to row-major matrices*************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring addition assignment of a transpose sparse matrix-dense matrix
@@ -910,6 +1194,30 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense matrices (kernel selection)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an subtraction assignment of a transpose sparse
+   //        matrix-dense matrix multiplication to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      if( B.columns() <= IntrinsicTrait<ElementType>::size*4UL )
+         selectRegisterBlockedSubAssignKernel( C, A, B );
+      else
+         selectDefaultSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense matrices********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose sparse matrix-dense matrix multiplication
@@ -928,7 +1236,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT5> >::Type
-      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -997,7 +1305,7 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
    static inline typename EnableIf< UseOptimizedKernel<MT3,MT4,MT5> >::Type
-      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -1062,6 +1370,112 @@ class TSMatDMatMultExpr : public DenseMatrix< TSMatDMatMultExpr<MT1,MT2>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Default register-blocked subtraction assignment to dense matrices***************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default register-blocked subtraction assignment of a transpose sparse matrix-dense
+   //        matrix multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the subtraction assignment of a
+   // transpose sparse matrix-dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectRegisterBlockedSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectDefaultSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Register-blocked subtraction assignment to row-major dense matrices*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register-blocked subtraction assignment of a transpose sparse matrix-dense matrix
+   //        multiplication to row-major dense matrices (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the register-blocked subtraction assignment of a transpose sparse
+   // matrix-dense matrix multiplication expression to a row-major dense matrix. The kernel is
+   // selected for right-hand side dense matrices with up to four intrinsic vectors per row: The
+   // according row of the dense matrix is held in registers while the matching column of the
+   // sparse matrix is traversed, such that every column of the sparse matrix is streamed only
+   // once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseRegisterBlockedKernel<MT3,MT4,MT5> >::Type
+      selectRegisterBlockedSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename IT::Type            IntrinsicType;
+      typedef typename MT4::ConstIterator  ConstIterator;
+
+      const size_t N( B.columns() );
+
+      for( size_t k=0UL; k<A.columns(); ++k )
+      {
+         const ConstIterator begin( A.begin(k) );
+         const ConstIterator end  ( A.end(k)   );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
+         {
+            const IntrinsicType b1( B.load(k,j             ) );
+            const IntrinsicType b2( B.load(k,j+IT::size    ) );
+            const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
+            const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t i( element->index() );
+               C.store( i, j             , C.load(i,j             ) - a1 * b1 );
+               C.store( i, j+IT::size    , C.load(i,j+IT::size    ) - a1 * b2 );
+               C.store( i, j+IT::size*2UL, C.load(i,j+IT::size*2UL) - a1 * b3 );
+               C.store( i, j+IT::size*3UL, C.load(i,j+IT::size*3UL) - a1 * b4 );
+            }
+         }
+
+         for( ; (j+IT::size) < N; j+=IT::size*2UL )
+         {
+            const IntrinsicType b1( B.load(k,j         ) );
+            const IntrinsicType b2( B.load(k,j+IT::size) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const IntrinsicType a1( set( element->value() ) );
+               const size_t i( element->index() );
+               C.store( i, j         , C.load(i,j         ) - a1 * b1 );
+               C.store( i, j+IT::size, C.load(i,j+IT::size) - a1 * b2 );
+            }
+         }
+
+         if( j < N )
+         {
+            const IntrinsicType b1( B.load(k,j) );
+
+            for( ConstIterator element=begin; element!=end; ++element ) {
+               const size_t i( element->index() );
+               C.store( i, j, C.load(i,j) - set( element->value() ) * b1 );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring subtraction assignment to row-major matrices**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring subtraction assignment of a transpose sparse matrix-dense matrix
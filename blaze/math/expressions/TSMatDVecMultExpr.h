@@ -60,6 +60,7 @@
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHypersparse.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -333,7 +334,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsHypersparse<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -354,6 +356,49 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Hypersparse assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized assignment of a hypersparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial assignment kernel for the column-major hypersparse
+   // matrix-dense vector multiplication. In contrast to the default kernel, only the non-empty
+   // columns of the matrix are traversed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsHypersparse<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t j( indices[k] );
+         ConstIterator element( A.nonEmptyBegin(k) );
+         const ConstIterator end( A.nonEmptyEnd(k) );
+
+         for( ; element!=end; ++element ) {
+            if( IsResizable<typename VT1::ElementType>::value &&
+                isDefault( y[element->index()] ) )
+               y[element->index()] = element->value() * x[j];
+            else
+               y[element->index()] += element->value() * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-dense vector multiplication to a sparse
@@ -436,7 +481,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsHypersparse<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -453,6 +499,45 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Hypersparse addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized addition assignment of a hypersparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial addition assignment kernel for the column-major hypersparse
+   // matrix-dense vector multiplication. In contrast to the default kernel, only the non-empty
+   // columns of the matrix are traversed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsHypersparse<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t j( indices[k] );
+         ConstIterator element( A.nonEmptyBegin(k) );
+         const ConstIterator end( A.nonEmptyEnd(k) );
+
+         for( ; element!=end; ++element ) {
+            y[element->index()] += element->value() * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -511,7 +596,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< IsHypersparse<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -528,6 +614,45 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Hypersparse subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Optimized subtraction assignment of a hypersparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side hypersparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial subtraction assignment kernel for the column-major hypersparse
+   // matrix-dense vector multiplication. In contrast to the default kernel, only the non-empty
+   // columns of the matrix are traversed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsHypersparse<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
+
+      const size_t* const indices( A.nonEmptyIndices() );
+
+      for( size_t k=0UL; k<A.nonEmpty(); ++k )
+      {
+         const size_t j( indices[k] );
+         ConstIterator element( A.nonEmptyBegin(k) );
+         const ConstIterator end( A.nonEmptyEnd(k) );
+
+         for( ; element!=end; ++element ) {
+            y[element->index()] -= element->value() * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/SparseMatrix.h>
@@ -51,12 +53,14 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHypersparse.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -126,6 +130,33 @@ class TSMatSVecMultExpr : public SparseVector< TSMatSVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the (evaluated) sparse matrix operand is a HypersparseMatrix, the nested \value
+       will be set to 1 and the assignment to sparse vectors does not require any temporary
+       proportional to the number of rows of the matrix. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseHypersparseKernel {
+      enum { value = IsHypersparse< typename SelectType< evaluateMatrix, MRT, MT >::Type >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class CompareIndex******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for sorting the partial products of the hypersparse assignment kernel.
+   */
+   struct CompareIndex
+   {
+      template< typename Product >
+      inline bool operator()( const Product& p1, const Product& p2 ) const {
+         return p1.first < p2.first;
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TSMatSVecMultExpr<MT,VT>            This;           //!< Type of this TSMatSVecMultExpr instance.
@@ -222,9 +253,13 @@ class TSMatSVecMultExpr : public SparseVector< TSMatSVecMultExpr<MT,VT>, false >
    /*!\brief Returns an estimation for the number of non-zero elements in the sparse vector.
    //
    // \return The estimate for the number of non-zero elements in the sparse vector.
+   //
+   // Since every non-zero element of the resulting vector requires at least one non-zero element
+   // in the according row of the sparse matrix, the estimate is bounded by the number of non-zero
+   // elements of the matrix. This keeps the estimate small for huge, hypersparse matrices.
    */
    inline size_t nonZeros() const {
-      return mat_.rows();
+      return min( mat_.rows(), mat_.nonZeros() );
    }
    //**********************************************************************************************
 
@@ -385,7 +420,8 @@ class TSMatSVecMultExpr : public SparseVector< TSMatSVecMultExpr<MT,VT>, false >
    // sparse vector multiplication expression to a sparse vector.
    */
    template< typename VT1 >  // Type of the target sparse vector
-   friend inline void assign( SparseVector<VT1,false>& lhs, const TSMatSVecMultExpr& rhs )
+   friend inline typename DisableIf< UseHypersparseKernel<VT1> >::Type
+      assign( SparseVector<VT1,false>& lhs, const TSMatSVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -439,6 +475,91 @@ class TSMatSVecMultExpr : public SparseVector< TSMatSVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to sparse vectors (hypersparse)**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a column-major hypersparse matrix-sparse vector multiplication to a
+   //        sparse vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a column-major hypersparse
+   // matrix-sparse vector multiplication expression to a sparse vector. In contrast to the default
+   // assignment, the partial products are collected and sorted by their row index instead of
+   // being accumulated in a dense temporary vector. Therefore both the time and the memory
+   // requirements of the assignment are independent of the number of rows of the matrix.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline typename EnableIf< UseHypersparseKernel<VT1> >::Type
+      assign( SparseVector<VT1,false>& lhs, const TSMatSVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename RemoveReference<LT>::Type::ConstIterator  MatrixIterator;
+      typedef typename RemoveReference<RT>::Type::ConstIterator  VectorIterator;
+      typedef std::pair<size_t,ElementType>                      Product;
+      typedef typename std::vector<Product>::const_iterator      ProductIterator;
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side sparse vector operand
+      if( x.nonZeros() == 0UL ) return;
+
+      LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      std::vector<Product> products;
+
+      const VectorIterator vend ( x.end() );
+      VectorIterator       velem( x.begin() );
+
+      for( ; velem!=vend; ++velem )
+      {
+         const MatrixIterator mend ( A.end  ( velem->index() ) );
+         MatrixIterator       melem( A.begin( velem->index() ) );
+
+         for( ; melem!=mend; ++melem ) {
+            products.push_back( Product( melem->index(), melem->value() * velem->value() ) );
+         }
+      }
+
+      if( products.empty() ) return;
+
+      std::stable_sort( products.begin(), products.end(), CompareIndex() );
+
+      size_t nonzeros( 1UL );
+
+      for( size_t k=1UL; k<products.size(); ++k ) {
+         if( products[k].first != products[k-1UL].first )
+            ++nonzeros;
+      }
+
+      (~lhs).reserve( nonzeros );
+
+      ProductIterator product( products.begin() );
+      const ProductIterator end( products.end() );
+
+      while( product != end )
+      {
+         const size_t index( product->first );
+         ElementType tmp( product->second );
+
+         for( ++product; product!=end && product->first==index; ++product ) {
+            tmp += product->second;
+         }
+
+         (~lhs).append( index, tmp );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to dense vectors********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Addition assignment of a transpose sparse matrix-sparse vector multiplication to a
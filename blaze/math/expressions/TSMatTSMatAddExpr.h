@@ -406,15 +406,17 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
 
          while( l != lend && r != rend )
          {
-            if( l->index() < r->index() ) {
+            const size_t ri( r->index() );
+            for( ; l != lend && l->index() < ri; ++l )
                ++nonzeros[l->index()];
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
+            if( l == lend ) break;
+
+            const size_t li( l->index() );
+            for( ; r != rend && r->index() < li; ++r )
                ++nonzeros[r->index()];
-               ++r;
-            }
-            else {
+            if( r == rend ) break;
+
+            if( li == r->index() ) {
                ++nonzeros[l->index()];
                ++l;
                ++r;
@@ -448,15 +450,17 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
 
          while( l != lend && r != rend )
          {
-            if( l->index() < r->index() ) {
+            const size_t ri( r->index() );
+            for( ; l != lend && l->index() < ri; ++l )
                (~lhs).append( l->index(), j, l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
+            if( l == lend ) break;
+
+            const size_t li( l->index() );
+            for( ; r != rend && r->index() < li; ++r )
                (~lhs).append( r->index(), j, r->value() );
-               ++r;
-            }
-            else {
+            if( r == rend ) break;
+
+            if( li == r->index() ) {
                (~lhs).append( l->index(), j, l->value()+r->value() );
                ++l;
                ++r;
@@ -554,15 +558,17 @@ class TSMatTSMatAddExpr : public SparseMatrix< TSMatTSMatAddExpr<MT1,MT2>, true
 
          while( l != lend && r != rend )
          {
-            if( l->index() < r->index() ) {
+            const size_t ri( r->index() );
+            for( ; l != lend && l->index() < ri; ++l )
                (~lhs).append( l->index(), j, l->value() );
-               ++l;
-            }
-            else if( l->index() > r->index() ) {
+            if( l == lend ) break;
+
+            const size_t li( l->index() );
+            for( ; r != rend && r->index() < li; ++r )
                (~lhs).append( r->index(), j, r->value() );
-               ++r;
-            }
-            else {
+            if( r == rend ) break;
+
+            if( li == r->index() ) {
                (~lhs).append( l->index(), j, l->value()+r->value() );
                ++l;
                ++r;
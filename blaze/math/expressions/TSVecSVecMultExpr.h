@@ -43,8 +43,11 @@
 #include <stdexcept>
 #include <blaze/math/constraints/SparseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/sparse/IndexIntersection.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/RemoveReference.h>
@@ -52,6 +55,67 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the scalar product of two sparse vectors.
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side sparse vector for the inner product.
+// \param rhs The right-hand side sparse vector for the inner product.
+// \return The scalar product.
+//
+// This function computes the scalar product of two sparse vectors of equal size by means of
+// the intersection of their index sets. The transpose flags of the two vectors are ignored.
+*/
+template< typename T1  // Type of the left-hand side sparse vector
+        , bool TF1     // Transpose flag of the left-hand side sparse vector
+        , typename T2  // Type of the right-hand side sparse vector
+        , bool TF2 >   // Transpose flag of the right-hand side sparse vector
+inline const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type
+   tsvecsvecmult( const SparseVector<T1,TF1>& lhs, const SparseVector<T2,TF2>& rhs )
+{
+   typedef typename T1::CompositeType           Lhs;            // Composite type of the left-hand side sparse vector expression
+   typedef typename T2::CompositeType           Rhs;            // Composite type of the right-hand side sparse vector expression
+   typedef typename RemoveReference<Lhs>::Type  X1;             // Auxiliary type for the left-hand side composite type
+   typedef typename RemoveReference<Rhs>::Type  X2;             // Auxiliary type for the right-hand side composite type
+   typedef typename X1::ElementType             E1;             // Element type of the left-hand side sparse vector expression
+   typedef typename X2::ElementType             E2;             // Element type of the right-hand side sparse vector expression
+   typedef typename MultTrait<E1,E2>::Type      MultType;       // Multiplication result type
+   typedef typename X1::ConstIterator           LeftIterator;   // Iterator type of the left-hand sparse vector expression
+   typedef typename X2::ConstIterator           RightIterator;  // Iterator type of the right-hand sparse vector expression
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( (~lhs).nonZeros() == 0UL || (~rhs).nonZeros() == 0UL ) return MultType();
+
+   Lhs left ( ~lhs );
+   Rhs right( ~rhs );
+   const LeftIterator  lend( left.end()  );
+   const RightIterator rend( right.end() );
+   LeftIterator  l( left.begin()  );
+   RightIterator r( right.begin() );
+   MultType sp = MultType();
+
+   if( nextMatch( l, lend, r, rend ) ) {
+      sp = l->value() * r->value();
+      for( ++l, ++r; nextMatch( l, lend, r, rend ); ++l, ++r )
+         sp += l->value() * r->value();
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
@@ -93,16 +157,6 @@ inline const typename MultTrait<typename T1::ElementType,typename T2::ElementTyp
 {
    BLAZE_FUNCTION_TRACE;
 
-   typedef typename T1::CompositeType           Lhs;            // Composite type of the left-hand side sparse vector expression
-   typedef typename T2::CompositeType           Rhs;            // Composite type of the right-hand side sparse vector expression
-   typedef typename RemoveReference<Lhs>::Type  X1;             // Auxiliary type for the left-hand side composite type
-   typedef typename RemoveReference<Rhs>::Type  X2;             // Auxiliary type for the right-hand side composite type
-   typedef typename X1::ElementType             E1;             // Element type of the left-hand side sparse vector expression
-   typedef typename X2::ElementType             E2;             // Element type of the right-hand side sparse vector expression
-   typedef typename MultTrait<E1,E2>::Type      MultType;       // Multiplication result type
-   typedef typename X1::ConstIterator           LeftIterator;   // Iterator type of the left-hand sparse vector expression
-   typedef typename X2::ConstIterator           RightIterator;  // Iterator type of the right-hand sparse vector expression
-
    BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( T1 );
    BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( T2 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( T1 );
@@ -111,35 +165,43 @@ inline const typename MultTrait<typename T1::ElementType,typename T2::ElementTyp
    if( (~lhs).size() != (~rhs).size() )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   if( (~lhs).nonZeros() == 0UL || (~rhs).nonZeros() == 0UL ) return MultType();
+   return tsvecsvecmult( ~lhs, ~rhs );
+}
+//*************************************************************************************************
 
-   Lhs left ( ~lhs );
-   Rhs right( ~rhs );
-   const LeftIterator  lend( left.end()  );
-   const RightIterator rend( right.end() );
-   LeftIterator  l( left.begin()  );
-   RightIterator r( right.begin() );
-   MultType sp = MultType();
 
-   for( ; l!=lend && r!=rend; ++l ) {
-      while( r->index() < l->index() && ++r != rend ) {}
-      if( r!=rend && l->index() == r->index() ) {
-         sp = l->value() * r->value();
-         ++r;
-         break;
-      }
-   }
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the scalar product of a transpose sparse vector and a
+//        sparse vector (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side transpose sparse vector for the inner product.
+// \param rhs The right-hand side sparse vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This operator restructures the scalar product such that it works directly on the elements
+// of the transposed sparse vector instead of the elements of the transpose expression.
+*/
+template< typename T1    // Type of the left-hand side sparse vector
+        , typename T2 >  // Type of the right-hand side sparse vector
+inline const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type
+   operator*( const SVecTransExpr<T1,true>& lhs, const SparseVector<T2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
 
-   for( ; l!=lend && r!=rend; ++l ) {
-      while( r->index() < l->index() && ++r != rend ) {}
-      if( r!=rend && l->index() == r->index() ) {
-         sp += l->value() * r->value();
-         ++r;
-      }
-   }
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( T1 );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( T2 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( T1 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( T2 );
 
-   return sp;
+   if( lhs.size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   return tsvecsvecmult( trans( lhs ), ~rhs );
 }
+/*! \endcond */
 //*************************************************************************************************
 
 } // namespace blaze
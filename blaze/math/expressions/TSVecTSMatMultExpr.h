@@ -54,6 +54,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/IndexIntersection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -203,42 +204,10 @@ class TSVecTSMatMultExpr : public SparseVector< TSVecTSMatMultExpr<VT,MT>, true
          return res;
       }
 
-      while( true ) {
-         if( velem->index() < melem->index() ) {
-            ++velem;
-            if( velem == vend ) break;
-         }
-         else if( melem->index() < velem->index() ) {
-            ++melem;
-            if( melem == mend ) break;
-         }
-         else {
-            res = velem->value() * melem->value();
-            ++velem;
-            ++melem;
-            break;
-         }
-      }
-
-      if( melem != mend && velem != vend )
-      {
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               res += velem->value() * melem->value();
-               ++velem;
-               if( velem == vend ) break;
-               ++melem;
-               if( melem == mend ) break;
-            }
-         }
+      if( nextMatch( velem, vend, melem, mend ) ) {
+         res = velem->value() * melem->value();
+         for( ++velem, ++melem; nextMatch( velem, vend, melem, mend ); ++velem, ++melem )
+            res += velem->value() * melem->value();
       }
 
       return res;
@@ -400,42 +369,10 @@ class TSVecTSMatMultExpr : public SparseVector< TSVecTSMatMultExpr<VT,MT>, true
 
          VectorIterator velem( x.begin() );
 
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               y[j] = velem->value() * melem->value();
-               ++velem;
-               ++melem;
-               break;
-            }
-         }
-
-         if( velem != vend && melem != mend )
-         {
-            while( true ) {
-               if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else {
-                  y[j] += velem->value() * melem->value();
-                  ++velem;
-                  if( velem == vend ) break;
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-            }
+         if( nextMatch( velem, vend, melem, mend ) ) {
+            y[j] = velem->value() * melem->value();
+            for( ++velem, ++melem; nextMatch( velem, vend, melem, mend ); ++velem, ++melem )
+               y[j] += velem->value() * melem->value();
          }
       }
    }
@@ -493,42 +430,10 @@ class TSVecTSMatMultExpr : public SparseVector< TSVecTSMatMultExpr<VT,MT>, true
 
          reset( accu );
 
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               accu = velem->value() * melem->value();
-               ++velem;
-               ++melem;
-               break;
-            }
-         }
-
-         if( velem != vend && melem != mend )
-         {
-            while( true ) {
-               if( velem->index() < melem->index() ) {
-                  ++velem;
-                  if( velem == vend ) break;
-               }
-               else if( melem->index() < velem->index() ) {
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-               else {
-                  accu += velem->value() * melem->value();
-                  ++velem;
-                  if( velem == vend ) break;
-                  ++melem;
-                  if( melem == mend ) break;
-               }
-            }
+         if( nextMatch( velem, vend, melem, mend ) ) {
+            accu = velem->value() * melem->value();
+            for( ++velem, ++melem; nextMatch( velem, vend, melem, mend ); ++velem, ++melem )
+               accu += velem->value() * melem->value();
          }
 
          if( !isDefault( accu ) )
@@ -610,23 +515,8 @@ class TSVecTSMatMultExpr : public SparseVector< TSVecTSMatMultExpr<VT,MT>, true
 
          VectorIterator velem( x.begin() );
 
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               y[j] += velem->value() * melem->value();
-               ++velem;
-               if( velem == vend ) break;
-               ++melem;
-               if( melem == mend ) break;
-            }
-         }
+         for( ; nextMatch( velem, vend, melem, mend ); ++velem, ++melem )
+            y[j] += velem->value() * melem->value();
       }
    }
    /*! \endcond */
@@ -708,23 +598,8 @@ class TSVecTSMatMultExpr : public SparseVector< TSVecTSMatMultExpr<VT,MT>, true
 
          VectorIterator velem( x.begin() );
 
-         while( true ) {
-            if( velem->index() < melem->index() ) {
-               ++velem;
-               if( velem == vend ) break;
-            }
-            else if( melem->index() < velem->index() ) {
-               ++melem;
-               if( melem == mend ) break;
-            }
-            else {
-               y[j] -= velem->value() * melem->value();
-               ++velem;
-               if( velem == vend ) break;
-               ++melem;
-               if( melem == mend ) break;
-            }
-         }
+         for( ; nextMatch( velem, vend, melem, mend ); ++velem, ++melem )
+            y[j] -= velem->value() * melem->value();
       }
    }
    /*! \endcond */
@@ -0,0 +1,387 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC STRIDED LOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float' values from strided memory.
+// \ingroup intrinsics
+//
+// \param address The first 'float' value to be loaded.
+// \param stride The distance between two consecutive values (in number of 'float' values).
+// \return The loaded vector of 'float' values.
+//
+// This function loads a vector of 'float' values, which are not stored contiguously in memory
+// but with a constant distance of \a stride elements, as for instance the values of the
+// value-index-pairs of a sparse vector or matrix. The given address is not required to be
+// properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t loads( const float* address, size_t stride )
+{
+#if BLAZE_MIC_MODE
+   const float tmp[16] = { address[     0UL], address[     stride], address[ 2UL*stride]
+                         , address[ 3UL*stride], address[ 4UL*stride], address[ 5UL*stride]
+                         , address[ 6UL*stride], address[ 7UL*stride], address[ 8UL*stride]
+                         , address[ 9UL*stride], address[10UL*stride], address[11UL*stride]
+                         , address[12UL*stride], address[13UL*stride], address[14UL*stride]
+                         , address[15UL*stride] };
+   __m512 v1 = _mm512_setzero_ps();
+   v1 = _mm512_loadunpacklo_ps( v1, tmp );
+   v1 = _mm512_loadunpackhi_ps( v1, tmp+16UL );
+   return v1;
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[7UL*stride], address[6UL*stride], address[5UL*stride]
+                       , address[4UL*stride], address[3UL*stride], address[2UL*stride]
+                       , address[    stride], address[      0UL] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[3UL*stride], address[2UL*stride], address[stride], address[0UL] );
+#else
+   UNUSED_PARAMETER( stride );
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'double' values from strided memory.
+// \ingroup intrinsics
+//
+// \param address The first 'double' value to be loaded.
+// \param stride The distance between two consecutive values (in number of 'double' values).
+// \return The loaded vector of 'double' values.
+//
+// This function loads a vector of 'double' values, which are not stored contiguously in memory
+// but with a constant distance of \a stride elements, as for instance the values of the
+// value-index-pairs of a sparse vector or matrix. The given address is not required to be
+// properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t loads( const double* address, size_t stride )
+{
+#if BLAZE_MIC_MODE
+   const double tmp[8] = { address[    0UL], address[    stride], address[2UL*stride]
+                         , address[3UL*stride], address[4UL*stride], address[5UL*stride]
+                         , address[6UL*stride], address[7UL*stride] };
+   __m512d v1 = _mm512_setzero_pd();
+   v1 = _mm512_loadunpacklo_pd( v1, tmp );
+   v1 = _mm512_loadunpackhi_pd( v1, tmp+8UL );
+   return v1;
+#elif BLAZE_AVX2_MODE
+   const int64_t s( static_cast<int64_t>( stride ) );
+   return _mm256_i64gather_pd( address, _mm256_set_epi64x( 3*s, 2*s, s, 0 ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[3UL*stride], address[2UL*stride], address[stride], address[0UL] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[stride], address[0UL] );
+#else
+   UNUSED_PARAMETER( stride );
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via the indices of consecutive sparse elements.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'float' values to be gathered.
+// \param element Iterator to the first of the sparse elements providing the indices.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address. The offsets
+// of the single values are given by the indices of the sparse elements in the range
+// \f$ [element..element+N) \f$, where \f$ N \f$ is the number of values in the resulting
+// intrinsic vector. The given iterator must therefore provide random access to at least
+// \f$ N \f$ elements.
+*/
+template< typename Iterator >  // Type of the sparse element iterator
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, Iterator element )
+{
+#if BLAZE_MIC_MODE
+   const float tmp[16] = { address[element[ 0].index()], address[element[ 1].index()]
+                         , address[element[ 2].index()], address[element[ 3].index()]
+                         , address[element[ 4].index()], address[element[ 5].index()]
+                         , address[element[ 6].index()], address[element[ 7].index()]
+                         , address[element[ 8].index()], address[element[ 9].index()]
+                         , address[element[10].index()], address[element[11].index()]
+                         , address[element[12].index()], address[element[13].index()]
+                         , address[element[14].index()], address[element[15].index()] };
+   __m512 v1 = _mm512_setzero_ps();
+   v1 = _mm512_loadunpacklo_ps( v1, tmp );
+   v1 = _mm512_loadunpackhi_ps( v1, tmp+16UL );
+   return v1;
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[element[7].index()], address[element[6].index()]
+                       , address[element[5].index()], address[element[4].index()]
+                       , address[element[3].index()], address[element[2].index()]
+                       , address[element[1].index()], address[element[0].index()] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[element[3].index()], address[element[2].index()]
+                    , address[element[1].index()], address[element[0].index()] );
+#else
+   return address[element->index()];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via the indices of consecutive sparse elements.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'double' values to be gathered.
+// \param element Iterator to the first of the sparse elements providing the indices.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address. The offsets
+// of the single values are given by the indices of the sparse elements in the range
+// \f$ [element..element+N) \f$, where \f$ N \f$ is the number of values in the resulting
+// intrinsic vector. The given iterator must therefore provide random access to at least
+// \f$ N \f$ elements.
+*/
+template< typename Iterator >  // Type of the sparse element iterator
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, Iterator element )
+{
+#if BLAZE_MIC_MODE
+   const double tmp[8] = { address[element[0].index()], address[element[1].index()]
+                         , address[element[2].index()], address[element[3].index()]
+                         , address[element[4].index()], address[element[5].index()]
+                         , address[element[6].index()], address[element[7].index()] };
+   __m512d v1 = _mm512_setzero_pd();
+   v1 = _mm512_loadunpacklo_pd( v1, tmp );
+   v1 = _mm512_loadunpackhi_pd( v1, tmp+8UL );
+   return v1;
+#elif BLAZE_AVX2_MODE
+   const __m128i i1 = _mm_insert_epi64( _mm_cvtsi64_si128( element[0].index() ), element[1].index(), 1 );
+   const __m128i i2 = _mm_insert_epi64( _mm_cvtsi64_si128( element[2].index() ), element[3].index(), 1 );
+   return _mm256_i64gather_pd( address, _mm256_inserti128_si256( _mm256_castsi128_si256( i1 ), i2, 1 ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[element[3].index()], address[element[2].index()]
+                       , address[element[1].index()], address[element[0].index()] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[element[1].index()], address[element[0].index()] );
+#else
+   return address[element->index()];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via an array of indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'float' values to be gathered.
+// \param index Pointer to the first of the indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address. The offsets
+// of the single values are given by the contiguously stored indices in the range
+// \f$ [index..index+N) \f$, where \f$ N \f$ is the number of values in the resulting intrinsic
+// vector. The given index array is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const size_t* index )
+{
+#if BLAZE_MIC_MODE
+   const float tmp[16] = { address[index[ 0]], address[index[ 1]], address[index[ 2]], address[index[ 3]]
+                         , address[index[ 4]], address[index[ 5]], address[index[ 6]], address[index[ 7]]
+                         , address[index[ 8]], address[index[ 9]], address[index[10]], address[index[11]]
+                         , address[index[12]], address[index[13]], address[index[14]], address[index[15]] };
+   __m512 v1 = _mm512_setzero_ps();
+   v1 = _mm512_loadunpacklo_ps( v1, tmp );
+   v1 = _mm512_loadunpackhi_ps( v1, tmp+16UL );
+   return v1;
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[index[7]], address[index[6]], address[index[5]], address[index[4]]
+                       , address[index[3]], address[index[2]], address[index[1]], address[index[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[index[3]], address[index[2]], address[index[1]], address[index[0]] );
+#else
+   return address[*index];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via an array of indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'double' values to be gathered.
+// \param index Pointer to the first of the indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address. The offsets
+// of the single values are given by the contiguously stored indices in the range
+// \f$ [index..index+N) \f$, where \f$ N \f$ is the number of values in the resulting intrinsic
+// vector. The given index array is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const size_t* index )
+{
+#if BLAZE_MIC_MODE
+   const double tmp[8] = { address[index[0]], address[index[1]], address[index[2]], address[index[3]]
+                         , address[index[4]], address[index[5]], address[index[6]], address[index[7]] };
+   __m512d v1 = _mm512_setzero_pd();
+   v1 = _mm512_loadunpacklo_pd( v1, tmp );
+   v1 = _mm512_loadunpackhi_pd( v1, tmp+8UL );
+   return v1;
+#elif BLAZE_AVX2_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   return _mm256_i64gather_pd( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( index ) ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[index[3]], address[index[2]], address[index[1]], address[index[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[index[1]], address[index[0]] );
+#else
+   return address[*index];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via an array of 32-bit indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'float' values to be gathered.
+// \param index Pointer to the first of the indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address. The offsets
+// of the single values are given by the contiguously stored 32-bit indices in the range
+// \f$ [index..index+N) \f$, where \f$ N \f$ is the number of values in the resulting intrinsic
+// vector. The indices are zero-extended to 64 bit before gathering the values, i.e. the entire
+// range of the 32-bit unsigned index type can be used. The given index array is not required
+// to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const uint32_t* index )
+{
+#if BLAZE_MIC_MODE
+   const float tmp[16] = { address[index[ 0]], address[index[ 1]], address[index[ 2]], address[index[ 3]]
+                         , address[index[ 4]], address[index[ 5]], address[index[ 6]], address[index[ 7]]
+                         , address[index[ 8]], address[index[ 9]], address[index[10]], address[index[11]]
+                         , address[index[12]], address[index[13]], address[index[14]], address[index[15]] };
+   __m512 v1 = _mm512_setzero_ps();
+   v1 = _mm512_loadunpacklo_ps( v1, tmp );
+   v1 = _mm512_loadunpackhi_ps( v1, tmp+16UL );
+   return v1;
+#elif BLAZE_AVX2_MODE
+   const __m256i i1( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( index     ) ) ) );
+   const __m256i i2( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( index+4UL ) ) ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_i64gather_ps( address, i1, 4 ) )
+                              , _mm256_i64gather_ps( address, i2, 4 ), 1 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[index[7]], address[index[6]], address[index[5]], address[index[4]]
+                       , address[index[3]], address[index[2]], address[index[1]], address[index[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[index[3]], address[index[2]], address[index[1]], address[index[0]] );
+#else
+   return address[*index];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via an array of 32-bit indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the 'double' values to be gathered.
+// \param index Pointer to the first of the indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address. The offsets
+// of the single values are given by the contiguously stored 32-bit indices in the range
+// \f$ [index..index+N) \f$, where \f$ N \f$ is the number of values in the resulting intrinsic
+// vector. In comparison to 64-bit indices, only half of the index data has to be loaded. The
+// indices are zero-extended to 64 bit before gathering the values, i.e. the entire range of
+// the 32-bit unsigned index type can be used. The given index array is not required to be
+// properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const uint32_t* index )
+{
+#if BLAZE_MIC_MODE
+   const double tmp[8] = { address[index[0]], address[index[1]], address[index[2]], address[index[3]]
+                         , address[index[4]], address[index[5]], address[index[6]], address[index[7]] };
+   __m512d v1 = _mm512_setzero_pd();
+   v1 = _mm512_loadunpacklo_pd( v1, tmp );
+   v1 = _mm512_loadunpackhi_pd( v1, tmp+8UL );
+   return v1;
+#elif BLAZE_AVX2_MODE
+   const __m256i i1( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( index ) ) ) );
+   return _mm256_i64gather_pd( address, i1, 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[index[3]], address[index[2]], address[index[1]], address[index[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[index[1]], address[index[0]] );
+#else
+   return address[*index];
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
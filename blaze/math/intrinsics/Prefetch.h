@@ -0,0 +1,80 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Prefetch.h
+//  \brief Header file for the intrinsic prefetch functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_PREFETCH_H_
+#define _BLAZE_MATH_INTRINSICS_PREFETCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC PREFETCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Prefetches the cache line containing the given address into all levels of the cache.
+// \ingroup intrinsics
+//
+// \param address The address to be prefetched.
+// \return void
+//
+// This function issues a software prefetch for the cache line containing the given address.
+// The prefetch is only a hint to the processor and does not result in any fault in case the
+// given address is invalid. In case no SSE functionality is available, the function has no
+// effect.
+*/
+BLAZE_ALWAYS_INLINE void prefetch( const void* address )
+{
+#if BLAZE_MIC_MODE || BLAZE_SSE_MODE
+   _mm_prefetch( reinterpret_cast<const char*>( address ), _MM_HINT_T0 );
+#else
+   UNUSED_PARAMETER( address );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,446 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedFile.h
+//  \brief Header file for the memory mapped file format of dense vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDFILE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DOXYGEN DOCUMENTATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup math_mapped_file Memory mapped files
+// \ingroup math_serialization
+//
+// In contrast to the portable serialization format of the Archive class, the memory mapped file
+// format stores a dense vector or matrix in exactly the same layout as in main memory: the
+// elements start at a 64-byte aligned offset and each row (for row-major matrices) or column
+// (for column-major matrices) is padded with zeros to a multiple of 64 bytes. Therefore a file
+// can be mapped into memory via the MemoryMap class and can be directly adapted by an aligned
+// and padded CustomVector or CustomMatrix without any deserialization step. The pages of the
+// file are loaded on demand, which makes it possible to work on vectors and matrices that are
+// larger than the available main memory:
+
+   \code
+   using blaze::aligned;
+   using blaze::padded;
+   using blaze::rowMajor;
+
+   // Writing the matrix into the file "matrix.bin"
+   {
+      blaze::DynamicMatrix<double,rowMajor> A( 10000UL, 10000UL );
+      // ... Initialization
+
+      blaze::writeMappedFile( "matrix.bin", A );
+   }
+
+   // Mapping the matrix
+   {
+      blaze::MemoryMap map( "matrix.bin", blaze::readOnly );
+
+      blaze::CustomMatrix<double,aligned,padded,rowMajor> A;
+      blaze::mapMatrix( map, A );
+
+      blaze::DynamicVector<double> x( A.columns(), 1.0 ), y;
+      y = A * x;
+   }
+   \endcode
+
+// A file consists of a 64-byte header followed by the padded elements. The header contains the
+// following fields (all integral values are stored in the byte order of the platform):
+
+   \code
+   Offset  Size  Content
+   ------  ----  ---------------------------------------------------------------------
+        0     8  The magic string "BLAZEMAP"
+        8     1  The version of the format (currently 1)
+        9     1  0 for vectors, 1 for matrices
+       10     1  The transpose flag (vectors) or the storage order (matrices)
+       11     1  The type of the elements (see the TypeValueMapping class template)
+       12     1  The size of the elements in bytes
+       16     8  The size of the vector or the number of rows of the matrix
+       24     8  The number of columns of the matrix (0 for vectors)
+       32     8  The number of elements per row/column including padding (the capacity
+                 of vectors)
+   \endcode
+
+// The adapting vector or matrix refers to the memory of the mapping, which therefore has to be
+// kept alive as long as the vector or matrix is used. In case of a \a readOnly mapping, the
+// elements of the vector or matrix must not be modified since any write access results in a
+// segmentation fault. In case of a \a copyOnWrite mapping, the elements can be modified without
+// affecting the file.
+*/
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MAPPED FILE FORMAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary class for the memory mapped file format of dense vectors and matrices.
+// \ingroup math_mapped_file
+*/
+struct MappedFile
+{
+ public:
+   //**Constants***********************************************************************************
+   static const size_t headerSize = 64UL;  //!< The size of the file header in bytes.
+   static const size_t alignment  = 64UL;  //!< The alignment of all rows/columns in bytes.
+   static const uint8_t  version    = 1U;    //!< The version of the file format.
+   static const uint8_t  vectorKind = 0U;    //!< The kind value of vectors.
+   static const uint8_t  matrixKind = 1U;    //!< The kind value of matrices.
+   //**********************************************************************************************
+
+   //**Spacing function****************************************************************************
+   /*!\brief Returns the number of elements per row/column including padding.
+   //
+   // \param n The number of elements per row/column.
+   // \return The number of elements including padding.
+   */
+   template< typename Type >
+   static inline size_t spacing( size_t n )
+   {
+      BLAZE_STATIC_ASSERT( alignment % sizeof(Type) == 0UL );
+
+      const size_t multiple( alignment / sizeof(Type) );
+      return ( n + multiple - 1UL ) & ~( multiple - 1UL );
+   }
+   //**********************************************************************************************
+
+   //**Header writing function*********************************************************************
+   /*!\brief Writes the file header into the given stream.
+   //
+   // \param os The output stream.
+   // \param kind The kind of the stored object (vector or matrix).
+   // \param flag The transpose flag or storage order.
+   // \param n The size of the vector or the number of rows of the matrix.
+   // \param m The number of columns of the matrix.
+   // \param nn The number of elements per row/column including padding.
+   // \return void
+   */
+   template< typename Type >
+   static inline void writeHeader( std::ostream& os, uint8_t kind, uint8_t flag,
+                                   uint64_t n, uint64_t m, uint64_t nn )
+   {
+      byte header[headerSize] = {};
+
+      std::memcpy( header, "BLAZEMAP", 8UL );
+      header[ 8] = version;
+      header[ 9] = kind;
+      header[10] = flag;
+      header[11] = static_cast<uint8_t>( TypeValueMapping<Type>::value );
+      header[12] = static_cast<uint8_t>( sizeof(Type) );
+      std::memcpy( header+16, &n , sizeof(uint64_t) );
+      std::memcpy( header+24, &m , sizeof(uint64_t) );
+      std::memcpy( header+32, &nn, sizeof(uint64_t) );
+
+      os.write( reinterpret_cast<const char*>( header ), headerSize );
+   }
+   //**********************************************************************************************
+
+   //**Header reading function*********************************************************************
+   /*!\brief Validates the given file header and extracts the dimensions.
+   //
+   // \param header The first \a headerSize bytes of the file.
+   // \param filesize The total size of the file in bytes.
+   // \param kind The expected kind of the stored object (vector or matrix).
+   // \param flag The expected transpose flag or storage order.
+   // \param rows The size of the vector or the number of rows of the matrix.
+   // \param columns The number of columns of the matrix.
+   // \param nn The number of elements per row/column including padding.
+   // \return void
+   // \exception std::runtime_error Invalid file header detected.
+   */
+   template< typename Type >
+   static inline void readHeader( const byte* header, uint64_t filesize, uint8_t kind, uint8_t flag,
+                                  uint64_t& rows, uint64_t& columns, uint64_t& nn )
+   {
+      if( filesize < headerSize || std::memcmp( header, "BLAZEMAP", 8UL ) != 0 )
+         throw std::runtime_error( "Corrupt file detected" );
+
+      if( header[8] != version )
+         throw std::runtime_error( "Invalid version detected" );
+
+      if( header[9] != kind || header[10] != flag )
+         throw std::runtime_error( ( kind == vectorKind )?( "Invalid vector type detected" )
+                                                         :( "Invalid matrix type detected" ) );
+
+      if( header[11] != static_cast<uint8_t>( TypeValueMapping<Type>::value ) )
+         throw std::runtime_error( "Invalid element type detected" );
+
+      if( header[12] != sizeof(Type) )
+         throw std::runtime_error( "Invalid element size detected" );
+
+      std::memcpy( &rows   , header+16, sizeof(uint64_t) );
+      std::memcpy( &columns, header+24, sizeof(uint64_t) );
+      std::memcpy( &nn     , header+32, sizeof(uint64_t) );
+
+      const uint64_t outer( ( kind == vectorKind )?( 1UL ):( ( flag )?( columns ):( rows ) ) );
+      const uint64_t inner( ( kind == matrixKind && !flag )?( columns ):( rows ) );
+      const uint64_t capacity( ( filesize - headerSize ) / sizeof(Type) );
+
+      if( nn < inner || nn != spacing<Type>( nn ) || ( nn != 0UL && outer > capacity / nn ) )
+         throw std::runtime_error( "Invalid file size detected" );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Memory mapped file functions */
+//@{
+template< typename VT, bool TF >
+void writeMappedFile( const std::string& file, const DenseVector<VT,TF>& vec );
+
+template< typename MT, bool SO >
+void writeMappedFile( const std::string& file, const DenseMatrix<MT,SO>& mat );
+
+template< typename Type, bool AF, bool PF, bool TF >
+void mapVector( MemoryMap& map, CustomVector<Type,AF,PF,TF>& vec );
+
+template< typename Type, bool AF, bool PF, bool SO >
+void mapMatrix( MemoryMap& map, CustomMatrix<Type,AF,PF,SO>& mat );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector into a memory mapped file.
+// \ingroup math_mapped_file
+//
+// \param file The name of the file to be written.
+// \param vec The dense vector to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense vector into the given file in the memory mapped file
+// format (see \ref math_mapped_file). An existing file is overwritten. In case the file cannot
+// be written, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void writeMappedFile( const std::string& file, const DenseVector<VT,TF>& vec )
+{
+   typedef typename VT::ElementType  ET;
+   typedef typename VT::CompositeType CT;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CT v( ~vec );
+
+   const size_t n ( v.size() );
+   const size_t nn( MappedFile::spacing<ET>( n ) );
+   const size_t blocksize( 4096UL );
+
+   std::ofstream os( file.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+   MappedFile::writeHeader<ET>( os, MappedFile::vectorKind, TF, n, 0UL, nn );
+
+   std::vector<ET> buffer( blocksize );
+
+   for( size_t i=0UL; i<nn; i+=blocksize )
+   {
+      const size_t iend( ( i+blocksize < nn )?( i+blocksize ):( nn ) );
+
+      for( size_t k=i; k<iend; ++k )
+         buffer[k-i] = ( k < n )?( ET( v[k] ) ):( ET() );
+
+      os.write( reinterpret_cast<const char*>( &buffer[0] ), ( iend - i ) * sizeof(ET) );
+   }
+
+   if( !os ) {
+      throw std::runtime_error( "Dense vector could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix into a memory mapped file.
+// \ingroup math_mapped_file
+//
+// \param file The name of the file to be written.
+// \param mat The dense matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense matrix into the given file in the memory mapped file
+// format (see \ref math_mapped_file). The storage order of the file corresponds to the storage
+// order of the matrix. An existing file is overwritten. In case the file cannot be written, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void writeMappedFile( const std::string& file, const DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType  ET;
+   typedef typename MT::CompositeType CT;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CT A( ~mat );
+
+   const size_t m    ( A.rows()    );
+   const size_t n    ( A.columns() );
+   const size_t outer( ( SO )?( n ):( m ) );
+   const size_t inner( ( SO )?( m ):( n ) );
+   const size_t nn   ( MappedFile::spacing<ET>( inner ) );
+
+   std::ofstream os( file.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+   MappedFile::writeHeader<ET>( os, MappedFile::matrixKind, SO, m, n, nn );
+
+   std::vector<ET> buffer( nn );
+
+   for( size_t i=0UL; i<outer && os; ++i )
+   {
+      for( size_t j=0UL; j<inner; ++j )
+         buffer[j] = ( SO )?( ET( A(j,i) ) ):( ET( A(i,j) ) );
+
+      if( nn > 0UL )
+         os.write( reinterpret_cast<const char*>( &buffer[0] ), nn * sizeof(ET) );
+   }
+
+   if( !os ) {
+      throw std::runtime_error( "Dense matrix could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adapts the dense vector stored in the given memory mapped file.
+// \ingroup math_mapped_file
+//
+// \param map The memory mapped file.
+// \param vec The custom vector to adapt the stored vector.
+// \return void
+// \exception std::runtime_error Invalid file header detected.
+//
+// This function resets the given custom vector to the elements of the dense vector stored in
+// the given memory mapped file (see \ref math_mapped_file). No element is copied; the vector
+// directly refers to the pages of the mapping, which therefore has to outlive the vector. In
+// case the file does not contain a vector of the according element type and transpose flag,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool TF >      // Transpose flag
+void mapVector( MemoryMap& map, CustomVector<Type,AF,PF,TF>& vec )
+{
+   uint64_t n( 0UL ), m( 0UL ), nn( 0UL );
+
+   MappedFile::readHeader<Type>( map.data(), map.size(), MappedFile::vectorKind, TF, n, m, nn );
+
+   vec.reset( reinterpret_cast<Type*>( map.data() + MappedFile::headerSize ), n, nn );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adapts the dense matrix stored in the given memory mapped file.
+// \ingroup math_mapped_file
+//
+// \param map The memory mapped file.
+// \param mat The custom matrix to adapt the stored matrix.
+// \return void
+// \exception std::runtime_error Invalid file header detected.
+//
+// This function resets the given custom matrix to the elements of the dense matrix stored in
+// the given memory mapped file (see \ref math_mapped_file). No element is copied; the matrix
+// directly refers to the pages of the mapping, which therefore has to outlive the matrix. In
+// case the file does not contain a matrix of the according element type and storage order,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+void mapMatrix( MemoryMap& map, CustomMatrix<Type,AF,PF,SO>& mat )
+{
+   uint64_t m( 0UL ), n( 0UL ), nn( 0UL );
+
+   MappedFile::readHeader<Type>( map.data(), map.size(), MappedFile::matrixKind, SO, m, n, nn );
+
+   mat.reset( reinterpret_cast<Type*>( map.data() + MappedFile::headerSize ), m, n, nn );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
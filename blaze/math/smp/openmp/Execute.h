@@ -0,0 +1,123 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Execute.h
+//  \brief Header file for the OpenMP-based SMP task execution
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_EXECUTE_H_
+#define _BLAZE_MATH_SMP_OPENMP_EXECUTE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP TASK EXECUTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based SMP execution of a set of independent tasks.
+// \ingroup smp
+//
+// \param task The task functor to be executed.
+// \param tasks The total number of tasks.
+// \return void
+//
+// This function executes the function call operator of the given task functor for all task
+// indices \f$[0..tasks)\f$. The tasks are dynamically distributed among the active OpenMP
+// threads and the function returns as soon as all tasks have been completed. In case a serial
+// section or another parallel section is active, all tasks are executed by the calling thread.
+// Within a task, all Blaze operations are executed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// evaluation of kernels that cannot be expressed as SMP assignments.
+*/
+template< typename Task >  // Type of the task functor
+inline void smpExecute( const Task& task, size_t tasks )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( tasks < 2UL || isSerialSectionActive() || isParallelSectionActive() || omp_in_parallel() ) {
+      for( size_t i=0UL; i<tasks; ++i ) {
+         task( i );
+      }
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const int n( static_cast<int>( tasks ) );
+
+#pragma omp parallel for schedule(dynamic,1) shared( task )
+      for( int i=0; i<n; ++i ) {
+         task( static_cast<size_t>( i ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -109,6 +109,9 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Task >
+   static inline void scheduleTask( const Task& task, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -277,6 +280,41 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class TaskExecutor******************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a single task of a task set.
+   */
+   template< typename Task >  // Type of the task functor
+   struct TaskExecutor
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the TaskExecutor class template.
+      //
+      // \param task The task functor to be executed.
+      // \param index The index of the task to be executed.
+      */
+      explicit inline TaskExecutor( const Task& task, size_t index )
+         : task_ ( task  )  // The task functor
+         , index_( index )  // The index of the task
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         task_( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Task   task_;   //!< The task functor.
+      const size_t index_;  //!< The index of the task.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -498,6 +536,31 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, cons
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a single task of a task set for execution.
+//
+// \param task The task functor to be executed.
+// \param index The index of the task to be executed.
+// \return void
+//
+// This function schedules the execution of the function call operator of the given task functor
+// for the given task index. Note that the task functor is copied and that all copies must refer
+// to the same shared state.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Task >  // Type of the task functor
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleTask( const Task& task, size_t index )
+{
+   threadpool_.schedule( TaskExecutor<Task>( task, index ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
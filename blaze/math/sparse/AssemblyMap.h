@@ -0,0 +1,496 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/AssemblyMap.h
+//  \brief Header file for the AssemblyMap class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ASSEMBLYMAP_H_
+#define _BLAZE_MATH_SPARSE_ASSEMBLYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/smp/Execute.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Precomputed mapping of assembly contributions onto a fixed sparsity pattern.
+// \ingroup sparse_matrix
+//
+// The AssemblyMap class enables the repeated, value-only assembly of a sparse matrix whose
+// sparsity pattern does not change, as for instance the system matrix of a transient finite
+// element simulation. During construction, a list of contributions given by their coordinates
+// \f$ (rows[k],columns[k]) \f$ (e.g. all entries of all element matrices, including duplicates)
+// is mapped once onto the stored elements of the given matrix: each contribution is assigned to
+// the row/column it belongs to and to the position of its element within that row/column, and
+// the contributions are sorted accordingly. Every subsequent assembly with a new array of
+// contribution values is a pure streaming pass over the elements of the matrix without any
+// element lookup or insertion:
+
+   \code
+   using blaze::CompressedMatrix;
+
+   std::vector<size_t> rows, columns;  // Coordinates of all element matrix entries
+   std::vector<double> values;         // Values of all element matrix entries
+
+   CompressedMatrix<double> A( n, n, &rows[0], &columns[0], &values[0], rows.size() );
+   const blaze::AssemblyMap map( A, &rows[0], &columns[0], rows.size() );
+
+   for( size_t step=0UL; step<steps; ++step ) {
+      // ... Computing the new element matrices into 'values'
+      map.assemble( A, &values[0] );  // A = sum of all contributions
+   }
+   \endcode
+
+// The assemble() function resets the values of all stored elements and adds all contributions,
+// the accumulate() function adds all contributions to the current values. Since the rows (for a
+// row-major matrix) or columns (for a column-major matrix) are processed independently, both
+// functions are executed in parallel by the active shared memory parallelization in case the
+// number of contributions is at least SMP_SMATASSEMBLE_THRESHOLD. Duplicate contributions are
+// always added in the order of their appearance, i.e. the result is deterministic and does not
+// depend on the number of threads.
+//
+// An AssemblyMap is valid for all matrices with the same storage order and the same sparsity
+// pattern as the matrix it was constructed with. Therefore several matrices (as for instance
+// the mass and stiffness matrices of a finite element discretization) can share a single map.
+// Both functions verify the storage order, the size, and the number of non-zero elements of
+// the given matrix, but the map must not be used after the sparsity pattern of a matrix has
+// been changed otherwise.
+*/
+class AssemblyMap
+{
+ private:
+   //**AssemblyTask class definition***************************************************************
+   /*!\brief Task for the assembly of a range of rows/columns.
+   */
+   template< typename MT       // Type of the sparse matrix
+           , typename Other >  // Type of the contribution values
+   struct AssemblyTask
+   {
+      inline AssemblyTask( const AssemblyMap& map, MT& A, const Other* values,
+                           const size_t* ranges, bool reset )
+         : map_   ( map    )  // The assembly map
+         , A_     ( A      )  // The sparse matrix to be assembled
+         , values_( values )  // The contribution values
+         , ranges_( ranges )  // The row/column ranges of all tasks
+         , reset_ ( reset  )  // Flag for the reset of the current values
+      {}
+
+      inline void operator()( size_t task ) const {
+         map_.assembleRange( A_, values_, ranges_[task], ranges_[task+1UL], reset_ );
+      }
+
+      const AssemblyMap& map_;  //!< The assembly map.
+      MT& A_;                   //!< The sparse matrix to be assembled.
+      const Other* values_;     //!< The contribution values.
+      const size_t* ranges_;    //!< The row/column ranges of all tasks.
+      bool reset_;              //!< Flag for the reset of the current values.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO, typename IT >
+   explicit AssemblyMap( const SparseMatrix<MT,SO>& sm, const IT* rows, const IT* columns,
+                         size_t contributions );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows         () const;
+   inline size_t columns      () const;
+   inline size_t nonZeros     () const;
+   inline size_t contributions() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assembly functions**************************************************************************
+   /*!\name Assembly functions */
+   //@{
+   template< typename MT, bool SO, typename Other >
+   inline void assemble( SparseMatrix<MT,SO>& sm, const Other* values ) const;
+
+   template< typename MT, bool SO, typename Other >
+   inline void accumulate( SparseMatrix<MT,SO>& sm, const Other* values ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Assembly functions**************************************************************************
+   /*!\name Assembly functions */
+   //@{
+   template< typename MT, bool SO, typename Other >
+   void assemble( SparseMatrix<MT,SO>& sm, const Other* values, bool reset ) const;
+
+   template< typename MT, typename Other >
+   void assembleRange( MT& A, const Other* values, size_t first, size_t last, bool reset ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                       //!< The number of rows of the sparsity pattern.
+   size_t n_;                       //!< The number of columns of the sparsity pattern.
+   size_t nonZeros_;                //!< The number of non-zero elements of the sparsity pattern.
+   bool   columnMajor_;             //!< The storage order of the sparsity pattern.
+   std::vector<size_t> offsets_;    //!< The offsets of the contributions of each row/column.
+   std::vector<size_t> positions_;  //!< The element positions of all sorted contributions.
+   std::vector<size_t> sources_;    //!< The input indices of all sorted contributions.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the AssemblyMap class.
+//
+// \param sm The sparse matrix defining the sparsity pattern.
+// \param rows The array of row indices of the contributions.
+// \param columns The array of column indices of the contributions.
+// \param contributions The number of contributions.
+// \exception std::invalid_argument Invalid contribution index.
+// \exception std::invalid_argument Contribution not contained in the sparsity pattern.
+//
+// This constructor maps the given contributions onto the stored elements of the given sparse
+// matrix. The iterators of the matrix are required to be random access iterators (as for
+// instance the iterators of the CompressedMatrix class template). In case any row or column
+// index is out of bounds or any contribution refers to an element that is not stored in the
+// matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO      // Storage order
+        , typename IT >  // Type of the contribution indices
+AssemblyMap::AssemblyMap( const SparseMatrix<MT,SO>& sm, const IT* rows, const IT* columns,
+                          size_t contributions )
+   : m_          ( (~sm).rows()     )  // The number of rows of the sparsity pattern
+   , n_          ( (~sm).columns()  )  // The number of columns of the sparsity pattern
+   , nonZeros_   ( (~sm).nonZeros() )  // The number of non-zero elements of the sparsity pattern
+   , columnMajor_( SO == columnMajor )  // The storage order of the sparsity pattern
+   , offsets_    ()                    // The offsets of the contributions of each row/column
+   , positions_  ()                    // The element positions of all sorted contributions
+   , sources_    ()                    // The input indices of all sorted contributions
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   const MT& A( ~sm );
+
+   const size_t majors( SO ? n_ : m_ );
+
+   // Locating the element of every contribution
+   std::vector<size_t> major   ( contributions );
+   std::vector<size_t> position( contributions );
+
+   offsets_.assign( majors+1UL, 0UL );
+
+   for( size_t k=0UL; k<contributions; ++k )
+   {
+      const size_t i( static_cast<size_t>( rows[k]    ) );
+      const size_t j( static_cast<size_t>( columns[k] ) );
+
+      if( i >= m_ || j >= n_ )
+         throw std::invalid_argument( "Invalid contribution index" );
+
+      const size_t index( SO ? j : i );
+      const ConstIterator pos( A.find( i, j ) );
+
+      if( pos == A.end( index ) )
+         throw std::invalid_argument( "Contribution not contained in the sparsity pattern" );
+
+      major[k]    = index;
+      position[k] = static_cast<size_t>( pos - A.begin( index ) );
+      ++offsets_[index+1UL];
+   }
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      offsets_[i+1UL] += offsets_[i];
+   }
+
+   // Sorting the contributions by row/column (stable) and by position within the row/column
+   std::vector< std::pair<size_t,size_t> > sorted( contributions );
+   std::vector<size_t> next( offsets_.begin(), offsets_.end()-1 );
+
+   for( size_t k=0UL; k<contributions; ++k ) {
+      sorted[next[major[k]]++] = std::make_pair( position[k], k );
+   }
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      std::sort( sorted.begin()+offsets_[i], sorted.begin()+offsets_[i+1UL] );
+   }
+
+   positions_.resize( contributions );
+   sources_.resize( contributions );
+
+   for( size_t k=0UL; k<contributions; ++k ) {
+      positions_[k] = sorted[k].first;
+      sources_[k]   = sorted[k].second;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the sparsity pattern.
+//
+// \return The number of rows of the sparsity pattern.
+*/
+inline size_t AssemblyMap::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the sparsity pattern.
+//
+// \return The number of columns of the sparsity pattern.
+*/
+inline size_t AssemblyMap::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the sparsity pattern.
+//
+// \return The number of non-zero elements of the sparsity pattern.
+*/
+inline size_t AssemblyMap::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of contributions.
+//
+// \return The number of contributions.
+*/
+inline size_t AssemblyMap::contributions() const
+{
+   return sources_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSEMBLY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assembly of the given sparse matrix from the given contribution values.
+//
+// \param sm The sparse matrix to be assembled.
+// \param values The array of values of all contributions.
+// \return void
+// \exception std::invalid_argument Sparsity pattern does not match the assembly map.
+//
+// This function resets the values of all stored elements of the given sparse matrix and adds
+// all contributions \f$ values[k] \f$ to their elements. The sparsity pattern of the matrix
+// remains unchanged, i.e. elements without any contribution are stored with their default
+// value. In case the storage order, the size, or the number of non-zero elements of the matrix
+// don't match the sparsity pattern of the map, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Other >  // Type of the contribution values
+inline void AssemblyMap::assemble( SparseMatrix<MT,SO>& sm, const Other* values ) const
+{
+   assemble( sm, values, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Accumulation of the given contribution values into the given sparse matrix.
+//
+// \param sm The sparse matrix to be updated.
+// \param values The array of values of all contributions.
+// \return void
+// \exception std::invalid_argument Sparsity pattern does not match the assembly map.
+//
+// This function adds all contributions \f$ values[k] \f$ to the current values of their
+// elements of the given sparse matrix. In case the storage order, the size, or the number
+// of non-zero elements of the matrix don't match the sparsity pattern of the map, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Other >  // Type of the contribution values
+inline void AssemblyMap::accumulate( SparseMatrix<MT,SO>& sm, const Other* values ) const
+{
+   assemble( sm, values, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Backend of the assemble() and accumulate() functions.
+//
+// \param sm The sparse matrix to be assembled.
+// \param values The array of values of all contributions.
+// \param reset \a true in order to reset the current values of the elements.
+// \return void
+// \exception std::invalid_argument Sparsity pattern does not match the assembly map.
+//
+// The rows/columns are partitioned into tasks of approximately the same number of
+// contributions, which are executed in parallel in case the number of contributions
+// is at least SMP_SMATASSEMBLE_THRESHOLD.
+*/
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order
+        , typename Other >  // Type of the contribution values
+void AssemblyMap::assemble( SparseMatrix<MT,SO>& sm, const Other* values, bool reset ) const
+{
+   if( SO != columnMajor_ || (~sm).rows() != m_ || (~sm).columns() != n_ ||
+       (~sm).nonZeros() != nonZeros_ )
+      throw std::invalid_argument( "Sparsity pattern does not match the assembly map" );
+
+   const size_t majors( offsets_.size()-1UL );
+   const size_t total ( contributions() );
+   const size_t threads( getNumThreads() );
+
+   const size_t tasks( ( threads > 1UL && total >= SMP_SMATASSEMBLE_THRESHOLD )
+                       ?( min( 4UL*threads, majors ) ):( 1UL ) );
+
+   // Partitioning the rows/columns into tasks of approximately equal number of contributions
+   std::vector<size_t> ranges( tasks+1UL, majors );
+   ranges[0UL] = 0UL;
+
+   for( size_t t=1UL; t<tasks; ++t ) {
+      ranges[t] = static_cast<size_t>( std::lower_bound( offsets_.begin(), offsets_.end(),
+                                                         ( t*total ) / tasks ) - offsets_.begin() );
+      ranges[t] = max( min( ranges[t], majors ), ranges[t-1UL] );
+   }
+
+   smpExecute( AssemblyTask<MT,Other>( *this, ~sm, values, &ranges[0], reset ), tasks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembly of a range of rows/columns.
+//
+// \param A The sparse matrix to be assembled.
+// \param values The array of values of all contributions.
+// \param first The index of the first row/column.
+// \param last The index one past the last row/column.
+// \param reset \a true in order to reset the current values of the elements.
+// \return void
+*/
+template< typename MT      // Type of the sparse matrix
+        , typename Other >  // Type of the contribution values
+void AssemblyMap::assembleRange( MT& A, const Other* values, size_t first, size_t last,
+                                 bool reset ) const
+{
+   using blaze::clear;
+
+   typedef typename MT::Iterator  Iterator;
+
+   for( size_t i=first; i<last; ++i )
+   {
+      const Iterator begin( A.begin( i ) );
+
+      if( reset ) {
+         const Iterator end( A.end( i ) );
+         for( Iterator element=begin; element!=end; ++element )
+            clear( element->value() );
+      }
+
+      BLAZE_USER_ASSERT( offsets_[i] == offsets_[i+1UL] ||
+                         positions_[offsets_[i+1UL]-1UL] < A.nonZeros( i ),
+                         "Sparsity pattern does not match the assembly map" );
+
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         ( begin + positions_[k] )->value() += values[sources_[k]];
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
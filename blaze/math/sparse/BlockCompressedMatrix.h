@@ -0,0 +1,1555 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a sparse matrix in block compressed row (BSR) format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Row-major sparse matrix in block compressed row (BSR) format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is a read-only, row-major sparse matrix that stores
+// its non-zero elements in dense \f$ B \times B \f$ blocks. In contrast to CompressedMatrix,
+// which stores a column index for every single non-zero element, BlockCompressedMatrix stores
+// only a single column index per block. All blocks of a block row are stored consecutively and
+// are sorted by their block column index. Every block is a row-major StaticMatrix, which enables
+// the multiplication of a single block with the according part of a dense vector or matrix
+// completely in registers. The type of the elements and the block size of the matrix can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t B >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - B   : specifies the number of rows and columns of the blocks. The number of rows and
+//          columns of the matrix has to be a multiple of \a B.
+//
+// A BlockCompressedMatrix is created from any other (dense or sparse) matrix. Every \f$ B
+// \times B \f$ block of the given matrix that contains at least one non-zero element is stored
+// as a complete block, i.e. including all zero elements of the block:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::BlockCompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 3000UL, 3000UL );
+   // ... Initialization of A with 3x3 blocks
+
+   BlockCompressedMatrix<double,3UL> B( A );  // Conversion to 3x3 blocks
+
+   DynamicVector<double> x( 3000UL ), y;
+   // ... Initialization of x
+
+   y = B * x;  // Block-wise sparse matrix/dense vector multiplication
+   \endcode
+
+// Element access and the traversal of the elements of a row work exactly as for a row-major
+// CompressedMatrix, except that the elements cannot be modified and that the traversal also
+// visits the zero elements within the stored blocks. The values of the stored blocks can be
+// updated via the low-level blocks() function, new blocks can only be added by assigning a
+// new matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,B>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrix<Type,B,B,false>  BlockType;  //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a single row of the sparse matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sparse matrix.
+      typedef ValueIndexPair<Type>  Element;
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying pointers.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying pointers.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : block_ ( NULL )  // Pointer to the current block
+         , index_ ( NULL )  // Pointer to the block column index of the current block
+         , row_   ( 0UL  )  // Row index within the current block
+         , column_( 0UL  )  // Column index within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param block Pointer to the current block.
+      // \param index Pointer to the block column index of the current block.
+      // \param row The row index within the current block.
+      // \param column The column index within the current block.
+      */
+      inline ConstIterator( const BlockType* block, const size_t* index, size_t row, size_t column )
+         : block_ ( block  )  // Pointer to the current block
+         , index_ ( index  )  // Pointer to the block column index of the current block
+         , row_   ( row    )  // Row index within the current block
+         , column_( column )  // Column index within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         if( ++column_ == B ) {
+            column_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( value(), index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const {
+         return (*block_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return (*index_)*B + column_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return block_ == rhs.block_ && column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return block_ != rhs.block_ || column_ != rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( block_ - rhs.block_ ) * static_cast<DifferenceType>( B ) +
+                static_cast<DifferenceType>( column_ ) - static_cast<DifferenceType>( rhs.column_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const BlockType* block_;   //!< Pointer to the current block.
+      const size_t*    index_;   //!< Pointer to the block column index of the current block.
+      size_t           row_;     //!< Row index within the current block.
+      size_t           column_;  //!< Column index within the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,B>  This;            //!< Type of this BlockCompressedMatrix instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>    OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>    TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                    Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef ConstIterator                  Iterator;        //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BlockCompressedMatrix<ET,B>  Other;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+
+   //! The number of rows and columns per block.
+   enum { blockSize = B };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix();
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+            inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const DenseMatrix<MT,SO>& dm );
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const SparseMatrix<MT,SO>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const DenseMatrix<MT,SO>&  rhs );
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const SparseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t i ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( BlockCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t           blockRows() const;
+   inline size_t           blockColumns() const;
+   inline size_t           nonZeroBlocks() const;
+   inline size_t           blockOffset( size_t I ) const;
+   inline const size_t*    indices() const;
+   inline BlockType*       blocks();
+   inline const BlockType* blocks() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const size_t* findBlock( size_t I, size_t J ) const;
+
+   template< typename MT >
+   void build( const MT& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t     m_;        //!< The current number of rows of the sparse matrix.
+   size_t     n_;        //!< The current number of columns of the sparse matrix.
+   size_t*    offset_;   //!< The offsets of the first blocks of all block rows.
+   size_t*    indices_;  //!< The block column indices of all blocks.
+   BlockType* blocks_;   //!< The dense blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+const Type BlockCompressedMatrix<Type,B>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix()
+   : m_      ( 0UL )              // The current number of rows of the sparse matrix
+   , n_      ( 0UL )              // The current number of columns of the sparse matrix
+   , offset_ ( new size_t[1UL] )  // The offsets of the first blocks of all block rows
+   , indices_( NULL )             // The block column indices of all blocks
+   , blocks_ ( NULL )             // The dense blocks
+{
+   offset_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty \f$ m \times n \f$ BlockCompressedMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid matrix size for block compressed matrix.
+//
+// In case \a m or \a n is not a multiple of the block size \a B, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( size_t m, size_t n )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , offset_ ( NULL )  // The offsets of the first blocks of all block rows
+   , indices_( NULL )  // The block column indices of all blocks
+   , blocks_ ( NULL )  // The dense blocks
+{
+   build( CompressedMatrix<Type,false>( m, n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : m_      ( sm.m_ )                                       // The current number of rows of the sparse matrix
+   , n_      ( sm.n_ )                                       // The current number of columns of the sparse matrix
+   , offset_ ( new size_t[sm.blockRows()+1UL] )              // The offsets of the first blocks of all block rows
+   , indices_( allocate<size_t>( sm.nonZeroBlocks() ) )      // The block column indices of all blocks
+   , blocks_ ( allocate<BlockType>( sm.nonZeroBlocks() ) )   // The dense blocks
+{
+   std::copy( sm.offset_ , sm.offset_ +blockRows()+1UL, offset_  );
+   std::copy( sm.indices_, sm.indices_+nonZeroBlocks(), indices_ );
+   std::copy( sm.blocks_ , sm.blocks_ +nonZeroBlocks(), blocks_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be converted.
+// \exception std::invalid_argument Invalid matrix size for block compressed matrix.
+//
+// In case the number of rows or columns of the given matrix is not a multiple of the block
+// size \a B, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO >      // Storage order of the foreign dense matrix
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const DenseMatrix<MT,SO>& dm )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , offset_ ( NULL )  // The offsets of the first blocks of all block rows
+   , indices_( NULL )  // The block column indices of all blocks
+   , blocks_ ( NULL )  // The dense blocks
+{
+   build( CompressedMatrix<Type,false>( ~dm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from sparse matrices.
+//
+// \param sm Sparse matrix to be converted.
+// \exception std::invalid_argument Invalid matrix size for block compressed matrix.
+//
+// Row-major sparse matrices are converted directly. Column-major sparse matrices and sparse
+// matrix expressions are first evaluated into a temporary row-major CompressedMatrix. In case
+// the number of rows or columns of the given matrix is not a multiple of the block size \a B,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO >      // Storage order of the foreign sparse matrix
+inline BlockCompressedMatrix<Type,B>::BlockCompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : m_      ( 0UL )   // The current number of rows of the sparse matrix
+   , n_      ( 0UL )   // The current number of columns of the sparse matrix
+   , offset_ ( NULL )  // The offsets of the first blocks of all block rows
+   , indices_( NULL )  // The block column indices of all blocks
+   , blocks_ ( NULL )  // The dense blocks
+{
+   typedef typename SelectType< SO || IsExpression<MT>::value
+                              , const CompressedMatrix<Type,false>
+                              , const MT& >::Type  Tmp;
+
+   Tmp tmp( ~sm );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline BlockCompressedMatrix<Type,B>::~BlockCompressedMatrix()
+{
+   delete [] offset_;
+   deallocate( indices_ );
+   deallocate( blocks_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstReference
+   BlockCompressedMatrix<Type,B>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t* const pos( findBlock( i/B, j/B ) );
+
+   if( pos == indices_ + offset_[i/B+1UL] || *pos != j/B )
+      return zero_;
+   else
+      return blocks_[pos-indices_](i%B,j%B);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t offset( offset_[i/B] );
+   return ConstIterator( blocks_+offset, indices_+offset, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t offset( offset_[i/B+1UL] );
+   return ConstIterator( blocks_+offset, indices_+offset, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid matrix size for block compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for sparse matrices.
+//
+// \param rhs Sparse matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid matrix size for block compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO >      // Storage order of the right-hand side sparse matrix
+inline BlockCompressedMatrix<Type,B>&
+   BlockCompressedMatrix<Type,B>::operator=( const SparseMatrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::capacity() const
+{
+   return nonZeroBlocks()*B*B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified row.
+//
+// \param i The index of the row.
+// \return The capacity of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return ( offset_[i/B+1UL] - offset_[i/B] )*B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// Since all elements of the stored blocks are treated as non-zero elements, the number of
+// non-zero elements corresponds to the capacity of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros() const
+{
+   return capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::nonZeros( size_t i ) const
+{
+   return capacity( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all non-zero elements from the sparse matrix.
+//
+// \return void
+//
+// This function removes all blocks from the sparse matrix. The number of rows and columns
+// remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline void BlockCompressedMatrix<Type,B>::reset()
+{
+   BlockCompressedMatrix tmp( m_, n_ );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline void BlockCompressedMatrix<Type,B>::clear()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline void BlockCompressedMatrix<Type,B>::swap( BlockCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_      , sm.m_       );
+   std::swap( n_      , sm.n_       );
+   std::swap( offset_ , sm.offset_  );
+   std::swap( indices_, sm.indices_ );
+   std::swap( blocks_ , sm.blocks_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches the first block of block row \a I with a block column index not less than \a J.
+//
+// \param I The index of the block row.
+// \param J The index of the block column.
+// \return Pointer to the block column index of the found block.
+//
+// In case no such block exists, the function returns a pointer just past the block column
+// index of the last block of block row \a I.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline const size_t* BlockCompressedMatrix<Type,B>::findBlock( size_t I, size_t J ) const
+{
+   return std::lower_bound( indices_+offset_[I], indices_+offset_[I+1UL], J );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the block compressed data structure for the given row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+// \exception std::invalid_argument Invalid matrix size for block compressed matrix.
+//
+// This function determines all \f$ B \times B \f$ blocks of the given matrix that contain at
+// least one non-zero element and stores them block row by block row, sorted by their block
+// column index. In case the number of rows or columns of the given matrix is not a multiple
+// of the block size \a B, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+template< typename MT >  // Type of the row-major sparse matrix
+void BlockCompressedMatrix<Type,B>::build( const MT& sm )
+{
+   typedef typename MT::ConstIterator  RowIterator;
+
+   if( sm.rows() % B != 0UL || sm.columns() % B != 0UL )
+      throw std::invalid_argument( "Invalid matrix size for block compressed matrix" );
+
+   const size_t mb( sm.rows()    / B );
+   const size_t nb( sm.columns() / B );
+   const size_t invalid( mb );
+
+   std::vector<size_t> marker( nb, invalid );
+   std::vector<size_t> position( nb );
+
+   BlockCompressedMatrix tmp;
+   delete [] tmp.offset_;
+   tmp.offset_ = NULL;
+
+   tmp.m_      = sm.rows();
+   tmp.n_      = sm.columns();
+   tmp.offset_ = new size_t[mb+1UL];
+
+   tmp.offset_[0UL] = 0UL;
+   for( size_t I=0UL; I<mb; ++I ) {
+      size_t count( 0UL );
+      for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+         const RowIterator end( sm.end( i ) );
+         for( RowIterator element=sm.begin( i ); element!=end; ++element ) {
+            const size_t J( element->index() / B );
+            if( marker[J] != I ) {
+               marker[J] = I;
+               ++count;
+            }
+         }
+      }
+      tmp.offset_[I+1UL] = tmp.offset_[I] + count;
+   }
+
+   tmp.indices_ = allocate<size_t>   ( tmp.offset_[mb] );
+   tmp.blocks_  = allocate<BlockType>( tmp.offset_[mb] );
+
+   std::fill( marker.begin(), marker.end(), invalid );
+
+   for( size_t I=0UL; I<mb; ++I )
+   {
+      size_t* const first( tmp.indices_ + tmp.offset_[I] );
+      size_t* last( first );
+
+      for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+         const RowIterator end( sm.end( i ) );
+         for( RowIterator element=sm.begin( i ); element!=end; ++element ) {
+            const size_t J( element->index() / B );
+            if( marker[J] != I ) {
+               marker[J] = I;
+               *last++ = J;
+            }
+         }
+      }
+
+      std::sort( first, last );
+
+      for( size_t* index=first; index!=last; ++index ) {
+         position[*index] = tmp.offset_[I] + ( index - first );
+      }
+
+      for( size_t i=I*B; i<(I+1UL)*B; ++i ) {
+         const RowIterator end( sm.end( i ) );
+         for( RowIterator element=sm.begin( i ); element!=end; ++element ) {
+            const size_t j( element->index() );
+            tmp.blocks_[position[j/B]](i%B,j%B) = element->value();
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t I( i/B );
+   const size_t* const pos( findBlock( I, j/B ) );
+   const size_t k( pos - indices_ );
+
+   if( pos != indices_+offset_[I+1UL] && *pos == j/B )
+      return ConstIterator( blocks_+k, pos, i%B, j%B );
+   else
+      return ConstIterator( blocks_+k, pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::ConstIterator
+   BlockCompressedMatrix<Type,B>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t I( i/B );
+   const size_t* const pos( findBlock( I, j/B ) );
+   const size_t k( pos - indices_ );
+
+   if( pos != indices_+offset_[I+1UL] && *pos == j/B && j%B+1UL < B )
+      return ConstIterator( blocks_+k, pos, i%B, j%B+1UL );
+   else if( pos != indices_+offset_[I+1UL] && *pos == j/B )
+      return ConstIterator( blocks_+k+1UL, pos+1UL, i%B, 0UL );
+   else
+      return ConstIterator( blocks_+k, pos, i%B, 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of block rows of the sparse matrix.
+//
+// \return The number of block rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::blockRows() const
+{
+   return m_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of block columns of the sparse matrix.
+//
+// \return The number of block columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::blockColumns() const
+{
+   return n_ / B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored blocks of the sparse matrix.
+//
+// \return The number of stored blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::nonZeroBlocks() const
+{
+   return offset_[blockRows()];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first block of the specified block row.
+//
+// \param I The index of the block row. The index has to be in the range \f$[0..blockRows()]\f$.
+// \return The offset of the first block of block row \a I.
+//
+// The blocks of block row \a I are stored in the range \f$ [blockOffset(I)..blockOffset(I+1)) \f$
+// of the arrays returned by the indices() and blocks() functions.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline size_t BlockCompressedMatrix<Type,B>::blockOffset( size_t I ) const
+{
+   BLAZE_USER_ASSERT( I <= blockRows(), "Invalid block row access index" );
+   return offset_[I];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the block column indices of the stored blocks.
+//
+// \return Pointer to the block column indices of the stored blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline const size_t* BlockCompressedMatrix<Type,B>::indices() const
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the stored blocks.
+//
+// \return Pointer to the stored blocks.
+//
+// This function enables the in-place update of the values of the stored blocks, for instance
+// during a repeated assembly of a matrix with fixed sparsity pattern. The sparsity pattern
+// itself cannot be modified.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline typename BlockCompressedMatrix<Type,B>::BlockType* BlockCompressedMatrix<Type,B>::blocks()
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the stored blocks.
+//
+// \return Pointer to the stored blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline const typename BlockCompressedMatrix<Type,B>::BlockType*
+   BlockCompressedMatrix<Type,B>::blocks() const
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns per block
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t B >        // Number of rows and columns per block
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,B>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since the matrix does not support SMP assignments.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline bool BlockCompressedMatrix<Type,B>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t B >
+inline void reset( BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void clear( BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline bool isDefault( const BlockCompressedMatrix<Type,B>& m );
+
+template< typename Type, size_t B >
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline void reset( BlockCompressedMatrix<Type,B>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline void clear( BlockCompressedMatrix<Type,B>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline bool isDefault( const BlockCompressedMatrix<Type,B>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t B >     // Number of rows and columns per block
+inline void swap( BlockCompressedMatrix<Type,B>& a, BlockCompressedMatrix<Type,B>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISBLOCKCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t B >
+struct IsBlockCompressed< BlockCompressedMatrix<T,B> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, T2 >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< T1, BlockCompressedMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, size_t B, typename T2, size_t N >
+struct MultTrait< BlockCompressedMatrix<T1,B>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t B >
+struct MultTrait< StaticVector<T1,N,true>, BlockCompressedMatrix<T2,B> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t N >
+struct MultTrait< BlockCompressedMatrix<T1,B>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t B >
+struct MultTrait< HybridVector<T1,N,true>, BlockCompressedMatrix<T2,B> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2, typename A2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, DynamicVector<T2,false,A2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t B, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, BlockCompressedMatrix<T2,B> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t B >
+struct MultTrait< CompressedVector<T1,true>, BlockCompressedMatrix<T2,B> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< BlockCompressedMatrix<T1,B>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct MultTrait< StaticMatrix<T1,M,N,SO>, BlockCompressedMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< BlockCompressedMatrix<T1,B>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t B >
+struct MultTrait< HybridMatrix<T1,M,N,SO>, BlockCompressedMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO, typename A2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, DynamicMatrix<T2,SO,A2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, BlockCompressedMatrix<T2,B> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t B, typename T2, bool SO, typename A2 >
+struct MultTrait< BlockCompressedMatrix<T1,B>, CompressedMatrix<T2,SO,A2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t B, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, BlockCompressedMatrix<T2,B> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -48,10 +48,13 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/StorageOrderConverter.h>
+#include <blaze/math/sparse/TripletAssembler.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -70,6 +73,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -81,6 +85,7 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
@@ -103,11 +108,11 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements, the storage order of the matrix, and the allocator of the elements can be
+// specified via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename AT >
    class CompressedMatrix;
    \endcode
 
@@ -115,6 +120,9 @@ namespace blaze {
 //          any non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
+//  - AT  : specifies the allocator of the matrix elements. The allocator has to model the
+//          allocator concept of the standard library. The default value is
+//          blaze::AlignedAllocator.
 //
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -140,6 +148,11 @@ namespace blaze {
    // it inserts the element only in case the element is not already contained in the matrix.
    A.insert( 2, 1, 3.7 );
 
+   // Elements can be inserted via the function call operator, set(), and insert() in any order.
+   // Every row keeps some free capacity for new elements, which can be removed afterwards via
+   // the compact() function.
+   A.compact();
+
    // A very efficient way to add new elements to a sparse matrix is the append() function.
    // Note that append() requires that the appended element's index is strictly larger than
    // the currently largest non-zero index of the specified row and that the matrix's capacity
@@ -205,8 +218,9 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the sparse matrix
-        , bool SO = defaultStorageOrder >  // Storage order
-class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename AT >                    // Type of the allocator
+class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO,AT>, SO >
 {
  private:
    //**Type definitions****************************************************************************
@@ -254,17 +268,18 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,SO>   This;            //!< Type of this CompressedMatrix instance.
-   typedef This                        ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                        ElementType;     //!< Type of the sparse matrix elements.
-   typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                 CompositeType;   //!< Data type for composite expression templates.
-   typedef MatrixAccessProxy<This>     Reference;       //!< Reference to a sparse matrix value.
-   typedef const Type&                 ConstReference;  //!< Reference to a constant sparse matrix value.
-   typedef Element*                    Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*              ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedMatrix<Type,SO,AT>   This;            //!< Type of this CompressedMatrix instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,AT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,AT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef Element*                       Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                 ConstIterator;   //!< Iterator over constant elements.
+   typedef AT                             AllocatorType;   //!< Type of the allocator of the sparse matrix elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -272,7 +287,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,SO>  Other;  //!< The type of the other CompressedMatrix.
+      typedef typename AT::BLAZE_TEMPLATE rebind<ET>::other  OtherAllocator;  //!< Allocator type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,SO,OtherAllocator>         Other;           //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -288,12 +304,18 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    /*!\name Constructors */
    //@{
                             explicit inline CompressedMatrix();
-                            explicit inline CompressedMatrix( size_t m, size_t n );
-                            explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros );
-                            explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                            explicit inline CompressedMatrix( const AT& alloc );
+                            explicit inline CompressedMatrix( size_t m, size_t n, const AT& alloc = AT() );
+                            explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros, const AT& alloc = AT() );
+                            explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros,
+                                                              const AT& alloc = AT() );
                                      inline CompressedMatrix( const CompressedMatrix& sm );
    template< typename MT, bool SO2 > inline CompressedMatrix( const DenseMatrix<MT,SO2>&  dm );
    template< typename MT, bool SO2 > inline CompressedMatrix( const SparseMatrix<MT,SO2>& sm );
+
+   template< typename IT, typename Other >
+   explicit CompressedMatrix( size_t m, size_t n, const IT* rows, const IT* columns,
+                              const Other* values, size_t nonzeros );
    //@}
    //**********************************************************************************************
 
@@ -344,11 +366,13 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
                               inline size_t            rows() const;
                               inline size_t            columns() const;
                               inline size_t            capacity() const;
+                              inline AT                getAllocator() const;
                               inline size_t            capacity( size_t i ) const;
                               inline size_t            nonZeros() const;
                               inline size_t            nonZeros( size_t i ) const;
                               inline void              reset();
                               inline void              reset( size_t i );
+                              inline void              resetValues();
                               inline void              clear();
                               inline Iterator          set    ( size_t i, size_t j, const Type& value );
                               inline Iterator          insert ( size_t i, size_t j, const Type& value );
@@ -360,6 +384,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
                                      void              reserve( size_t i, size_t nonzeros );
                               inline void              trim   ();
                               inline void              trim   ( size_t i );
+                                     void              compact();
                               inline CompressedMatrix& transpose();
    template< typename Other > inline CompressedMatrix& scale( const Other& scalar );
    template< typename Other > inline CompressedMatrix& scaleDiagonal( Other scalar );
@@ -384,6 +409,13 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //@{
    inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void finalize( size_t i );
+
+   template< typename IT, typename Other >
+   inline void assemble( const IT* rows, const IT* columns, const Other* values, size_t nonzeros );
+
+   template< typename IT, typename Other, typename Combiner >
+   void assemble( const IT* rows, const IT* columns, const Other* values,
+                  size_t nonzeros, Combiner combine );
    //@}
    //**********************************************************************************************
 
@@ -409,20 +441,50 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+   inline Iterator insertPosition( size_t i, size_t j ) const;
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
+          bool     borrowCapacity( size_t i, Iterator& pos );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
    //@}
    //**********************************************************************************************
 
+   //**struct Memory******************************************************************************
+   /*!\brief The allocator of the sparse matrix elements and the current capacity of the pointer array.
+   //
+   // The allocator is stored as base class in order to exploit the empty base optimization,
+   // i.e. a stateless allocator does not increase the size of the sparse matrix.
+   */
+   struct Memory : public AT
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the allocator and the capacity.
+      //
+      // \param alloc The allocator of the sparse matrix elements.
+      // \param capacity The current capacity of the pointer array.
+      */
+      explicit inline Memory( const AT& alloc, size_t capacity )
+         : AT       ( alloc    )  // The allocator of the sparse matrix elements
+         , capacity_( capacity )  // The current capacity of the pointer array
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t capacity_;  //!< The current capacity of the pointer array.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    size_t m_;         //!< The current number of rows of the sparse matrix.
    size_t n_;         //!< The current number of columns of the sparse matrix.
-   size_t capacity_;  //!< The current capacity of the pointer array.
+   Memory alloc_;     //!< The allocator and the capacity of the pointer array.
    Iterator* begin_;  //!< Pointers to the first non-zero element of each row.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each row.
+   size_t cursor_;    //!< The row of the most recent insertion.
+   size_t offset_;    //!< The position of the most recent insertion within its row.
 
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
@@ -449,8 +511,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_ = Type();
+template< typename Type, bool SO, typename AT >
+const Type CompressedMatrix<Type,SO,AT>::zero_ = Type();
 
 
 
@@ -465,13 +527,38 @@ const Type CompressedMatrix<Type,SO>::zero_ = Type();
 /*!\brief The default constructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
-   : m_       ( 0UL )           // The current number of rows of the sparse matrix
-   , n_       ( 0UL )           // The current number of columns of the sparse matrix
-   , capacity_( 0UL )           // The current capacity of the pointer array
-   , begin_( new Iterator[2] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+1 )         // Pointers one past the last non-zero element of each row
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix()
+   : m_       ( 0UL )                           // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                           // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), 0UL )                     // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( AT(), 2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+1 )                         // Pointers one past the last non-zero element of each row
+   , cursor_( 0UL )                             // The row of the most recent insertion
+   , offset_( 0UL )                             // The position of the most recent insertion
+{
+   begin_[0] = end_[0] = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty matrix using the given allocator.
+//
+// \param alloc The allocator for the sparse matrix elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix( const AT& alloc )
+   : m_       ( 0UL )                            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                            // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, 0UL )                     // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+1 )                          // Pointers one past the last non-zero element of each row
+   , cursor_( 0UL )                              // The row of the most recent insertion
+   , offset_( 0UL )                              // The position of the most recent insertion
 {
    begin_[0] = end_[0] = NULL;
 }
@@ -483,17 +570,21 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the sparse matrix elements.
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix( size_t m, size_t n, const AT& alloc )
+   : m_       ( m )                                    // The current number of rows of the sparse matrix
+   , n_       ( n )                                    // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, m )                             // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                          // Pointers one past the last non-zero element of each row
+   , cursor_( 0UL )                                    // The row of the most recent insertion
+   , offset_( 0UL )                                    // The position of the most recent insertion
 {
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = NULL;
@@ -507,19 +598,23 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The number of expected non-zero elements.
+// \param alloc The allocator for the sparse matrix elements.
 //
 // The matrix is initialized to the zero matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
-{
-   begin_[0UL] = allocate<Element>( nonzeros );
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros, const AT& alloc )
+   : m_       ( m )                                    // The current number of rows of the sparse matrix
+   , n_       ( n )                                    // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, m )                             // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                          // Pointers one past the last non-zero element of each row
+   , cursor_( 0UL )                                    // The row of the most recent insertion
+   , offset_( 0UL )                                    // The position of the most recent insertion
+{
+   begin_[0UL] = allocate<Element>( alloc_, nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
       begin_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
@@ -533,19 +628,24 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The expected number of non-zero elements in each row/column.
+// \param alloc The allocator for the sparse matrix elements.
 //
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // row/column. Note that in case of a row-major matrix the given vector must have at least
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
-   , capacity_( m )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+CompressedMatrix<Type,SO,AT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros,
+                                                const AT& alloc )
+   : m_       ( m )                                     // The current number of rows of the sparse matrix
+   , n_       ( n )                                     // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, m )                              // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )                          // Pointers one past the last non-zero element of each row
+   , cursor_( 0UL )                                     // The row of the most recent insertion
+   , offset_( 0UL )                                     // The position of the most recent insertion
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
@@ -553,7 +653,7 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
    for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
       newCapacity += *it;
 
-   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity );
+   begin_[0UL] = end_[0UL] = allocate<Element>( alloc_, newCapacity );
    for( size_t i=0UL; i<m_; ++i ) {
       begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
    }
@@ -567,17 +667,20 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
-   : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
-   , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
-   , capacity_( sm.m_ )                     // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix( const CompressedMatrix& sm )
+   : m_       ( sm.m_ )                                        // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                        // The current number of columns of the sparse matrix
+   , alloc_   ( sm.alloc_, sm.m_ )                             // The allocator and capacity of the pointer array
+   , begin_   ( allocate<Iterator>( sm.alloc_, 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                              // Pointers one past the last non-zero element of each row
+   , cursor_  ( 0UL )                                          // The row of the most recent insertion
+   , offset_  ( 0UL )                                          // The position of the most recent insertion
 {
    const size_t nonzeros( sm.nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( alloc_, nonzeros );
    for( size_t i=0UL; i<m_; ++i )
       begin_[i+1UL] = end_[i] = std::copy( sm.begin(i), sm.end(i), begin_[i] );
    end_[m_] = begin_[0UL]+nonzeros;
@@ -591,15 +694,18 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 // \param dm Dense matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( (~dm).rows() )                            // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                         // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), m_ )                                // The allocator and capacity of the pointer array
+   , begin_   ( allocate<Iterator>( AT(), 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                         // Pointers one past the last non-zero element of each row
+   , cursor_  ( 0UL )                                     // The row of the most recent insertion
+   , offset_  ( 0UL )                                     // The position of the most recent insertion
 {
    using blaze::assign;
 
@@ -617,21 +723,24 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the foreign sparse matrix
         , bool SO2 >     // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+inline CompressedMatrix<Type,SO,AT>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( (~sm).rows() )                            // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                         // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), m_ )                                // The allocator and capacity of the pointer array
+   , begin_   ( allocate<Iterator>( AT(), 2UL*m_+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                         // Pointers one past the last non-zero element of each row
+   , cursor_  ( 0UL )                                     // The row of the most recent insertion
+   , offset_  ( 0UL )                                     // The position of the most recent insertion
 {
    using blaze::assign;
 
    const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( alloc_, nonzeros );
    for( size_t i=0UL; i<m_; ++i )
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
@@ -641,6 +750,50 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$ from coordinate triplets.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param rows The array of row indices of the triplets.
+// \param columns The array of column indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The number of triplets.
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This constructor initializes the matrix with the given unsorted coordinate triplets, where
+// the values of duplicate triplets are summed up (see the assemble() function). In case any
+// row or column index is out of bounds, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+template< typename IT    // Type of the triplet indices
+        , typename Other > // Type of the triplet values
+CompressedMatrix<Type,SO,AT>::CompressedMatrix( size_t m, size_t n, const IT* rows, const IT* columns,
+                                                const Other* values, size_t nonzeros )
+   : m_       ( m )                                   // The current number of rows of the sparse matrix
+   , n_       ( n )                                   // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), m )                             // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( AT(), 2UL*m+2UL ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                         // Pointers one past the last non-zero element of each row
+   , cursor_( 0UL )                                   // The row of the most recent insertion
+   , offset_( 0UL )                                   // The position of the most recent insertion
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = NULL;
+
+   try {
+      assemble( rows, columns, values, nonzeros );
+   }
+   catch( ... ) {
+      deallocate( alloc_, begin_, 2UL*alloc_.capacity_+2UL );
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -653,11 +806,12 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 /*!\brief The destructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>::~CompressedMatrix()
 {
-   deallocate( begin_[0UL] );
-   delete [] begin_;
+   deallocate( alloc_, begin_[0UL], capacity() );
+   deallocate( alloc_, begin_, 2UL*alloc_.capacity_+2UL );
 }
 //*************************************************************************************************
 
@@ -678,9 +832,10 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Reference
+   CompressedMatrix<Type,SO,AT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -698,9 +853,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstReference
+   CompressedMatrix<Type,SO,AT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -727,9 +883,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::begin( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -749,9 +906,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::begin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -771,9 +929,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::cbegin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -793,9 +952,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::end( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -815,9 +975,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::end( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -837,9 +998,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::cend( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -865,30 +1027,33 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>&
+   CompressedMatrix<Type,SO,AT>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
    const size_t nonzeros( rhs.nonZeros() );
 
-   if( rhs.m_ > capacity_ || nonzeros > capacity() )
+   if( rhs.m_ > alloc_.capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.m_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*rhs.m_+2UL ) );
       Iterator* newEnd  ( newBegin+(rhs.m_+1UL) );
 
-      newBegin[0UL] = allocate<Element>( nonzeros );
+      newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
       for( size_t i=0UL; i<rhs.m_; ++i ) {
          newBegin[i+1UL] = newEnd[i] = std::copy( rhs.begin_[i], rhs.end_[i], newBegin[i] );
       }
       newEnd[rhs.m_] = newBegin[0UL]+nonzeros;
 
+      const size_t oldCapacity( capacity() );
+
       std::swap( begin_, newBegin );
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
-      delete [] newBegin;
-      capacity_ = rhs.m_;
+      deallocate( alloc_, newBegin[0UL], oldCapacity );
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+      alloc_.capacity_ = rhs.m_;
    }
    else {
      for( size_t i=0UL; i<rhs.m_; ++i ) {
@@ -914,16 +1079,18 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,AT>&
+   CompressedMatrix<Type,SO,AT>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( alloc_ );
+      tmp = ~rhs;
       swap( tmp );
    }
    else {
@@ -946,18 +1113,20 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,AT>&
+   CompressedMatrix<Type,SO,AT>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ||
-       (~rhs).rows()     > capacity_ ||
+       (~rhs).rows()     > alloc_.capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( (~rhs).rows(), (~rhs).columns(), (~rhs).nonZeros(), alloc_ );
+      assign( tmp, ~rhs );
       swap( tmp );
    }
    else {
@@ -982,11 +1151,12 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,AT>&
+   CompressedMatrix<Type,SO,AT>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::addAssign;
 
@@ -1010,10 +1180,11 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,AT>& CompressedMatrix<Type,SO,AT>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::subAssign;
 
@@ -1037,16 +1208,18 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,AT>&
+   CompressedMatrix<Type,SO,AT>::operator*=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   CompressedMatrix tmp( *this * (~rhs) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = *this * (~rhs);
    swap( tmp );
 
    return *this;
@@ -1062,10 +1235,11 @@ inline CompressedMatrix<Type,SO>&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,AT> >::Type&
+   CompressedMatrix<Type,SO,AT>::operator*=( Other rhs )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       const Iterator last( end(i) );
@@ -1085,10 +1259,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,AT> >::Type&
+   CompressedMatrix<Type,SO,AT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -1132,8 +1307,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return The number of rows of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::rows() const
 {
    return m_;
 }
@@ -1146,8 +1322,9 @@ inline size_t CompressedMatrix<Type,SO>::rows() const
 // \return The number of columns of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::columns() const
 {
    return n_;
 }
@@ -1160,14 +1337,30 @@ inline size_t CompressedMatrix<Type,SO>::columns() const
 // \return The capacity of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::capacity() const
 {
    return end_[m_] - begin_[0UL];
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns a copy of the allocator of the sparse matrix elements.
+//
+// \return The allocator of the sparse matrix elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline AT CompressedMatrix<Type,SO,AT>::getAllocator() const
+{
+   return alloc_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the current capacity of the specified row/column.
 //
@@ -1180,8 +1373,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const
 // of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::capacity( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1195,8 +1389,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
 // \return The number of non-zero elements in the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1220,8 +1415,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // the number of non-zero elements in column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1235,8 +1431,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1256,8 +1453,9 @@ inline void CompressedMatrix<Type,SO>::reset()
 // Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1265,6 +1463,31 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Reset the values of all non-zero elements while preserving the sparsity pattern.
+//
+// \return void
+//
+// In contrast to the reset() function, which removes all non-zero elements, this function
+// resets the values of all stored elements to their default value but keeps the elements
+// themselves (i.e. the number of non-zero elements and the capacity remain unchanged). This
+// enables the repeated assembly of a matrix with a fixed sparsity pattern without any element
+// insertion, for instance via the AssemblyMap class.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::resetValues()
+{
+   using blaze::clear;
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( Iterator element=begin_[i]; element!=end_[i]; ++element )
+         clear( element->value_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Clearing the sparse matrix.
 //
@@ -1273,8 +1496,9 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 // After the clear() function, the size of the sparse matrix is 0.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::clear()
 {
    end_[0UL] = end_[m_];
    m_ = 0UL;
@@ -1294,16 +1518,24 @@ inline void CompressedMatrix<Type,SO>::clear()
 // This function sets the value of an element of the compressed matrix. In case the compressed
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
+//
+// The position of the most recent insertion is cached, which makes inserting elements in
+// ascending order of the column indices within a row a constant time operation. The cached
+// position is used by set(), insert(), and find() and therefore also by the function call
+// operator (for instance \c A(i,j)=v). It is only modified in case an element is actually
+// inserted. Therefore set() can be called concurrently for disjoint rows as long as it
+// only modifies existing elements.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
-   const Iterator pos( lowerBound( i, j ) );
+   const Iterator pos( insertPosition( i, j ) );
 
    if( pos != end_[i] && pos->index_ == j ) {
        pos->value() = value;
@@ -1326,16 +1558,31 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // This function inserts a new element into the compressed matrix. However, duplicate elements
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
+//
+// In case the row/column is running out of capacity, it borrows free capacity from a nearby
+// row/column or from the end of the matrix. If this is not possible at a reasonable cost, the
+// matrix is reallocated and half of the free capacity is distributed among all rows/columns in
+// proportion to their number of non-zero elements. Therefore inserting elements in random
+// order does not require to move all subsequent elements of the matrix. The remaining free
+// capacity can be removed via the compact() function.
+//
+// The position of the most recent insertion is cached, which makes inserting elements in
+// ascending order of the column indices within a row a constant time operation. The cached
+// position is used by set(), insert(), and find() and therefore also by the function call
+// operator (for instance \c A(i,j)=v). It is only modified in case an element is actually
+// inserted. Therefore set() can be called concurrently for disjoint rows as long as it
+// only modifies existing elements.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
-   const Iterator pos( lowerBound( i, j ) );
+   const Iterator pos( insertPosition( i, j ) );
 
    if( pos != end_[i] && pos->index_ == j )
       throw std::invalid_argument( "Bad access index" );
@@ -1345,6 +1592,49 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Calculating the insertion position of an element of the compressed matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns the same position as the lowerBound() function. However, in case the
+// requested element is located at or directly behind the position of the most recent insertion
+// (the cursor), the position is found without a binary search. This makes set(), insert(), and
+// the function call operator in ascending order of the column indices a constant time operation.
+// The cursor is only read by this function and only modified by an actual insertion.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::insertPosition( size_t i, size_t j ) const
+{
+   if( cursor_ == i )
+   {
+      const size_t offset( offset_ );
+
+      if( offset <= size_t( end_[i] - begin_[i] ) )
+      {
+         Iterator pos( begin_[i] + offset );
+
+         if( pos == begin_[i] || (pos-1)->index_ < j )
+         {
+            if( pos != end_[i] && pos->index_ < j )
+               ++pos;
+
+            if( pos == end_[i] || pos->index_ >= j )
+               return pos;
+         }
+      }
+   }
+
+   return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Inserting an element into the compressed matrix.
 //
@@ -1356,65 +1646,67 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
-   if( begin_[i+1UL] - end_[i] != 0 ) {
+   if( begin_[i+1UL] != end_[i] || borrowCapacity( i, pos ) ) {
       std::copy_backward( pos, end_[i], end_[i]+1 );
       pos->value_ = value;
       pos->index_ = j;
       ++end_[i];
 
-      return pos;
-   }
-   else if( end_[m_] - begin_[m_] != 0 ) {
-      std::copy_backward( pos, end_[m_-1UL], end_[m_-1UL]+1 );
-
-      pos->value_ = value;
-      pos->index_ = j;
-
-      for( size_t k=i+1UL; k<m_+1UL; ++k ) {
-         ++begin_[k];
-         ++end_[k-1UL];
-      }
+      cursor_ = i;
+      offset_ = pos - begin_[i];
 
       return pos;
    }
    else {
-      size_t newCapacity( extendCapacity() );
+      // Reallocating with the current capacity in case at most three quarters of it are in use
+      // (i.e. in case no suitable free capacity could be borrowed) and extending it otherwise
+      const size_t elements( nonZeros() + 1UL );
+      const size_t newCapacity( ( 4UL*elements <= 3UL*capacity() )?( capacity() ):( extendCapacity() ) );
+      const size_t slack( newCapacity - elements );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
-      Iterator* newEnd   = newBegin+capacity_+1UL;
+      Iterator* newBegin = allocate<Iterator>( alloc_, 2UL*alloc_.capacity_+2UL );
+      Iterator* newEnd   = newBegin+alloc_.capacity_+1UL;
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( alloc_, newCapacity );
 
-      for( size_t k=0UL; k<i; ++k ) {
-         const size_t nonzeros( end_[k] - begin_[k] );
-         const size_t total( begin_[k+1UL] - begin_[k] );
-         newEnd  [k]     = newBegin[k] + nonzeros;
-         newBegin[k+1UL] = newBegin[k] + total;
-      }
-      newEnd  [i]     = newBegin[i] + ( end_[i] - begin_[i] ) + 1;
-      newBegin[i+1UL] = newBegin[i] + ( begin_[i+1] - begin_[i] ) + 1;
-      for( size_t k=i+1UL; k<m_; ++k ) {
-         const size_t nonzeros( end_[k] - begin_[k] );
-         const size_t total( begin_[k+1UL] - begin_[k] );
+      // Distributing half of the additional capacity among all rows in proportion to their
+      // number of non-zero elements and keeping the other half at the end of the matrix
+      size_t share( slack / 2UL );
+
+      for( size_t k=0UL; k<m_; ++k ) {
+         const size_t nonzeros( end_[k] - begin_[k] + ( k == i ? 1UL : 0UL ) );
+         const size_t additional( blaze::min( ( nonzeros+1UL ) / 2UL, share ) );
+         share -= additional;
          newEnd  [k]     = newBegin[k] + nonzeros;
-         newBegin[k+1UL] = newBegin[k] + total;
+         newBegin[k+1UL] = newEnd[k] + additional;
       }
 
-      newEnd[m_] = newEnd[capacity_] = newBegin[0UL]+newCapacity;
+      newEnd[m_] = newEnd[alloc_.capacity_] = newBegin[0UL]+newCapacity;
 
-      Iterator tmp = std::copy( begin_[0UL], pos, newBegin[0UL] );
+      for( size_t k=0UL; k<m_; ++k ) {
+         if( k != i )
+            std::copy( begin_[k], end_[k], newBegin[k] );
+      }
+
+      Iterator tmp = std::copy( begin_[i], pos, newBegin[i] );
       tmp->value_ = value;
       tmp->index_ = j;
-      std::copy( pos, end_[m_-1UL], tmp+1UL );
+      std::copy( pos, end_[i], tmp+1UL );
+
+      const size_t oldCapacity( capacity() );
 
       std::swap( newBegin, begin_ );
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( alloc_, newBegin[0UL], oldCapacity );
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+
+      cursor_ = i;
+      offset_ = tmp - begin_[i];
 
       return tmp;
    }
@@ -1422,6 +1714,87 @@ typename CompressedMatrix<Type,SO>::Iterator
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Moving free capacity from the closest row with free capacity to the given row.
+//
+// \param i The index of the row running out of capacity \f$[0..M-1]\f$.
+// \param pos The insertion position within row \a i, which is adapted in case row \a i is moved.
+// \return \a true in case capacity could be borrowed, \a false otherwise.
+//
+// This function searches the rows before and after row \a i for the closest row with free
+// capacity and moves the rows in between such that half of the free capacity of this row is
+// assigned to row \a i. The free capacity at the end of the matrix is assigned geometrically,
+// i.e. the capacity of row \a i is doubled (if possible). Thus only the elements between row
+// \a i and the chosen row are moved, which form a single contiguous block that is moved at
+// once. A row is skipped in case it requires to move more elements per borrowed element than
+// the free capacity at the end of the matrix (but at least four), which is always used. In case
+// no suitable row is found, the function returns \a false and the matrix is reallocated.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+bool CompressedMatrix<Type,SO,AT>::borrowCapacity( size_t i, Iterator& pos )
+{
+   const size_t spare( end_[m_] - begin_[m_] );
+   const size_t gain ( blaze::min( spare, blaze::max( capacity(i), 1UL ) ) );
+   const size_t tail ( ( i+1UL < m_ )?( end_[m_-1UL] - begin_[i+1UL] ):( 0UL ) );
+   const size_t ratio( ( gain != 0UL )?( blaze::max( tail / gain, 4UL ) ):( 4UL ) );
+
+   for( size_t d=1UL; d<=i || i+d<=m_; ++d )
+   {
+      if( i+d <= m_ )
+      {
+         const size_t k( i+d );
+         const size_t slack( ( k < m_ )?( begin_[k+1UL] - end_[k] ):( end_[m_] - begin_[m_] ) );
+
+         if( slack != 0UL )
+         {
+            const size_t additional( ( k < m_ )?( ( slack+1UL ) / 2UL ):( gain ) );
+            const size_t last( blaze::min( k, m_-1UL ) );
+            const size_t moved( ( last > i )?( end_[last] - begin_[i+1UL] ):( 0UL ) );
+
+            if( k == m_ || moved <= ratio*additional )
+            {
+               if( k == m_ )
+                  begin_[m_] += additional;
+
+               if( last > i ) {
+                  std::copy_backward( begin_[i+1UL], end_[last], end_[last]+additional );
+                  for( size_t l=i+1UL; l<=last; ++l ) {
+                     begin_[l] += additional;
+                     end_  [l] += additional;
+                  }
+               }
+
+               return true;
+            }
+         }
+      }
+
+      if( d <= i && begin_[i-d+1UL] != end_[i-d] )
+      {
+         const size_t additional( ( begin_[i-d+1UL] - end_[i-d] + 1UL ) / 2UL );
+         const size_t moved( end_[i] - begin_[i-d+1UL] );
+
+         if( moved <= ratio*additional )
+         {
+            std::copy( begin_[i-d+1UL], end_[i], begin_[i-d+1UL]-additional );
+            for( size_t l=i-d+1UL; l<=i; ++l ) {
+               begin_[l] -= additional;
+               end_  [l] -= additional;
+            }
+            pos -= additional;
+
+            return true;
+         }
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Erasing an element from the sparse matrix.
 //
@@ -1432,8 +1805,9 @@ typename CompressedMatrix<Type,SO>::Iterator
 // This function erases an element from the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1457,9 +1831,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // \a columnMajor the function erases an element from column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -1485,9 +1860,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -1518,17 +1894,18 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+void CompressedMatrix<Type,SO,AT>::resize( size_t m, size_t n, bool preserve )
 {
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 
    if( m == m_ && n == n_ ) return;
 
-   if( m > capacity_ )
+   if( m > alloc_.capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*m+2UL] );
+      Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*m+2UL ) );
       Iterator* newEnd  ( newBegin+m+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -1551,10 +1928,10 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       newEnd[m] = end_[m_];
 
       std::swap( newBegin, begin_ );
-      delete [] newBegin;
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
 
       end_ = newEnd;
-      capacity_ = m;
+      alloc_.capacity_ = m;
    }
    else if( m > m_ )
    {
@@ -1586,7 +1963,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    n_ = n;
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 }
 //*************************************************************************************************
 
@@ -1602,8 +1979,9 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // are preserved.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1626,13 +2004,14 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+void CompressedMatrix<Type,SO,AT>::reserve( size_t i, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 
    const size_t current( capacity(i) );
 
@@ -1645,10 +2024,10 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
       const size_t newCapacity( begin_[m_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*m_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*m_+2UL ) );
       Iterator* newEnd  ( newBegin+m_+1UL );
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( alloc_, newCapacity );
       newEnd  [m_ ] = newBegin[0UL]+newCapacity;
 
       for( size_t k=0UL; k<i; ++k ) {
@@ -1664,11 +2043,13 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 
       BLAZE_INTERNAL_ASSERT( newBegin[m_] == newEnd[m_], "Invalid pointer calculations" );
 
+      const size_t oldCapacity( capacity() );
+
       std::swap( newBegin, begin_ );
-      deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( alloc_, newBegin[0UL], oldCapacity );
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
       end_ = newEnd;
-      capacity_ = m_;
+      alloc_.capacity_ = m_;
    }
    else
    {
@@ -1680,7 +2061,7 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
    }
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 }
 //*************************************************************************************************
 
@@ -1696,8 +2077,9 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // remove the overall capacity but only reduces the capacity per row/column.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1717,8 +2099,9 @@ inline void CompressedMatrix<Type,SO>::trim()
 // subsequent row/column.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1729,16 +2112,56 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from the sparse matrix.
+//
+// \return void
+//
+// In contrast to the trim() function, which only removes the excessive capacity of the
+// individual rows/columns, the compact() function additionally releases all excessive memory
+// of the sparse matrix. After the call, the capacity of the matrix is equal to its number of
+// non-zero elements. The function can be used to squeeze out the free capacity left behind by
+// inserting elements via the insert() function or the function call operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+void CompressedMatrix<Type,SO,AT>::compact()
+{
+   const size_t nonzeros( nonZeros() );
+
+   Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*m_+2UL ) );
+   Iterator* newEnd  ( newBegin+m_+1UL );
+
+   newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
+
+   for( size_t i=0UL; i<m_; ++i )
+      newBegin[i+1UL] = newEnd[i] = std::copy( begin_[i], end_[i], newBegin[i] );
+   newEnd[m_] = newBegin[0UL]+nonzeros;
+
+   const size_t oldCapacity( capacity() );
+
+   std::swap( newBegin, begin_ );
+   deallocate( alloc_, newBegin[0UL], oldCapacity );
+   deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+   end_ = newEnd;
+   alloc_.capacity_ = m_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Transposing the matrix.
 //
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline CompressedMatrix<Type,SO,AT>& CompressedMatrix<Type,SO,AT>::transpose()
 {
-   CompressedMatrix tmp( trans( *this ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = trans( *this );
    swap( tmp );
    return *this;
 }
@@ -1752,9 +2175,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,AT>& CompressedMatrix<Type,SO,AT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( Iterator element=begin_[i]; element!=end_[i]; ++element )
@@ -1772,9 +2196,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,SO,AT>& CompressedMatrix<Type,SO,AT>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -1797,14 +2222,17 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Othe
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() */
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
-   std::swap( capacity_, sm.capacity_ );
+   std::swap( alloc_, sm.alloc_ );
    std::swap( begin_, sm.begin_ );
    std::swap( end_  , sm.end_   );
+   std::swap( cursor_, sm.cursor_ );
+   std::swap( offset_, sm.offset_ );
 }
 //*************************************************************************************************
 
@@ -1818,8 +2246,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() *
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline size_t CompressedMatrix<Type,SO,AT>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1838,13 +2267,14 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+void CompressedMatrix<Type,SO,AT>::reserveElements( size_t nonzeros )
 {
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
-   Iterator* newEnd   = newBegin+capacity_+1UL;
+   Iterator* newBegin = allocate<Iterator>( alloc_, 2UL*alloc_.capacity_+2UL );
+   Iterator* newEnd   = newBegin+alloc_.capacity_+1UL;
 
-   newBegin[0UL] = allocate<Element>( nonzeros );
+   newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
 
    for( size_t k=0UL; k<m_; ++k ) {
       BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row pointers" );
@@ -1854,9 +2284,11 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 
    newEnd[m_] = newBegin[0UL]+nonzeros;
 
+   const size_t oldCapacity( capacity() );
+
    std::swap( newBegin, begin_ );
-   deallocate( newBegin[0UL] );
-   delete [] newBegin;
+   deallocate( alloc_, newBegin[0UL], oldCapacity );
+   deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
    end_ = newEnd;
 }
 //*************************************************************************************************
@@ -1881,16 +2313,22 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // matrix. It specifically searches for the element with row index \a i and column index \a j.
 // In case the element is found, the function returns an row/column iterator to the element.
 // Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
-// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
-// invalidation due to inserting operations via the function call operator or the insert()
-// function!
+// end() iterator) is returned. In case the element is located at or directly behind the most
+// recently inserted element, it is found without a binary search. Note that the returned sparse
+// matrix iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::find( size_t i, size_t j )
 {
-   return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   const Iterator pos( insertPosition( i, j ) );
+   if( pos != end_[i] && pos->index_ == j )
+      return pos;
+   else return end_[i];
 }
 //*************************************************************************************************
 
@@ -1906,16 +2344,19 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // matrix. It specifically searches for the element with row index \a i and column index \a j.
 // In case the element is found, the function returns an row/column iterator to the element.
 // Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
-// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
-// invalidation due to inserting operations via the function call operator or the insert()
-// function!
+// end() iterator) is returned. In case the element is located at or directly behind the most
+// recently inserted element, it is found without a binary search. Note that the returned sparse
+// matrix iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::find( size_t i, size_t j ) const
 {
-   const ConstIterator pos( lowerBound( i, j ) );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   const ConstIterator pos( insertPosition( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
       return pos;
    else return end_[i];
@@ -1939,11 +2380,13 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::lowerBound( size_t i, size_t j )
 {
-   return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
 }
 //*************************************************************************************************
 
@@ -1964,9 +2407,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
@@ -1990,9 +2434,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::Iterator
+   CompressedMatrix<Type,SO,AT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2015,9 +2460,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline typename CompressedMatrix<Type,SO,AT>::ConstIterator
+   CompressedMatrix<Type,SO,AT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j, FindIndex() );
@@ -2078,8 +2524,9 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2110,8 +2557,9 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void CompressedMatrix<Type,SO,AT>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2122,6 +2570,100 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Assembly of the sparse matrix from unsorted coordinate triplets.
+//
+// \param rows The array of row indices of the triplets.
+// \param columns The array of column indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The number of triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the sparse matrix by the given unsorted
+// coordinate triplets \f$ (rows[k],columns[k],values[k]) \f$. The values of duplicate
+// triplets are summed up. For details and for the use of a different combination of
+// duplicates see the assemble() function with an explicit combiner.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+template< typename IT    // Type of the triplet indices
+        , typename Other > // Type of the triplet values
+inline void CompressedMatrix<Type,SO,AT>::assemble( const IT* rows, const IT* columns,
+                                                    const Other* values, size_t nonzeros )
+{
+   assemble( rows, columns, values, nonzeros, std::plus<Type>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembly of the sparse matrix from unsorted coordinate triplets.
+//
+// \param rows The array of row indices of the triplets.
+// \param columns The array of column indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The number of triplets.
+// \param combine The binary combiner for the values of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the sparse matrix by the given unsorted
+// coordinate triplets \f$ (rows[k],columns[k],values[k]) \f$, for instance as produced by
+// a file parser or a finite element assembly. In contrast to the insertion of the elements via
+// the function call operator or the insert() function, the triplets are sorted by a two-level
+// radix sort and written into a single allocation of the final storage. In case the shared
+// memory parallelization is active and the number of triplets exceeds the
+// \a SMP_SMATASSEMBLE_THRESHOLD, both the sort and the fill are executed in parallel.
+//
+// The values of duplicate triplets are merged via the given binary combiner in the order of
+// their appearance in the input (e.g. \a std::plus<Type>() sums up duplicates, a combiner
+// returning its second argument keeps the last duplicate). Elements that are default values
+// after the merge are not stored.
+
+   \code
+   const size_t rows   [] = { 2, 0, 2, 1 };
+   const size_t columns[] = { 1, 0, 1, 2 };
+   const double values [] = { 1.0, 2.0, 3.0, 4.0 };
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 3, 3 );
+   A.assemble( rows, columns, values, 4UL );  // Results in A(0,0)=2, A(1,2)=4, A(2,1)=4
+   \endcode
+
+// In case any row or column index is out of bounds, a \a std::invalid_argument exception is
+// thrown and the matrix remains unchanged. Note that in case of merged or dropped duplicates
+// the matrix has some unused capacity, which can be released via the trim() function.
+*/
+template< typename Type       // Data type of the sparse matrix
+        , bool SO             // Storage order
+        , typename AT >       // Type of the allocator
+template< typename IT         // Type of the triplet indices
+        , typename Other      // Type of the triplet values
+        , typename Combiner > // Type of the combiner for duplicate triplets
+void CompressedMatrix<Type,SO,AT>::assemble( const IT* rows, const IT* columns, const Other* values,
+                                             size_t nonzeros, Combiner combine )
+{
+   const TripletAssembler<Type> assembler( m_, n_, rows, columns, values, nonzeros );
+
+   Iterator* newBegin = allocate<Iterator>( alloc_, 2UL*alloc_.capacity_+2UL );
+   Iterator* newEnd   = newBegin+alloc_.capacity_+1UL;
+
+   newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
+   newBegin[m_]  = newEnd[m_] = newBegin[0UL]+nonzeros;
+
+   assembler.fill( newBegin[0UL], newBegin, newEnd, combine );
+
+   const size_t oldCapacity( capacity() );
+
+   std::swap( newBegin, begin_ );
+   deallocate( alloc_, newBegin[0UL], oldCapacity );
+   deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+   end_ = newEnd;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2141,9 +2683,10 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,AT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2161,9 +2704,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,AT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2181,8 +2725,9 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
 // rows and/or columns of the matrix).
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline bool CompressedMatrix<Type,SO,AT>::canSMPAssign() const
 {
    return false;
 }
@@ -2201,10 +2746,11 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2260,9 +2806,10 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2291,9 +2838,10 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2302,25 +2850,13 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   typedef typename MT::ConstIterator  RhsIterator;
-
    // Counting the number of elements per row
-   std::vector<size_t> rowLengths( m_, 0UL );
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         ++rowLengths[element->index()];
-   }
+   StorageOrderConverter<MT,!SO> converter( ~rhs );
 
-   // Resizing the sparse matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
-   }
+   BLAZE_INTERNAL_ASSERT( capacity() >= converter.size(), "Invalid capacity detected" );
 
-   // Appending the elements to the rows of the sparse matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         append( element->index(), j, element->value() );
-   }
+   // Scattering the elements into the rows of the sparse matrix
+   converter.fill( begin_[0UL], begin_, end_ );
 }
 //*************************************************************************************************
 
@@ -2337,15 +2873,17 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this + (~rhs) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2363,15 +2901,17 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this + (~rhs) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2389,15 +2929,17 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this - (~rhs) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2415,15 +2957,17 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand sparse matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,AT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this - (~rhs) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -2449,8 +2993,9 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the sparse matrix
-class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+class CompressedMatrix<Type,true,AT> : public SparseMatrix< CompressedMatrix<Type,true,AT>, true >
 {
  private:
    //**Type definitions****************************************************************************
@@ -2498,17 +3043,18 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,true>   This;            //!< Type of this CompressedMatrix instance.
-   typedef This                          ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                          ElementType;     //!< Type of the sparse matrix elements.
-   typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
-   typedef MatrixAccessProxy<This>       Reference;       //!< Reference to a non-constant matrix value.
-   typedef const Type&                   ConstReference;  //!< Reference to a constant matrix value.
-   typedef Element*                      Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*                ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedMatrix<Type,true,AT>   This;            //!< Type of this CompressedMatrix instance.
+   typedef This                             ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,false,AT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,false,AT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>          Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant matrix value.
+   typedef Element*                         Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                   ConstIterator;   //!< Iterator over constant elements.
+   typedef AT                               AllocatorType;   //!< Type of the allocator of the sparse matrix elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -2516,7 +3062,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,true>  Other;  //!< The type of the other CompressedMatrix.
+      typedef typename AT::BLAZE_TEMPLATE rebind<ET>::other  OtherAllocator;  //!< Allocator type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,true,OtherAllocator>       Other;           //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -2532,12 +3079,18 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    /*!\name Constructors */
    //@{
                            explicit inline CompressedMatrix();
-                           explicit inline CompressedMatrix( size_t m, size_t n );
-                           explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros );
-                           explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                           explicit inline CompressedMatrix( const AT& alloc );
+                           explicit inline CompressedMatrix( size_t m, size_t n, const AT& alloc = AT() );
+                           explicit inline CompressedMatrix( size_t m, size_t n, size_t nonzeros, const AT& alloc = AT() );
+                           explicit        CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros,
+                                                             const AT& alloc = AT() );
                                     inline CompressedMatrix( const CompressedMatrix& sm );
    template< typename MT, bool SO > inline CompressedMatrix( const DenseMatrix<MT,SO>&  dm );
    template< typename MT, bool SO > inline CompressedMatrix( const SparseMatrix<MT,SO>& sm );
+
+   template< typename IT, typename Other >
+   explicit CompressedMatrix( size_t m, size_t n, const IT* rows, const IT* columns,
+                              const Other* values, size_t nonzeros );
    //@}
    //**********************************************************************************************
 
@@ -2588,11 +3141,13 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
                               inline size_t            rows() const;
                               inline size_t            columns() const;
                               inline size_t            capacity() const;
+                              inline AT                getAllocator() const;
                               inline size_t            capacity( size_t j ) const;
                               inline size_t            nonZeros() const;
                               inline size_t            nonZeros( size_t j ) const;
                               inline void              reset();
                               inline void              reset( size_t j );
+                              inline void              resetValues();
                               inline void              clear();
                               inline Iterator          set    ( size_t i, size_t j, const Type& value );
                               inline Iterator          insert ( size_t i, size_t j, const Type& value );
@@ -2604,6 +3159,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
                                      void              reserve( size_t j, size_t nonzeros );
                               inline void              trim   ();
                               inline void              trim   ( size_t j );
+                                     void              compact();
                               inline CompressedMatrix& transpose();
    template< typename Other > inline CompressedMatrix& scale( const Other& scalar );
    template< typename Other > inline CompressedMatrix& scaleDiagonal( Other scalar );
@@ -2628,6 +3184,13 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    //@{
    inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
    inline void finalize( size_t j );
+
+   template< typename IT, typename Other >
+   inline void assemble( const IT* rows, const IT* columns, const Other* values, size_t nonzeros );
+
+   template< typename IT, typename Other, typename Combiner >
+   void assemble( const IT* rows, const IT* columns, const Other* values,
+                  size_t nonzeros, Combiner combine );
    //@}
    //**********************************************************************************************
 
@@ -2653,20 +3216,50 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+   inline Iterator insertPosition( size_t i, size_t j ) const;
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
+          bool     borrowCapacity( size_t i, Iterator& pos );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
    //@}
    //**********************************************************************************************
 
+   //**struct Memory******************************************************************************
+   /*!\brief The allocator of the sparse matrix elements and the current capacity of the pointer array.
+   //
+   // The allocator is stored as base class in order to exploit the empty base optimization,
+   // i.e. a stateless allocator does not increase the size of the sparse matrix.
+   */
+   struct Memory : public AT
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the allocator and the capacity.
+      //
+      // \param alloc The allocator of the sparse matrix elements.
+      // \param capacity The current capacity of the pointer array.
+      */
+      explicit inline Memory( const AT& alloc, size_t capacity )
+         : AT       ( alloc    )  // The allocator of the sparse matrix elements
+         , capacity_( capacity )  // The current capacity of the pointer array
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t capacity_;  //!< The current capacity of the pointer array.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    size_t m_;         //!< The current number of rows of the sparse matrix.
    size_t n_;         //!< The current number of columns of the sparse matrix.
-   size_t capacity_;  //!< The current capacity of the pointer array.
+   Memory alloc_;     //!< The allocator and the capacity of the pointer array.
    Iterator* begin_;  //!< Pointers to the first non-zero element of each column.
    Iterator* end_;    //!< Pointers one past the last non-zero element of each column.
+   size_t cursor_;    //!< The column of the most recent insertion.
+   size_t offset_;    //!< The position of the most recent insertion within its column.
 
    static const Type zero_;  //!< Neutral element for accesses to zero elements.
    //@}
@@ -2694,8 +3287,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_ = Type();
+template< typename Type, typename AT >
+const Type CompressedMatrix<Type,true,AT>::zero_ = Type();
 
 
 
@@ -2710,13 +3303,39 @@ const Type CompressedMatrix<Type,true>::zero_ = Type();
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
-   : m_       ( 0UL )             // The current number of rows of the sparse matrix
-   , n_       ( 0UL )             // The current number of columns of the sparse matrix
-   , capacity_( 0UL )             // The current capacity of the pointer array
-   , begin_( new Iterator[2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+1UL )         // Pointers one past the last non-zero element of each column
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix()
+   : m_       ( 0UL )                           // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                           // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), 0UL )                     // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( AT(), 2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+1UL )                       // Pointers one past the last non-zero element of each column
+   , cursor_( 0UL )                             // The column of the most recent insertion
+   , offset_( 0UL )                             // The position of the most recent insertion
+{
+   begin_[0UL] = end_[0UL] = NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an empty matrix using the given allocator.
+//
+// \param alloc The allocator for the sparse matrix elements.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix( const AT& alloc )
+   : m_       ( 0UL )                            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                            // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, 0UL )                     // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+1UL )                        // Pointers one past the last non-zero element of each column
+   , cursor_( 0UL )                              // The column of the most recent insertion
+   , offset_( 0UL )                              // The position of the most recent insertion
 {
    begin_[0UL] = end_[0UL] = NULL;
 }
@@ -2730,16 +3349,20 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \param alloc The allocator for the sparse matrix elements.
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix( size_t m, size_t n, const AT& alloc )
+   : m_       ( m )                                    // The current number of rows of the sparse matrix
+   , n_       ( n )                                    // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, n )                             // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL*n+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                          // Pointers one past the last non-zero element of each column
+   , cursor_( 0UL )                                    // The column of the most recent insertion
+   , offset_( 0UL )                                    // The position of the most recent insertion
 {
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = NULL;
@@ -2755,18 +3378,22 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The number of expected non-zero elements.
+// \param alloc The allocator for the sparse matrix elements.
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
-{
-   begin_[0UL] = allocate<Element>( nonzeros );
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros, const AT& alloc )
+   : m_       ( m )                                    // The current number of rows of the sparse matrix
+   , n_       ( n )                                    // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, n )                             // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL*n+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                          // Pointers one past the last non-zero element of each column
+   , cursor_( 0UL )                                    // The column of the most recent insertion
+   , offset_( 0UL )                                    // The position of the most recent insertion
+{
+   begin_[0UL] = allocate<Element>( alloc_, nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
       begin_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
@@ -2782,17 +3409,22 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The expected number of non-zero elements in each column.
+// \param alloc The allocator for the sparse matrix elements.
 //
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the sparse matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
-   , capacity_( n )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+CompressedMatrix<Type,true,AT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros,
+                                                  const AT& alloc )
+   : m_       ( m )                                     // The current number of rows of the sparse matrix
+   , n_       ( n )                                     // The current number of columns of the sparse matrix
+   , alloc_   ( alloc, n )                              // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( alloc, 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n_+1UL) )                          // Pointers one past the last non-zero element of each column
+   , cursor_( 0UL )                                     // The column of the most recent insertion
+   , offset_( 0UL )                                     // The position of the most recent insertion
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
@@ -2800,7 +3432,7 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
    for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
       newCapacity += *it;
 
-   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity );
+   begin_[0UL] = end_[0UL] = allocate<Element>( alloc_, newCapacity );
    for( size_t j=0UL; j<n_; ++j ) {
       begin_[j+1UL] = end_[j+1UL] = begin_[j] + nonzeros[j];
    }
@@ -2815,17 +3447,20 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
-   : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
-   , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
-   , capacity_( sm.n_ )                     // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix( const CompressedMatrix& sm )
+   : m_       ( sm.m_ )                                        // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                        // The current number of columns of the sparse matrix
+   , alloc_   ( sm.alloc_, sm.n_ )                             // The allocator and capacity of the pointer array
+   , begin_   ( allocate<Iterator>( sm.alloc_, 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                              // Pointers one past the last non-zero element of each column
+   , cursor_  ( 0UL )                                          // The column of the most recent insertion
+   , offset_  ( 0UL )                                          // The position of the most recent insertion
 {
    const size_t nonzeros( sm.nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( alloc_, nonzeros );
    for( size_t j=0UL; j<n_; ++j )
       begin_[j+1UL] = end_[j] = std::copy( sm.begin(j), sm.end(j), begin_[j] );
    end_[n_] = begin_[0UL]+nonzeros;
@@ -2840,15 +3475,18 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+   : m_       ( (~dm).rows() )                            // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                         // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), n_ )                                // The allocator and capacity of the pointer array
+   , begin_   ( allocate<Iterator>( AT(), 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                         // Pointers one past the last non-zero element of each column
+   , cursor_  ( 0UL )                                     // The column of the most recent insertion
+   , offset_  ( 0UL )                                     // The position of the most recent insertion
 {
    using blaze::assign;
 
@@ -2867,21 +3505,24 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the foreign sparse matrix
         , bool SO >        // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+inline CompressedMatrix<Type,true,AT>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : m_       ( (~sm).rows() )                            // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                         // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), n_ )                                // The allocator and capacity of the pointer array
+   , begin_   ( allocate<Iterator>( AT(), 2UL*n_+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                         // Pointers one past the last non-zero element of each column
+   , cursor_  ( 0UL )                                     // The column of the most recent insertion
+   , offset_  ( 0UL )                                     // The position of the most recent insertion
 {
    using blaze::assign;
 
    const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( alloc_, nonzeros );
    for( size_t j=0UL; j<n_; ++j )
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
@@ -2892,6 +3533,51 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$ from coordinate triplets.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param rows The array of row indices of the triplets.
+// \param columns The array of column indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The number of triplets.
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This constructor initializes the matrix with the given unsorted coordinate triplets, where
+// the values of duplicate triplets are summed up (see the assemble() function). In case any
+// row or column index is out of bounds, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+template< typename IT      // Type of the triplet indices
+        , typename Other > // Type of the triplet values
+CompressedMatrix<Type,true,AT>::CompressedMatrix( size_t m, size_t n, const IT* rows, const IT* columns,
+                                                  const Other* values, size_t nonzeros )
+   : m_       ( m )                                   // The current number of rows of the sparse matrix
+   , n_       ( n )                                   // The current number of columns of the sparse matrix
+   , alloc_   ( AT(), n )                             // The allocator and capacity of the pointer array
+   , begin_( allocate<Iterator>( AT(), 2UL*n+2UL ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                         // Pointers one past the last non-zero element of each column
+   , cursor_( 0UL )                                   // The column of the most recent insertion
+   , offset_( 0UL )                                   // The position of the most recent insertion
+{
+   for( size_t j=0UL; j<2UL*n_+2UL; ++j )
+      begin_[j] = NULL;
+
+   try {
+      assemble( rows, columns, values, nonzeros );
+   }
+   catch( ... ) {
+      deallocate( alloc_, begin_, 2UL*alloc_.capacity_+2UL );
+      throw;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2904,11 +3590,12 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>::~CompressedMatrix()
 {
-   deallocate( begin_[0UL] );
-   delete [] begin_;
+   deallocate( alloc_, begin_[0UL], capacity() );
+   deallocate( alloc_, begin_, 2UL*alloc_.capacity_+2UL );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2930,9 +3617,10 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Reference
+   CompressedMatrix<Type,true,AT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2951,9 +3639,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstReference
+   CompressedMatrix<Type,true,AT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2976,9 +3665,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::begin( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -2994,9 +3684,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::begin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3012,9 +3703,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::cbegin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3030,9 +3722,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::end( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3048,9 +3741,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::end( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3066,9 +3760,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::cend( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3095,30 +3790,33 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // The sparse matrix is resized according to the given sparse matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>&
+   CompressedMatrix<Type,true,AT>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
    const size_t nonzeros( rhs.nonZeros() );
 
-   if( rhs.n_ > capacity_ || nonzeros > capacity() )
+   if( rhs.n_ > alloc_.capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.n_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*rhs.n_+2UL ) );
       Iterator* newEnd  ( newBegin+(rhs.n_+1UL) );
 
-      newBegin[0UL] = allocate<Element>( nonzeros );
+      newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
       for( size_t j=0UL; j<rhs.n_; ++j ) {
          newBegin[j+1UL] = newEnd[j] = std::copy( rhs.begin_[j], rhs.end_[j], newBegin[j] );
       }
       newEnd[rhs.n_] = newBegin[0UL]+nonzeros;
 
+      const size_t oldCapacity( capacity() );
+
       std::swap( begin_, newBegin );
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
-      delete [] newBegin;
-      capacity_ = rhs.n_;
+      deallocate( alloc_, newBegin[0UL], oldCapacity );
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+      alloc_.capacity_ = rhs.n_;
    }
    else {
      for( size_t j=0UL; j<rhs.n_; ++j ) {
@@ -3145,16 +3843,18 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,AT>&
+   CompressedMatrix<Type,true,AT>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( alloc_ );
+      tmp = ~rhs;
       swap( tmp );
    }
    else {
@@ -3178,18 +3878,20 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,AT>&
+   CompressedMatrix<Type,true,AT>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
    if( (~rhs).canAlias( this ) ||
-       (~rhs).columns()  > capacity_ ||
+       (~rhs).columns()  > alloc_.capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
-      CompressedMatrix tmp( ~rhs );
+      CompressedMatrix tmp( (~rhs).rows(), (~rhs).columns(), (~rhs).nonZeros(), alloc_ );
+      assign( tmp, ~rhs );
       swap( tmp );
    }
    else {
@@ -3215,10 +3917,11 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,AT>& CompressedMatrix<Type,true,AT>::operator+=( const Matrix<MT,SO>& rhs )
 {
    using blaze::addAssign;
 
@@ -3243,10 +3946,11 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,AT>& CompressedMatrix<Type,true,AT>::operator-=( const Matrix<MT,SO>& rhs )
 {
    using blaze::subAssign;
 
@@ -3271,16 +3975,18 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator*=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,AT>&
+   CompressedMatrix<Type,true,AT>::operator*=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   CompressedMatrix tmp( *this * (~rhs) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = *this * (~rhs);
    swap( tmp );
 
    return *this;
@@ -3297,10 +4003,11 @@ inline CompressedMatrix<Type,true>&
 // \param rhs The right-hand side scalar value for the multiplication.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,AT> >::Type&
+   CompressedMatrix<Type,true,AT>::operator*=( Other rhs )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       const Iterator last( end(j) );
@@ -3321,10 +4028,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 // \param rhs The right-hand side scalar value for the division.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,AT> >::Type&
+   CompressedMatrix<Type,true,AT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -3369,8 +4077,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 //
 // \return The number of rows of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::rows() const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::rows() const
 {
    return m_;
 }
@@ -3384,8 +4093,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const
 //
 // \return The number of columns of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::columns() const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::columns() const
 {
    return n_;
 }
@@ -3399,8 +4109,9 @@ inline size_t CompressedMatrix<Type,true>::columns() const
 //
 // \return The capacity of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::capacity() const
 {
    return end_[n_] - begin_[0UL];
 }
@@ -3408,6 +4119,22 @@ inline size_t CompressedMatrix<Type,true>::capacity() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a copy of the allocator of the sparse matrix elements.
+//
+// \return The allocator of the sparse matrix elements.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline AT CompressedMatrix<Type,true,AT>::getAllocator() const
+{
+   return alloc_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns the current capacity of the specified column.
@@ -3415,8 +4142,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::capacity( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -3431,8 +4159,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
 //
 // \return The number of non-zero elements in the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -3452,8 +4181,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -3468,8 +4198,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -3488,8 +4219,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -3498,6 +4230,32 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the values of all non-zero elements while preserving the sparsity pattern.
+//
+// \return void
+//
+// In contrast to the reset() function, which removes all non-zero elements, this function
+// resets the values of all stored elements to their default value but keeps the elements
+// themselves (i.e. the number of non-zero elements and the capacity remain unchanged). This
+// enables the repeated assembly of a matrix with a fixed sparsity pattern without any element
+// insertion, for instance via the AssemblyMap class.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::resetValues()
+{
+   using blaze::clear;
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( Iterator element=begin_[j]; element!=end_[j]; ++element )
+         clear( element->value_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Clearing the sparse matrix.
@@ -3506,8 +4264,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the sparse matrix is 0.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::clear()
 {
    end_[0UL] = end_[n_];
    m_ = 0UL;
@@ -3529,15 +4288,23 @@ inline void CompressedMatrix<Type,true>::clear()
 // This function sets the value of an element of the compressed matrix. In case the compressed
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
+//
+// The position of the most recent insertion is cached, which makes inserting elements in
+// ascending order of the row indices within a column a constant time operation. The cached
+// position is used by set(), insert(), and find() and therefore also by the function call
+// operator (for instance \c A(i,j)=v). It is only modified in case an element is actually
+// inserted. Therefore set() can be called concurrently for disjoint columns as long as it
+// only modifies existing elements.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
-   const Iterator pos( lowerBound( i, j ) );
+   const Iterator pos( insertPosition( i, j ) );
 
    if( pos != end_[j] && pos->index_ == i ) {
       pos->value() = value;
@@ -3562,15 +4329,30 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // This function inserts a new element into the compressed matrix. However, duplicate elements
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
-*/
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+//
+// In case the row/column is running out of capacity, it borrows free capacity from a nearby
+// row/column or from the end of the matrix. If this is not possible at a reasonable cost, the
+// matrix is reallocated and half of the free capacity is distributed among all rows/columns in
+// proportion to their number of non-zero elements. Therefore inserting elements in random
+// order does not require to move all subsequent elements of the matrix. The remaining free
+// capacity can be removed via the compact() function.
+//
+// The position of the most recent insertion is cached, which makes inserting elements in
+// ascending order of the row indices within a column a constant time operation. The cached
+// position is used by set(), insert(), and find() and therefore also by the function call
+// operator (for instance \c A(i,j)=v). It is only modified in case an element is actually
+// inserted. Therefore set() can be called concurrently for disjoint columns as long as it
+// only modifies existing elements.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
-   const Iterator pos( lowerBound( i, j ) );
+   const Iterator pos( insertPosition( i, j ) );
 
    if( pos != end_[j] && pos->index_ == i )
       throw std::invalid_argument( "Bad access index" );
@@ -3581,6 +4363,50 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating the insertion position of an element of the compressed matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns the same position as the lowerBound() function. However, in case the
+// requested element is located at or directly behind the position of the most recent insertion
+// (the cursor), the position is found without a binary search. This makes set(), insert(), and
+// the function call operator in ascending order of the row indices a constant time operation.
+// The cursor is only read by this function and only modified by an actual insertion.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::insertPosition( size_t i, size_t j ) const
+{
+   if( cursor_ == j )
+   {
+      const size_t offset( offset_ );
+
+      if( offset <= size_t( end_[j] - begin_[j] ) )
+      {
+         Iterator pos( begin_[j] + offset );
+
+         if( pos == begin_[j] || (pos-1)->index_ < i )
+         {
+            if( pos != end_[j] && pos->index_ < i )
+               ++pos;
+
+            if( pos == end_[j] || pos->index_ >= i )
+               return pos;
+         }
+      }
+   }
+
+   return std::lower_bound( begin_[j], end_[j], i, FindIndex() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Inserting an element into the compressed matrix.
@@ -3592,65 +4418,67 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the sparse matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
-   if( begin_[j+1UL] - end_[j] != 0 ) {
+   if( begin_[j+1UL] != end_[j] || borrowCapacity( j, pos ) ) {
       std::copy_backward( pos, end_[j], end_[j]+1 );
       pos->value_ = value;
       pos->index_ = i;
       ++end_[j];
 
-      return pos;
-   }
-   else if( end_[n_] - begin_[n_] != 0 ) {
-      std::copy_backward( pos, end_[n_-1UL], end_[n_-1]+1 );
-
-      pos->value_ = value;
-      pos->index_ = i;
-
-      for( size_t k=j+1UL; k<n_+1UL; ++k ) {
-         ++begin_[k];
-         ++end_[k-1UL];
-      }
+      cursor_ = j;
+      offset_ = pos - begin_[j];
 
       return pos;
    }
    else {
-      size_t newCapacity( extendCapacity() );
+      // Reallocating with the current capacity in case at most three quarters of it are in use
+      // (i.e. in case no suitable free capacity could be borrowed) and extending it otherwise
+      const size_t elements( nonZeros() + 1UL );
+      const size_t newCapacity( ( 4UL*elements <= 3UL*capacity() )?( capacity() ):( extendCapacity() ) );
+      const size_t slack( newCapacity - elements );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
-      Iterator* newEnd   = newBegin+capacity_+1UL;
+      Iterator* newBegin = allocate<Iterator>( alloc_, 2UL*alloc_.capacity_+2UL );
+      Iterator* newEnd   = newBegin+alloc_.capacity_+1UL;
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( alloc_, newCapacity );
 
-      for( size_t k=0UL; k<j; ++k ) {
-         const size_t nonzeros( end_[k] - begin_[k] );
-         const size_t total( begin_[k+1UL] - begin_[k] );
-         newEnd  [k]     = newBegin[k] + nonzeros;
-         newBegin[k+1UL] = newBegin[k] + total;
-      }
-      newEnd  [j]     = newBegin[j] + ( end_[j] - begin_[j] ) + 1;
-      newBegin[j+1UL] = newBegin[j] + ( begin_[j+1UL] - begin_[j] ) + 1;
-      for( size_t k=j+1UL; k<n_; ++k ) {
-         const size_t nonzeros( end_[k] - begin_[k] );
-         const size_t total( begin_[k+1UL] - begin_[k] );
+      // Distributing half of the additional capacity among all columns in proportion to their
+      // number of non-zero elements and keeping the other half at the end of the matrix
+      size_t share( slack / 2UL );
+
+      for( size_t k=0UL; k<n_; ++k ) {
+         const size_t nonzeros( end_[k] - begin_[k] + ( k == j ? 1UL : 0UL ) );
+         const size_t additional( blaze::min( ( nonzeros+1UL ) / 2UL, share ) );
+         share -= additional;
          newEnd  [k]     = newBegin[k] + nonzeros;
-         newBegin[k+1UL] = newBegin[k] + total;
+         newBegin[k+1UL] = newEnd[k] + additional;
       }
 
-      newEnd[n_] = newEnd[capacity_] = newBegin[0UL]+newCapacity;
+      newEnd[n_] = newEnd[alloc_.capacity_] = newBegin[0UL]+newCapacity;
 
-      Iterator tmp = std::copy( begin_[0UL], pos, newBegin[0UL] );
+      for( size_t k=0UL; k<n_; ++k ) {
+         if( k != j )
+            std::copy( begin_[k], end_[k], newBegin[k] );
+      }
+
+      Iterator tmp = std::copy( begin_[j], pos, newBegin[j] );
       tmp->value_ = value;
       tmp->index_ = i;
-      std::copy( pos, end_[n_-1UL], tmp+1UL );
+      std::copy( pos, end_[j], tmp+1UL );
+
+      const size_t oldCapacity( capacity() );
 
       std::swap( newBegin, begin_ );
       end_ = newEnd;
-      deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( alloc_, newBegin[0UL], oldCapacity );
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+
+      cursor_ = j;
+      offset_ = tmp - begin_[j];
 
       return tmp;
    }
@@ -3659,6 +4487,89 @@ typename CompressedMatrix<Type,true>::Iterator
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moving free capacity from the closest column with free capacity to the given column.
+//
+// \param j The index of the column running out of capacity \f$[0..N-1]\f$.
+// \param pos The insertion position within column \a j, which is adapted in case column \a j is moved.
+// \return \a true in case capacity could be borrowed, \a false otherwise.
+//
+// This function searches the columns before and after column \a j for the closest column with
+// free capacity and moves the columns in between such that half of the free capacity of this
+// column is assigned to column \a j. The free capacity at the end of the matrix is assigned
+// geometrically, i.e. the capacity of column \a j is doubled (if possible). Thus only the
+// elements between column \a j and the chosen column are moved, which form a single contiguous
+// block that is moved at once. A column is skipped in case it requires to move more elements
+// per borrowed element than the free capacity at the end of the matrix (but at least four),
+// which is always used. In case no suitable column is found, the function returns \a false
+// and the matrix is reallocated.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+bool CompressedMatrix<Type,true,AT>::borrowCapacity( size_t j, Iterator& pos )
+{
+   const size_t spare( end_[n_] - begin_[n_] );
+   const size_t gain ( blaze::min( spare, blaze::max( capacity(j), 1UL ) ) );
+   const size_t tail ( ( j+1UL < n_ )?( end_[n_-1UL] - begin_[j+1UL] ):( 0UL ) );
+   const size_t ratio( ( gain != 0UL )?( blaze::max( tail / gain, 4UL ) ):( 4UL ) );
+
+   for( size_t d=1UL; d<=j || j+d<=n_; ++d )
+   {
+      if( j+d <= n_ )
+      {
+         const size_t k( j+d );
+         const size_t slack( ( k < n_ )?( begin_[k+1UL] - end_[k] ):( end_[n_] - begin_[n_] ) );
+
+         if( slack != 0UL )
+         {
+            const size_t additional( ( k < n_ )?( ( slack+1UL ) / 2UL ):( gain ) );
+            const size_t last( blaze::min( k, n_-1UL ) );
+            const size_t moved( ( last > j )?( end_[last] - begin_[j+1UL] ):( 0UL ) );
+
+            if( k == n_ || moved <= ratio*additional )
+            {
+               if( k == n_ )
+                  begin_[n_] += additional;
+
+               if( last > j ) {
+                  std::copy_backward( begin_[j+1UL], end_[last], end_[last]+additional );
+                  for( size_t l=j+1UL; l<=last; ++l ) {
+                     begin_[l] += additional;
+                     end_  [l] += additional;
+                  }
+               }
+
+               return true;
+            }
+         }
+      }
+
+      if( d <= j && begin_[j-d+1UL] != end_[j-d] )
+      {
+         const size_t additional( ( begin_[j-d+1UL] - end_[j-d] + 1UL ) / 2UL );
+         const size_t moved( end_[j] - begin_[j-d+1UL] );
+
+         if( moved <= ratio*additional )
+         {
+            std::copy( begin_[j-d+1UL], end_[j], begin_[j-d+1UL]-additional );
+            for( size_t l=j-d+1UL; l<=j; ++l ) {
+               begin_[l] -= additional;
+               end_  [l] -= additional;
+            }
+            pos -= additional;
+
+            return true;
+         }
+      }
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Erasing an element from the sparse matrix.
@@ -3669,8 +4580,9 @@ typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases an element from the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3693,9 +4605,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -3720,9 +4633,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -3754,17 +4668,18 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+void CompressedMatrix<Type,true,AT>::resize( size_t m, size_t n, bool preserve )
 {
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 
    if( m == m_ && n == n_ ) return;
 
-   if( n > capacity_ )
+   if( n > alloc_.capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*n+2UL] );
+      Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*n+2UL ) );
       Iterator* newEnd  ( newBegin+n+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -3787,10 +4702,10 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       newEnd[n] = end_[n_];
 
       std::swap( newBegin, begin_ );
-      delete [] newBegin;
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
 
       end_ = newEnd;
-      capacity_ = n;
+      alloc_.capacity_ = n;
    }
    else if( n > n_ )
    {
@@ -3822,7 +4737,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    n_ = n;
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3839,8 +4754,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -3861,13 +4777,14 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // elements. The current values of the sparse matrix and all other individual column capacities are
 // preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+void CompressedMatrix<Type,true,AT>::reserve( size_t j, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 
    const size_t current( capacity(j) );
 
@@ -3880,10 +4797,10 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
       const size_t newCapacity( begin_[n_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*n_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*n_+2UL ) );
       Iterator* newEnd  ( newBegin+n_+1UL );
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( alloc_, newCapacity );
       newEnd  [n_ ] = newBegin[0UL]+newCapacity;
 
       for( size_t k=0UL; k<j; ++k ) {
@@ -3899,11 +4816,13 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 
       BLAZE_INTERNAL_ASSERT( newBegin[n_] == newEnd[n_], "Invalid pointer calculations" );
 
+      const size_t oldCapacity( capacity() );
+
       std::swap( newBegin, begin_ );
-      deallocate( newBegin[0UL] );
-      delete [] newBegin;
+      deallocate( alloc_, newBegin[0UL], oldCapacity );
+      deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
       end_ = newEnd;
-      capacity_ = n_;
+      alloc_.capacity_ = n_;
    }
    else
    {
@@ -3915,7 +4834,7 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
    }
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
-   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == alloc_.capacity_ + 1UL, "Invalid storage setting detected" );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3931,8 +4850,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+void CompressedMatrix<Type,true,AT>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -3952,8 +4872,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+void CompressedMatrix<Type,true,AT>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3965,16 +4886,56 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing all excessive capacity from the sparse matrix.
+//
+// \return void
+//
+// In contrast to the trim() function, which only removes the excessive capacity of the
+// individual columns, the compact() function additionally releases all excessive memory
+// of the sparse matrix. After the call, the capacity of the matrix is equal to its number of
+// non-zero elements.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+void CompressedMatrix<Type,true,AT>::compact()
+{
+   const size_t nonzeros( nonZeros() );
+
+   Iterator* newBegin( allocate<Iterator>( alloc_, 2UL*n_+2UL ) );
+   Iterator* newEnd  ( newBegin+n_+1UL );
+
+   newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
+
+   for( size_t j=0UL; j<n_; ++j )
+      newBegin[j+1UL] = newEnd[j] = std::copy( begin_[j], end_[j], newBegin[j] );
+   newEnd[n_] = newBegin[0UL]+nonzeros;
+
+   const size_t oldCapacity( capacity() );
+
+   std::swap( newBegin, begin_ );
+   deallocate( alloc_, newBegin[0UL], oldCapacity );
+   deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+   end_ = newEnd;
+   alloc_.capacity_ = n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Transposing the matrix.
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline CompressedMatrix<Type,true,AT>& CompressedMatrix<Type,true,AT>::transpose()
 {
-   CompressedMatrix tmp( trans( *this ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = trans( *this );
    swap( tmp );
    return *this;
 }
@@ -3989,9 +4950,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 // \param scalar The scalar value for the matrix scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,AT>& CompressedMatrix<Type,true,AT>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( Iterator element=begin_[j]; element!=end_[j]; ++element )
@@ -4010,9 +4972,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // \param scalar The scalar value for the diagonal scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,true,AT>& CompressedMatrix<Type,true,AT>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -4036,14 +4999,17 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal(
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw() */
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
-   std::swap( capacity_, sm.capacity_ );
+   std::swap( alloc_, sm.alloc_ );
    std::swap( begin_, sm.begin_ );
    std::swap( end_  , sm.end_   );
+   std::swap( cursor_, sm.cursor_ );
+   std::swap( offset_, sm.offset_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4058,8 +5024,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw()
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline size_t CompressedMatrix<Type,true,AT>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4079,13 +5046,14 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+void CompressedMatrix<Type,true,AT>::reserveElements( size_t nonzeros )
 {
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
-   Iterator* newEnd   = newBegin+capacity_+1UL;
+   Iterator* newBegin = allocate<Iterator>( alloc_, 2UL*alloc_.capacity_+2UL );
+   Iterator* newEnd   = newBegin+alloc_.capacity_+1UL;
 
-   newBegin[0UL] = allocate<Element>( nonzeros );
+   newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
 
    for( size_t k=0UL; k<n_; ++k ) {
       BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid column pointers" );
@@ -4095,9 +5063,11 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 
    newEnd[n_] = newBegin[0UL]+nonzeros;
 
+   const size_t oldCapacity( capacity() );
+
    std::swap( newBegin, begin_ );
-   deallocate( newBegin[0UL] );
-   delete [] newBegin;
+   deallocate( alloc_, newBegin[0UL], oldCapacity );
+   deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
    end_ = newEnd;
 }
 /*! \endcond */
@@ -4124,14 +5094,20 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // matrix. It specifically searches for the element with row index \a i and column index \a j.
 // In case the element is found, the function returns an iterator to the element. Otherwise an
 // iterator just past the last non-zero element of column \a j (the end() iterator) is returned.
-// Note that the returned sparse matrix iterator is subject to invalidation due to inserting
-// operations via the subscript operator or the insert() function!
+// In case the element is located at or directly behind the most recently inserted element, it
+// is found without a binary search. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::find( size_t i, size_t j )
 {
-   return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   const Iterator pos( insertPosition( i, j ) );
+   if( pos != end_[j] && pos->index_ == i )
+      return pos;
+   else return end_[j];
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4149,14 +5125,17 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix. It specifically searches for the element with row index \a i and column index \a j.
 // In case the element is found, the function returns an iterator to the element. Otherwise an
 // iterator just past the last non-zero element of column \a j (the end() iterator) is returned.
-// Note that the returned sparse matrix iterator is subject to invalidation due to inserting
-// operations via the subscript operator or the insert() function!
+// In case the element is located at or directly behind the most recently inserted element, it
+// is found without a binary search. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::find( size_t i, size_t j ) const
 {
-   const ConstIterator pos( lowerBound( i, j ) );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   const ConstIterator pos( insertPosition( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
       return pos;
    else return end_[j];
@@ -4179,11 +5158,13 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::lowerBound( size_t i, size_t j )
 {
-   return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return std::lower_bound( begin_[j], end_[j], i, FindIndex() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4203,9 +5184,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4228,9 +5210,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::Iterator
+   CompressedMatrix<Type,true,AT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -4252,9 +5235,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline typename CompressedMatrix<Type,true,AT>::ConstIterator
+   CompressedMatrix<Type,true,AT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4313,8 +5297,9 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \b Note: Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4346,8 +5331,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \b Note: Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline void CompressedMatrix<Type,true,AT>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid row access index" );
 
@@ -4359,6 +5345,80 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembly of the sparse matrix from unsorted coordinate triplets.
+//
+// \param rows The array of row indices of the triplets.
+// \param columns The array of column indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The number of triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the sparse matrix by the given unsorted
+// coordinate triplets \f$ (rows[k],columns[k],values[k]) \f$. The values of duplicate
+// triplets are summed up.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+template< typename IT      // Type of the triplet indices
+        , typename Other > // Type of the triplet values
+inline void CompressedMatrix<Type,true,AT>::assemble( const IT* rows, const IT* columns,
+                                                      const Other* values, size_t nonzeros )
+{
+   assemble( rows, columns, values, nonzeros, std::plus<Type>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembly of the sparse matrix from unsorted coordinate triplets.
+//
+// \param rows The array of row indices of the triplets.
+// \param columns The array of column indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The number of triplets.
+// \param combine The binary combiner for the values of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function replaces the current content of the sparse matrix by the given unsorted
+// coordinate triplets \f$ (rows[k],columns[k],values[k]) \f$. The triplets are sorted by
+// column index and row index and the values of duplicate triplets are merged via the given
+// binary combiner in the order of their appearance in the input.
+*/
+template< typename Type       // Data type of the sparse matrix
+        , typename AT >       // Type of the allocator
+template< typename IT         // Type of the triplet indices
+        , typename Other      // Type of the triplet values
+        , typename Combiner > // Type of the combiner for duplicate triplets
+void CompressedMatrix<Type,true,AT>::assemble( const IT* rows, const IT* columns, const Other* values,
+                                               size_t nonzeros, Combiner combine )
+{
+   const TripletAssembler<Type> assembler( n_, m_, columns, rows, values, nonzeros );
+
+   Iterator* newBegin = allocate<Iterator>( alloc_, 2UL*alloc_.capacity_+2UL );
+   Iterator* newEnd   = newBegin+alloc_.capacity_+1UL;
+
+   newBegin[0UL] = allocate<Element>( alloc_, nonzeros );
+   newBegin[n_]  = newEnd[n_] = newBegin[0UL]+nonzeros;
+
+   assembler.fill( newBegin[0UL], newBegin, newEnd, combine );
+
+   const size_t oldCapacity( capacity() );
+
+   std::swap( newBegin, begin_ );
+   deallocate( alloc_, newBegin[0UL], oldCapacity );
+   deallocate( alloc_, newBegin, 2UL*alloc_.capacity_+2UL );
+   end_ = newEnd;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -4378,9 +5438,10 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,AT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4399,9 +5460,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename AT >     // Type of the allocator
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,AT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4420,8 +5482,9 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the sparse matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
+inline bool CompressedMatrix<Type,true,AT>::canSMPAssign() const
 {
    return false;
 }
@@ -4441,10 +5504,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,AT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4501,9 +5565,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void CompressedMatrix<Type,true,AT>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4533,9 +5598,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void CompressedMatrix<Type,true,AT>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4544,25 +5610,13 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   typedef typename MT::ConstIterator  RhsIterator;
-
    // Counting the number of elements per column
-   std::vector<size_t> columnLengths( n_, 0UL );
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         ++columnLengths[element->index()];
-   }
+   StorageOrderConverter<MT,false> converter( ~rhs );
 
-   // Resizing the sparse matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
-   }
+   BLAZE_INTERNAL_ASSERT( capacity() >= converter.size(), "Invalid capacity detected" );
 
-   // Appending the elements to the columns of the sparse matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         append( i, element->index(), element->value() );
-   }
+   // Scattering the elements into the columns of the sparse matrix
+   converter.fill( begin_[0UL], begin_, end_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4580,15 +5634,17 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,AT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this + (~rhs) );
    swap( tmp );
 }
 /*! \endcond */
@@ -4607,15 +5663,17 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,AT>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this + (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this + (~rhs) );
    swap( tmp );
 }
 /*! \endcond */
@@ -4634,15 +5692,17 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,AT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this - (~rhs) );
    swap( tmp );
 }
 /*! \endcond */
@@ -4661,15 +5721,17 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename AT >    // Type of the allocator
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,AT>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   CompressedMatrix tmp( serial( *this - (~rhs) ) );
+   CompressedMatrix tmp( alloc_ );
+   tmp = serial( *this - (~rhs) );
    swap( tmp );
 }
 /*! \endcond */
@@ -4691,23 +5753,23 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename AT >
+inline void reset( CompressedMatrix<Type,SO,AT>& m );
 
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename AT >
+inline void reset( CompressedMatrix<Type,SO,AT>& m, size_t i );
 
-template< typename Type, bool SO >
-inline void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename AT >
+inline void clear( CompressedMatrix<Type,SO,AT>& m );
 
-template< typename Type, bool SO >
-inline bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename AT >
+inline bool isDefault( const CompressedMatrix<Type,SO,AT>& m );
 
-template< typename Type, bool SO >
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */;
+template< typename Type, bool SO, typename AT >
+inline void swap( CompressedMatrix<Type,SO,AT>& a, CompressedMatrix<Type,SO,AT>& b ) /* throw() */;
 
-template< typename Type, bool SO >
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */;
+template< typename Type, bool SO, typename AT >
+inline void move( CompressedMatrix<Type,SO,AT>& dst, CompressedMatrix<Type,SO,AT>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -4720,8 +5782,9 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void reset( CompressedMatrix<Type,SO,AT>& m )
 {
    m.reset();
 }
@@ -4742,8 +5805,9 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void reset( CompressedMatrix<Type,SO,AT>& m, size_t i )
 {
    m.reset( i );
 }
@@ -4758,8 +5822,9 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void clear( CompressedMatrix<Type,SO,AT>& m )
 {
    m.clear();
 }
@@ -4785,8 +5850,9 @@ inline void clear( CompressedMatrix<Type,SO>& m )
    \endcode
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline bool isDefault( const CompressedMatrix<Type,SO,AT>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -4803,8 +5869,9 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void swap( CompressedMatrix<Type,SO,AT>& a, CompressedMatrix<Type,SO,AT>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -4821,8 +5888,9 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */
+        , bool SO        // Storage order
+        , typename AT >  // Type of the allocator
+inline void move( CompressedMatrix<Type,SO,AT>& dst, CompressedMatrix<Type,SO,AT>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -4839,8 +5907,8 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename A >
+struct IsResizable< CompressedMatrix<T,SO,A> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -4859,86 +5927,86 @@ struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct AddTrait< CompressedMatrix<T1,SO,A1>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct AddTrait< CompressedMatrix<T1,SO1,A1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,A2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct AddTrait< CompressedMatrix<T1,SO,A1>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct AddTrait< CompressedMatrix<T1,SO1,A1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,A2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct AddTrait< CompressedMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct AddTrait< CompressedMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct AddTrait< DynamicMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct AddTrait< DynamicMatrix<T1,SO1,A1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct AddTrait< CompressedMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
    typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct AddTrait< CompressedMatrix<T1,SO1,A1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
 };
@@ -4956,86 +6024,86 @@ struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct SubTrait< CompressedMatrix<T1,SO,A1>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct SubTrait< CompressedMatrix<T1,SO1,A1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,A2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename A1 >
+struct SubTrait< CompressedMatrix<T1,SO,A1>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct SubTrait< CompressedMatrix<T1,SO1,A1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename A2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,A2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct SubTrait< CompressedMatrix<T1,SO,A1>, DynamicMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct SubTrait< CompressedMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct SubTrait< DynamicMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct SubTrait< DynamicMatrix<T1,SO1,A1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct SubTrait< CompressedMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
    typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct SubTrait< CompressedMatrix<T1,SO1,A1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
 };
@@ -5053,106 +6121,106 @@ struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, T2 >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< T1, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A2 >
+struct MultTrait< T1, CompressedMatrix<T2,SO,A2> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, StaticVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, StaticVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename A2 >
+struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, HybridVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, HybridVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename A2 >
+struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, DynamicVector<T2,false,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A1, typename A2 >
+struct MultTrait< DynamicVector<T1,true,A1>, CompressedMatrix<T2,SO,A2> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, CompressedVector<T2,false> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename A2 >
+struct MultTrait< CompressedVector<T1,true>, CompressedMatrix<T2,SO,A2> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO1,A1>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO1,A1>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename A2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct MultTrait< CompressedMatrix<T1,SO1,A1>, DynamicMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1, typename A2 >
+struct MultTrait< CompressedMatrix<T1,SO1,A1>, CompressedMatrix<T2,SO2,A2> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
@@ -5170,8 +6238,8 @@ struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct DivTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename A1 >
+struct DivTrait< CompressedMatrix<T1,SO,A1>, T2 >
 {
    typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
@@ -5190,8 +6258,8 @@ struct DivTrait< CompressedMatrix<T1,SO>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename A1, typename A2 >
+struct MathTrait< CompressedMatrix<T1,SO,A1>, CompressedMatrix<T2,SO,A2> >
 {
    typedef CompressedMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
    typedef CompressedMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
@@ -5210,10 +6278,10 @@ struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct SubmatrixTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename A1 >
+struct SubmatrixTrait< CompressedMatrix<T1,SO,A1> >
 {
-   typedef CompressedMatrix<T1,SO>  Type;
+   typedef CompressedMatrix<T1,SO,A1>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5229,8 +6297,8 @@ struct SubmatrixTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct RowTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename A1 >
+struct RowTrait< CompressedMatrix<T1,SO,A1> >
 {
    typedef CompressedVector<T1,true>  Type;
 };
@@ -5248,8 +6316,8 @@ struct RowTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct ColumnTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename A1 >
+struct ColumnTrait< CompressedMatrix<T1,SO,A1> >
 {
    typedef CompressedVector<T1,false>  Type;
 };
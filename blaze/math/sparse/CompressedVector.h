@@ -1934,14 +1934,14 @@ struct AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A2 >
+struct AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1 >
+struct AddTrait< DynamicVector<T1,TF,A1>, CompressedVector<T2,TF> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
@@ -1989,14 +1989,14 @@ struct SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A2 >
+struct SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1 >
+struct SubTrait< DynamicVector<T1,TF,A1>, CompressedVector<T2,TF> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
@@ -2106,38 +2106,38 @@ struct MultTrait< HybridVector<T1,N,true>, CompressedVector<T2,false> >
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A2 >
+struct MultTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF,A2> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,false>, DynamicVector<T2,true> >
+template< typename T1, typename T2, typename A2 >
+struct MultTrait< CompressedVector<T1,false>, DynamicVector<T2,true,A2> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename A2 >
+struct MultTrait< CompressedVector<T1,true>, DynamicVector<T2,false,A2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename A1 >
+struct MultTrait< DynamicVector<T1,TF,A1>, CompressedVector<T2,TF> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,false>, CompressedVector<T2,true> >
+template< typename T1, typename T2, typename A1 >
+struct MultTrait< DynamicVector<T1,false,A1>, CompressedVector<T2,true> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,true>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, CompressedVector<T2,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
@@ -2213,8 +2213,8 @@ struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename A2 >
+struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false,A2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2223,8 +2223,8 @@ struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename A1 >
+struct CrossTrait< DynamicVector<T1,false,A1>, CompressedVector<T2,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
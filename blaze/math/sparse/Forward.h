@@ -36,6 +36,14 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,8 +52,13 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
+template< typename, size_t > class BlockCompressedMatrix;
+template< typename T, bool, typename = AlignedAllocator<T> > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
+template< typename, bool > class HypersparseMatrix;
+template< typename, size_t > class SlicedEllpackMatrix;
+template< typename, bool, typename > class SplitCompressedMatrix;
+template< typename, bool, typename > class SplitCompressedVector;
 
 } // namespace blaze
 
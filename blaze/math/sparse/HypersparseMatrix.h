@@ -0,0 +1,1870 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/HypersparseMatrix.h
+//  \brief Implementation of a doubly compressed (hypersparse) sparse matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_HYPERSPARSEMATRIX_H_
+#define _BLAZE_MATH_SPARSE_HYPERSPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsHypersparse.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup hypersparse_matrix HypersparseMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Doubly compressed sparse matrix (DCSR/DCSC) for matrices with mostly empty rows/columns.
+// \ingroup hypersparse_matrix
+//
+// The HypersparseMatrix class template is the representation of an arbitrary sized sparse matrix
+// in the doubly compressed row (DCSR) or doubly compressed column (DCSC) format. In contrast to
+// CompressedMatrix, which stores two pointers for every single row (or column) of the matrix,
+// HypersparseMatrix only stores the indices and offsets of the rows (or columns) that contain
+// at least one non-zero element:
+
+   \code
+   // Row-major 6x4 matrix         Rows:     | 1     | 4 |
+   //                                        |-------|---|
+   //   ( 0 0 0 0 )                Offsets:  | 0     | 2 | 3
+   //   ( 1 0 2 0 )                          |-------|---|
+   //   ( 0 0 0 0 )                Elements: | 1 2   | 3 |
+   //   ( 0 0 0 0 )                Indices:  | 0 2   | 1 |
+   //   ( 0 3 0 0 )
+   //   ( 0 0 0 0 )
+   \endcode
+
+// Therefore both the memory requirements and the time for a complete traversal of the matrix
+// scale with the number of non-zero elements instead of the number of rows (or columns). This
+// makes HypersparseMatrix the format of choice for huge matrices with only a few non-zero
+// elements per row, as for instance \f$ 10^9 \times 10^9 \f$ matrices with \f$ 10^7 \f$
+// non-zero elements. The type of the elements and the storage order of the matrix can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class HypersparseMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. HypersparseMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// A HypersparseMatrix is either created from any other (dense or sparse) matrix or filled via
+// the reserve() and append() functions. Since the rows (or columns) have to be appended in
+// strictly increasing order, the latter never touches any of the empty rows (or columns):
+
+   \code
+   using blaze::HypersparseMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   HypersparseMatrix<double,rowMajor> A( 1000000000UL, 1000000000UL );
+
+   A.reserve( 3UL );                      // Reserving enough capacity for 3 non-zero elements
+   A.append(        42UL,      7UL, 1.0 );  // Appending the value 1 in row 42 with column index 7
+   A.append(        42UL, 999999UL, 2.0 );  // Appending the value 2 in row 42 with column index 999999
+   A.append( 123456789UL,      0UL, 3.0 );  // Appending the value 3 in row 123456789 with column index 0
+
+   for( size_t k=0UL; k<A.nonEmpty(); ++k ) {
+      const size_t i( A.nonEmptyIndices()[k] );  // The index of the k-th non-empty row
+      for( HypersparseMatrix<double,rowMajor>::ConstIterator it=A.nonEmptyBegin(k); it!=A.nonEmptyEnd(k); ++it ) {
+         ... = it->value();  // Access to the value of the non-zero element A(i,it->index())
+      }
+   }
+   \endcode
+
+// Element access and the traversal of a single row (or column) via the begin() and end()
+// functions work exactly as for CompressedMatrix, except that the elements cannot be inserted
+// or erased individually and that locating a row (or column) requires a binary search over
+// the non-empty rows (or columns). Matrix/vector multiplications with both dense and sparse
+// vectors use dedicated kernels that only traverse the non-empty rows (or columns). Note
+// however that the result of a multiplication with a dense vector is a dense vector, whose size
+// still corresponds to the number of rows of the matrix. A HypersparseMatrix can be converted
+// into a CompressedMatrix and vice versa:
+
+   \code
+   CompressedMatrix<double,rowMajor> B( A );  // Conversion to a compressed matrix
+   HypersparseMatrix<double,rowMajor> C( B );  // Conversion to a hypersparse matrix
+   \endcode
+*/
+template< typename Type                  // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class HypersparseMatrix : public SparseMatrix< HypersparseMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   //**********************************************************************************************
+
+   //**Private class Element***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Value-index-pair for the HypersparseMatrix class.
+   */
+   struct Element : public ElementBase
+   {
+      // This operator is required due to a bug in all versions of the the MSVC compiler.
+      // A simple 'using ElementBase::operator=;' statement results in ambiguity problems.
+      template< typename Other >
+      inline Element& operator=( const Other& rhs )
+      {
+         ElementBase::operator=( rhs );
+         return *this;
+      }
+
+      friend class HypersparseMatrix;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() function.
+   */
+   struct FindIndex : public std::binary_function<Element,size_t,bool>
+   {
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+      inline bool operator()( const Element& element1, const Element& element2 ) const {
+         return element1.index() < element2.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Triplet***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary element for the conversion of matrices with opposite storage order.
+   */
+   struct Triplet
+   {
+      inline bool operator<( const Triplet& rhs ) const {
+         return major_ < rhs.major_;
+      }
+
+      size_t major_;  //!< The row index (row-major) or column index (column-major).
+      size_t minor_;  //!< The column index (row-major) or row index (column-major).
+      Type   value_;  //!< The value of the element.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef HypersparseMatrix<Type,SO>   This;            //!< Type of this HypersparseMatrix instance.
+   typedef This                         ResultType;      //!< Result type for expression template evaluations.
+   typedef HypersparseMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef HypersparseMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                         ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                  ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                  CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                  Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                  ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef Element*                     Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*               ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a HypersparseMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef HypersparseMatrix<ET,SO>  Other;  //!< The type of the other HypersparseMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                                     explicit inline HypersparseMatrix();
+                                     explicit inline HypersparseMatrix( size_t m, size_t n );
+                                     explicit inline HypersparseMatrix( size_t m, size_t n, size_t nonzeros );
+                                              inline HypersparseMatrix( const HypersparseMatrix& sm );
+   template< typename MT, bool SO2 >          inline HypersparseMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 >          inline HypersparseMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~HypersparseMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline HypersparseMatrix& operator=( const HypersparseMatrix& rhs );
+   template< typename MT, bool SO2 > inline HypersparseMatrix& operator=( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline HypersparseMatrix& operator=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t             rows() const;
+   inline size_t             columns() const;
+   inline size_t             capacity() const;
+   inline size_t             capacity( size_t i ) const;
+   inline size_t             nonZeros() const;
+   inline size_t             nonZeros( size_t i ) const;
+   inline void               reset();
+   inline void               clear();
+          void               reserve( size_t nonzeros );
+   inline HypersparseMatrix& transpose();
+   inline void               swap( HypersparseMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void          append         ( size_t i, size_t j, const Type& value, bool check=false );
+   inline size_t        nonEmpty       () const;
+   inline const size_t* nonEmptyIndices() const;
+   inline Iterator      nonEmptyBegin  ( size_t k );
+   inline ConstIterator nonEmptyBegin  ( size_t k ) const;
+   inline Iterator      nonEmptyEnd    ( size_t k );
+   inline ConstIterator nonEmptyEnd    ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t position( size_t k ) const;
+
+   template< typename MT, bool SO2 > void build( const DenseMatrix<MT,SO2>& dm );
+   template< typename MT >           void build( const SparseMatrix<MT,SO>&  sm );
+   template< typename MT >           void build( const SparseMatrix<MT,!SO>& sm );
+   template< typename Other >        void build( const HypersparseMatrix<Other,SO>&  sm );
+   template< typename Other >        void build( const HypersparseMatrix<Other,!SO>& sm );
+                                     void build( size_t m, size_t n, std::vector<Triplet>& triplets );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t   m_;          //!< The current number of rows (row-major) or columns (column-major).
+   size_t   n_;          //!< The current number of columns (row-major) or rows (column-major).
+   size_t   nonEmpty_;   //!< The current number of non-empty rows/columns.
+   size_t   capacity_;   //!< The current capacity of the element and index arrays.
+   size_t*  indices_;    //!< The indices of the non-empty rows/columns.
+   size_t*  offsets_;    //!< The offsets of the first non-zero element of each non-empty row/column.
+   Element* elements_;   //!< The non-zero elements of the sparse matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename Other, bool SO2 > friend class HypersparseMatrix;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type HypersparseMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for HypersparseMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>::HypersparseMatrix()
+   : m_       ( 0UL )              // The current number of rows/columns of the sparse matrix
+   , n_       ( 0UL )              // The current number of columns/rows of the sparse matrix
+   , nonEmpty_( 0UL )              // The current number of non-empty rows/columns
+   , capacity_( 0UL )              // The current capacity of the element and index arrays
+   , indices_ ( NULL )             // The indices of the non-empty rows/columns
+   , offsets_ ( new size_t[1UL] )  // The offsets of the first non-zero element of each non-empty row/column
+   , elements_( NULL )             // The non-zero elements of the sparse matrix
+{
+   offsets_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized to the zero matrix and has no free capacity. Note that in contrast
+// to CompressedMatrix no memory proportional to the number of rows (or columns) is allocated.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>::HypersparseMatrix( size_t m, size_t n )
+   : m_       ( SO ? n : m )       // The current number of rows/columns of the sparse matrix
+   , n_       ( SO ? m : n )       // The current number of columns/rows of the sparse matrix
+   , nonEmpty_( 0UL )              // The current number of non-empty rows/columns
+   , capacity_( 0UL )              // The current capacity of the element and index arrays
+   , indices_ ( NULL )             // The indices of the non-empty rows/columns
+   , offsets_ ( new size_t[1UL] )  // The offsets of the first non-zero element of each non-empty row/column
+   , elements_( NULL )             // The non-zero elements of the sparse matrix
+{
+   offsets_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+//
+// The matrix is initialized to the zero matrix and provides enough capacity to append
+// \a nonzeros elements (see the append() function).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>::HypersparseMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( SO ? n : m )       // The current number of rows/columns of the sparse matrix
+   , n_       ( SO ? m : n )       // The current number of columns/rows of the sparse matrix
+   , nonEmpty_( 0UL )              // The current number of non-empty rows/columns
+   , capacity_( 0UL )              // The current capacity of the element and index arrays
+   , indices_ ( NULL )             // The indices of the non-empty rows/columns
+   , offsets_ ( new size_t[1UL] )  // The offsets of the first non-zero element of each non-empty row/column
+   , elements_( NULL )             // The non-zero elements of the sparse matrix
+{
+   offsets_[0UL] = 0UL;
+   reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for HypersparseMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>::HypersparseMatrix( const HypersparseMatrix& sm )
+   : m_       ( sm.m_ )                           // The current number of rows/columns of the sparse matrix
+   , n_       ( sm.n_ )                           // The current number of columns/rows of the sparse matrix
+   , nonEmpty_( sm.nonEmpty_ )                    // The current number of non-empty rows/columns
+   , capacity_( sm.nonZeros() )                   // The current capacity of the element and index arrays
+   , indices_ ( new size_t[nonEmpty_] )           // The indices of the non-empty rows/columns
+   , offsets_ ( new size_t[nonEmpty_+1UL] )       // The offsets of the first non-zero element of each non-empty row/column
+   , elements_( allocate<Element>( capacity_ ) )  // The non-zero elements of the sparse matrix
+{
+   std::copy( sm.indices_, sm.indices_+nonEmpty_, indices_ );
+   std::copy( sm.offsets_, sm.offsets_+nonEmpty_+1UL, offsets_ );
+   std::copy( sm.elements_, sm.elements_+capacity_, elements_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be converted.
+//
+// All non-default elements of the given dense matrix are stored in the hypersparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline HypersparseMatrix<Type,SO>::HypersparseMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( 0UL )              // The current number of rows/columns of the sparse matrix
+   , n_       ( 0UL )              // The current number of columns/rows of the sparse matrix
+   , nonEmpty_( 0UL )              // The current number of non-empty rows/columns
+   , capacity_( 0UL )              // The current capacity of the element and index arrays
+   , indices_ ( NULL )             // The indices of the non-empty rows/columns
+   , offsets_ ( new size_t[1UL] )  // The offsets of the first non-zero element of each non-empty row/column
+   , elements_( NULL )             // The non-zero elements of the sparse matrix
+{
+   offsets_[0UL] = 0UL;
+   build( ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from sparse matrices.
+//
+// \param sm Sparse matrix to be converted.
+//
+// Hypersparse matrices are converted by only traversing their non-empty rows/columns. Other
+// sparse matrices are traversed row by row (or column by column), sparse matrix expressions
+// that require an intermediate evaluation are first evaluated into a temporary CompressedMatrix.
+// Matrices with opposite storage order are converted by sorting their non-zero elements, which
+// requires a time proportional to \f$ nnz \log(nnz) \f$, but no memory proportional to the
+// number of rows/columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline HypersparseMatrix<Type,SO>::HypersparseMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( 0UL )              // The current number of rows/columns of the sparse matrix
+   , n_       ( 0UL )              // The current number of columns/rows of the sparse matrix
+   , nonEmpty_( 0UL )              // The current number of non-empty rows/columns
+   , capacity_( 0UL )              // The current capacity of the element and index arrays
+   , indices_ ( NULL )             // The indices of the non-empty rows/columns
+   , offsets_ ( new size_t[1UL] )  // The offsets of the first non-zero element of each non-empty row/column
+   , elements_( NULL )             // The non-zero elements of the sparse matrix
+{
+   typedef typename SelectType< RequiresEvaluation<MT>::value
+                              , const CompressedMatrix<Type,SO2>
+                              , const MT& >::Type  Tmp;
+
+   offsets_[0UL] = 0UL;
+
+   Tmp tmp( ~sm );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for HypersparseMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>::~HypersparseMatrix()
+{
+   delete [] indices_;
+   delete [] offsets_;
+   deallocate( elements_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstReference
+   HypersparseMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i. Note that locating the
+// row/column requires a binary search over all non-empty rows/columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return elements_ + offsets_[position( i )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return elements_ + offsets_[position( i )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return elements_ + offsets_[position( i )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   const size_t k( position( i ) );
+   return elements_ + offsets_[ ( k < nonEmpty_ && indices_[k] == i )?( k+1UL ):( k ) ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   const size_t k( position( i ) );
+   return elements_ + offsets_[ ( k < nonEmpty_ && indices_[k] == i )?( k+1UL ):( k ) ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for HypersparseMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>& HypersparseMatrix<Type,SO>::operator=( const HypersparseMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   HypersparseMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+//
+// The hypersparse matrix is resized according to the given dense matrix and initialized as a
+// copy of this dense matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline HypersparseMatrix<Type,SO>& HypersparseMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   HypersparseMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+//
+// The hypersparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline HypersparseMatrix<Type,SO>& HypersparseMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   HypersparseMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::rows() const
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::columns() const
+{
+   return ( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// Since the rows/columns of a hypersparse matrix are stored without any free capacity, this
+// function returns the number of non-zero elements in the specified row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::capacity( size_t i ) const
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::nonZeros() const
+{
+   return offsets_[nonEmpty_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   return end( i ) - begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements from the matrix. The size and the capacity of
+// the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void HypersparseMatrix<Type,SO>::reset()
+{
+   nonEmpty_ = 0UL;
+   offsets_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void HypersparseMatrix<Type,SO>::clear()
+{
+   m_ = 0UL;
+   n_ = 0UL;
+   reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// Since every non-empty row/column contains at least one non-zero element, this capacity is
+// also sufficient for the according number of non-empty rows/columns. The current values of
+// the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void HypersparseMatrix<Type,SO>::reserve( size_t nonzeros )
+{
+   if( nonzeros <= capacity_ )
+      return;
+
+   const size_t majors( blaze::min( nonzeros, m_ ) );
+
+   size_t*  newIndices ( new size_t[majors] );
+   size_t*  newOffsets ( new size_t[majors+1UL] );
+   Element* newElements( allocate<Element>( nonzeros ) );
+
+   std::copy( indices_, indices_+nonEmpty_, newIndices );
+   std::copy( offsets_, offsets_+nonEmpty_+1UL, newOffsets );
+   std::copy( elements_, elements_+offsets_[nonEmpty_], newElements );
+
+   std::swap( indices_ , newIndices  );
+   std::swap( offsets_ , newOffsets  );
+   std::swap( elements_, newElements );
+   capacity_ = nonzeros;
+
+   delete [] newIndices;
+   delete [] newOffsets;
+   deallocate( newElements );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// The transposition is performed by sorting the non-zero elements by their minor index and
+// therefore does not require any memory proportional to the number of rows/columns.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline HypersparseMatrix<Type,SO>& HypersparseMatrix<Type,SO>::transpose()
+{
+   std::vector<Triplet> triplets( nonZeros() );
+
+   for( size_t k=0UL, l=0UL; k<nonEmpty_; ++k ) {
+      for( ConstIterator element=nonEmptyBegin(k); element!=nonEmptyEnd(k); ++element, ++l ) {
+         triplets[l].major_ = element->index_;
+         triplets[l].minor_ = indices_[k];
+         triplets[l].value_ = element->value_;
+      }
+   }
+
+   build( columns(), rows(), triplets );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void HypersparseMatrix<Type,SO>::swap( HypersparseMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( nonEmpty_, sm.nonEmpty_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( indices_, sm.indices_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( elements_, sm.elements_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the given row/column within the non-empty rows/columns.
+//
+// \param i The index of the row/column.
+// \return The position of the first non-empty row/column with an index not less than \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::position( size_t i ) const
+{
+   return std::lower_bound( indices_, indices_+nonEmpty_, i ) - indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index_ == ( SO ? i : j ) )
+      return pos;
+   else return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return std::lower_bound( begin( SO ? j : i ), end( SO ? j : i ), ( SO ? i : j ), FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::upperBound( size_t i, size_t j )
+{
+   return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return std::upper_bound( begin( SO ? j : i ), end( SO ? j : i ), ( SO ? i : j ), FindIndex() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a hypersparse matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the row index (row-major) or column index (column-major) of the new element must not be
+//    smaller than the according index of all previously appended elements
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested. In contrast to CompressedMatrix, no
+// finalize() function is required since empty rows/columns are not stored at all.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void HypersparseMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < m_, "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( l < n_, "Invalid column/row access index" );
+   BLAZE_USER_ASSERT( offsets_[nonEmpty_] < capacity_, "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( nonEmpty_ == 0UL || k >= indices_[nonEmpty_-1UL], "Row/column index is decreasing" );
+   BLAZE_USER_ASSERT( nonEmpty_ == 0UL || k > indices_[nonEmpty_-1UL] ||
+                      l > elements_[offsets_[nonEmpty_]-1UL].index_, "Index is not strictly increasing" );
+
+   if( check && isDefault( value ) )
+      return;
+
+   if( nonEmpty_ == 0UL || indices_[nonEmpty_-1UL] != k ) {
+      indices_[nonEmpty_] = k;
+      offsets_[nonEmpty_+1UL] = offsets_[nonEmpty_];
+      ++nonEmpty_;
+   }
+
+   Element& element( elements_[offsets_[nonEmpty_]] );
+   element.value_ = value;
+   element.index_ = l;
+   ++offsets_[nonEmpty_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-empty rows/columns of the sparse matrix.
+//
+// \return The number of rows (row-major) or columns (column-major) with at least one element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t HypersparseMatrix<Type,SO>::nonEmpty() const
+{
+   return nonEmpty_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the non-empty rows/columns of the sparse matrix.
+//
+// \return Pointer to the first of the nonEmpty() strictly increasing row/column indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline const size_t* HypersparseMatrix<Type,SO>::nonEmptyIndices() const
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the \a k-th non-empty row/column.
+//
+// \param k The position of the row/column within the non-empty rows/columns \f$[0..nonEmpty()-1]\f$.
+// \return Iterator to the first non-zero element of the \a k-th non-empty row/column.
+//
+// In contrast to the begin() function this function does not require a binary search. The
+// index of the according row/column is given by \a nonEmptyIndices()[k].
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::nonEmptyBegin( size_t k )
+{
+   BLAZE_USER_ASSERT( k < nonEmpty_, "Invalid non-empty row/column access index" );
+   return elements_ + offsets_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the \a k-th non-empty row/column.
+//
+// \param k The position of the row/column within the non-empty rows/columns \f$[0..nonEmpty()-1]\f$.
+// \return Iterator to the first non-zero element of the \a k-th non-empty row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::nonEmptyBegin( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < nonEmpty_, "Invalid non-empty row/column access index" );
+   return elements_ + offsets_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the \a k-th non-empty row/column.
+//
+// \param k The position of the row/column within the non-empty rows/columns \f$[0..nonEmpty()-1]\f$.
+// \return Iterator just past the last non-zero element of the \a k-th non-empty row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::Iterator
+   HypersparseMatrix<Type,SO>::nonEmptyEnd( size_t k )
+{
+   BLAZE_USER_ASSERT( k < nonEmpty_, "Invalid non-empty row/column access index" );
+   return elements_ + offsets_[k+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the \a k-th non-empty row/column.
+//
+// \param k The position of the row/column within the non-empty rows/columns \f$[0..nonEmpty()-1]\f$.
+// \return Iterator just past the last non-zero element of the \a k-th non-empty row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename HypersparseMatrix<Type,SO>::ConstIterator
+   HypersparseMatrix<Type,SO>::nonEmptyEnd( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < nonEmpty_, "Invalid non-empty row/column access index" );
+   return elements_ + offsets_[k+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool HypersparseMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool HypersparseMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false, since hypersparse matrices are always assigned serially.
+//
+// Since the non-empty rows/columns of a hypersparse matrix can only be appended in increasing
+// order, hypersparse matrices cannot be used in SMP assignments.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool HypersparseMatrix<Type,SO>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Construction of the hypersparse matrix from a dense matrix.
+//
+// \param dm The dense matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the dense matrix
+        , bool SO2 >     // Storage order of the dense matrix
+void HypersparseMatrix<Type,SO>::build( const DenseMatrix<MT,SO2>& dm )
+{
+   const size_t m( SO ? (~dm).columns() : (~dm).rows() );
+   const size_t n( SO ? (~dm).rows() : (~dm).columns() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<m; ++k ) {
+      for( size_t l=0UL; l<n; ++l ) {
+         if( !isDefault( SO ? (~dm)(l,k) : (~dm)(k,l) ) )
+            ++nonzeros;
+      }
+   }
+
+   HypersparseMatrix tmp( (~dm).rows(), (~dm).columns(), nonzeros );
+
+   for( size_t k=0UL; k<m; ++k ) {
+      for( size_t l=0UL; l<n; ++l ) {
+         if( SO ) tmp.append( l, k, (~dm)(l,k), true );
+         else     tmp.append( k, l, (~dm)(k,l), true );
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Construction of the hypersparse matrix from a sparse matrix with the same storage order.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the sparse matrix
+void HypersparseMatrix<Type,SO>::build( const SparseMatrix<MT,SO>& sm )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t m( SO ? (~sm).columns() : (~sm).rows() );
+
+   HypersparseMatrix tmp( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() );
+
+   for( size_t k=0UL; k<m; ++k ) {
+      for( RhsIterator element=(~sm).begin(k); element!=(~sm).end(k); ++element ) {
+         if( SO ) tmp.append( element->index(), k, element->value() );
+         else     tmp.append( k, element->index(), element->value() );
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Construction of the hypersparse matrix from a sparse matrix with opposite storage order.
+//
+// \param sm The sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the sparse matrix
+void HypersparseMatrix<Type,SO>::build( const SparseMatrix<MT,!SO>& sm )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t n( SO ? (~sm).rows() : (~sm).columns() );
+
+   std::vector<Triplet> triplets( (~sm).nonZeros() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<n; ++l ) {
+      for( RhsIterator element=(~sm).begin(l); element!=(~sm).end(l); ++element, ++nonzeros ) {
+         triplets[nonzeros].major_ = element->index();
+         triplets[nonzeros].minor_ = l;
+         triplets[nonzeros].value_ = element->value();
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( nonzeros == triplets.size(), "Invalid number of non-zero elements" );
+
+   build( (~sm).rows(), (~sm).columns(), triplets );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Construction of the hypersparse matrix from a hypersparse matrix with the same storage
+//        order.
+//
+// \param sm The hypersparse matrix to be converted.
+// \return void
+//
+// In contrast to the construction from a general sparse matrix, this function only traverses
+// the non-empty rows/columns of the given matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the hypersparse matrix
+void HypersparseMatrix<Type,SO>::build( const HypersparseMatrix<Other,SO>& sm )
+{
+   typedef typename HypersparseMatrix<Other,SO>::ConstIterator  RhsIterator;
+
+   HypersparseMatrix tmp( sm.rows(), sm.columns(), sm.nonZeros() );
+
+   for( size_t k=0UL; k<sm.nonEmpty_; ++k ) {
+      const size_t i( sm.indices_[k] );
+      for( RhsIterator element=sm.nonEmptyBegin(k); element!=sm.nonEmptyEnd(k); ++element ) {
+         if( SO ) tmp.append( element->index(), i, element->value() );
+         else     tmp.append( i, element->index(), element->value() );
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Construction of the hypersparse matrix from a hypersparse matrix with opposite storage
+//        order.
+//
+// \param sm The hypersparse matrix to be converted.
+// \return void
+//
+// In contrast to the construction from a general sparse matrix, this function only traverses
+// the non-empty rows/columns of the given matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the hypersparse matrix
+void HypersparseMatrix<Type,SO>::build( const HypersparseMatrix<Other,!SO>& sm )
+{
+   typedef typename HypersparseMatrix<Other,!SO>::ConstIterator  RhsIterator;
+
+   std::vector<Triplet> triplets( sm.nonZeros() );
+
+   for( size_t k=0UL, l=0UL; k<sm.nonEmpty_; ++k ) {
+      for( RhsIterator element=sm.nonEmptyBegin(k); element!=sm.nonEmptyEnd(k); ++element, ++l ) {
+         triplets[l].major_ = element->index();
+         triplets[l].minor_ = sm.indices_[k];
+         triplets[l].value_ = element->value();
+      }
+   }
+
+   build( sm.rows(), sm.columns(), triplets );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Construction of the hypersparse matrix from a set of triplets.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param triplets The non-zero elements of the matrix, ordered by their minor index.
+// \return void
+//
+// This function sorts the given triplets according to their major index and builds the matrix
+// from the sorted triplets. Since the sorting algorithm is stable, the elements within each
+// row/column remain ordered by their minor index.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void HypersparseMatrix<Type,SO>::build( size_t m, size_t n, std::vector<Triplet>& triplets )
+{
+   typedef typename std::vector<Triplet>::const_iterator  TripletIterator;
+
+   std::stable_sort( triplets.begin(), triplets.end() );
+
+   HypersparseMatrix tmp( m, n, triplets.size() );
+
+   for( TripletIterator t=triplets.begin(); t!=triplets.end(); ++t ) {
+      if( SO ) tmp.append( t->minor_, t->major_, t->value_ );
+      else     tmp.append( t->major_, t->minor_, t->value_ );
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HYPERSPARSEMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name HypersparseMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( HypersparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void clear( HypersparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isDefault( const HypersparseMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( HypersparseMatrix<Type,SO>& a, HypersparseMatrix<Type,SO>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given hypersparse matrix.
+// \ingroup hypersparse_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void reset( HypersparseMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given hypersparse matrix.
+// \ingroup hypersparse_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void clear( HypersparseMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given hypersparse matrix is in default state.
+// \ingroup hypersparse_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const HypersparseMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two hypersparse matrices.
+// \ingroup hypersparse_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline void swap( HypersparseMatrix<Type,SO>& a, HypersparseMatrix<Type,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHYPERSPARSE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsHypersparse< HypersparseMatrix<T,SO> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< HypersparseMatrix<T1,SO>, T2 >
+{
+   typedef HypersparseMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< T1, HypersparseMatrix<T2,SO> >
+{
+   typedef HypersparseMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< HypersparseMatrix<T1,SO>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, HypersparseMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< HypersparseMatrix<T1,SO>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, HypersparseMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename A2 >
+struct MultTrait< HypersparseMatrix<T1,SO>, DynamicVector<T2,false,A2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, HypersparseMatrix<T2,SO> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< HypersparseMatrix<T1,SO>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true>, HypersparseMatrix<T2,SO> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< HypersparseMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, HypersparseMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< HypersparseMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, HypersparseMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename A2 >
+struct MultTrait< HypersparseMatrix<T1,SO1>, DynamicMatrix<T2,SO2,A2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, HypersparseMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename A2 >
+struct MultTrait< HypersparseMatrix<T1,SO1>, CompressedMatrix<T2,SO2,A2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO1,A1>, HypersparseMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< HypersparseMatrix<T1,SO1>, HypersparseMatrix<T2,SO2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,484 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/IndexIntersection.h
+//  \brief Header file for the sparse index intersection kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_INDEXINTERSECTION_H_
+#define _BLAZE_MATH_SPARSE_INDEXINTERSECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SplitIterator.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsPointer.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE INDEX INTERSECTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Ratio of the number of non-zero elements from which on galloping search is used.
+// \ingroup sparse
+//
+// In case the number of remaining non-zero elements of one sparse operand exceeds the number
+// of remaining non-zero elements of the other operand by this factor, the intersection of the
+// two index sets is computed by means of galloping (exponential) search instead of a merge.
+*/
+const size_t SPARSE_GALLOPING_RATIO = 16UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum ratio of the index range to the number of non-zero elements for block compares.
+// \ingroup sparse
+//
+// The SIMD block comparison of sparse index arrays (see the IndexBlock class template) is only
+// beneficial in case matches are rare. Therefore it is only used in case the remaining index
+// range of at least one sparse operand exceeds its number of remaining non-zero elements by
+// this factor, i.e. in case the density of the sparser operand does not exceed 12.5%. For denser
+// operands, the element-wise merge is used.
+*/
+const size_t SPARSE_BLOCK_SPREAD = 8UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Galloping search for the first sparse element with an index not less than \a index.
+// \ingroup sparse
+//
+// \param pos Iterator to the first element of the sorted range of sparse elements.
+// \param end Iterator one past the last element of the sorted range of sparse elements.
+// \param index The index to search for.
+// \return Iterator to the first element with an index not less than \a index, \a end otherwise.
+//
+// This function searches the range \f$ [pos..end) \f$ by means of exponentially growing steps
+// followed by a binary search within the last step. In contrast to a plain binary search over
+// the entire range, the number of comparisons is logarithmic in the distance between \a pos
+// and the result, which is beneficial for the repeated searches of an intersection. The given
+// iterators must provide random access to the sparse elements.
+*/
+template< typename Ptr >  // Type of the random access iterator to the sparse elements
+inline Ptr gallop( Ptr pos, Ptr end, size_t index )
+{
+   if( pos == end || pos->index() >= index )
+      return pos;
+
+   size_t step( 1UL );
+
+   while( step < size_t( end - pos ) && (pos+step)->index() < index ) {
+      pos  += step;
+      step *= 2UL;
+   }
+
+   Ptr first( pos+1 );
+   size_t count( ( step < size_t( end - pos ) ? pos+step : end ) - first );
+
+   while( count > 0UL ) {
+      const size_t half( count / 2UL );
+      if( (first+half)->index() < index ) {
+         first += half+1UL;
+         count -= half+1UL;
+      }
+      else count = half;
+   }
+
+   return first;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise SIMD comparison of contiguously stored sparse indices.
+// \ingroup sparse
+//
+// The IndexBlock class template compares a block of contiguously stored indices of one sparse
+// operand with a block of indices of another sparse operand. The template argument \a N is
+// the size of the index type in bytes. The \a size member specifies the number of indices per
+// block. The \a match() function returns a bit mask in which bit \a k is set in case the
+// \a k-th index of the first block is contained in the second block. The comparison of all
+// pairs of indices is performed via one vector comparison per rotation of the second block.
+// For index types without SIMD support, the block size is 1.
+*/
+template< size_t N >  // Size of the index type in bytes
+struct IndexBlock
+{
+   enum { size = 1 };
+
+   template< typename IT >  // Type of the indices
+   static BLAZE_ALWAYS_INLINE unsigned int match( const IT* l, const IT* r ) {
+      return ( *l == *r );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IndexBlock class template for 32-bit indices.
+// \ingroup sparse
+*/
+#if BLAZE_AVX2_MODE
+template<>
+struct IndexBlock<4UL>
+{
+   enum { size = 8 };
+
+   template< typename IT >  // Type of the indices
+   static BLAZE_ALWAYS_INLINE unsigned int match( const IT* l, const IT* r ) {
+      const __m256i rotate( _mm256_set_epi32( 0, 7, 6, 5, 4, 3, 2, 1 ) );
+      const __m256i a( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( l ) ) );
+      __m256i b( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( r ) ) );
+      __m256i m( _mm256_cmpeq_epi32( a, b ) );
+      for( size_t k=1UL; k<8UL; ++k ) {
+         b = _mm256_permutevar8x32_epi32( b, rotate );
+         m = _mm256_or_si256( m, _mm256_cmpeq_epi32( a, b ) );
+      }
+      return _mm256_movemask_ps( _mm256_castsi256_ps( m ) );
+   }
+};
+#elif BLAZE_SSE2_MODE
+template<>
+struct IndexBlock<4UL>
+{
+   enum { size = 4 };
+
+   template< typename IT >  // Type of the indices
+   static BLAZE_ALWAYS_INLINE unsigned int match( const IT* l, const IT* r ) {
+      const __m128i a( _mm_loadu_si128( reinterpret_cast<const __m128i*>( l ) ) );
+      __m128i b( _mm_loadu_si128( reinterpret_cast<const __m128i*>( r ) ) );
+      __m128i m( _mm_cmpeq_epi32( a, b ) );
+      b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+      m = _mm_or_si128( m, _mm_cmpeq_epi32( a, b ) );
+      b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+      m = _mm_or_si128( m, _mm_cmpeq_epi32( a, b ) );
+      b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+      m = _mm_or_si128( m, _mm_cmpeq_epi32( a, b ) );
+      return _mm_movemask_ps( _mm_castsi128_ps( m ) );
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IndexBlock class template for 64-bit indices.
+// \ingroup sparse
+*/
+#if BLAZE_AVX2_MODE
+template<>
+struct IndexBlock<8UL>
+{
+   enum { size = 4 };
+
+   template< typename IT >  // Type of the indices
+   static BLAZE_ALWAYS_INLINE unsigned int match( const IT* l, const IT* r ) {
+      const __m256i a( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( l ) ) );
+      __m256i b( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( r ) ) );
+      __m256i m( _mm256_cmpeq_epi64( a, b ) );
+      b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+      m = _mm256_or_si256( m, _mm256_cmpeq_epi64( a, b ) );
+      b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+      m = _mm256_or_si256( m, _mm256_cmpeq_epi64( a, b ) );
+      b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+      m = _mm256_or_si256( m, _mm256_cmpeq_epi64( a, b ) );
+      return _mm256_movemask_pd( _mm256_castsi256_pd( m ) );
+   }
+};
+#elif BLAZE_SSE4_MODE
+template<>
+struct IndexBlock<8UL>
+{
+   enum { size = 2 };
+
+   template< typename IT >  // Type of the indices
+   static BLAZE_ALWAYS_INLINE unsigned int match( const IT* l, const IT* r ) {
+      const __m128i a( _mm_loadu_si128( reinterpret_cast<const __m128i*>( l ) ) );
+      const __m128i b( _mm_loadu_si128( reinterpret_cast<const __m128i*>( r ) ) );
+      const __m128i m( _mm_or_si128( _mm_cmpeq_epi64( a, b ),
+                                     _mm_cmpeq_epi64( a, _mm_shuffle_epi32( b, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) ) );
+      return _mm_movemask_pd( _mm_castsi128_pd( m ) );
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Advancing two sparse iterators to the next pair of elements with identical indices.
+// \ingroup sparse
+//
+// \param l Iterator to the current element of the left-hand side sparse operand.
+// \param lend Iterator one past the last element of the left-hand side sparse operand.
+// \param r Iterator to the current element of the right-hand side sparse operand.
+// \param rend Iterator one past the last element of the right-hand side sparse operand.
+// \return \a true in case a pair of elements with identical indices is found, \a false if not.
+//
+// This function advances the two given iterators until both refer to elements with the same
+// index. In case no such pair of elements exists, the function returns \a false. The default
+// implementation for general sparse iterators performs a plain merge of the two index sets.
+*/
+template< typename IT1    // Type of the left-hand side iterator
+        , typename IT2 >  // Type of the right-hand side iterator
+inline typename EnableIf< Not< And< IsPointer<IT1>, IsPointer<IT2> > >, bool >::Type
+   nextMatch( IT1& l, IT1 lend, IT2& r, IT2 rend )
+{
+   for( ; l != lend && r != rend; ++l )
+   {
+      const size_t li( l->index() );
+
+      while( r->index() < li ) {
+         if( ++r == rend ) return false;
+      }
+
+      if( r->index() == li ) return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Advancing two sparse iterators to the next pair of elements with identical indices.
+// \ingroup sparse
+//
+// \param l Pointer to the current element of the left-hand side sparse operand.
+// \param lend Pointer one past the last element of the left-hand side sparse operand.
+// \param r Pointer to the current element of the right-hand side sparse operand.
+// \param rend Pointer one past the last element of the right-hand side sparse operand.
+// \return \a true in case a pair of elements with identical indices is found, \a false if not.
+//
+// This function is the implementation of the intersection kernel for contiguously stored sparse
+// elements (as for instance the elements of CompressedVector and CompressedMatrix). In case the
+// number of remaining elements of both operands is of the same order, both pointers are advanced
+// by means of a branch-free merge step. Otherwise the elements of the shorter operand are looked
+// up in the longer operand via galloping search.
+*/
+template< typename IT1    // Type of the left-hand side pointer
+        , typename IT2 >  // Type of the right-hand side pointer
+inline typename EnableIf< And< IsPointer<IT1>, IsPointer<IT2> >, bool >::Type
+   nextMatch( IT1& l, IT1 lend, IT2& r, IT2 rend )
+{
+   const size_t lsize( lend - l );
+   const size_t rsize( rend - r );
+
+   if( lsize * SPARSE_GALLOPING_RATIO < rsize ) {
+      for( ; l!=lend; ++l ) {
+         r = gallop( r, rend, l->index() );
+         if( r == rend ) return false;
+         if( r->index() == l->index() ) return true;
+      }
+      return false;
+   }
+   else if( rsize * SPARSE_GALLOPING_RATIO < lsize ) {
+      for( ; r!=rend; ++r ) {
+         l = gallop( l, lend, r->index() );
+         if( l == lend ) return false;
+         if( l->index() == r->index() ) return true;
+      }
+      return false;
+   }
+
+   while( l != lend && r != rend ) {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+      if( li == ri ) return true;
+      l += ( li < ri );
+      r += ( ri < li );
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise advancing of two split storage iterators to the next pair of elements with
+//        identical indices.
+// \ingroup sparse
+//
+// \param l Iterator to the current element of the left-hand side sparse operand.
+// \param lend Iterator one past the last element of the left-hand side sparse operand.
+// \param r Iterator to the current element of the right-hand side sparse operand.
+// \param rend Iterator one past the last element of the right-hand side sparse operand.
+// \return \a true in case a pair of elements with identical indices is found, \a false if not.
+//
+// This function compares the index arrays of the two operands block-wise via SIMD operations
+// (see the IndexBlock class template). In case a block of the left-hand side operand does not
+// share an index with the current block of the right-hand side operand, the block with the
+// smaller last index is skipped entirely. In case less than a full block of elements remains
+// in one of the operands, the function returns \a false and the remaining elements have to be
+// merged element-wise. The function is never inlined and works on copies of the iterators of
+// the nextMatch() function. Otherwise the element-wise merge of dense operands is slowed down,
+// even though the block comparison is not used for them.
+*/
+template< typename T1    // Type of the values of the left-hand side operand
+        , typename T2    // Type of the values of the right-hand side operand
+        , typename IT >  // Type of the indices of both operands
+BLAZE_NEVER_INLINE bool nextBlockMatch( SplitIterator<T1,IT>& l, SplitIterator<T1,IT> lend,
+                                        SplitIterator<T2,IT>& r, SplitIterator<T2,IT> rend )
+{
+   typedef IndexBlock<sizeof(IT)>  Block;
+
+   const ptrdiff_t blocksize( Block::size );
+
+   while( lend - l >= blocksize && rend - r >= blocksize )
+   {
+      const IT* const lindices( l.indices() );
+      const IT* const rindices( r.indices() );
+      const unsigned int mask( Block::match( lindices, rindices ) );
+
+      if( mask != 0U ) {
+         ptrdiff_t k( 0 );
+         while( !( mask & ( 1U << k ) ) ) ++k;
+         l += k;
+         while( r->index() < l->index() ) ++r;
+         return true;
+      }
+
+      const IT lmax( lindices[blocksize-1] );
+      const IT rmax( rindices[blocksize-1] );
+      if( lmax <= rmax ) l += blocksize;
+      if( rmax <= lmax ) r += blocksize;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Advancing two sparse iterators to the next pair of elements with identical indices.
+// \ingroup sparse
+//
+// \param l Iterator to the current element of the left-hand side sparse operand.
+// \param lend Iterator one past the last element of the left-hand side sparse operand.
+// \param r Iterator to the current element of the right-hand side sparse operand.
+// \param rend Iterator one past the last element of the right-hand side sparse operand.
+// \return \a true in case a pair of elements with identical indices is found, \a false if not.
+//
+// This function is the implementation of the intersection kernel for sparse operands with split
+// storage (as for instance SplitCompressedVector and SplitCompressedMatrix), which store their
+// indices in a separate, contiguous array. In case the number of remaining elements of both
+// operands is of the same order and at least one operand is sufficiently sparse (see
+// SPARSE_BLOCK_SPREAD), the index arrays are compared block-wise via SIMD operations (see the
+// IndexBlock class template): In case a block of the left-hand side operand does not share an
+// index with the current block of the right-hand side operand, the block with the smaller last
+// index is skipped entirely. The remaining elements are merged element-wise.
+// In case the numbers of remaining elements differ considerably, the elements of the shorter
+// operand are looked up in the longer operand via galloping search.
+*/
+template< typename T1    // Type of the values of the left-hand side operand
+        , typename T2    // Type of the values of the right-hand side operand
+        , typename IT >  // Type of the indices of both operands
+inline bool nextMatch( SplitIterator<T1,IT>& l, SplitIterator<T1,IT> lend,
+                       SplitIterator<T2,IT>& r, SplitIterator<T2,IT> rend )
+{
+   const size_t lsize( lend - l );
+   const size_t rsize( rend - r );
+
+   if( lsize * SPARSE_GALLOPING_RATIO < rsize ) {
+      for( ; l!=lend; ++l ) {
+         r = gallop( r, rend, l->index() );
+         if( r == rend ) return false;
+         if( r->index() == l->index() ) return true;
+      }
+      return false;
+   }
+   else if( rsize * SPARSE_GALLOPING_RATIO < lsize ) {
+      for( ; r!=rend; ++r ) {
+         l = gallop( l, lend, r->index() );
+         if( l == lend ) return false;
+         if( l->index() == r->index() ) return true;
+      }
+      return false;
+   }
+
+   if( IndexBlock<sizeof(IT)>::size > 1 && lsize > 0UL && rsize > 0UL &&
+       ( lsize * SPARSE_BLOCK_SPREAD <= (lend-1)->index() - l->index() + 1UL ||
+         rsize * SPARSE_BLOCK_SPREAD <= (rend-1)->index() - r->index() + 1UL ) )
+   {
+      SplitIterator<T1,IT> lpos( l );
+      SplitIterator<T2,IT> rpos( r );
+      const bool match( nextBlockMatch( lpos, lend, rpos, rend ) );
+      l = lpos;
+      r = rpos;
+      if( match ) return true;
+   }
+
+   while( l != lend && r != rend ) {
+      const size_t li( l->index() );
+      const size_t ri( r->index() );
+      if( li == ri ) return true;
+      l += ( li < ri );
+      r += ( ri < li );
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,953 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for the bandwidth-reducing reordering of sparse matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ADJACENCYGRAPH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symmetric adjacency structure of the sparsity pattern of a square sparse matrix.
+// \ingroup sparse_matrix
+//
+// The AdjacencyGraph class represents the undirected graph of the structure of \f$ A + A^T \f$
+// of a square sparse matrix \f$ A \f$ (without self loops), stored in compressed form. It is
+// the auxiliary data structure for the reverse Cuthill-McKee and nested dissection orderings.
+// Each vertex is assigned to a part; all graph traversals are restricted to the vertices of
+// a single part, which enables the recursive bisection of the nested dissection algorithm.
+*/
+class AdjacencyGraph
+{
+ public:
+   //**Constructor*********************************************************************************
+   template< typename MT, bool SO >
+   explicit inline AdjacencyGraph( const SparseMatrix<MT,SO>& sm );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline size_t size  () const;
+   inline size_t degree( size_t v ) const;
+   inline size_t part  ( size_t v ) const;
+   inline void   assign( size_t v, size_t p );
+   inline size_t begin ( size_t v ) const;
+   inline size_t end   ( size_t v ) const;
+   inline size_t vertex( size_t k ) const;
+
+   inline size_t levelStructure( size_t root, std::vector<size_t>& order, std::vector<size_t>& levels );
+   inline size_t peripheralVertex( size_t start, std::vector<size_t>& order, std::vector<size_t>& levels );
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::vector<size_t> offsets_;    //!< Offsets of the adjacency lists of all vertices.
+   std::vector<size_t> adjacency_;  //!< The concatenated adjacency lists.
+   std::vector<size_t> parts_;      //!< The part each vertex is currently assigned to.
+   std::vector<size_t> marker_;     //!< Visitation stamps of the current traversal.
+   size_t stamp_;                   //!< The stamp of the current traversal.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the AdjacencyGraph class.
+//
+// \param sm The square sparse matrix whose sparsity pattern defines the graph.
+//
+// All vertices are initially assigned to part 0.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline AdjacencyGraph::AdjacencyGraph( const SparseMatrix<MT,SO>& sm )
+   : offsets_  ( (~sm).rows()+1UL, 0UL )  // Offsets of the adjacency lists of all vertices
+   , adjacency_()                         // The concatenated adjacency lists
+   , parts_    ( (~sm).rows(), 0UL )      // The part each vertex is currently assigned to
+   , marker_   ( (~sm).rows(), 0UL )      // Visitation stamps of the current traversal
+   , stamp_    ( 0UL )                    // The stamp of the current traversal
+{
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( (~sm).rows() == (~sm).columns(), "Non-square matrix detected" );
+
+   CT A( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t n( A.rows() );
+
+   // Counting the entries of A and A^T per vertex (the transpose pattern yields the same
+   // graph for both storage orders)
+   for( size_t i=0UL; i<n; ++i ) {
+      const ConstIterator end( A.end( i ) );
+      for( ConstIterator element=A.begin( i ); element!=end; ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            ++offsets_[i+1UL];
+            ++offsets_[j+1UL];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      offsets_[i+1UL] += offsets_[i];
+   }
+
+   // Scattering both directions of every edge
+   std::vector<size_t> pos( offsets_.begin(), offsets_.end()-1 );
+   adjacency_.resize( offsets_[n] );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const ConstIterator end( A.end( i ) );
+      for( ConstIterator element=A.begin( i ); element!=end; ++element ) {
+         const size_t j( element->index() );
+         if( i != j ) {
+            adjacency_[pos[i]++] = j;
+            adjacency_[pos[j]++] = i;
+         }
+      }
+   }
+
+   // Removing duplicate edges (i.e. entries present in both A and A^T) in place
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t first( offsets_[i] );
+      const size_t last ( offsets_[i+1UL] );
+      offsets_[i] = k;
+      ++stamp_;
+
+      for( size_t l=first; l<last; ++l ) {
+         const size_t j( adjacency_[l] );
+         if( marker_[j] != stamp_ ) {
+            marker_[j] = stamp_;
+            adjacency_[k++] = j;
+         }
+      }
+   }
+
+   offsets_[n] = k;
+   adjacency_.resize( k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of vertices of the graph.
+//
+// \return The number of vertices.
+*/
+inline size_t AdjacencyGraph::size() const
+{
+   return parts_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the degree of the given vertex.
+//
+// \param v The index of the vertex.
+// \return The number of neighbors of the vertex.
+*/
+inline size_t AdjacencyGraph::degree( size_t v ) const
+{
+   BLAZE_INTERNAL_ASSERT( v < size(), "Invalid vertex access index" );
+   return offsets_[v+1UL] - offsets_[v];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the part the given vertex is assigned to.
+//
+// \param v The index of the vertex.
+// \return The part of the vertex.
+*/
+inline size_t AdjacencyGraph::part( size_t v ) const
+{
+   BLAZE_INTERNAL_ASSERT( v < size(), "Invalid vertex access index" );
+   return parts_[v];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assigns the given vertex to the given part.
+//
+// \param v The index of the vertex.
+// \param p The new part of the vertex.
+// \return void
+*/
+inline void AdjacencyGraph::assign( size_t v, size_t p )
+{
+   BLAZE_INTERNAL_ASSERT( v < size(), "Invalid vertex access index" );
+   parts_[v] = p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offset of the first neighbor of the given vertex.
+//
+// \param v The index of the vertex.
+// \return Offset of the first neighbor.
+*/
+inline size_t AdjacencyGraph::begin( size_t v ) const
+{
+   BLAZE_INTERNAL_ASSERT( v < size(), "Invalid vertex access index" );
+   return offsets_[v];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offset one past the last neighbor of the given vertex.
+//
+// \param v The index of the vertex.
+// \return Offset one past the last neighbor.
+*/
+inline size_t AdjacencyGraph::end( size_t v ) const
+{
+   BLAZE_INTERNAL_ASSERT( v < size(), "Invalid vertex access index" );
+   return offsets_[v+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the neighbor stored at the given offset.
+//
+// \param k The offset within the concatenated adjacency lists.
+// \return The index of the neighboring vertex.
+*/
+inline size_t AdjacencyGraph::vertex( size_t k ) const
+{
+   BLAZE_INTERNAL_ASSERT( k < adjacency_.size(), "Invalid adjacency access index" );
+   return adjacency_[k];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the rooted level structure of the given vertex.
+//
+// \param root The root vertex of the level structure.
+// \param order The vertices reachable from the root within its part, in breadth-first order.
+// \param levels The offsets of the levels within \a order.
+// \return The number of levels (i.e. the eccentricity of the root plus one).
+//
+// The breadth-first search is restricted to the vertices of the part of the given root.
+*/
+inline size_t AdjacencyGraph::levelStructure( size_t root, std::vector<size_t>& order,
+                                              std::vector<size_t>& levels )
+{
+   BLAZE_INTERNAL_ASSERT( root < size(), "Invalid vertex access index" );
+
+   const size_t p( parts_[root] );
+
+   order.clear();
+   levels.clear();
+   ++stamp_;
+
+   order.push_back( root );
+   marker_[root] = stamp_;
+   levels.push_back( 0UL );
+
+   size_t head( 0UL );
+
+   while( head < order.size() )
+   {
+      const size_t tail( order.size() );
+
+      for( ; head<tail; ++head ) {
+         const size_t v( order[head] );
+         for( size_t k=offsets_[v]; k<offsets_[v+1UL]; ++k ) {
+            const size_t w( adjacency_[k] );
+            if( marker_[w] != stamp_ && parts_[w] == p ) {
+               marker_[w] = stamp_;
+               order.push_back( w );
+            }
+         }
+      }
+
+      levels.push_back( tail );
+   }
+
+   return levels.size() - 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finds a pseudo-peripheral vertex in the connected component of the given vertex.
+//
+// \param start The starting vertex of the search.
+// \param order The breadth-first order of the level structure of the returned vertex.
+// \param levels The level offsets of the level structure of the returned vertex.
+// \return The pseudo-peripheral vertex.
+//
+// This function implements the algorithm by Gibbs, Poole, and Stockmeyer in the formulation of
+// George and Liu: Starting from \a start, the level structure is repeatedly rebuilt from the
+// vertex of minimum degree in the last level until the eccentricity stops growing. On return,
+// \a order and \a levels contain the level structure rooted at the returned vertex.
+*/
+inline size_t AdjacencyGraph::peripheralVertex( size_t start, std::vector<size_t>& order,
+                                                std::vector<size_t>& levels )
+{
+   size_t root ( start );
+   size_t depth( levelStructure( root, order, levels ) );
+
+   while( true )
+   {
+      size_t candidate( order[levels[depth-1UL]] );
+
+      for( size_t k=levels[depth-1UL]+1UL; k<levels[depth]; ++k ) {
+         if( degree( order[k] ) < degree( candidate ) )
+            candidate = order[k];
+      }
+
+      if( candidate == root )
+         break;
+
+      std::vector<size_t> order2, levels2;
+      const size_t depth2( levelStructure( candidate, order2, levels2 ) );
+
+      if( depth2 <= depth )
+         break;
+
+      root  = candidate;
+      depth = depth2;
+      order.swap( order2 );
+      levels.swap( levels2 );
+   }
+
+   return root;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Comparison functor for the ordering of vertices by increasing degree.
+//
+// Ties are broken by the vertex index to guarantee a deterministic ordering.
+*/
+struct DegreeLess
+{
+   explicit inline DegreeLess( const AdjacencyGraph& graph ) : graph_( graph ) {}
+
+   inline bool operator()( size_t v, size_t w ) const {
+      const size_t dv( graph_.degree( v ) );
+      const size_t dw( graph_.degree( w ) );
+      return ( dv < dw ) || ( dv == dw && v < w );
+   }
+
+   const AdjacencyGraph& graph_;  //!< The graph providing the vertex degrees.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse matrix reordering functions */
+//@{
+template< typename MT, bool SO >
+size_t bandwidth( const SparseMatrix<MT,SO>& sm );
+
+template< typename MT, bool SO >
+void reverseCuthillMcKee( const SparseMatrix<MT,SO>& sm, std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+void nestedDissection( const SparseMatrix<MT,SO>& sm, std::vector<size_t>& perm, size_t minSize = 64UL );
+
+template< typename MT, bool SO >
+const CompressedMatrix<typename MT::ElementType,SO>
+   permute( const SparseMatrix<MT,SO>& sm, const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+const CompressedMatrix<typename MT::ElementType,SO>
+   permute( const SparseMatrix<MT,SO>& sm, const std::vector<size_t>& rowPerm,
+            const std::vector<size_t>& colPerm );
+
+template< typename VT, bool TF >
+const DynamicVector<typename VT::ElementType,TF>
+   permute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+const DynamicVector<typename VT::ElementType,TF>
+   unpermute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the bandwidth of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \return The largest distance \f$ |i-j| \f$ of a non-zero element from the diagonal.
+//
+// This function returns the bandwidth of the given sparse matrix, i.e. the largest distance of
+// any non-zero element \f$ a_{ij} \f$ from the diagonal. It can be used to assess the quality
+// of a bandwidth-reducing reordering (see reverseCuthillMcKee()).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+size_t bandwidth( const SparseMatrix<MT,SO>& sm )
+{
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  ConstIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t index( ( SO == rowMajor )?( A.rows() ):( A.columns() ) );
+
+   size_t width( 0UL );
+
+   for( size_t i=0UL; i<index; ++i ) {
+      const ConstIterator end( A.end( i ) );
+      for( ConstIterator element=A.begin( i ); element!=end; ++element ) {
+         const size_t j( element->index() );
+         const size_t distance( ( i < j )?( j - i ):( i - j ) );
+         if( distance > width )
+            width = distance;
+      }
+   }
+
+   return width;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the reverse Cuthill-McKee ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given square sparse matrix.
+// \param perm The resulting permutation vector.
+// \return void
+// \exception std::invalid_argument Non-square matrix detected.
+//
+// This function computes a bandwidth-reducing symmetric ordering of the given square sparse
+// matrix by means of the reverse Cuthill-McKee algorithm. The ordering is based on the
+// structure of \f$ A + A^T \f$, i.e. unsymmetric matrices are treated as if they were
+// structurally symmetric. Each connected component is traversed breadth-first, starting
+// from a pseudo-peripheral vertex and visiting the neighbors of each vertex by increasing
+// degree, and the resulting order is reversed. The permutation is returned in \a perm in
+// the "new-to-old" convention: \a perm[i] is the index of the row/column of the original
+// matrix that becomes row/column \a i of the reordered matrix. The reordered matrix can be
+// computed by the permute() function:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Initialization
+
+   std::vector<size_t> perm;
+   reverseCuthillMcKee( A, perm );
+
+   const blaze::CompressedMatrix<double> B( permute( A, perm ) );  // B = P*A*trans(P)
+   y = unpermute( B * permute( x, perm ), perm );                  // y = A*x
+   \endcode
+
+// Since the non-zero elements of the reordered matrix are clustered around the diagonal, the
+// accesses to the dense vector operand of a sparse matrix/dense vector multiplication exhibit
+// a considerably better cache reuse. In case the given matrix is not square, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void reverseCuthillMcKee( const SparseMatrix<MT,SO>& sm, std::vector<size_t>& perm )
+{
+   if( (~sm).rows() != (~sm).columns() )
+      throw std::invalid_argument( "Non-square matrix detected" );
+
+   AdjacencyGraph graph( ~sm );
+
+   const size_t n( graph.size() );
+
+   perm.clear();
+   perm.reserve( n );
+
+   // Visiting the connected components starting from the vertices of smallest degree
+   std::vector<size_t> vertices( n );
+   for( size_t v=0UL; v<n; ++v )
+      vertices[v] = v;
+   std::sort( vertices.begin(), vertices.end(), DegreeLess( graph ) );
+
+   const size_t numbered( n );  // Part of all vertices that have already been numbered
+   std::vector<size_t> order, levels;
+
+   for( size_t s=0UL; s<n; ++s )
+   {
+      if( graph.part( vertices[s] ) == numbered )
+         continue;
+
+      const size_t root( graph.peripheralVertex( vertices[s], order, levels ) );
+
+      // Cuthill-McKee breadth-first numbering of the connected component
+      size_t head( perm.size() );
+      perm.push_back( root );
+      graph.assign( root, numbered );
+
+      for( ; head<perm.size(); ++head )
+      {
+         const size_t v( perm[head] );
+         const size_t first( perm.size() );
+
+         for( size_t k=graph.begin( v ); k<graph.end( v ); ++k ) {
+            const size_t w( graph.vertex( k ) );
+            if( graph.part( w ) != numbered ) {
+               graph.assign( w, numbered );
+               perm.push_back( w );
+            }
+         }
+
+         std::sort( perm.begin()+first, perm.end(), DegreeLess( graph ) );
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid number of numbered vertices" );
+
+   std::reverse( perm.begin(), perm.end() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recursive backend of the nested dissection ordering.
+// \ingroup sparse_matrix
+//
+// \param graph The adjacency graph of the matrix.
+// \param vertices The vertices of the current part (all assigned to the same part).
+// \param nextPart The next unused part index.
+// \param minSize The size below which parts are not dissected any further.
+// \param perm The permutation vector to be extended.
+// \return void
+//
+// The connected components of the given part are handled one after another. Each component
+// that is larger than \a minSize is split by the level of its pseudo-peripheral level structure
+// that best balances the two halves. The halves are ordered first (recursively), followed by
+// the separator level. Smaller components are numbered in breadth-first order.
+*/
+inline void nestedDissection( AdjacencyGraph& graph, std::vector<size_t>& vertices,
+                              size_t& nextPart, size_t minSize, std::vector<size_t>& perm )
+{
+   const size_t separated( ~size_t( 0UL ) );  // Part of all vertices that have been numbered
+   std::vector<size_t> order, levels;
+
+   for( size_t s=0UL; s<vertices.size(); ++s )
+   {
+      if( graph.part( vertices[s] ) == separated )
+         continue;
+
+      graph.peripheralVertex( vertices[s], order, levels );
+      const size_t depth( levels.size() - 1UL );
+
+      // Numbering of small or non-separable components in breadth-first order
+      if( order.size() <= minSize || depth < 3UL ) {
+         for( size_t k=0UL; k<order.size(); ++k ) {
+            graph.assign( order[k], separated );
+            perm.push_back( order[k] );
+         }
+         continue;
+      }
+
+      // Selection of the separator level that balances the two halves
+      size_t sep( 1UL );
+      while( sep+2UL < depth && 2UL*levels[sep+1UL] < order.size() )
+         ++sep;
+
+      const size_t lowerPart( nextPart++ );
+      const size_t upperPart( nextPart++ );
+
+      std::vector<size_t> lower( order.begin(), order.begin()+levels[sep] );
+      std::vector<size_t> upper( order.begin()+levels[sep+1UL], order.end() );
+      std::vector<size_t> separator( order.begin()+levels[sep], order.begin()+levels[sep+1UL] );
+
+      for( size_t k=0UL; k<lower.size(); ++k )
+         graph.assign( lower[k], lowerPart );
+      for( size_t k=0UL; k<upper.size(); ++k )
+         graph.assign( upper[k], upperPart );
+      for( size_t k=0UL; k<separator.size(); ++k )
+         graph.assign( separator[k], separated );
+
+      nestedDissection( graph, lower, nextPart, minSize, perm );
+      nestedDissection( graph, upper, nextPart, minSize, perm );
+
+      perm.insert( perm.end(), separator.begin(), separator.end() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a nested dissection ordering of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given square sparse matrix.
+// \param perm The resulting permutation vector.
+// \param minSize The size below which subgraphs are not dissected any further.
+// \return void
+// \exception std::invalid_argument Non-square matrix detected.
+//
+// This function computes a fill-reducing symmetric ordering of the given square sparse matrix
+// by means of a simple nested dissection algorithm based on the structure of \f$ A + A^T \f$.
+// Each connected component is recursively bisected by a level of the level structure rooted
+// at a pseudo-peripheral vertex. The two halves are numbered first, followed by the separator,
+// such that the reordered matrix exhibits the bordered block-diagonal form that is favorable
+// for sparse factorizations and for the parallel processing of independent blocks. Subgraphs
+// with at most \a minSize vertices are numbered in breadth-first order. As for the
+// reverseCuthillMcKee() function, the permutation is returned in the "new-to-old" convention
+// and can be applied via the permute() function. In case the given matrix is not square, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void nestedDissection( const SparseMatrix<MT,SO>& sm, std::vector<size_t>& perm, size_t minSize )
+{
+   if( (~sm).rows() != (~sm).columns() )
+      throw std::invalid_argument( "Non-square matrix detected" );
+
+   AdjacencyGraph graph( ~sm );
+
+   const size_t n( graph.size() );
+
+   perm.clear();
+   perm.reserve( n );
+
+   std::vector<size_t> vertices( n );
+   for( size_t v=0UL; v<n; ++v )
+      vertices[v] = v;
+   std::sort( vertices.begin(), vertices.end(), DegreeLess( graph ) );
+
+   size_t nextPart( 1UL );
+   nestedDissection( graph, vertices, nextPart, minSize, perm );
+
+   BLAZE_INTERNAL_ASSERT( perm.size() == n, "Invalid number of numbered vertices" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inverse of the given permutation vector.
+// \ingroup sparse_matrix
+//
+// \param perm The permutation vector.
+// \param n The expected size of the permutation.
+// \param inv The resulting inverse permutation.
+// \return void
+// \exception std::invalid_argument Invalid permutation vector.
+*/
+inline void invertPermutation( const std::vector<size_t>& perm, size_t n, std::vector<size_t>& inv )
+{
+   if( perm.size() != n )
+      throw std::invalid_argument( "Invalid permutation vector" );
+
+   inv.assign( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( perm[i] >= n || inv[perm[i]] != n )
+         throw std::invalid_argument( "Invalid permutation vector" );
+      inv[perm[i]] = i;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the given square sparse matrix (\f$ P A P^T \f$).
+// \ingroup sparse_matrix
+//
+// \param sm The given square sparse matrix.
+// \param perm The permutation vector in "new-to-old" convention.
+// \return The permuted sparse matrix.
+// \exception std::invalid_argument Invalid permutation vector.
+//
+// This function returns the symmetrically permuted matrix \f$ B = P A P^T \f$, i.e. the
+// matrix with \f$ b_{ij} = a_{perm[i],perm[j]} \f$. In contrast to the multiplication with
+// explicit permutation matrices, the permuted matrix is computed by two linear bucket passes
+// over the non-zero elements without any sorting or element insertion. In case \a perm is not
+// a valid permutation of the rows and columns of the given matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+const CompressedMatrix<typename MT::ElementType,SO>
+   permute( const SparseMatrix<MT,SO>& sm, const std::vector<size_t>& perm )
+{
+   return permute( ~sm, perm, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the rows and columns of the given sparse matrix (\f$ P A Q^T \f$).
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \param rowPerm The row permutation vector in "new-to-old" convention.
+// \param colPerm The column permutation vector in "new-to-old" convention.
+// \return The permuted sparse matrix.
+// \exception std::invalid_argument Invalid permutation vector.
+//
+// This function returns the permuted matrix \f$ B = P A Q^T \f$, i.e. the matrix with
+// \f$ b_{ij} = a_{rowPerm[i],colPerm[j]} \f$. In case \a rowPerm is not a valid permutation
+// of the rows or \a colPerm is not a valid permutation of the columns of the given matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+const CompressedMatrix<typename MT::ElementType,SO>
+   permute( const SparseMatrix<MT,SO>& sm, const std::vector<size_t>& rowPerm,
+            const std::vector<size_t>& colPerm )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  ConstIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+
+   const std::vector<size_t>& majorPerm( ( SO == rowMajor )?( rowPerm ):( colPerm ) );
+   const std::vector<size_t>& minorPerm( ( SO == rowMajor )?( colPerm ):( rowPerm ) );
+   const size_t majors( ( SO == rowMajor )?( m ):( n ) );
+   const size_t minors( ( SO == rowMajor )?( n ):( m ) );
+
+   // Validation of both permutations; only the inverse minor permutation is required
+   std::vector<size_t> inv;
+   invertPermutation( majorPerm, majors, inv );
+   invertPermutation( minorPerm, minors, inv );
+
+   // First pass: bucketing all elements by their new minor index, which orders each
+   // bucket by the new major index
+   std::vector<size_t> majorOffsets( majors+1UL, 0UL );
+   std::vector<size_t> minorOffsets( minors+1UL, 0UL );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      const ConstIterator end( A.end( majorPerm[i] ) );
+      for( ConstIterator element=A.begin( majorPerm[i] ); element!=end; ++element ) {
+         ++majorOffsets[i+1UL];
+         ++minorOffsets[inv[element->index()]+1UL];
+      }
+   }
+
+   for( size_t i=0UL; i<majors; ++i )
+      majorOffsets[i+1UL] += majorOffsets[i];
+   for( size_t j=0UL; j<minors; ++j )
+      minorOffsets[j+1UL] += minorOffsets[j];
+
+   const size_t nonzeros( majorOffsets[majors] );
+
+   std::vector<size_t> buckets( nonzeros );
+   std::vector<ET>     values ( nonzeros );
+
+   for( size_t i=0UL; i<majors; ++i ) {
+      const ConstIterator end( A.end( majorPerm[i] ) );
+      for( ConstIterator element=A.begin( majorPerm[i] ); element!=end; ++element ) {
+         const size_t k( minorOffsets[inv[element->index()]]++ );
+         buckets[k] = i;
+         values[k]  = element->value();
+      }
+   }
+
+   // Second pass: redistributing the buckets by their new major index, which orders each
+   // row/column of the result by the new minor index
+   std::vector<size_t> indices( nonzeros );
+   std::vector<ET>     sorted ( nonzeros );
+
+   for( size_t j=0UL, k=0UL; j<minors; ++j ) {
+      for( ; k<minorOffsets[j]; ++k ) {
+         const size_t l( majorOffsets[buckets[k]]++ );
+         indices[l] = j;
+         sorted[l]  = values[k];
+      }
+   }
+
+   // Assembling the result in a single allocation
+   CompressedMatrix<ET,SO> B( m, n );
+   B.reserve( nonzeros );
+
+   for( size_t i=0UL, k=0UL; i<majors; ++i ) {
+      for( ; k<majorOffsets[i]; ++k ) {
+         if( SO == rowMajor )
+            B.append( i, indices[k], sorted[k] );
+         else
+            B.append( indices[k], i, sorted[k] );
+      }
+      B.finalize( i );
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the given dense vector.
+// \ingroup sparse_matrix
+//
+// \param dv The given dense vector.
+// \param perm The permutation vector in "new-to-old" convention.
+// \return The permuted dense vector \f$ y = P x \f$ with \f$ y_i = x_{perm[i]} \f$.
+// \exception std::invalid_argument Invalid permutation vector.
+//
+// This function permutes the given dense vector consistently with the permute() function for
+// sparse matrices. In case \a perm is not a valid permutation of the given vector, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const DynamicVector<typename VT::ElementType,TF>
+   permute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm )
+{
+   typedef typename VT::CompositeType  CT;
+
+   CT x( ~dv );  // Evaluation of the dense vector operand
+
+   const size_t n( x.size() );
+
+   std::vector<size_t> inv;
+   invertPermutation( perm, n, inv );
+
+   DynamicVector<typename VT::ElementType,TF> y( n );
+
+   for( size_t i=0UL; i<n; ++i )
+      y[i] = x[perm[i]];
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverse permutation of the given dense vector.
+// \ingroup sparse_matrix
+//
+// \param dv The given dense vector.
+// \param perm The permutation vector in "new-to-old" convention.
+// \return The unpermuted dense vector \f$ y = P^T x \f$ with \f$ y_{perm[i]} = x_i \f$.
+// \exception std::invalid_argument Invalid permutation vector.
+//
+// This function reverts the effect of the permute() function for dense vectors, i.e. it maps
+// the result of a computation with a permuted matrix back to the original ordering. In case
+// \a perm is not a valid permutation of the given vector, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const DynamicVector<typename VT::ElementType,TF>
+   unpermute( const DenseVector<VT,TF>& dv, const std::vector<size_t>& perm )
+{
+   typedef typename VT::CompositeType  CT;
+
+   CT x( ~dv );  // Evaluation of the dense vector operand
+
+   const size_t n( x.size() );
+
+   std::vector<size_t> inv;
+   invertPermutation( perm, n, inv );
+
+   DynamicVector<typename VT::ElementType,TF> y( n );
+
+   for( size_t i=0UL; i<n; ++i )
+      y[perm[i]] = x[i];
+
+   return y;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1154 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Semiring.h
+//  \brief Header file for the semiring-generic sparse matrix products
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SEMIRING_H_
+#define _BLAZE_MATH_SPARSE_SEMIRING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Execute.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Limits.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SEMIRINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The conventional arithmetic (plus-times) semiring.
+// \ingroup sparse_matrix
+//
+// The PlusTimes semiring combines the elements via multiplication and reduces via addition,
+// i.e. the semiring-generic products compute the same results as the conventional products.
+// The identity of the reduction is the default value of \a Type. All semirings provide the
+// same interface: the element type of the products (\a ElementType), the identity of the
+// reduction (zero()), which also represents the elements that are not stored in a sparse
+// result, the reduction (add()), and the combination of two elements (mult()). In order to
+// define a user-defined semiring, a class with the same interface has to be provided:
+
+   \code
+   // Semiring computing the number of paths of a graph modulo 1000
+   struct PathCount
+   {
+      typedef int  ElementType;
+
+      inline int zero() const { return 0; }
+      inline int add ( int a, int b ) const { return ( a + b ) % 1000; }
+      inline int mult( int a, int b ) const { return ( a * b ) % 1000; }
+   };
+   \endcode
+
+// The zero() element must be the identity of add() and must annihilate mult(), since all
+// elements that are not stored in a sparse operand are skipped by the semiring products.
+*/
+template< typename Type >  // Data type of the elements
+struct PlusTimes
+{
+   typedef Type  ElementType;  //!< Element type of the semiring.
+
+   inline Type zero() const { return Type(); }
+   inline Type add ( const Type& a, const Type& b ) const { return a + b; }
+   inline Type mult( const Type& a, const Type& b ) const { return a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The tropical min-plus semiring.
+// \ingroup sparse_matrix
+//
+// The MinPlus semiring combines the elements via addition and reduces via the minimum. Its
+// identity is the positive infinity of \a Type (see the Limits class template), which is also
+// guaranteed to annihilate the combination. It is the semiring of shortest path problems: for
+// an adjacency matrix \a A of edge weights and a vector \a d of distances, \f$ A^T d \f$
+// computes the distances after a single relaxation step of the Bellman-Ford algorithm.
+*/
+template< typename Type >  // Data type of the elements
+struct MinPlus
+{
+   typedef Type  ElementType;  //!< Element type of the semiring.
+
+   inline Type zero() const { return Limits<Type>::inf(); }
+   inline Type add ( const Type& a, const Type& b ) const { return ( b < a )?( b ):( a ); }
+   inline Type mult( const Type& a, const Type& b ) const {
+      return ( a == zero() || b == zero() )?( zero() ):( a + b );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The tropical max-plus semiring.
+// \ingroup sparse_matrix
+//
+// The MaxPlus semiring combines the elements via addition and reduces via the maximum. Its
+// identity is the negative infinity of \a Type (see the Limits class template), which is also
+// guaranteed to annihilate the combination. It is the semiring of longest path problems, as
+// for instance the critical path of a task graph.
+*/
+template< typename Type >  // Data type of the elements
+struct MaxPlus
+{
+   typedef Type  ElementType;  //!< Element type of the semiring.
+
+   inline Type zero() const { return Limits<Type>::ninf(); }
+   inline Type add ( const Type& a, const Type& b ) const { return ( a < b )?( b ):( a ); }
+   inline Type mult( const Type& a, const Type& b ) const {
+      return ( a == zero() || b == zero() )?( zero() ):( a + b );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The max-times semiring.
+// \ingroup sparse_matrix
+//
+// The MaxTimes semiring combines the elements via multiplication and reduces via the maximum.
+// Its identity is the default value of \a Type, i.e. the semiring is restricted to non-negative
+// elements. It is the semiring of most reliable path problems with edge probabilities.
+*/
+template< typename Type >  // Data type of the elements
+struct MaxTimes
+{
+   typedef Type  ElementType;  //!< Element type of the semiring.
+
+   inline Type zero() const { return Type(); }
+   inline Type add ( const Type& a, const Type& b ) const { return ( a < b )?( b ):( a ); }
+   inline Type mult( const Type& a, const Type& b ) const { return a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The max-min (bottleneck) semiring.
+// \ingroup sparse_matrix
+//
+// The MaxMin semiring combines the elements via the minimum and reduces via the maximum. Its
+// identity is the negative infinity of \a Type. It is the semiring of widest path problems,
+// i.e. of the path with maximum capacity in a network of edge capacities.
+*/
+template< typename Type >  // Data type of the elements
+struct MaxMin
+{
+   typedef Type  ElementType;  //!< Element type of the semiring.
+
+   inline Type zero() const { return Limits<Type>::ninf(); }
+   inline Type add ( const Type& a, const Type& b ) const { return ( a < b )?( b ):( a ); }
+   inline Type mult( const Type& a, const Type& b ) const { return ( b < a )?( b ):( a ); }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The Boolean or-and semiring.
+// \ingroup sparse_matrix
+//
+// The OrAnd semiring combines the elements via the logical and and reduces via the logical or.
+// The elements of all operands are interpreted as truth values (i.e. all non-default elements
+// are true) and the results are represented by the values 0 and 1 of type \a Type. It is the
+// semiring of reachability problems, as for instance a single step of a breadth-first search.
+*/
+template< typename Type = bool >  // Data type of the elements
+struct OrAnd
+{
+   typedef Type  ElementType;  //!< Element type of the semiring.
+
+   inline Type zero() const { return Type(); }
+   inline Type add ( const Type& a, const Type& b ) const { return Type( a != Type() || b != Type() ); }
+   inline Type mult( const Type& a, const Type& b ) const { return Type( a != Type() && b != Type() ); }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASSES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to a dense vector operand of a semiring-generic product.
+// \ingroup sparse_matrix
+*/
+template< typename VT >  // Type of the dense vector
+struct SemiringDenseOperand
+{
+   explicit inline SemiringDenseOperand( const VT& x ) : x_( x ) {}
+
+   inline size_t nonZeros() const { return x_.size(); }
+   inline size_t index( size_t k ) const { return k; }
+   inline bool contains( size_t ) const { return true; }
+   inline typename VT::ReturnType operator[]( size_t j ) const { return x_[j]; }
+
+   const VT& x_;  //!< The dense vector operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to a sparse vector operand of a semiring-generic product.
+// \ingroup sparse_matrix
+//
+// The non-zero elements of the sparse vector are scattered into a dense array in order to
+// provide constant time random access for the rows of a row-major matrix. Only elements that
+// are stored in the sparse vector are considered, independent of their value.
+*/
+template< typename Type >  // Data type of the elements
+struct SemiringSparseOperand
+{
+   template< typename VT >  // Type of the sparse vector
+   explicit inline SemiringSparseOperand( const VT& x )
+      : indices_()                  // The indices of the stored elements
+      , values_ ( x.size() )        // The scattered values of the stored elements
+      , flags_  ( x.size(), 0U )    // The flags of the stored elements
+   {
+      typedef typename VT::ConstIterator  ConstIterator;
+
+      indices_.reserve( x.nonZeros() );
+
+      const ConstIterator end( x.end() );
+      for( ConstIterator element=x.begin(); element!=end; ++element ) {
+         const size_t j( element->index() );
+         indices_.push_back( j );
+         values_[j] = element->value();
+         flags_[j]  = 1U;
+      }
+   }
+
+   inline size_t nonZeros() const { return indices_.size(); }
+   inline size_t index( size_t k ) const { return indices_[k]; }
+   inline bool contains( size_t j ) const { return flags_[j] != 0U; }
+   inline const Type& operator[]( size_t j ) const { return values_[j]; }
+
+   std::vector<size_t>        indices_;  //!< The indices of the stored elements.
+   std::vector<Type>          values_;   //!< The scattered values of the stored elements.
+   std::vector<unsigned char> flags_;    //!< The flags of the stored elements.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Output mask of a semiring-generic matrix/vector product.
+// \ingroup sparse_matrix
+//
+// An element \a i of the result is computed in case the mask contains element \a i, i.e. in
+// case element \a i of the given mask vector is stored and not default (for a complemented
+// mask: in case it is not stored or default). A default constructed mask contains all elements.
+*/
+class SemiringMask
+{
+ public:
+   inline SemiringMask() : flags_(), masked_( false ), complement_( false ) {}
+
+   template< typename VT >  // Type of the dense mask vector
+   inline void assign( const DenseVector<VT,false>& mask, bool complement ) {
+      flags_.assign( (~mask).size(), 0U );
+      for( size_t i=0UL; i<(~mask).size(); ++i ) {
+         if( !isDefault( (~mask)[i] ) ) flags_[i] = 1U;
+      }
+      masked_     = true;
+      complement_ = complement;
+   }
+
+   template< typename VT >  // Type of the sparse mask vector
+   inline void assign( const SparseVector<VT,false>& mask, bool complement ) {
+      typedef typename VT::CompositeType  CT;
+      typedef typename RemoveReference<CT>::Type::ConstIterator  ConstIterator;
+      CT tmp( ~mask );
+      flags_.assign( tmp.size(), 0U );
+      const ConstIterator end( tmp.end() );
+      for( ConstIterator element=tmp.begin(); element!=end; ++element ) {
+         if( !isDefault( element->value() ) ) flags_[element->index()] = 1U;
+      }
+      masked_     = true;
+      complement_ = complement;
+   }
+
+   inline size_t size() const { return flags_.size(); }
+   inline bool contains( size_t i ) const {
+      return !masked_ || ( ( flags_[i] != 0U ) != complement_ );
+   }
+
+ private:
+   std::vector<unsigned char> flags_;  //!< The flags of the non-default mask elements.
+   bool masked_;                       //!< \a true in case a mask vector has been assigned.
+   bool complement_;                   //!< \a true for a complemented mask.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows of a semiring-generic product into tasks of equal work.
+// \ingroup sparse_matrix
+//
+// \param work The amount of work per row.
+// \param total The total amount of work.
+// \param tasks The number of tasks.
+// \param ranges The resulting row ranges of all tasks (size \a tasks + 1).
+// \return void
+*/
+inline void semiringPartition( const std::vector<size_t>& work, size_t total, size_t tasks,
+                               std::vector<size_t>& ranges )
+{
+   const size_t m( work.size() );
+
+   ranges.assign( tasks+1UL, m );
+   ranges[0UL] = 0UL;
+
+   for( size_t i=0UL, t=1UL, sum=0UL; i<m && t<tasks; ++i ) {
+      sum += work[i];
+      while( t < tasks && sum*tasks >= t*total ) {
+         ranges[t] = i+1UL;
+         ++t;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SEMIRING MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task of the parallel semiring-generic row-major matrix/vector multiplication.
+// \ingroup sparse_matrix
+*/
+template< typename MT    // Type of the row-major sparse matrix
+        , typename XT    // Type of the vector operand
+        , typename SR >  // Type of the semiring
+struct SemiringMxvTask
+{
+   typedef typename SR::ElementType  ET;  //!< Element type of the semiring.
+
+   explicit inline SemiringMxvTask( const MT& A, const XT& x, const SemiringMask& mask,
+                                    const SR& sr, const size_t* ranges, ET* values,
+                                    unsigned char* flags )
+      : A_     ( &A     )  // The row-major sparse matrix
+      , x_     ( &x     )  // The vector operand
+      , mask_  ( &mask  )  // The output mask
+      , sr_    ( &sr    )  // The semiring
+      , ranges_( ranges )  // The row ranges of all tasks
+      , values_( values )  // The output array for the values
+      , flags_ ( flags  )  // The output array for the flags of the computed elements
+   {}
+
+   inline void operator()( size_t task ) const
+   {
+      typedef typename MT::ConstIterator  ConstIterator;
+
+      for( size_t i=ranges_[task]; i<ranges_[task+1UL]; ++i )
+      {
+         if( !mask_->contains( i ) )
+            continue;
+
+         ET tmp = ET();
+         bool found( false );
+
+         const ConstIterator end( A_->end(i) );
+         for( ConstIterator element=A_->begin(i); element!=end; ++element )
+         {
+            const size_t j( element->index() );
+
+            if( !x_->contains( j ) )
+               continue;
+
+            if( found ) {
+               tmp = sr_->add( tmp, sr_->mult( element->value(), (*x_)[j] ) );
+            }
+            else {
+               tmp = sr_->mult( element->value(), (*x_)[j] );
+               found = true;
+            }
+         }
+
+         if( found ) {
+            values_[i] = tmp;
+            flags_[i]  = 1U;
+         }
+      }
+   }
+
+   const MT*           A_;       //!< The row-major sparse matrix.
+   const XT*           x_;       //!< The vector operand.
+   const SemiringMask* mask_;    //!< The output mask.
+   const SR*           sr_;      //!< The semiring.
+   const size_t*       ranges_;  //!< The row ranges of all tasks.
+   ET*                 values_;  //!< The output array for the values.
+   unsigned char*      flags_;   //!< The output array for the flags of the computed elements.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring-generic multiplication of a row-major sparse matrix and a vector.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param x The vector operand.
+// \param mask The output mask.
+// \param sr The semiring.
+// \param values The output array for the values.
+// \param flags The output array for the flags of the computed elements.
+// \return void
+//
+// Every row is reduced independently (pull direction). In case the matrix has at least
+// SMP_SMATDVECMULT_THRESHOLD rows, the rows are partitioned into tasks of approximately the
+// same number of non-zero elements, which are executed by the active shared memory
+// parallelization.
+*/
+template< typename MT    // Type of the row-major sparse matrix
+        , typename XT    // Type of the vector operand
+        , typename SR >  // Type of the semiring
+inline typename EnableIf< IsRowMajorMatrix<MT> >::Type
+   semiringMxvKernel( const MT& A, const XT& x, const SemiringMask& mask, const SR& sr,
+                std::vector<typename SR::ElementType>& values, std::vector<unsigned char>& flags )
+{
+   const size_t m( A.rows() );
+   const size_t threads( getNumThreads() );
+
+   std::vector<size_t> ranges( 2UL, m );
+   ranges[0UL] = 0UL;
+
+   if( threads > 1UL && m >= SMP_SMATDVECMULT_THRESHOLD )
+   {
+      std::vector<size_t> work( m );
+      size_t total( 0UL );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         work[i] = A.nonZeros( i ) + 1UL;
+         total += work[i];
+      }
+
+      semiringPartition( work, total, min( 4UL*threads, m ), ranges );
+   }
+
+   smpExecute( SemiringMxvTask<MT,XT,SR>( A, x, mask, sr, &ranges[0], &values[0], &flags[0] ),
+               ranges.size()-1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Semiring-generic multiplication of a column-major sparse matrix and a vector.
+// \ingroup sparse_matrix
+//
+// \param A The column-major sparse matrix.
+// \param x The vector operand.
+// \param mask The output mask.
+// \param sr The semiring.
+// \param values The output array for the values.
+// \param flags The output array for the flags of the computed elements.
+// \return void
+//
+// The columns selected by the stored elements of the vector operand are scattered into the
+// result (push direction). Therefore the work is proportional to the number of non-zero
+// elements of the selected columns, which makes this kernel the method of choice for sparse
+// frontiers of graph traversals. Due to the scattered updates the kernel is executed serially.
+*/
+template< typename MT    // Type of the column-major sparse matrix
+        , typename XT    // Type of the vector operand
+        , typename SR >  // Type of the semiring
+inline typename DisableIf< IsRowMajorMatrix<MT> >::Type
+   semiringMxvKernel( const MT& A, const XT& x, const SemiringMask& mask, const SR& sr,
+                std::vector<typename SR::ElementType>& values, std::vector<unsigned char>& flags )
+{
+   typedef typename SR::ElementType    ET;
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   for( size_t k=0UL; k<x.nonZeros(); ++k )
+   {
+      const size_t j( x.index( k ) );
+      const ET xj( x[j] );
+
+      const ConstIterator end( A.end(j) );
+      for( ConstIterator element=A.begin(j); element!=end; ++element )
+      {
+         const size_t i( element->index() );
+
+         if( !mask.contains( i ) )
+            continue;
+
+         if( flags[i] ) {
+            values[i] = sr.add( values[i], sr.mult( element->value(), xj ) );
+         }
+         else {
+            values[i] = sr.mult( element->value(), xj );
+            flags[i]  = 1U;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a dense vector operand of a semiring-generic matrix/vector product.
+// \ingroup sparse_matrix
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename VT    // Type of the dense vector operand
+        , typename SR >  // Type of the semiring
+inline void semiringMxv( const MT& A, const DenseVector<VT,false>& x, const SemiringMask& mask,
+                         const SR& sr, std::vector<typename SR::ElementType>& values,
+                         std::vector<unsigned char>& flags )
+{
+   typedef typename VT::CompositeType  CT;
+
+   CT tmp( ~x );  // Evaluation of the dense vector operand
+
+   semiringMxvKernel( A, SemiringDenseOperand<typename RemoveReference<CT>::Type>( tmp ),
+                      mask, sr, values, flags );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a sparse vector operand of a semiring-generic matrix/vector product.
+// \ingroup sparse_matrix
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename VT    // Type of the sparse vector operand
+        , typename SR >  // Type of the semiring
+inline void semiringMxv( const MT& A, const SparseVector<VT,false>& x, const SemiringMask& mask,
+                         const SR& sr, std::vector<typename SR::ElementType>& values,
+                         std::vector<unsigned char>& flags )
+{
+   typedef typename VT::CompositeType  CT;
+
+   CT tmp( ~x );  // Evaluation of the sparse vector operand
+
+   semiringMxvKernel( A, SemiringSparseOperand<typename SR::ElementType>( tmp ),
+                      mask, sr, values, flags );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the result of a semiring-generic product to a dense vector.
+// \ingroup sparse_matrix
+//
+// All elements that have not been computed are set to the zero element of the semiring.
+*/
+template< typename VT    // Type of the dense target vector
+        , typename SR >  // Type of the semiring
+inline void semiringAssign( DenseVector<VT,false>& y, const std::vector<typename SR::ElementType>& values,
+                            const std::vector<unsigned char>& flags, const SR& sr )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == values.size(), "Invalid vector sizes" );
+
+   for( size_t i=0UL; i<values.size(); ++i ) {
+      (~y)[i] = ( flags[i] )?( values[i] ):( sr.zero() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the result of a semiring-generic product to a sparse vector.
+// \ingroup sparse_matrix
+//
+// All computed elements are stored, independent of their value.
+*/
+template< typename VT    // Type of the sparse target vector
+        , typename SR >  // Type of the semiring
+inline void semiringAssign( SparseVector<VT,false>& y, const std::vector<typename SR::ElementType>& values,
+                            const std::vector<unsigned char>& flags, const SR& /*sr*/ )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == values.size(), "Invalid vector sizes" );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<flags.size(); ++i ) {
+      if( flags[i] ) ++nonzeros;
+   }
+
+   (~y).reset();
+   (~y).reserve( nonzeros );
+
+   for( size_t i=0UL; i<values.size(); ++i ) {
+      if( flags[i] ) (~y).append( i, values[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the semiring-generic matrix/vector multiplication.
+// \ingroup sparse_matrix
+*/
+template< typename VT1   // Type of the target vector
+        , typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename VT2   // Type of the vector operand
+        , typename SR >  // Type of the semiring
+void mxv_backend( VT1& y, const SparseMatrix<MT,SO>& A, const VT2& x,
+                  const SemiringMask& mask, const SR& sr )
+{
+   typedef typename MT::CompositeType  CT;
+
+   if( (~A).columns() != x.size() || (~A).rows() != y.size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   CT tmp( ~A );  // Evaluation of the sparse matrix operand
+
+   std::vector<typename SR::ElementType> values( tmp.rows() );
+   std::vector<unsigned char> flags( tmp.rows(), 0U );
+
+   semiringMxv( tmp, x, mask, sr, values, flags );
+   semiringAssign( y, values, flags, sr );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SEMIRING MATRIX/MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Result of a single task of a semiring-generic matrix/matrix multiplication.
+// \ingroup sparse_matrix
+*/
+template< typename Type >  // Data type of the elements
+struct SemiringMxmResult
+{
+   std::vector<size_t> indices_;  //!< The column indices of all computed elements.
+   std::vector<Type>   values_;   //!< The values of all computed elements.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task of the parallel semiring-generic sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// Each row of the result is computed by a row-wise (Gustavson) kernel with a dense accumulator
+// of size \f$ O(columns) \f$, which is owned by the task and reused for all of its rows. In case
+// a mask matrix is given, the elements of the current row of the mask are marked in a second
+// dense array and all products outside of the mask are skipped before they are combined.
+*/
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , typename MT2   // Type of the right-hand side sparse matrix
+        , typename MT3   // Type of the mask matrix
+        , typename SR >  // Type of the semiring
+struct SemiringMxmTask
+{
+   typedef typename SR::ElementType  ET;  //!< Element type of the semiring.
+
+   explicit inline SemiringMxmTask( const MT1& A, const MT2& B, const MT3* M, bool complement,
+                                    const SR& sr, const size_t* ranges, size_t* nonzeros,
+                                    SemiringMxmResult<ET>* results )
+      : A_         ( &A         )  // The left-hand side sparse matrix
+      , B_         ( &B         )  // The right-hand side sparse matrix
+      , M_         ( M          )  // The mask matrix (NULL in case no mask is given)
+      , complement_( complement )  // Flag for a complemented mask
+      , sr_        ( &sr        )  // The semiring
+      , ranges_    ( ranges     )  // The row ranges of all tasks
+      , nonzeros_  ( nonzeros   )  // The output array for the number of elements per row
+      , results_   ( results    )  // The results of all tasks
+   {}
+
+   inline void operator()( size_t task ) const
+   {
+      typedef typename MT1::ConstIterator  LeftIterator;
+      typedef typename MT2::ConstIterator  RightIterator;
+      typedef typename MT3::ConstIterator  MaskIterator;
+
+      const size_t n( B_->columns() );
+
+      std::vector<ET>     values( n );
+      std::vector<size_t> marker( n, 0UL );
+      std::vector<size_t> maskMarker( ( M_ != NULL )?( n ):( 0UL ), 0UL );
+      std::vector<size_t> columns;
+
+      SemiringMxmResult<ET>& result( results_[task] );
+
+      for( size_t i=ranges_[task]; i<ranges_[task+1UL]; ++i )
+      {
+         const size_t stamp( i+1UL );
+
+         if( M_ != NULL ) {
+            const MaskIterator mend( M_->end(i) );
+            for( MaskIterator element=M_->begin(i); element!=mend; ++element ) {
+               if( !isDefault( element->value() ) )
+                  maskMarker[element->index()] = stamp;
+            }
+         }
+
+         columns.clear();
+
+         const LeftIterator lend( A_->end(i) );
+         for( LeftIterator lelem=A_->begin(i); lelem!=lend; ++lelem )
+         {
+            const RightIterator rend( B_->end( lelem->index() ) );
+            for( RightIterator relem=B_->begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               const size_t j( relem->index() );
+
+               if( M_ != NULL && ( maskMarker[j] == stamp ) == complement_ )
+                  continue;
+
+               if( marker[j] == stamp ) {
+                  values[j] = sr_->add( values[j], sr_->mult( lelem->value(), relem->value() ) );
+               }
+               else {
+                  values[j] = sr_->mult( lelem->value(), relem->value() );
+                  marker[j] = stamp;
+                  columns.push_back( j );
+               }
+            }
+         }
+
+         std::sort( columns.begin(), columns.end() );
+
+         for( size_t k=0UL; k<columns.size(); ++k ) {
+            result.indices_.push_back( columns[k] );
+            result.values_.push_back( values[columns[k]] );
+         }
+
+         nonzeros_[i] = columns.size();
+      }
+   }
+
+   const MT1*             A_;           //!< The left-hand side sparse matrix.
+   const MT2*             B_;           //!< The right-hand side sparse matrix.
+   const MT3*             M_;           //!< The mask matrix (NULL in case no mask is given).
+   bool                   complement_;  //!< Flag for a complemented mask.
+   const SR*              sr_;          //!< The semiring.
+   const size_t*          ranges_;      //!< The row ranges of all tasks.
+   size_t*                nonzeros_;    //!< The output array for the number of elements per row.
+   SemiringMxmResult<ET>* results_;     //!< The results of all tasks.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the semiring-generic sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param M The row-major mask matrix (NULL in case no mask is given).
+// \param complement \a true for a complemented mask.
+// \param sr The semiring.
+// \return void
+//
+// The rows of the result are partitioned into tasks of approximately the same number of scalar
+// combinations, which are executed by the active shared memory parallelization in case the
+// result has at least SMP_SMATSMATMULT_THRESHOLD rows. Each task collects the elements of its
+// rows in its own buffers, which are finally appended to the target matrix. Since the target
+// matrix is not modified before all rows have been computed, the target may be identical to
+// any of the operands.
+*/
+template< typename MT1   // Type of the target sparse matrix
+        , typename MT2   // Type of the left-hand side sparse matrix
+        , typename MT3   // Type of the right-hand side sparse matrix
+        , typename MT4   // Type of the mask matrix
+        , typename SR >  // Type of the semiring
+void mxm_backend( MT1& C, const MT2& A, const MT3& B, const MT4* M, bool complement, const SR& sr )
+{
+   typedef typename SR::ElementType     ET;
+   typedef typename MT2::ConstIterator  LeftIterator;
+
+   const size_t m( A.rows()    );
+   const size_t n( B.columns() );
+
+   // Counting the number of scalar combinations per row
+   std::vector<size_t> flops( m, 1UL );
+   size_t total( m );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const LeftIterator lend( A.end(i) );
+      for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         flops[i] += B.nonZeros( lelem->index() );
+      }
+      total += flops[i] - 1UL;
+   }
+
+   // Partitioning the rows into tasks of approximately equal work
+   const size_t threads( getNumThreads() );
+   std::vector<size_t> ranges( 2UL, m );
+   ranges[0UL] = 0UL;
+
+   if( threads > 1UL && m >= SMP_SMATSMATMULT_THRESHOLD ) {
+      semiringPartition( flops, total, min( 4UL*threads, m ), ranges );
+   }
+
+   const size_t tasks( ranges.size()-1UL );
+
+   // Computing the rows of the result
+   std::vector<size_t> nonzeros( m+1UL, 0UL );
+   std::vector< SemiringMxmResult<ET> > results( tasks );
+
+   smpExecute( SemiringMxmTask<MT2,MT3,MT4,SR>(
+                  A, B, M, complement, sr, &ranges[0], &nonzeros[0], &results[0] ), tasks );
+
+   // Transferring the result to the target matrix
+   size_t capacity( 0UL );
+   for( size_t t=0UL; t<tasks; ++t ) {
+      capacity += results[t].indices_.size();
+   }
+
+   resize( C, m, n, false );
+   C.reset();
+   C.reserve( capacity );
+
+   for( size_t t=0UL; t<tasks; ++t ) {
+      const SemiringMxmResult<ET>& result( results[t] );
+      for( size_t i=ranges[t], k=0UL; i<ranges[t+1UL]; ++i ) {
+         for( const size_t end=k+nonzeros[i]; k<end; ++k ) {
+            C.append( i, result.indices_[k], result.values_[k] );
+         }
+         C.finalize( i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SEMIRING MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Semiring multiplication functions */
+//@{
+template< typename VT1, typename MT, bool SO, typename VT2, typename SR >
+void mxv( Vector<VT1,false>& y, const SparseMatrix<MT,SO>& A, const Vector<VT2,false>& x,
+          const SR& sr );
+
+template< typename VT1, typename VT2, typename MT, bool SO, typename VT3, typename SR >
+void mxv( Vector<VT1,false>& y, const Vector<VT2,false>& mask, const SparseMatrix<MT,SO>& A,
+          const Vector<VT3,false>& x, const SR& sr, bool complement=false );
+
+template< typename MT1, typename MT2, typename MT3, typename SR >
+void mxm( SparseMatrix<MT1,false>& C, const SparseMatrix<MT2,false>& A,
+          const SparseMatrix<MT3,false>& B, const SR& sr );
+
+template< typename MT1, typename MT2, typename MT3, typename MT4, typename SR >
+void mxm( SparseMatrix<MT1,false>& C, const SparseMatrix<MT2,false>& M,
+          const SparseMatrix<MT3,false>& A, const SparseMatrix<MT4,false>& B,
+          const SR& sr, bool complement=false );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring-generic multiplication of a sparse matrix and a vector (\f$ y=A \oplus.\otimes x \f$).
+// \ingroup sparse_matrix
+//
+// \param y The target dense or sparse column vector.
+// \param A The sparse matrix operand.
+// \param x The dense or sparse column vector operand.
+// \param sr The semiring.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the given sparse matrix and vector, where the scalar
+// multiplication is replaced by the mult() function and the summation is replaced by the add()
+// function of the given semiring (see for instance the PlusTimes, MinPlus, MaxPlus, MaxTimes,
+// MaxMin, and OrAnd semirings). Only the elements that are stored in the sparse operands are
+// combined, independent of their value. Elements of the result without any contribution are
+// not stored in a sparse target vector and are set to the zero() element of the semiring in
+// a dense target vector. The following example demonstrates a single step of a breadth-first
+// search and of the Bellman-Ford algorithm:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::CompressedVector;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<bool,blaze::columnMajor> G;   // Adjacency matrix (G(i,j) for an edge j->i)
+   CompressedVector<bool> frontier, next;
+   // ... Initialization
+
+   blaze::mxv( next, G, frontier, blaze::OrAnd<bool>() );
+
+   CompressedMatrix<double> W;   // Transposed weight matrix (W(i,j) for an edge j->i)
+   DynamicVector<double> d, tmp;
+   // ... Initialization
+
+   blaze::mxv( tmp, W, d, blaze::MinPlus<double>() );  // tmp_i = min_j( W(i,j) + d_j )
+   \endcode
+
+// For a row-major matrix each element of the result is reduced independently (pull direction)
+// and the rows are processed in parallel by the active shared memory parallelization in case
+// the matrix has at least SMP_SMATDVECMULT_THRESHOLD rows. For a column-major matrix only the
+// columns selected by the stored elements of \a x are traversed (push direction). The target
+// vector must have the size of the number of rows of the matrix and may be identical to the
+// vector operand. In case the sizes of the operands don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT1   // Type of the target vector
+        , typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename VT2   // Type of the vector operand
+        , typename SR >  // Type of the semiring
+void mxv( Vector<VT1,false>& y, const SparseMatrix<MT,SO>& A, const Vector<VT2,false>& x,
+          const SR& sr )
+{
+   const SemiringMask mask;
+   mxv_backend( ~y, A, ~x, mask, sr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked semiring-generic multiplication of a sparse matrix and a vector.
+// \ingroup sparse_matrix
+//
+// \param y The target dense or sparse column vector.
+// \param mask The dense or sparse mask vector.
+// \param A The sparse matrix operand.
+// \param x The dense or sparse column vector operand.
+// \param sr The semiring.
+// \param complement \a true in order to use the complement of the mask.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the semiring-generic product \f$ y=A \oplus.\otimes x \f$ (see the
+// unmasked mxv() function) restricted to the elements selected by the given mask vector: An
+// element \a i of the result is only computed in case element \a i of the mask is stored and
+// not default or, in case \a complement is \a true, in case it is not stored or default. All
+// other elements of the target vector are removed from a sparse target vector and are set to
+// the zero() element of the semiring in a dense target vector. The work of the elements outside
+// of the mask is skipped entirely. As an example, the following breadth-first search step only
+// computes the vertices that have not been visited before:
+
+   \code
+   blaze::mxv( next, visited, G, frontier, blaze::OrAnd<bool>(), true );
+   \endcode
+
+// In case the sizes of the operands don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1   // Type of the target vector
+        , typename VT2   // Type of the mask vector
+        , typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename VT3   // Type of the vector operand
+        , typename SR >  // Type of the semiring
+void mxv( Vector<VT1,false>& y, const Vector<VT2,false>& mask, const SparseMatrix<MT,SO>& A,
+          const Vector<VT3,false>& x, const SR& sr, bool complement )
+{
+   if( (~mask).size() != (~A).rows() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SemiringMask tmp;
+   tmp.assign( ~mask, complement );
+
+   mxv_backend( ~y, A, ~x, tmp, sr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring-generic multiplication of two row-major sparse matrices (\f$ C=A \oplus.\otimes B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param sr The semiring.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the two given row-major sparse matrices, where the
+// scalar multiplication is replaced by the mult() function and the summation is replaced by
+// the add() function of the given semiring. Only the elements that are stored in the sparse
+// operands are combined and all computed elements are stored in the result, independent of
+// their value. The target matrix is resized to the size of the product and may be identical to
+// any of the operands. The following example computes the two-hop shortest path distances of
+// a weighted graph:
+
+   \code
+   blaze::CompressedMatrix<double> W, D;
+   // ... Initialization of the weight matrix
+
+   blaze::mxm( D, W, W, blaze::MinPlus<double>() );
+   \endcode
+
+// The rows of the result are computed by a row-wise (Gustavson) kernel and are processed in
+// parallel by the active shared memory parallelization in case the result has at least
+// SMP_SMATSMATMULT_THRESHOLD rows. In case the number of columns of \a A doesn't match the
+// number of rows of \a B, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1   // Type of the target sparse matrix
+        , typename MT2   // Type of the left-hand side sparse matrix
+        , typename MT3   // Type of the right-hand side sparse matrix
+        , typename SR >  // Type of the semiring
+void mxm( SparseMatrix<MT1,false>& C, const SparseMatrix<MT2,false>& A,
+          const SparseMatrix<MT3,false>& B, const SR& sr )
+{
+   typedef typename MT2::CompositeType  CT2;
+   typedef typename MT3::CompositeType  CT3;
+   typedef typename RemoveReference<CT2>::Type  MaskType;
+
+   if( (~A).columns() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CT2 lhs( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   CT3 rhs( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   mxm_backend( ~C, lhs, rhs, static_cast<const MaskType*>( NULL ), false, sr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked semiring-generic multiplication of two row-major sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param C The target row-major sparse matrix.
+// \param M The row-major mask matrix.
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param sr The semiring.
+// \param complement \a true in order to use the complement of the mask.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the semiring-generic product \f$ C=A \oplus.\otimes B \f$ (see the
+// unmasked mxm() function) restricted to the elements selected by the given mask matrix: An
+// element \f$ (i,j) \f$ of the result is only computed in case element \f$ (i,j) \f$ of the
+// mask is stored and not default or, in case \a complement is \a true, in case it is not stored
+// or default. The following example counts the triangles of an undirected graph given by its
+// strictly lower adjacency matrix \a L, where the number of triangles is the sum of all
+// elements of \a C:
+
+   \code
+   blaze::CompressedMatrix<int> L, C;
+   // ... Initialization
+
+   blaze::mxm( C, L, L, L, blaze::PlusTimes<int>() );
+   \endcode
+
+// In case the sizes of the operands don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1   // Type of the target sparse matrix
+        , typename MT2   // Type of the mask matrix
+        , typename MT3   // Type of the left-hand side sparse matrix
+        , typename MT4   // Type of the right-hand side sparse matrix
+        , typename SR >  // Type of the semiring
+void mxm( SparseMatrix<MT1,false>& C, const SparseMatrix<MT2,false>& M,
+          const SparseMatrix<MT3,false>& A, const SparseMatrix<MT4,false>& B,
+          const SR& sr, bool complement )
+{
+   typedef typename MT2::CompositeType  CT2;
+   typedef typename MT3::CompositeType  CT3;
+   typedef typename MT4::CompositeType  CT4;
+
+   if( (~A).columns() != (~B).rows() ||
+       (~M).rows() != (~A).rows() || (~M).columns() != (~B).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CT2 mask( ~M );  // Evaluation of the mask matrix
+   CT3 lhs ( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   CT4 rhs ( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   mxm_backend( ~C, lhs, rhs, &mask, complement, sr );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
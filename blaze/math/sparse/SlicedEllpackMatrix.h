@@ -0,0 +1,1630 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sparse matrix in sliced ELLPACK (SELL-C-sigma) format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Row-major sparse matrix in sliced ELLPACK (SELL-C-sigma) format.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is a read-only, row-major sparse matrix that is tailored
+// for the efficient multiplication with dense vectors. In contrast to CompressedMatrix, which
+// stores the non-zero elements of every row as consecutive value-index-pairs, SlicedEllpackMatrix
+// groups \a C consecutive rows into a chunk and stores the values and column indices of a chunk
+// in two separate arrays, where the k-th non-zero element of all \a C rows of a chunk is stored
+// contiguously. All rows of a chunk are padded (with zero values) to the length of the longest
+// row of the chunk. Therefore a sparse matrix/dense vector multiplication is able to compute
+// the results of all rows of a chunk simultaneously via vectorized loads and gathers. Padding
+// elements never contribute to the result of a multiplication, i.e. infinite or NaN elements
+// of the dense vector only affect the rows that actually refer to them. In order
+// to reduce the amount of padding, the rows within each window of \a sigma consecutive rows can
+// be sorted by their number of non-zero elements. The type of the elements and the chunk size
+// of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t C >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - C   : specifies the number of rows per chunk. In order to enable the vectorized sparse
+//          matrix/dense vector multiplication, \a C should be a multiple of the number of
+//          elements per intrinsic vector. The default value is 8.
+//
+// A SlicedEllpackMatrix is created from any other (dense or sparse) matrix. The sorting window
+// \a sigma is specified as second constructor argument. Since the sorting only affects the
+// internal placement of the rows, the interface of the matrix is not affected by the choice of
+// \a sigma. A value of 1 (the default) preserves the original row order, a value that is a
+// multiple of \a C usually reduces the padding considerably:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SlicedEllpackMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of A
+
+   SlicedEllpackMatrix<double> B( A, 64UL );  // Conversion with a sorting window of 64 rows
+
+   DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of x
+
+   y = B * x;  // Vectorized sparse matrix/dense vector multiplication
+   \endcode
+
+// Element access and the traversal of the non-zero elements of a row work exactly as for a
+// row-major CompressedMatrix, except that the elements cannot be modified. New elements can
+// only be added by assigning a new matrix.
+*/
+template< typename Type    // Data type of the sparse matrix
+        , size_t C = 8UL >  // Number of rows per chunk
+class SlicedEllpackMatrix : public SparseMatrix< SlicedEllpackMatrix<Type,C>, false >
+{
+ private:
+   //**Private class LengthComparison**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the sorting of rows by their number of non-zero elements.
+   */
+   struct LengthComparison
+   {
+      explicit inline LengthComparison( const size_t* lengths )
+         : lengths_( lengths )  // The number of non-zero elements of all rows
+      {}
+
+      inline bool operator()( size_t i, size_t j ) const {
+         return lengths_[i] > lengths_[j];
+      }
+
+      const size_t* lengths_;  //!< The number of non-zero elements of all rows.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the sparse matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sparse matrix.
+      typedef ValueIndexPair<Type>  Element;
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying pointers.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying pointers.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : value_( NULL )  // Pointer to the value of the current non-zero element
+         , index_( NULL )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the current non-zero element.
+      // \param index Pointer to the index of the current non-zero element.
+      */
+      inline ConstIterator( const Type* value, const size_t* index )
+         : value_( value )  // Pointer to the value of the current non-zero element
+         , index_( index )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         value_ += C;
+         index_ += C;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The element at the current iterator position.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( value_ - rhs.value_ ) / static_cast<DifferenceType>( C );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*   value_;  //!< Pointer to the value of the current non-zero element.
+      const size_t* index_;  //!< Pointer to the index of the current non-zero element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef SlicedEllpackMatrix<Type,C>  This;            //!< Type of this SlicedEllpackMatrix instance.
+   typedef This                         ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                         ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                  ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                  CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                  Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                  ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef ConstIterator                Iterator;        //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SlicedEllpackMatrix<ET,C>  Other;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+
+   //! The number of rows per chunk.
+   enum { chunkSize = C };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SlicedEllpackMatrix();
+   explicit inline SlicedEllpackMatrix( size_t m, size_t n );
+            inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const DenseMatrix<MT,SO>& dm, size_t sigma = 1UL );
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const SparseMatrix<MT,SO>& sm, size_t sigma = 1UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                    inline SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& rhs );
+   template< typename MT, bool SO > inline SlicedEllpackMatrix& operator=( const DenseMatrix<MT,SO>&  rhs );
+   template< typename MT, bool SO > inline SlicedEllpackMatrix& operator=( const SparseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t i ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t sigma() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( SlicedEllpackMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t        chunks() const;
+   inline size_t        chunkOffset( size_t c ) const;
+   inline size_t        chunkWidth ( size_t c ) const;
+   inline const Type*   values() const;
+   inline const size_t* indices() const;
+   inline const size_t* permutation() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rowOffset( size_t i ) const;
+
+   template< typename MT >
+   void build( const MT& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  sigma_;     //!< The size of the sorting window.
+   size_t  nonZeros_;  //!< The total number of non-zero elements.
+   size_t  chunks_;    //!< The number of chunks.
+   size_t* offset_;    //!< The offsets of the chunks within the value and index arrays.
+   size_t* lengths_;   //!< The number of non-zero elements of all rows.
+   size_t* perm_;      //!< The original row index of all row positions.
+   size_t* pos_;       //!< The row position of all original row indices.
+   Type*   values_;    //!< The values of the non-zero elements (including padding).
+   size_t* indices_;   //!< The column indices of the non-zero elements (including padding).
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( C > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+const Type SlicedEllpackMatrix<Type,C>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix()
+   : m_       ( 0UL )                // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                // The current number of columns of the sparse matrix
+   , sigma_   ( 1UL )                // The size of the sorting window
+   , nonZeros_( 0UL )                // The total number of non-zero elements
+   , chunks_  ( 0UL )                // The number of chunks
+   , offset_  ( new size_t[1UL] )    // The offsets of the chunks
+   , lengths_ ( NULL )               // The number of non-zero elements of all rows
+   , perm_    ( NULL )               // The original row index of all row positions
+   , pos_     ( NULL )               // The row position of all original row indices
+   , values_  ( NULL )               // The values of the non-zero elements
+   , indices_ ( NULL )               // The column indices of the non-zero elements
+{
+   offset_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty \f$ m \times n \f$ SlicedEllpackMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( size_t m, size_t n )
+   : m_       ( 0UL )                // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                // The current number of columns of the sparse matrix
+   , sigma_   ( 1UL )                // The size of the sorting window
+   , nonZeros_( 0UL )                // The total number of non-zero elements
+   , chunks_  ( 0UL )                // The number of chunks
+   , offset_  ( NULL )               // The offsets of the chunks
+   , lengths_ ( NULL )               // The number of non-zero elements of all rows
+   , perm_    ( NULL )               // The original row index of all row positions
+   , pos_     ( NULL )               // The row position of all original row indices
+   , values_  ( NULL )               // The values of the non-zero elements
+   , indices_ ( NULL )               // The column indices of the non-zero elements
+{
+   build( CompressedMatrix<Type,false>( m, n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : m_       ( sm.m_ )                         // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                         // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )                     // The size of the sorting window
+   , nonZeros_( sm.nonZeros_ )                  // The total number of non-zero elements
+   , chunks_  ( sm.chunks_ )                    // The number of chunks
+   , offset_  ( new size_t[sm.chunks_+1UL] )    // The offsets of the chunks
+   , lengths_ ( new size_t[sm.m_] )             // The number of non-zero elements of all rows
+   , perm_    ( new size_t[sm.m_] )             // The original row index of all row positions
+   , pos_     ( new size_t[sm.m_] )             // The row position of all original row indices
+   , values_  ( allocate<Type>( sm.capacity() ) )    // The values of the non-zero elements
+   , indices_ ( allocate<size_t>( sm.capacity() ) )  // The column indices of the non-zero elements
+{
+   std::copy( sm.offset_ , sm.offset_ +chunks_+1UL, offset_  );
+   std::copy( sm.lengths_, sm.lengths_+m_         , lengths_ );
+   std::copy( sm.perm_   , sm.perm_   +m_         , perm_    );
+   std::copy( sm.pos_    , sm.pos_    +m_         , pos_     );
+   std::copy( sm.values_ , sm.values_ +capacity() , values_  );
+   std::copy( sm.indices_, sm.indices_+capacity() , indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be converted.
+// \param sigma The size of the sorting window (in number of rows).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO >      // Storage order of the foreign dense matrix
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const DenseMatrix<MT,SO>& dm, size_t sigma )
+   : m_       ( 0UL )                              // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                              // The current number of columns of the sparse matrix
+   , sigma_   ( sigma > 0UL ? sigma : 1UL )        // The size of the sorting window
+   , nonZeros_( 0UL )                              // The total number of non-zero elements
+   , chunks_  ( 0UL )                              // The number of chunks
+   , offset_  ( NULL )                             // The offsets of the chunks
+   , lengths_ ( NULL )                             // The number of non-zero elements of all rows
+   , perm_    ( NULL )                             // The original row index of all row positions
+   , pos_     ( NULL )                             // The row position of all original row indices
+   , values_  ( NULL )                             // The values of the non-zero elements
+   , indices_ ( NULL )                             // The column indices of the non-zero elements
+{
+   build( CompressedMatrix<Type,false>( ~dm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from sparse matrices.
+//
+// \param sm Sparse matrix to be converted.
+// \param sigma The size of the sorting window (in number of rows).
+//
+// Row-major sparse matrices are converted directly. Column-major sparse matrices and sparse
+// matrix expressions are first evaluated into a temporary row-major CompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO >      // Storage order of the foreign sparse matrix
+inline SlicedEllpackMatrix<Type,C>::SlicedEllpackMatrix( const SparseMatrix<MT,SO>& sm, size_t sigma )
+   : m_       ( 0UL )                              // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                              // The current number of columns of the sparse matrix
+   , sigma_   ( sigma > 0UL ? sigma : 1UL )        // The size of the sorting window
+   , nonZeros_( 0UL )                              // The total number of non-zero elements
+   , chunks_  ( 0UL )                              // The number of chunks
+   , offset_  ( NULL )                             // The offsets of the chunks
+   , lengths_ ( NULL )                             // The number of non-zero elements of all rows
+   , perm_    ( NULL )                             // The original row index of all row positions
+   , pos_     ( NULL )                             // The row position of all original row indices
+   , values_  ( NULL )                             // The values of the non-zero elements
+   , indices_ ( NULL )                             // The column indices of the non-zero elements
+{
+   typedef typename SelectType< SO || IsExpression<MT>::value
+                              , const CompressedMatrix<Type,false>
+                              , const MT& >::Type  Tmp;
+
+   Tmp tmp( ~sm );
+   build( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>::~SlicedEllpackMatrix()
+{
+   delete [] offset_;
+   delete [] lengths_;
+   delete [] perm_;
+   delete [] pos_;
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstReference
+   SlicedEllpackMatrix<Type,C>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( i ) || pos->index() != j )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t offset( rowOffset( i ) );
+   return ConstIterator( values_+offset, indices_+offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t offset( rowOffset( i ) + lengths_[i]*C );
+   return ConstIterator( values_+offset, indices_+offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::cend( size_t i ) const
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix is rebuilt from the given dense matrix. The size of the sorting window of the
+// matrix is preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for sparse matrices.
+//
+// \param rhs Sparse matrix to be assigned.
+// \return Reference to the assigned sparse matrix.
+//
+// The matrix is rebuilt from the given sparse matrix. The size of the sorting window of the
+// matrix is preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO >      // Storage order of the right-hand side sparse matrix
+inline SlicedEllpackMatrix<Type,C>&
+   SlicedEllpackMatrix<Type,C>::operator=( const SparseMatrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the sparse matrix (including padding).
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::capacity() const
+{
+   return offset_[chunks_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified row (including padding).
+//
+// \param i The index of the row.
+// \return The capacity of row \a i.
+//
+// The capacity of a row corresponds to the number of non-zero elements of the longest row
+// of the chunk the row belongs to.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return chunkWidth( pos_[i] / C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return lengths_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the sorting window of the sparse matrix.
+//
+// \return The size of the sorting window (in number of rows).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all non-zero elements from the sparse matrix.
+//
+// \return void
+//
+// This function removes all non-zero elements from the sparse matrix. The number of rows and
+// columns as well as the size of the sorting window remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void SlicedEllpackMatrix<Type,C>::reset()
+{
+   SlicedEllpackMatrix tmp( m_, n_ );
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void SlicedEllpackMatrix<Type,C>::clear()
+{
+   SlicedEllpackMatrix tmp;
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void SlicedEllpackMatrix<Type,C>::swap( SlicedEllpackMatrix& sm ) /* throw() */
+{
+   std::swap( m_       , sm.m_        );
+   std::swap( n_       , sm.n_        );
+   std::swap( sigma_   , sm.sigma_    );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   std::swap( chunks_  , sm.chunks_   );
+   std::swap( offset_  , sm.offset_   );
+   std::swap( lengths_ , sm.lengths_  );
+   std::swap( perm_    , sm.perm_     );
+   std::swap( pos_     , sm.pos_      );
+   std::swap( values_  , sm.values_   );
+   std::swap( indices_ , sm.indices_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row \a i within the value and index arrays.
+//
+// \param i The index of the row.
+// \return The offset of the first element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::rowOffset( size_t i ) const
+{
+   const size_t pos( pos_[i] );
+   return offset_[pos/C] + pos%C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the sliced ELLPACK data structure for the given row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+//
+// This function sorts the rows within each window of \a sigma_ rows by decreasing number of
+// non-zero elements, partitions the resulting row sequence into chunks of \a C rows and stores
+// the elements of each chunk in column-major order, padded with zero values to the length of
+// the longest row of the chunk. The padding elements refer to the column index of the last
+// non-zero element of the according row (or column 0 in case of an empty row). Note that the
+// multiplication kernels never read the padding elements, but only the first nonZeros(i)
+// elements of each row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+template< typename MT >  // Type of the row-major sparse matrix
+void SlicedEllpackMatrix<Type,C>::build( const MT& sm )
+{
+   typedef typename MT::ConstIterator  RowIterator;
+
+   const size_t m( sm.rows() );
+   const size_t chunks( ( m + C - 1UL ) / C );
+
+   SlicedEllpackMatrix tmp;
+   delete [] tmp.offset_;
+   tmp.offset_ = NULL;
+
+   tmp.m_       = m;
+   tmp.n_       = sm.columns();
+   tmp.sigma_   = sigma_;
+   tmp.chunks_  = chunks;
+   tmp.offset_  = new size_t[chunks+1UL];
+   tmp.lengths_ = new size_t[m];
+   tmp.perm_    = new size_t[m];
+   tmp.pos_     = new size_t[m];
+
+   for( size_t i=0UL; i<m; ++i ) {
+      tmp.lengths_[i] = sm.nonZeros( i );
+      tmp.nonZeros_  += tmp.lengths_[i];
+      tmp.perm_[i]    = i;
+   }
+
+   if( sigma_ > 1UL ) {
+      for( size_t i=0UL; i<m; i+=sigma_ ) {
+         std::stable_sort( tmp.perm_+i, tmp.perm_+min( i+sigma_, m ),
+                           LengthComparison( tmp.lengths_ ) );
+      }
+   }
+
+   for( size_t p=0UL; p<m; ++p ) {
+      tmp.pos_[tmp.perm_[p]] = p;
+   }
+
+   tmp.offset_[0UL] = 0UL;
+   for( size_t c=0UL; c<chunks; ++c ) {
+      size_t width( 0UL );
+      for( size_t p=c*C; p<min( (c+1UL)*C, m ); ++p )
+         width = max( width, tmp.lengths_[tmp.perm_[p]] );
+      tmp.offset_[c+1UL] = tmp.offset_[c] + width*C;
+   }
+
+   tmp.values_  = allocate<Type>  ( tmp.offset_[chunks] );
+   tmp.indices_ = allocate<size_t>( tmp.offset_[chunks] );
+
+   for( size_t c=0UL; c<chunks; ++c )
+   {
+      const size_t width( ( tmp.offset_[c+1UL] - tmp.offset_[c] ) / C );
+
+      for( size_t r=0UL; r<C; ++r )
+      {
+         Type*   values ( tmp.values_  + tmp.offset_[c] + r );
+         size_t* indices( tmp.indices_ + tmp.offset_[c] + r );
+         size_t  k( 0UL ), last( 0UL );
+
+         if( c*C+r < m ) {
+            const RowIterator end( sm.end( tmp.perm_[c*C+r] ) );
+            for( RowIterator element=sm.begin( tmp.perm_[c*C+r] ); element!=end; ++element, ++k ) {
+               values [k*C] = element->value();
+               indices[k*C] = last = element->index();
+            }
+         }
+
+         for( ; k<width; ++k ) {
+            values [k*C] = Type();
+            indices[k*C] = last;
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t offset( rowOffset( i ) );
+   const size_t* const indices( indices_ + offset );
+
+   size_t first( 0UL ), count( lengths_[i] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices[(first+step)*C] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_+offset+first*C, indices+first*C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline typename SlicedEllpackMatrix<Type,C>::ConstIterator
+   SlicedEllpackMatrix<Type,C>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t offset( rowOffset( i ) );
+   const size_t* const indices( indices_ + offset );
+
+   size_t first( 0UL ), count( lengths_[i] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices[(first+step)*C] <= j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_+offset+first*C, indices+first*C );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+//
+// The number of chunks corresponds to the number of rows divided by the chunk size \a C,
+// rounded up. In case the number of rows is not a multiple of \a C, the last chunk is
+// completed by empty padding rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::chunks() const
+{
+   return chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the specified chunk within the value and index arrays.
+//
+// \param c The index of the chunk.
+// \return The offset of chunk \a c.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::chunkOffset( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return offset_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the width of the specified chunk.
+//
+// \param c The index of the chunk.
+// \return The number of elements stored per row of chunk \a c (including padding).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline size_t SlicedEllpackMatrix<Type,C>::chunkWidth( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < chunks(), "Invalid chunk access index" );
+   return ( offset_[c+1UL] - offset_[c] ) / C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements.
+//
+// \return Pointer to the values of the non-zero elements.
+//
+// The k-th element of the r-th row of chunk c is stored at position
+// \f$ chunkOffset(c) + k \cdot C + r \f$. The original index of the r-th row of chunk c is
+// given by \f$ permutation()[c \cdot C + r] \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const Type* SlicedEllpackMatrix<Type,C>::values() const
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the column indices of the non-zero elements.
+//
+// \return Pointer to the column indices of the non-zero elements.
+//
+// The column indices are stored in the same order as the values (see the values() function).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const size_t* SlicedEllpackMatrix<Type,C>::indices() const
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the row permutation of the sparse matrix.
+//
+// \return Pointer to the original row indices of all row positions.
+//
+// The returned array contains rows() elements. The p-th element contains the original index
+// of the row that is stored at position p, i.e. as row \f$ p \bmod C \f$ of chunk \f$ p / C \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline const size_t* SlicedEllpackMatrix<Type,C>::permutation() const
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,C>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t C >        // Number of rows per chunk
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,C>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false since the matrix does not support SMP assignments.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline bool SlicedEllpackMatrix<Type,C>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type, size_t C >
+inline void reset( SlicedEllpackMatrix<Type,C>& m );
+
+template< typename Type, size_t C >
+inline void clear( SlicedEllpackMatrix<Type,C>& m );
+
+template< typename Type, size_t C >
+inline bool isDefault( const SlicedEllpackMatrix<Type,C>& m );
+
+template< typename Type, size_t C >
+inline void swap( SlicedEllpackMatrix<Type,C>& a, SlicedEllpackMatrix<Type,C>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void reset( SlicedEllpackMatrix<Type,C>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void clear( SlicedEllpackMatrix<Type,C>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline bool isDefault( const SlicedEllpackMatrix<Type,C>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t C >     // Number of rows per chunk
+inline void swap( SlicedEllpackMatrix<Type,C>& a, SlicedEllpackMatrix<Type,C>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSLICEDELLPACK SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t C >
+struct IsSlicedEllpack< SlicedEllpackMatrix<T,C> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t C, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, T2 >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, size_t C >
+struct MultTrait< T1, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, size_t C, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t C >
+struct MultTrait< StaticVector<T1,N,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t C >
+struct MultTrait< HybridVector<T1,N,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2, typename A2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, DynamicVector<T2,false,A2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t C, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, CompressedVector<T2,false> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t C >
+struct MultTrait< CompressedVector<T1,true>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct MultTrait< StaticMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, size_t M, size_t N, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, size_t C >
+struct MultTrait< HybridMatrix<T1,M,N,SO>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO, typename A2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, DynamicMatrix<T2,SO,A2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO,A1>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t C, typename T2, bool SO, typename A2 >
+struct MultTrait< SlicedEllpackMatrix<T1,C>, CompressedMatrix<T2,SO,A2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t C, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, SlicedEllpackMatrix<T2,C> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,3117 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitCompressedMatrix.h
+//  \brief Implementation of a compressed MxN matrix with split value and index storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SplitCompressedVector.h>
+#include <blaze/math/sparse/SplitIterator.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup split_compressed_matrix SplitCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Compressed \f$ M \times N \f$ matrix with separate value and index arrays.
+// \ingroup split_compressed_matrix
+//
+// The SplitCompressedMatrix class template is the representation of an arbitrary sized sparse
+// matrix in the classic compressed row storage (CRS/CSR) or compressed column storage (CCS/CSC)
+// format. In contrast to the CompressedMatrix class template, which stores each non-zero element
+// as value-index-pair, the SplitCompressedMatrix stores the values and the indices of all non-zero
+// elements in two separate, contiguous arrays:
+
+   \code
+   // Row-major 3x4 matrix       Values:  | 1 2 | 3 | 4 5 |
+   //                                     |-----|---|-----|
+   //   ( 1 0 2 0 )              Indices: | 0 2 | 1 | 0 3 |
+   //   ( 0 3 0 0 )
+   //   ( 4 0 0 5 )
+   \endcode
+
+// Therefore the values of consecutive non-zero elements of a row (or column) can be loaded
+// directly into SIMD registers, no padding is wasted in case the element type is smaller than
+// the index type and the index array can be traversed without touching the values (e.g. for
+// the symbolic phase of a sparse matrix multiplication). The type of the elements, the storage
+// order and the index type of the matrix can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class SplitCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SplitCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type of the stored indices and row/column offsets.
+//          The default type is \c size_t. Choosing a smaller type (as for instance \c uint32_t)
+//          halves the memory and bandwidth requirements of the index and offset arrays, but
+//          restricts both the dimensions and the capacity of the matrix to the range of the
+//          type. Exceeding this range results in a \a std::invalid_argument exception (for
+//          the dimensions) or a \a std::length_error exception (for the capacity).
+//
+// The SplitCompressedMatrix provides the same interface as the CompressedMatrix class template.
+// The only visible difference is the type of the iterators: Since the value and the index of a
+// non-zero element are not stored next to each other, the iterators are not plain pointers but
+// SplitIterator instances, which provide access to the value and the index via the \a value()
+// and \a index() member functions. Additionally, the values() and indices() functions provide
+// direct access to the underlying arrays of a specific row (or column):
+
+   \code
+   using blaze::rowMajor;
+
+   SplitCompressedMatrix<double,rowMajor> A( 4, 3 );
+
+   A(1,2) = 2.0;
+   A.set( 2, 0, -1.2 );
+   A.insert( 2, 1, 3.7 );
+
+   for( SplitCompressedMatrix<double,rowMajor>::Iterator i=A.begin(2); i!=A.end(2); ++i ) {
+      ... = i->value();  // Access to the value of the non-zero element
+      ... = i->index();  // Access to the index of the non-zero element
+   }
+
+   const double* values  = A.values( 2 );   // The values of the non-zero elements of row 2
+   const size_t* indices = A.indices( 2 );  // The column indices of the non-zero elements of row 2
+   for( size_t k=0UL; k<A.nonZeros( 2 ); ++k ) {
+      ... = values[k] * x[indices[k]];
+   }
+   \endcode
+
+// All operations (addition, subtraction, multiplication, scaling, ...) can be performed on all
+// possible combinations of dense and sparse matrices with fitting element types. Matrix/vector
+// multiplications with dense vectors use vectorized kernels that directly operate on the value
+// and index arrays.
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
+class SplitCompressedMatrix : public SparseMatrix< SplitCompressedMatrix<Type,SO,IT>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef SplitCompressedMatrix<Type,SO,IT>   This;            //!< Type of this SplitCompressedMatrix instance.
+   typedef This                                ResultType;      //!< Result type for expression template evaluations.
+   typedef SplitCompressedMatrix<Type,!SO,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef SplitCompressedMatrix<Type,!SO,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the sparse matrix elements.
+   typedef IT                                  IndexType;       //!< Type of the indices of the non-zero elements.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>             Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SplitIterator<Type,IT>              Iterator;        //!< Iterator over non-constant elements.
+   typedef SplitIterator<const Type,IT>        ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SplitCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SplitCompressedMatrix<ET,SO,IT>  Other;  //!< The type of the other SplitCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline SplitCompressedMatrix();
+                            explicit inline SplitCompressedMatrix( size_t m, size_t n );
+                            explicit inline SplitCompressedMatrix( size_t m, size_t n, size_t nonzeros );
+                            explicit        SplitCompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline SplitCompressedMatrix( const SplitCompressedMatrix& sm );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SplitCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline SplitCompressedMatrix& operator= ( const SplitCompressedMatrix& rhs );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SplitCompressedMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SplitCompressedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SplitCompressedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 capacity( size_t i ) const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline void                   reset();
+                              inline void                   reset( size_t i );
+                              inline void                   clear();
+                              inline Iterator               set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator               insert ( size_t i, size_t j, const Type& value );
+                              inline void                   erase  ( size_t i, size_t j );
+                              inline Iterator               erase  ( size_t i, Iterator pos );
+                              inline Iterator               erase  ( size_t i, Iterator first, Iterator last );
+                                     void                   resize ( size_t m, size_t n, bool preserve=true );
+                              inline void                   reserve( size_t nonzeros );
+                                     void                   reserve( size_t i, size_t nonzeros );
+                              inline void                   trim   ();
+                              inline void                   trim   ( size_t i );
+                              inline SplitCompressedMatrix& transpose();
+   template< typename Other > inline SplitCompressedMatrix& scale( const Other& scalar );
+   template< typename Other > inline SplitCompressedMatrix& scaleDiagonal( Other scalar );
+                              inline void                   swap( SplitCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void          append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void          finalize( size_t i );
+   inline Type*         values  ( size_t i );
+   inline const Type*   values  ( size_t i ) const;
+   inline const IT* indices ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   position( size_t k, size_t l ) const;
+          Iterator insert( size_t pos, size_t k, size_t l, const Type& value );
+   inline size_t   extendCapacity() const;
+          void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkDimension( size_t n );
+   static inline void   checkCapacity ( size_t nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows (row-major) or columns (column-major).
+   size_t  n_;         //!< The current number of columns (row-major) or rows (column-major).
+   size_t  capacity_;  //!< The current capacity of the offset arrays.
+   IT*     begin_;     //!< Offsets of the first non-zero element of each row/column.
+   IT*     end_;       //!< Offsets one past the last non-zero element of each row/column.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The indices of the non-zero elements.
+
+   static const Type   zero_;      //!< Neutral element for accesses to zero elements.
+   static const size_t maxIndex_;  //!< The largest index/offset representable by the index type.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type SplitCompressedMatrix<Type,SO,IT>::zero_ = Type();
+
+template< typename Type, bool SO, typename IT >
+const size_t SplitCompressedMatrix<Type,SO,IT>::maxIndex_ = static_cast<IT>( -1 );
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SplitCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix()
+   : m_       ( 0UL )             // The current number of rows/columns of the sparse matrix
+   , n_       ( 0UL )             // The current number of columns/rows of the sparse matrix
+   , capacity_( 0UL )             // The current capacity of the offset arrays
+   , begin_   ( new IT[2] )       // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+1 )        // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )            // The values of the non-zero elements
+   , indices_ ( NULL )            // The indices of the non-zero elements
+{
+   begin_[0] = end_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix( size_t m, size_t n )
+   : m_       ( checkDimension( SO ? n : m ) )  // The current number of rows/columns of the sparse matrix
+   , n_       ( checkDimension( SO ? m : n ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                        // The current capacity of the offset arrays
+   , begin_   ( new IT[2UL*m_+2UL] )        // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )           // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                      // The values of the non-zero elements
+   , indices_ ( NULL )                      // The indices of the non-zero elements
+{
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+// \exception std::length_error Capacity exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( checkDimension( SO ? n : m ) )  // The current number of rows/columns of the sparse matrix
+   , n_       ( checkDimension( SO ? m : n ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                        // The current capacity of the offset arrays
+   , begin_   ( new IT[2UL*m_+2UL] )        // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )           // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                          // The values of the non-zero elements
+   , indices_ ( NULL )                          // The indices of the non-zero elements
+{
+   if( nonzeros > maxIndex_ ) {
+      delete [] begin_;
+      throw std::length_error( "Capacity exceeds the range of the index type" );
+   }
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=0UL; i<2UL*m_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+// \exception std::length_error Capacity exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( checkDimension( SO ? n : m ) )  // The current number of rows/columns of the sparse matrix
+   , n_       ( checkDimension( SO ? m : n ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                        // The current capacity of the offset arrays
+   , begin_   ( new IT[2UL*m_+2UL] )        // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )           // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                      // The values of the non-zero elements
+   , indices_ ( NULL )                      // The indices of the non-zero elements
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == m_, "Size of capacity vector and number of rows/columns don't match" );
+   size_t newCapacity( 0UL );
+   for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   if( newCapacity > maxIndex_ ) {
+      delete [] begin_;
+      throw std::length_error( "Capacity exceeds the range of the index type" );
+   }
+
+   values_  = allocate<Type>( newCapacity );
+   indices_ = allocate<IT>( newCapacity );
+
+   begin_[0UL] = end_[0UL] = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SplitCompressedMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The copy constructor only allocates memory for the non-zero elements of \a sm, i.e. the
+// resulting matrix has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix( const SplitCompressedMatrix& sm )
+   : m_       ( sm.m_ )                     // The current number of rows/columns of the sparse matrix
+   , n_       ( sm.n_ )                     // The current number of columns/rows of the sparse matrix
+   , capacity_( sm.m_ )                     // The current capacity of the offset arrays
+   , begin_   ( new IT[2UL*m_+2UL] )        // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )           // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                      // The values of the non-zero elements
+   , indices_ ( NULL )                      // The indices of the non-zero elements
+{
+   const size_t nonzeros( sm.nonZeros() );
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   begin_[0UL] = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      std::copy( sm.values_ +sm.begin_[i], sm.values_ +sm.end_[i], values_ +begin_[i] );
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      begin_[i+1UL] = end_[i] = begin_[i] + sm.nonZeros(i);
+   }
+   end_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( checkDimension( SO ? (~dm).columns() : (~dm).rows() ) )  // The current number of rows/columns of the sparse matrix
+   , n_       ( checkDimension( SO ? (~dm).rows() : (~dm).columns() ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                                   // The current capacity of the offset arrays
+   , begin_   ( new IT[2UL*m_+2UL] )                   // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )                      // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                                 // The values of the non-zero elements
+   , indices_ ( NULL )                                 // The indices of the non-zero elements
+{
+   using blaze::assign;
+
+   for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+      begin_[i] = 0UL;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+// \exception std::length_error Capacity exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline SplitCompressedMatrix<Type,SO,IT>::SplitCompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( checkDimension( SO ? (~sm).columns() : (~sm).rows() ) )  // The current number of rows/columns of the sparse matrix
+   , n_       ( checkDimension( SO ? (~sm).rows() : (~sm).columns() ) )  // The current number of columns/rows of the sparse matrix
+   , capacity_( m_ )                                   // The current capacity of the offset arrays
+   , begin_   ( new IT[2UL*m_+2UL] )                   // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(m_+1UL) )                      // Offsets one past the last non-zero element of each row/column
+   , values_  ( NULL )                                 // The values of the non-zero elements
+   , indices_ ( NULL )                                 // The indices of the non-zero elements
+{
+   using blaze::assign;
+
+   const size_t nonzeros( (~sm).nonZeros() );
+
+   if( nonzeros > maxIndex_ ) {
+      delete [] begin_;
+      throw std::length_error( "Capacity exceeds the range of the index type" );
+   }
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=0UL; i<2UL*m_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[m_] = nonzeros;
+
+   assign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SplitCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>::~SplitCompressedMatrix()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+   delete [] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case
+// the sparse matrix does not yet store an element for index (\a i,\a j) , a new element is
+// inserted into the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Reference
+   SplitCompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstReference
+   SplitCompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( position( k, l ) );
+
+   if( pos == end_[k] || indices_[pos] != l )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return Iterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor the
+// function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return Iterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SplitCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>&
+   SplitCompressedMatrix<Type,SO,IT>::operator=( const SplitCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t nonzeros( rhs.nonZeros() );
+   const size_t total( capacity() );
+
+   if( rhs.m_ > capacity_ || nonzeros > total ) {
+      SplitCompressedMatrix tmp( rhs );
+      swap( tmp );
+      return *this;
+   }
+
+   begin_[0UL] = 0UL;
+   for( size_t i=0UL; i<rhs.m_; ++i ) {
+      std::copy( rhs.values_ +rhs.begin_[i], rhs.values_ +rhs.end_[i], values_ +begin_[i] );
+      std::copy( rhs.indices_+rhs.begin_[i], rhs.indices_+rhs.end_[i], indices_+begin_[i] );
+      begin_[i+1UL] = end_[i] = begin_[i] + rhs.nonZeros(i);
+   }
+   end_[rhs.m_] = total;
+
+   m_ = rhs.m_;
+   n_ = rhs.n_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline SplitCompressedMatrix<Type,SO,IT>&
+   SplitCompressedMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      SplitCompressedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline SplitCompressedMatrix<Type,SO,IT>&
+   SplitCompressedMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ||
+       ( SO ? (~rhs).columns() : (~rhs).rows() ) > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      SplitCompressedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SplitCompressedMatrix<Type,SO,IT>&
+   SplitCompressedMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   addAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SplitCompressedMatrix<Type,SO,IT>&
+   SplitCompressedMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   subAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline SplitCompressedMatrix<Type,SO,IT>&
+   SplitCompressedMatrix<Type,SO,IT>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   SplitCompressedMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SplitCompressedMatrix<Type,SO,IT> >::Type&
+   SplitCompressedMatrix<Type,SO,IT>::operator*=( Other rhs )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SplitCompressedMatrix<Type,SO,IT> >::Type&
+   SplitCompressedMatrix<Type,SO,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t k=begin_[i]; k<end_[i]; ++k )
+            values_[k] *= tmp;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t k=begin_[i]; k<end_[i]; ++k )
+            values_[k] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::rows() const
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::columns() const
+{
+   return ( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::capacity() const
+{
+   return end_[m_] - begin_[0UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::reset()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to reset.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::clear()
+{
+   end_[0UL] = end_[m_];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the sparse matrix. In case the sparse matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( position( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      values_[pos] = value;
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else return insert( pos, k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts a new element into the sparse matrix. However, duplicate elements are
+// not allowed. In case the sparse matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( position( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      throw std::invalid_argument( "Bad access index" );
+
+   return insert( pos, k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( position( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      std::copy( values_ +pos+1UL, values_ +end_[k], values_ +pos );
+      std::copy( indices_+pos+1UL, indices_+end_[k], indices_+pos );
+      --end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the sparse matrix. In case the storage order is set to
+// \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
+// \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid compressed matrix iterator" );
+
+   if( pos != end(i) ) {
+      const size_t k( begin_[i] + ( pos - begin(i) ) );
+      std::copy( values_ +k+1UL, values_ +end_[i], values_ +k );
+      std::copy( indices_+k+1UL, indices_+end_[i], indices_+k );
+      --end_[i];
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the sparse matrix. In case the storage order is
+// set to \a rowMajor the function erases a range of elements element from row \a i, in case the
+// storage flag is set to \a columnMajor the function erases a range of elements from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < m_        , "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"           );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compressed matrix iterator" );
+
+   if( first != last ) {
+      const size_t k1( begin_[i] + ( first - begin(i) ) );
+      const size_t k2( begin_[i] + ( last  - begin(i) ) );
+      std::copy( values_ +k2, values_ +end_[i], values_ +k1 );
+      std::copy( indices_+k2, indices_+end_[i], indices_+k1 );
+      end_[i] -= k2 - k1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void SplitCompressedMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t M( SO ? n : m );
+   const size_t N( SO ? m : n );
+
+   checkDimension( M );
+   checkDimension( N );
+
+   if( M == m_ && N == n_ ) return;
+
+   if( M > capacity_ )
+   {
+      IT* newBegin( new IT[2UL*M+2UL] );
+      IT* newEnd  ( newBegin+M+1UL );
+
+      newBegin[0UL] = begin_[0UL];
+
+      if( preserve ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            newEnd  [i]     = end_  [i];
+            newBegin[i+1UL] = begin_[i+1UL];
+         }
+         for( size_t i=m_; i<M; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[m_];
+         }
+      }
+      else {
+         for( size_t i=0UL; i<M; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[0UL];
+         }
+      }
+
+      newEnd[M] = end_[m_];
+
+      std::swap( newBegin, begin_ );
+      delete [] newBegin;
+      end_ = newEnd;
+      capacity_ = M;
+   }
+   else if( M > m_ )
+   {
+      end_[M] = end_[m_];
+
+      if( !preserve ) {
+         for( size_t i=0UL; i<m_; ++i )
+            end_[i] = begin_[i];
+      }
+
+      for( size_t i=m_; i<M; ++i )
+         begin_[i+1UL] = end_[i] = begin_[m_];
+   }
+   else
+   {
+      if( preserve ) {
+         for( size_t i=0UL; i<M; ++i )
+            end_[i] = position( i, N );
+      }
+      else {
+         for( size_t i=0UL; i<M; ++i )
+            end_[i] = begin_[i];
+      }
+
+      end_[M] = end_[m_];
+   }
+
+   m_ = M;
+   n_ = N;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+// \exception std::length_error Capacity exceeds the range of the index type.
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// (or columns) are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   checkCapacity( nonzeros );
+
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+// \exception std::length_error Capacity exceeds the range of the index type.
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements. The current values of the sparse matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i. In case the storage order is set to \a columnMajor,
+// the function reserves capacity for column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void SplitCompressedMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( static_cast<size_t>( end_[m_] - begin_[m_] ) < additional )
+   {
+      const size_t newCapacity( begin_[m_] - begin_[0UL] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+      checkCapacity( newCapacity );
+
+      IT*     newBegin  ( new IT[2UL*m_+2UL] );
+      IT*     newEnd    ( newBegin+m_+1UL );
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      IT*     newIndices( allocate<IT>( newCapacity ) );
+
+      newBegin[0UL] = 0UL;
+      newEnd  [m_ ] = newCapacity;
+
+      for( size_t k=0UL; k<m_; ++k ) {
+         std::copy( values_ +begin_[k], values_ +end_[k], newValues +newBegin[k] );
+         std::copy( indices_+begin_[k], indices_+end_[k], newIndices+newBegin[k] );
+         newEnd  [k    ] = newBegin[k] + nonZeros(k);
+         newBegin[k+1UL] = newBegin[k] + ( k == i ? nonzeros : capacity(k) );
+      }
+
+      BLAZE_INTERNAL_ASSERT( newBegin[m_] == newEnd[m_], "Invalid offset calculations" );
+
+      std::swap( newBegin, begin_ );
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      delete [] newBegin;
+      deallocate( newValues );
+      deallocate( newIndices );
+      end_ = newEnd;
+      capacity_ = m_;
+   }
+   else
+   {
+      begin_[m_] += additional;
+      for( size_t j=m_-1UL; j>i; --j ) {
+         std::copy_backward( values_ +begin_[j], values_ +end_[j], values_ +end_[j]+additional );
+         std::copy_backward( indices_+begin_[j], indices_+end_[j], indices_+end_[j]+additional );
+         begin_[j] += additional;
+         end_  [j] += additional;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::trim()
+{
+   for( size_t i=0UL; i<m_; ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed.
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
+// subsequent row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+
+   if( i < ( m_ - 1UL ) ) {
+      std::copy( values_ +begin_[i+1UL], values_ +end_[i+1UL], values_ +end_[i] );
+      std::copy( indices_+begin_[i+1UL], indices_+end_[i+1UL], indices_+end_[i] );
+      end_[i+1UL] = end_[i] + nonZeros( i+1UL );
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline SplitCompressedMatrix<Type,SO,IT>& SplitCompressedMatrix<Type,SO,IT>::transpose()
+{
+   SplitCompressedMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SplitCompressedMatrix<Type,SO,IT>& SplitCompressedMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SplitCompressedMatrix<Type,SO,IT>& SplitCompressedMatrix<Type,SO,IT>::scaleDiagonal( Other scalar )
+{
+   const size_t size( blaze::min( m_, n_ ) );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      const size_t pos( position( i, i ) );
+      if( pos != end_[i] && indices_[pos] == i )
+         values_[pos] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::swap( SplitCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_  , sm.end_   );
+   std::swap( values_ , sm.values_  );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first non-zero element not less than the given index.
+//
+// \param k The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param l The column/row index of the searched element.
+// \return The offset of the first element with an index not less than \a l.
+//
+// This function performs a binary search on the index array of row/column \a k. Since the
+// indices are stored contiguously, no values are touched during the search.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::position( size_t k, size_t l ) const
+{
+   return std::lower_bound( indices_+begin_[k], indices_+end_[k], l ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the sparse matrix.
+//
+// \param pos The position (offset) of the new element.
+// \param k The row/column index of the new element.
+// \param l The column/row index of the new element.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::insert( size_t pos, size_t k, size_t l, const Type& value )
+{
+   if( begin_[k+1UL] - end_[k] != 0 ) {
+      std::copy_backward( values_ +pos, values_ +end_[k], values_ +end_[k]+1UL );
+      std::copy_backward( indices_+pos, indices_+end_[k], indices_+end_[k]+1UL );
+      values_ [pos] = value;
+      indices_[pos] = l;
+      ++end_[k];
+
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else if( end_[m_] - begin_[m_] != 0 ) {
+      std::copy_backward( values_ +pos, values_ +end_[m_-1UL], values_ +end_[m_-1UL]+1UL );
+      std::copy_backward( indices_+pos, indices_+end_[m_-1UL], indices_+end_[m_-1UL]+1UL );
+      values_ [pos] = value;
+      indices_[pos] = l;
+
+      for( size_t i=k+1UL; i<m_+1UL; ++i ) {
+         ++begin_[i];
+         ++end_[i-1UL];
+      }
+
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      IT*     newIndices( allocate<IT>( newCapacity ) );
+
+      std::copy( values_ +begin_[0UL], values_ +pos, newValues  );
+      std::copy( indices_+begin_[0UL], indices_+pos, newIndices );
+      newValues [pos] = value;
+      newIndices[pos] = l;
+      std::copy( values_ +pos, values_ +end_[m_-1UL], newValues +pos+1UL );
+      std::copy( indices_+pos, indices_+end_[m_-1UL], newIndices+pos+1UL );
+
+      for( size_t i=k+1UL; i<m_+1UL; ++i ) {
+         ++begin_[i];
+         ++end_[i-1UL];
+      }
+      end_[m_] = newCapacity;
+
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues  );
+      deallocate( newIndices );
+
+      return Iterator( values_+pos, indices_+pos );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new sparse matrix capacity.
+// \exception std::length_error Capacity exceeds the range of the index type.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$ and
+// additionally limited by the largest offset that can be represented by the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::extendCapacity() const
+{
+   checkCapacity( capacity()+1UL );
+
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+   nonzeros = blaze::min( nonzeros, maxIndex_ );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix dimension against the range of the index type.
+//
+// \param n The number of rows or columns to be checked.
+// \return The given number of rows or columns.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t SplitCompressedMatrix<Type,SO,IT>::checkDimension( size_t n )
+{
+   if( n > maxIndex_ )
+      throw std::invalid_argument( "Matrix dimensions exceed the range of the index type" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix capacity against the range of the index type.
+//
+// \param nonzeros The total number of elements to be checked.
+// \return void
+// \exception std::length_error Capacity exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::checkCapacity( size_t nonzeros )
+{
+   if( nonzeros > maxIndex_ )
+      throw std::length_error( "Capacity exceeds the range of the index type" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of sparse matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+//
+// The additional capacity is appended to the last row/column. The offsets of all rows/columns
+// remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void SplitCompressedMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
+{
+   Type*   newValues ( allocate<Type>( nonzeros ) );
+   IT*     newIndices( allocate<IT>( nonzeros ) );
+
+   for( size_t k=0UL; k<m_; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+      std::copy( values_ +begin_[k], values_ +end_[k], newValues +begin_[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+begin_[k] );
+   }
+
+   end_[m_] = nonzeros;
+
+   std::swap( newValues , values_  );
+   std::swap( newIndices, indices_ );
+   deallocate( newValues  );
+   deallocate( newIndices );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned sparse matrix iterator is subject to
+// invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( position( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return Iterator( values_+pos, indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( position( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return ConstIterator( values_+pos, indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < m_, "Invalid row/column access index" );
+
+   const size_t pos( SO ? position( j, i ) : position( i, j ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( ( SO ? j : i ) < m_, "Invalid row/column access index" );
+
+   const size_t pos( SO ? position( j, i ) : position( i, j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::Iterator
+   SplitCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < m_, "Invalid row/column access index" );
+
+   const size_t pos( std::upper_bound( indices_+begin_[k], indices_+end_[k], l ) - indices_ );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename SplitCompressedMatrix<Type,SO,IT>::ConstIterator
+   SplitCompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < m_, "Invalid row/column access index" );
+
+   const size_t pos( std::upper_bound( indices_+begin_[k], indices_+end_[k], l ) - indices_ );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a sparse matrix with elements. It appends
+// a new element to the end of the specified row/column without any additional memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested. As in case of the CompressedMatrix,
+// the append() function has to be combined with the finalize() function to fill a complete
+// matrix row by row (or column by column).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < m_, "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( l < n_, "Invalid column/row access index" );
+   BLAZE_USER_ASSERT( end_[k] < end_[m_], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || l > indices_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[k]] = value;
+
+   if( !check || !isDefault( values_[end_[k]] ) ) {
+      indices_[end_[k]] = l;
+      ++end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called to
+// finalize row/column \a i and prepare the next row/column for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void SplitCompressedMatrix<Type,SO,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != m_-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements of a row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguous array of the values of the non-zero
+// elements of row \a i (in case of a row-major matrix) or column \a i (in case of a column-major
+// matrix). The array contains exactly nonZeros(i) elements. Note that the returned pointer is
+// subject to invalidation due to inserting operations!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline Type* SplitCompressedMatrix<Type,SO,IT>::values( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return values_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements of a row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const Type* SplitCompressedMatrix<Type,SO,IT>::values( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return values_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the indices of the non-zero elements of a row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the index of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguous, strictly increasing array of the column
+// indices (in case of a row-major matrix) or row indices (in case of a column-major matrix) of
+// the non-zero elements of row/column \a i. The array contains exactly nonZeros(i) elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const IT* SplitCompressedMatrix<Type,SO,IT>::indices( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row/column access index" );
+   return indices_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool SplitCompressedMatrix<Type,SO,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t i=1UL; i<=m_; ++i )
+      begin_[i] = end_[i] = end_[m_];
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      begin_[i] = end_[i] = nonzeros;
+
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t k=i+1UL; k<=m_; ++k )
+               begin_[k] = end_[k] = end_[m_];
+         }
+
+         values_[end_[i]] = ( SO ? (~rhs)(j,i) : (~rhs)(i,j) );
+
+         if( !isDefault( values_[end_[i]] ) ) {
+            indices_[end_[i]] = j;
+            ++end_[i];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[m_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   if( m_ == 0UL || values_ == NULL )
+      return;
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      size_t pos( begin_[i] );
+      for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element, ++pos ) {
+         values_ [pos] = element->value();
+         indices_[pos] = element->index();
+      }
+      begin_[i+1UL] = end_[i] = pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( m_, 0UL );
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         ++lengths[element->index()];
+   }
+
+   // Resizing the sparse matrix
+   for( size_t i=0UL; i<m_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + lengths[i];
+   }
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+         const size_t i( element->index() );
+         values_ [end_[i]] = element->value();
+         indices_[end_[i]] = j;
+         ++end_[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SplitCompressedMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SplitCompressedMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SplitCompressedMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void SplitCompressedMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SplitCompressedMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPLITCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SplitCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline void reset( SplitCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void reset( SplitCompressedMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+inline void clear( SplitCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const SplitCompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void swap( SplitCompressedMatrix<Type,SO,IT>& a, SplitCompressedMatrix<Type,SO,IT>& b ) /* throw() */;
+
+template< typename Type, bool SO, typename IT >
+inline void move( SplitCompressedMatrix<Type,SO,IT>& dst, SplitCompressedMatrix<Type,SO,IT>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given split compressed matrix.
+// \ingroup split_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( SplitCompressedMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given split compressed matrix.
+// \ingroup split_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( SplitCompressedMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given split compressed matrix.
+// \ingroup split_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( SplitCompressedMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given split compressed matrix is in default state.
+// \ingroup split_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const SplitCompressedMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two split compressed matrices.
+// \ingroup split_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( SplitCompressedMatrix<Type,SO,IT>& a, SplitCompressedMatrix<Type,SO,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one split compressed matrix to another.
+// \ingroup split_compressed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void move( SplitCompressedMatrix<Type,SO,IT>& dst, SplitCompressedMatrix<Type,SO,IT>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSPLITCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsSplitCompressed< SplitCompressedMatrix<T,SO,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< SplitCompressedMatrix<T,SO,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename A2 >
+struct AddTrait< SplitCompressedMatrix<T1,SO1,IT1>, DynamicMatrix<T2,SO2,A2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT2, typename A1 >
+struct AddTrait< DynamicMatrix<T1,SO1,A1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename A2 >
+struct AddTrait< SplitCompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,A2> >
+{
+   typedef SplitCompressedMatrix< typename AddTrait<T1,T2>::Type , SO1, IT1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT2, typename A1 >
+struct AddTrait< CompressedMatrix<T1,SO1,A1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef SplitCompressedMatrix< typename AddTrait<T1,T2>::Type , SO2, IT2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< SplitCompressedMatrix<T1,SO,IT1>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef SplitCompressedMatrix< typename AddTrait<T1,T2>::Type , SO, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< SplitCompressedMatrix<T1,SO1,IT1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef SplitCompressedMatrix< typename AddTrait<T1,T2>::Type , false, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename A2 >
+struct SubTrait< SplitCompressedMatrix<T1,SO1,IT1>, DynamicMatrix<T2,SO2,A2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT2, typename A1 >
+struct SubTrait< DynamicMatrix<T1,SO1,A1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename A2 >
+struct SubTrait< SplitCompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,A2> >
+{
+   typedef SplitCompressedMatrix< typename SubTrait<T1,T2>::Type , SO1, IT1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT2, typename A1 >
+struct SubTrait< CompressedMatrix<T1,SO1,A1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef SplitCompressedMatrix< typename SubTrait<T1,T2>::Type , SO2, IT2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< SplitCompressedMatrix<T1,SO,IT1>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef SplitCompressedMatrix< typename SubTrait<T1,T2>::Type , SO, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< SplitCompressedMatrix<T1,SO1,IT1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef SplitCompressedMatrix< typename SubTrait<T1,T2>::Type , false, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT1 >
+struct MultTrait< SplitCompressedMatrix<T1,SO,IT1>, T2 >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, SO, IT1 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool SO, typename IT2 >
+struct MultTrait< T1, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, SO, IT2 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedMatrix<T1,SO,IT1>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT2 >
+struct MultTrait< StaticVector<T1,N,true>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedMatrix<T1,SO,IT1>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT2 >
+struct MultTrait< HybridVector<T1,N,true>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedMatrix<T1,SO,IT1>, DynamicVector<T2,false,A2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT2, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1 >
+struct MultTrait< SplitCompressedMatrix<T1,SO,IT1>, CompressedVector<T2,false> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, false, IT1 >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT2 >
+struct MultTrait< CompressedVector<T1,true>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, true, IT2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MultTrait< SplitCompressedMatrix<T1,SO,IT1>, SplitCompressedVector<T2,false,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, false, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT1, typename IT2 >
+struct MultTrait< SplitCompressedVector<T1,true,IT1>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, true, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO,A1>, SplitCompressedVector<T2,false,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, false, IT2 >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedVector<T1,true,IT1>, CompressedMatrix<T2,SO,A2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, true, IT1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT1 >
+struct MultTrait< SplitCompressedMatrix<T1,SO1,IT1>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT1 >
+struct MultTrait< SplitCompressedMatrix<T1,SO1,IT1>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedMatrix<T1,SO1,IT1>, DynamicMatrix<T2,SO2,A2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT2, typename A1 >
+struct MultTrait< DynamicMatrix<T1,SO1,A1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,A2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, SO1, IT1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT2, typename A1 >
+struct MultTrait< CompressedMatrix<T1,SO1,A1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, SO1, IT2 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< SplitCompressedMatrix<T1,SO1,IT1>, SplitCompressedMatrix<T2,SO2,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, SO1, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT1 >
+struct DivTrait< SplitCompressedMatrix<T1,SO,IT1>, T2 >
+{
+   typedef SplitCompressedMatrix< typename DivTrait<T1,T2>::Type, SO, IT1 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MathTrait< SplitCompressedMatrix<T1,SO,IT1>, SplitCompressedMatrix<T2,SO,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MathTrait<T1,T2>::HighType, SO, typename MathTrait<IT1,IT2>::HighType >  HighType;
+   typedef SplitCompressedMatrix< typename MathTrait<T1,T2>::LowType , SO, typename MathTrait<IT1,IT2>::HighType >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT1 >
+struct SubmatrixTrait< SplitCompressedMatrix<T1,SO,IT1> >
+{
+   typedef SplitCompressedMatrix<T1,SO,IT1>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT1 >
+struct RowTrait< SplitCompressedMatrix<T1,SO,IT1> >
+{
+   typedef SplitCompressedVector<T1,true,IT1>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT1 >
+struct ColumnTrait< SplitCompressedMatrix<T1,SO,IT1> >
+{
+   typedef SplitCompressedVector<T1,false,IT1>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2473 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitCompressedVector.h
+//  \brief Implementation of a compressed vector with separate value and index arrays
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDVECTOR_H_
+#define _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/SplitIterator.h>
+#include <blaze/math/sparse/VectorAccessProxy.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup split_compressed_vector SplitCompressedVector
+// \ingroup sparse_vector
+*/
+/*!\brief Compressed sparse vector with separate value and index arrays.
+// \ingroup split_compressed_vector
+//
+// The SplitCompressedVector class is a variant of the CompressedVector class that stores the
+// values and the indices of the non-zero elements in two separate, contiguous arrays instead
+// of a single array of value-index-pairs (structure-of-arrays instead of array-of-structures).
+// In contrast to the CompressedVector, index lookups only touch the index array and the values
+// of the non-zero elements are directly accessible for vectorized kernels:
+
+   \code
+   template< typename Type, bool TF, typename IT >
+   class SplitCompressedVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. SplitCompressedVector can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default type is
+//          \c size_t. Choosing a smaller type (as for instance \c uint32_t) reduces the memory
+//          and bandwidth requirements of the index array, but restricts the size of the vector
+//          to the range of the type. Exceeding this range results in a \a std::invalid_argument
+//          exception.
+//
+// The SplitCompressedVector provides the same interface as the CompressedVector. Additionally,
+// the values() and indices() functions provide direct access to the two arrays:
+
+   \code
+   using blaze::SplitCompressedVector;
+   using blaze::columnVector;
+
+   SplitCompressedVector<double,columnVector> a( 100 );
+
+   a[42] = 2.0;
+   a.set( 45, -1.2 );
+   a.insert( 50, 3.7 );
+
+   for( SplitCompressedVector<double,columnVector>::Iterator it=a.begin(); it!=a.end(); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+
+   const double* values  = a.values();   // The values of the non-zero elements
+   const size_t* indices = a.indices();  // The indices of the non-zero elements
+   for( size_t k=0UL; k<a.nonZeros(); ++k ) {
+      ... = values[k] * x[indices[k]];
+   }
+   \endcode
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename IT = size_t >            // Index type
+class SplitCompressedVector : public SparseVector< SplitCompressedVector<Type,TF,IT>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef SplitCompressedVector<Type,TF,IT>   This;            //!< Type of this SplitCompressedVector instance.
+   typedef This                                ResultType;      //!< Result type for expression template evaluations.
+   typedef SplitCompressedVector<Type,!TF,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the compressed vector elements.
+   typedef IT                                  IndexType;       //!< Type of the indices of the non-zero elements.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const SplitCompressedVector&        CompositeType;   //!< Data type for composite expression templates.
+   typedef VectorAccessProxy<This>             Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant vector value.
+   typedef SplitIterator<Type,IT>              Iterator;        //!< Iterator over non-constant elements.
+   typedef SplitIterator<const Type,IT>        ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SplitCompressedVector with different data/element type.
+   */
+   template< typename ET >  // Data type of the other vector
+   struct Rebind {
+      typedef SplitCompressedVector<ET,TF,IT>  Other;  //!< The type of the other SplitCompressedVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                           explicit inline SplitCompressedVector();
+                           explicit inline SplitCompressedVector( size_t size );
+                           explicit inline SplitCompressedVector( size_t size, size_t nonzeros );
+                                    inline SplitCompressedVector( const SplitCompressedVector& sv );
+   template< typename VT >          inline SplitCompressedVector( const DenseVector<VT,TF>&  dv );
+   template< typename VT >          inline SplitCompressedVector( const SparseVector<VT,TF>& sv );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SplitCompressedVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index );
+   inline ConstReference operator[]( size_t index ) const;
+   inline Iterator       begin ();
+   inline ConstIterator  begin () const;
+   inline ConstIterator  cbegin() const;
+   inline Iterator       end   ();
+   inline ConstIterator  end   () const;
+   inline ConstIterator  cend  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                           inline SplitCompressedVector& operator= ( const SplitCompressedVector& rhs );
+   template< typename VT > inline SplitCompressedVector& operator= ( const DenseVector<VT,TF>&  rhs );
+   template< typename VT > inline SplitCompressedVector& operator= ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline SplitCompressedVector& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SplitCompressedVector& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SplitCompressedVector& operator*=( const Vector<VT,TF>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 size() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 nonZeros() const;
+                              inline void                   reset();
+                              inline void                   clear();
+                              inline Iterator               set   ( size_t index, const Type& value );
+                              inline Iterator               insert( size_t index, const Type& value );
+                              inline void                   erase ( size_t index );
+                              inline Iterator               erase ( Iterator pos );
+                              inline Iterator               erase ( Iterator first, Iterator last );
+                              inline void                   resize( size_t n, bool preserve=true );
+                                     void                   reserve( size_t n );
+   template< typename Other > inline SplitCompressedVector& scale( const Other& scalar );
+                              inline void                   swap( SplitCompressedVector& sv ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t index );
+   inline ConstIterator find      ( size_t index ) const;
+   inline Iterator      lowerBound( size_t index );
+   inline ConstIterator lowerBound( size_t index ) const;
+   inline Iterator      upperBound( size_t index );
+   inline ConstIterator upperBound( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void          append ( size_t index, const Type& value, bool check=false );
+   inline Type*         values ();
+   inline const Type*   values () const;
+   inline const IT* indices() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename VT > inline void assign   ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void assign   ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void addAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void addAssign( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void subAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void subAssign( const SparseVector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   position( size_t index ) const;
+          Iterator insert( size_t pos, size_t index, const Type& value );
+   inline size_t   extendCapacity() const;
+
+   static inline size_t checkSize( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  size_;      //!< The current size/dimension of the compressed vector.
+   size_t  capacity_;  //!< The maximum capacity of the compressed vector.
+   size_t  nonzeros_;  //!< The current number of non-zero elements of the compressed vector.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The indices of the non-zero elements.
+
+   static const Type   zero_;      //!< Neutral element for accesses to zero elements.
+   static const size_t maxIndex_;  //!< The largest index/offset representable by the index type.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+const Type SplitCompressedVector<Type,TF,IT>::zero_ = Type();
+
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+const size_t SplitCompressedVector<Type,TF,IT>::maxIndex_ = static_cast<IT>( -1 );
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SplitCompressedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector()
+   : size_    ( 0UL )   // The current size/dimension of the compressed vector
+   , capacity_( 0UL )   // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )   // The current number of non-zero elements of the compressed vector
+   , values_  ( NULL )  // The values of the non-zero elements
+   , indices_ ( NULL )  // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( size_t n )
+   : size_    ( checkSize( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )            // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL  )            // The current number of non-zero elements of the compressed vector
+   , values_  ( NULL )            // The values of the non-zero elements
+   , indices_ ( NULL )            // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( size_t n, size_t nonzeros )
+   : size_    ( checkSize( n ) )                 // The current size/dimension of the compressed vector
+   , capacity_( nonzeros )                       // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )                            // The current number of non-zero elements of the compressed vector
+   , values_  ( allocate<Type>( capacity_ ) )    // The values of the non-zero elements
+   , indices_ ( allocate<IT>( capacity_ ) )      // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SplitCompressedVector.
+//
+// \param sv Compressed vector to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( const SplitCompressedVector& sv )
+   : size_    ( sv.size_ )                       // The current size/dimension of the compressed vector
+   , capacity_( sv.nonzeros_ )                   // The maximum capacity of the compressed vector
+   , nonzeros_( sv.nonzeros_ )                   // The current number of non-zero elements of the compressed vector
+   , values_  ( allocate<Type>( capacity_ ) )    // The values of the non-zero elements
+   , indices_ ( allocate<IT>( capacity_ ) )      // The indices of the non-zero elements
+{
+   std::copy( sv.values_ , sv.values_ +nonzeros_, values_  );
+   std::copy( sv.indices_, sv.indices_+nonzeros_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense vectors.
+//
+// \param dv Dense vector to be copied.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the foreign dense vector
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( const DenseVector<VT,TF>& dv )
+   : size_    ( checkSize( (~dv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )                       // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL  )                       // The current number of non-zero elements of the compressed vector
+   , values_  ( NULL )                       // The values of the non-zero elements
+   , indices_ ( NULL )                       // The indices of the non-zero elements
+{
+   using blaze::assign;
+
+   assign( *this, ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse vectors.
+//
+// \param sv Sparse vector to be copied.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the foreign sparse vector
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( const SparseVector<VT,TF>& sv )
+   : size_    ( checkSize( (~sv).size() ) )      // The current size/dimension of the compressed vector
+   , capacity_( (~sv).nonZeros() )               // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )                            // The current number of non-zero elements of the compressed vector
+   , values_  ( allocate<Type>( capacity_ ) )    // The values of the non-zero elements
+   , indices_ ( allocate<IT>( capacity_ ) )      // The indices of the non-zero elements
+{
+   using blaze::assign;
+
+   assign( *this, ~sv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SplitCompressedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::~SplitCompressedVector()
+{
+   deallocate( values_  );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position \a index. In case the
+// compressed vector does not yet store an element for index \a index, a new element is inserted
+// into the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Reference
+   SplitCompressedVector<Type,TF,IT>::operator[]( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   return Reference( *this, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstReference
+   SplitCompressedVector<Type,TF,IT>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const size_t pos( position( index ) );
+
+   if( pos == nonzeros_ || indices_[pos] != index )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator SplitCompressedVector<Type,TF,IT>::begin()
+{
+   return Iterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator SplitCompressedVector<Type,TF,IT>::begin() const
+{
+   return ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator SplitCompressedVector<Type,TF,IT>::cbegin() const
+{
+   return ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator SplitCompressedVector<Type,TF,IT>::end()
+{
+   return Iterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator SplitCompressedVector<Type,TF,IT>::end() const
+{
+   return ConstIterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator SplitCompressedVector<Type,TF,IT>::cend() const
+{
+   return ConstIterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SplitCompressedVector.
+//
+// \param rhs Compressed vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The compressed vector is resized according to the given compressed vector and initialized
+// as a copy of this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>&
+   SplitCompressedVector<Type,TF,IT>::operator=( const SplitCompressedVector& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( rhs.nonzeros_ > capacity_ ) {
+      SplitCompressedVector tmp( rhs );
+      swap( tmp );
+   }
+   else {
+      std::copy( rhs.values_ , rhs.values_ +rhs.nonzeros_, values_  );
+      std::copy( rhs.indices_, rhs.indices_+rhs.nonzeros_, indices_ );
+      size_     = rhs.size_;
+      nonzeros_ = rhs.nonzeros_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense vectors.
+//
+// \param rhs Dense vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The vector is resized according to the given dense vector and initialized as a copy of
+// this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side dense vector
+inline SplitCompressedVector<Type,TF,IT>&
+   SplitCompressedVector<Type,TF,IT>::operator=( const DenseVector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      SplitCompressedVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      size_     = (~rhs).size();
+      nonzeros_ = 0UL;
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse vectors.
+//
+// \param rhs Sparse vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The vector is resized according to the given sparse vector and initialized as a copy of
+// this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline SplitCompressedVector<Type,TF,IT>&
+   SplitCompressedVector<Type,TF,IT>::operator=( const SparseVector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
+      SplitCompressedVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      size_     = (~rhs).size();
+      nonzeros_ = 0UL;
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,IT>& SplitCompressedVector<Type,TF,IT>::operator+=( const Vector<VT,TF>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   addAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,IT>& SplitCompressedVector<Type,TF,IT>::operator-=( const Vector<VT,TF>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   subAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,IT>& SplitCompressedVector<Type,TF,IT>::operator*=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   SplitCompressedVector<Type,TF,IT> tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a compressed vector
+//        and a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the compressed vector.
+//
+// This operator can only be used for built-in data types. Additionally, the elements of the
+// compressed vector must support the multiplication assignment operator for the given scalar
+// built-in data type.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector<Type,TF,IT> >::Type&
+   SplitCompressedVector<Type,TF,IT>::operator*=( Other rhs )
+{
+   for( size_t k=0UL; k<nonzeros_; ++k )
+      values_[k] *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a compressed vector by a scalar value
+//        (\f$ \vec{a}/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the compressed vector.
+//
+// This operator can only be used for built-in data types. Additionally, the elements of the
+// compressed vector must either support the multiplication assignment operator for the given
+// floating point data type or the division assignment operator for the given integral data
+// type.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SplitCompressedVector<Type,TF,IT> >::Type&
+   SplitCompressedVector<Type,TF,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t k=0UL; k<nonzeros_; ++k )
+         values_[k] *= tmp;
+   }
+   else {
+      for( size_t k=0UL; k<nonzeros_; ++k )
+         values_[k] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the compressed vector.
+//
+// \return The size of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed vector.
+//
+// \return The capacity of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed vector.
+//
+// \return The number of non-zero elements in the compressed vector.
+//
+// Note that the number of non-zero elements is always less than or equal to the current size
+// of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::reset()
+{
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed vector.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed vector is 0.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::clear()
+{
+   size_     = 0UL;
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed vector.
+//
+// \param index The index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Reference to the set value.
+//
+// This function sets the value of an element of the compressed vector. In case the sparse
+// vector already contains an element with index \a index its value is modified, else a new
+// element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::set( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const size_t pos( position( index ) );
+
+   if( pos != nonzeros_ && indices_[pos] == index ) {
+      values_[pos] = value;
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else return insert( pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Reference to the inserted value.
+// \exception std::invalid_argument Invalid compressed vector access index.
+//
+// This function inserts a new element into the compressed vector. However, duplicate elements
+// are not allowed. In case the sparse vector already contains an element with index \a index,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::insert( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const size_t pos( position( index ) );
+
+   if( pos != nonzeros_ && indices_[pos] == index )
+      throw std::invalid_argument( "Bad access index" );
+
+   return insert( pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param index The index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::erase( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const size_t pos( position( index ) );
+
+   if( pos != nonzeros_ && indices_[pos] == index ) {
+      std::copy( values_ +pos+1UL, values_ +nonzeros_, values_ +pos );
+      std::copy( indices_+pos+1UL, indices_+nonzeros_, indices_+pos );
+      --nonzeros_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::erase( Iterator pos )
+{
+   BLAZE_USER_ASSERT( pos >= begin() && pos <= end(), "Invalid compressed vector iterator" );
+
+   if( pos != end() ) {
+      const size_t k( pos - begin() );
+      std::copy( values_ +k+1UL, values_ +nonzeros_, values_ +k );
+      std::copy( indices_+k+1UL, indices_+nonzeros_, indices_+k );
+      --nonzeros_;
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed vector.
+//
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin() && first <= end(), "Invalid compressed vector iterator" );
+   BLAZE_USER_ASSERT( last  >= begin() && last  <= end(), "Invalid compressed vector iterator" );
+
+   if( first != last ) {
+      const size_t k1( first - begin() );
+      const size_t k2( last  - begin() );
+      std::copy( values_ +k2, values_ +nonzeros_, values_ +k1 );
+      std::copy( indices_+k2, indices_+nonzeros_, indices_+k1 );
+      nonzeros_ -= k2 - k1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed vector.
+//
+// \param n The new size of the compressed vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This function resizes the compressed vector to the given size \a n. In case the size is
+// reduced, all elements with an index larger than \a n-1 are discarded. During this operation,
+// new dynamic memory may be allocated in case the capacity of the compressed vector is too
+// small. Therefore this function potentially changes all vector elements. In order to preserve
+// the old vector values, the \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::resize( size_t n, bool preserve )
+{
+   checkSize( n );
+
+   if( preserve ) {
+      nonzeros_ = position( n );
+   }
+   else {
+      nonzeros_ = 0UL;
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed vector.
+//
+// \param n The new minimum capacity of the compressed vector.
+// \return void
+//
+// This function increases the capacity of the compressed vector to at least \a n elements.
+// The current values of the vector elements are preserved.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+void SplitCompressedVector<Type,TF,IT>::reserve( size_t n )
+{
+   if( n > capacity_ )
+   {
+      const size_t newCapacity( n );
+
+      // Allocating a new data and index array
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      IT*     newIndices( allocate<IT>( newCapacity ) );
+
+      // Replacing the old data and index array
+      std::copy( values_ , values_ +nonzeros_, newValues  );
+      std::copy( indices_, indices_+nonzeros_, newIndices );
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      capacity_ = newCapacity;
+
+      deallocate( newValues  );
+      deallocate( newIndices );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed vector by the scalar value \a scalar (\f$ \vec{a}=\vec{b}*s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the compressed vector.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SplitCompressedVector<Type,TF,IT>& SplitCompressedVector<Type,TF,IT>::scale( const Other& scalar )
+{
+   for( size_t k=0UL; k<nonzeros_; ++k )
+      values_[k] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+//
+// \param sv The compressed vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::swap( SplitCompressedVector& sv ) /* throw() */
+{
+   std::swap( size_, sv.size_ );
+   std::swap( capacity_, sv.capacity_ );
+   std::swap( nonzeros_, sv.nonzeros_ );
+   std::swap( values_, sv.values_ );
+   std::swap( indices_, sv.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searching the position of an element within the index array.
+//
+// \param index The index of the search element.
+// \return The position of the first element with an index not less than \a index.
+//
+// This function performs a binary search on the index array. Since the indices are stored
+// contiguously, no values are touched during the search.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::position( size_t index ) const
+{
+   return std::lower_bound( indices_, indices_+nonzeros_, index ) - indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param pos The position of the new element.
+// \param index The index of the new element. The index must be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::insert( size_t pos, size_t index, const Type& value )
+{
+   if( nonzeros_ != capacity_ ) {
+      std::copy_backward( values_ +pos, values_ +nonzeros_, values_ +nonzeros_+1UL );
+      std::copy_backward( indices_+pos, indices_+nonzeros_, indices_+nonzeros_+1UL );
+      values_ [pos] = value;
+      indices_[pos] = index;
+      ++nonzeros_;
+
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else {
+      size_t newCapacity( extendCapacity() );
+
+      Type*   newValues ( allocate<Type>( newCapacity ) );
+      IT*     newIndices( allocate<IT>( newCapacity ) );
+
+      std::copy( values_ , values_ +pos, newValues  );
+      std::copy( indices_, indices_+pos, newIndices );
+      newValues [pos] = value;
+      newIndices[pos] = index;
+      std::copy( values_ +pos, values_ +nonzeros_, newValues +pos+1UL );
+      std::copy( indices_+pos, indices_+nonzeros_, newIndices+pos+1UL );
+
+      std::swap( newValues , values_  );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues  );
+      deallocate( newIndices );
+      capacity_ = newCapacity;
+      ++nonzeros_;
+
+      return Iterator( values_+pos, indices_+pos );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new vector capacity.
+//
+// \return The new compressed vector capacity.
+//
+// This function calculates a new vector capacity based on the current capacity of the sparse
+// vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::extendCapacity() const
+{
+   using blaze::max;
+   using blaze::min;
+
+   size_t nonzeros( 2UL*capacity_+1UL );
+   nonzeros = max( nonzeros, 7UL );
+   nonzeros = min( nonzeros, size_ );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity_, "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector size against the range of the index type.
+//
+// \param n The vector size to be checked.
+// \return The given vector size.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::checkSize( size_t n )
+{
+   if( n > maxIndex_ )
+      throw std::invalid_argument( "Vector size exceeds the range of the index type" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// vector. It specifically searches for the element with index \a index. In case the element
+// is found, the function returns an iterator to the element. Otherwise an iterator just past
+// the last non-zero element of the compressed vector (the end() iterator) is returned. Note
+// that the returned compressed vector iterator is subject to invalidation due to inserting
+// operations via the subscript operator or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::find( size_t index )
+{
+   const size_t pos( position( index ) );
+
+   if( pos != nonzeros_ && indices_[pos] == index )
+      return Iterator( values_+pos, indices_+pos );
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::find( size_t index ) const
+{
+   const size_t pos( position( index ) );
+
+   if( pos != nonzeros_ && indices_[pos] == index )
+      return ConstIterator( values_+pos, indices_+pos );
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a compressed vector, this function returns an iterator to the first element with
+// an index not less then the given index. In combination with the upperBound() function this
+// function can be used to create a pair of iterators specifying a range of indices. Note that
+// the returned compressed vector iterator is subject to invalidation due to inserting operations
+// via the subscript operator or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::lowerBound( size_t index )
+{
+   const size_t pos( position( index ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::lowerBound( size_t index ) const
+{
+   const size_t pos( position( index ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a compressed vector, this function returns an iterator to the first element with
+// an index greater then the given index. In combination with the upperBound() function this
+// function can be used to create a pair of iterators specifying a range of indices. Note that
+// the returned compressed vector iterator is subject to invalidation due to inserting operations
+// via the subscript operator or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::Iterator
+   SplitCompressedVector<Type,TF,IT>::upperBound( size_t index )
+{
+   const size_t pos( std::upper_bound( indices_, indices_+nonzeros_, index ) - indices_ );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::upperBound( size_t index ) const
+{
+   const size_t pos( std::upper_bound( indices_, indices_+nonzeros_, index ) - indices_ );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed vector with elements. It
+// appends a new element to the end of the compressed vector without any memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the compressed vector
+//  - the current number of non-zero elements must be smaller than the capacity of the vector
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::append( size_t index, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( nonzeros_ < capacity_, "Not enough reserved capacity" );
+   BLAZE_USER_ASSERT( nonzeros_ == 0UL || indices_[nonzeros_-1UL] < index, "Index is not strictly increasing" );
+
+   values_[nonzeros_] = value;
+
+   if( !check || !isDefault( values_[nonzeros_] ) ) {
+      indices_[nonzeros_] = index;
+      ++nonzeros_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements.
+//
+// \return Pointer to the value of the first non-zero element.
+//
+// This function returns a pointer to the contiguous array of the values of the non-zero
+// elements. The array contains exactly nonZeros() elements. Note that the returned pointer
+// is subject to invalidation due to inserting operations!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline Type* SplitCompressedVector<Type,TF,IT>::values()
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements.
+//
+// \return Pointer to the value of the first non-zero element.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline const Type* SplitCompressedVector<Type,TF,IT>::values() const
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the indices of the non-zero elements.
+//
+// \return Pointer to the index of the first non-zero element.
+//
+// This function returns a pointer to the contiguous, strictly increasing array of the indices
+// of the non-zero elements. The array contains exactly nonZeros() elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline const IT* SplitCompressedVector<Type,TF,IT>::indices() const
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedVector<Type,TF,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedVector<Type,TF,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool SplitCompressedVector<Type,TF,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SplitCompressedVector<Type,TF,IT>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonzeros_ == 0UL, "Invalid non-zero elements detected" );
+
+   for( size_t i=0UL; i<size_; ++i )
+   {
+      if( nonzeros_ == capacity_ )
+         reserve( extendCapacity() );
+
+      values_[nonzeros_] = (~rhs)[i];
+
+      if( !isDefault( values_[nonzeros_] ) ) {
+         indices_[nonzeros_] = i;
+         ++nonzeros_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SplitCompressedVector<Type,TF,IT>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonzeros_ == 0UL, "Invalid non-zero elements detected" );
+
+   typedef typename VT::ConstIterator  RhsIterator;
+
+   for( RhsIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      append( element->index(), element->value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SplitCompressedVector<Type,TF,IT>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   typedef typename AddTrait<This,typename VT::ResultType>::Type  AddType;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( AddType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( AddType, TF );
+   BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename AddType::CompositeType );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const AddType tmp( serial( *this + (~rhs) ) );
+   reset();
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SplitCompressedVector<Type,TF,IT>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SplitCompressedVector<Type,TF,IT> tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SplitCompressedVector<Type,TF,IT>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   typedef typename SubTrait<This,typename VT::ResultType>::Type  SubType;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( SubType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( SubType, TF );
+   BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename SubType::CompositeType );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   const SubType tmp( serial( *this - (~rhs) ) );
+   reset();
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SplitCompressedVector<Type,TF,IT>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SplitCompressedVector<Type,TF,IT> tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SplitCompressedVector operators */
+//@{
+template< typename Type, bool TF, typename IT >
+inline void reset( SplitCompressedVector<Type,TF,IT>& v );
+
+template< typename Type, bool TF, typename IT >
+inline void clear( SplitCompressedVector<Type,TF,IT>& v );
+
+template< typename Type, bool TF, typename IT >
+inline bool isDefault( const SplitCompressedVector<Type,TF,IT>& v );
+
+template< typename Type, bool TF, typename IT >
+inline void swap( SplitCompressedVector<Type,TF,IT>& a, SplitCompressedVector<Type,TF,IT>& b ) /* throw() */;
+
+template< typename Type, bool TF, typename IT >
+inline void move( SplitCompressedVector<Type,TF,IT>& dst, SplitCompressedVector<Type,TF,IT>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The compressed vector to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void reset( SplitCompressedVector<Type,TF,IT>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The compressed vector to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void clear( SplitCompressedVector<Type,TF,IT>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed vector is in default state.
+// \ingroup split_compressed_vector
+//
+// \param v The compressed vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the compressed vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false. The following example demonstrates the use of the \a isDefault() function:
+
+   \code
+   blaze::SplitCompressedVector<double> a;
+   // ... Resizing and initialization
+   if( isDefault( a ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isDefault( const SplitCompressedVector<Type,TF,IT>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+// \ingroup split_compressed_vector
+//
+// \param a The first compressed vector to be swapped.
+// \param b The second compressed vector to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void swap( SplitCompressedVector<Type,TF,IT>& a, SplitCompressedVector<Type,TF,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one compressed vector to another.
+// \ingroup split_compressed_vector
+//
+// \param dst The destination vector.
+// \param src The source vector.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void move( SplitCompressedVector<Type,TF,IT>& dst, SplitCompressedVector<Type,TF,IT>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSPLITCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct IsSplitCompressed< SplitCompressedVector<T,TF,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct IsResizable< SplitCompressedVector<T,TF,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename T2, size_t N, typename IT1 >
+struct AddTrait< SplitCompressedVector<T1,TF,IT1>, StaticVector<T2,N,TF> >
+{
+   typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename IT2 >
+struct AddTrait< StaticVector<T1,N,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, size_t N, typename IT1 >
+struct AddTrait< SplitCompressedVector<T1,TF,IT1>, HybridVector<T2,N,TF> >
+{
+   typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename IT2 >
+struct AddTrait< HybridVector<T1,N,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1, typename A2 >
+struct AddTrait< SplitCompressedVector<T1,TF,IT1>, DynamicVector<T2,TF,A2> >
+{
+   typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT2, typename A1 >
+struct AddTrait< DynamicVector<T1,TF,A1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct AddTrait< SplitCompressedVector<T1,TF,IT1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename AddTrait<T1,T2>::Type, TF, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1 >
+struct AddTrait< SplitCompressedVector<T1,TF,IT1>, CompressedVector<T2,TF> >
+{
+   typedef SplitCompressedVector< typename AddTrait<T1,T2>::Type, TF, IT1 >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT2 >
+struct AddTrait< CompressedVector<T1,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename AddTrait<T1,T2>::Type, TF, IT2 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename T2, size_t N, typename IT1 >
+struct SubTrait< SplitCompressedVector<T1,TF,IT1>, StaticVector<T2,N,TF> >
+{
+   typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename IT2 >
+struct SubTrait< StaticVector<T1,N,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, size_t N, typename IT1 >
+struct SubTrait< SplitCompressedVector<T1,TF,IT1>, HybridVector<T2,N,TF> >
+{
+   typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename IT2 >
+struct SubTrait< HybridVector<T1,N,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1, typename A2 >
+struct SubTrait< SplitCompressedVector<T1,TF,IT1>, DynamicVector<T2,TF,A2> >
+{
+   typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT2, typename A1 >
+struct SubTrait< DynamicVector<T1,TF,A1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct SubTrait< SplitCompressedVector<T1,TF,IT1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename SubTrait<T1,T2>::Type, TF, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1 >
+struct SubTrait< SplitCompressedVector<T1,TF,IT1>, CompressedVector<T2,TF> >
+{
+   typedef SplitCompressedVector< typename SubTrait<T1,T2>::Type, TF, IT1 >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT2 >
+struct SubTrait< CompressedVector<T1,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename SubTrait<T1,T2>::Type, TF, IT2 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename T2, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,TF,IT1>, T2 >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT1 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool TF, typename IT2 >
+struct MultTrait< T1, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT2 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool TF, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,TF,IT1>, StaticVector<T2,N,TF> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT1 >  Type;
+};
+
+template< typename T1, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,false,IT1>, StaticVector<T2,N,true> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, true, IT1 >  Type;
+};
+
+template< typename T1, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,true,IT1>, StaticVector<T2,N,false> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename IT2 >
+struct MultTrait< StaticVector<T1,N,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT2 >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT2 >
+struct MultTrait< StaticVector<T1,N,false>, SplitCompressedVector<T2,true,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT2 >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT2 >
+struct MultTrait< StaticVector<T1,N,true>, SplitCompressedVector<T2,false,IT2> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, bool TF, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,TF,IT1>, HybridVector<T2,N,TF> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT1 >  Type;
+};
+
+template< typename T1, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,false,IT1>, HybridVector<T2,N,true> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, true, IT1 >  Type;
+};
+
+template< typename T1, typename T2, size_t N, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,true,IT1>, HybridVector<T2,N,false> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, size_t N, bool TF, typename T2, typename IT2 >
+struct MultTrait< HybridVector<T1,N,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT2 >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT2 >
+struct MultTrait< HybridVector<T1,N,false>, SplitCompressedVector<T2,true,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT2 >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT2 >
+struct MultTrait< HybridVector<T1,N,true>, SplitCompressedVector<T2,false,IT2> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedVector<T1,TF,IT1>, DynamicVector<T2,TF,A2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT1 >  Type;
+};
+
+template< typename T1, typename T2, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedVector<T1,false,IT1>, DynamicVector<T2,true,A2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, true, IT1 >  Type;
+};
+
+template< typename T1, typename T2, typename IT1, typename A2 >
+struct MultTrait< SplitCompressedVector<T1,true,IT1>, DynamicVector<T2,false,A2> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT2, typename A1 >
+struct MultTrait< DynamicVector<T1,TF,A1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT2 >  Type;
+};
+
+template< typename T1, typename T2, typename IT2, typename A1 >
+struct MultTrait< DynamicVector<T1,false,A1>, SplitCompressedVector<T2,true,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT2 >  Type;
+};
+
+template< typename T1, typename T2, typename IT2, typename A1 >
+struct MultTrait< DynamicVector<T1,true,A1>, SplitCompressedVector<T2,false,IT2> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct MultTrait< SplitCompressedVector<T1,TF,IT1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT1 >
+struct MultTrait< SplitCompressedVector<T1,TF,IT1>, CompressedVector<T2,TF> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT1 >  Type;
+};
+
+template< typename T1, bool TF, typename T2, typename IT2 >
+struct MultTrait< CompressedVector<T1,TF>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MultTrait<T1,T2>::Type, TF, IT2 >  Type;
+};
+
+template< typename T1, typename T2, typename IT1, typename IT2 >
+struct MultTrait< SplitCompressedVector<T1,false,IT1>, SplitCompressedVector<T2,true,IT2> >
+{
+   typedef SplitCompressedMatrix< typename MultTrait<T1,T2>::Type, false, typename MathTrait<IT1,IT2>::HighType >  Type;
+};
+
+template< typename T1, typename T2, typename IT1, typename IT2 >
+struct MultTrait< SplitCompressedVector<T1,true,IT1>, SplitCompressedVector<T2,false,IT2> >
+{
+   typedef typename MultTrait<T1,T2>::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CROSSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, typename IT1 >
+struct CrossTrait< SplitCompressedVector<T1,false,IT1>, StaticVector<T2,3UL,false> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+
+template< typename T1, typename T2, typename IT2 >
+struct CrossTrait< StaticVector<T1,3UL,false>, SplitCompressedVector<T2,false,IT2> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+
+template< typename T1, typename T2, size_t N, typename IT1 >
+struct CrossTrait< SplitCompressedVector<T1,false,IT1>, HybridVector<T2,N,false> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT2 >
+struct CrossTrait< HybridVector<T1,N,false>, SplitCompressedVector<T2,false,IT2> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+
+template< typename T1, typename T2, typename IT1, typename A2 >
+struct CrossTrait< SplitCompressedVector<T1,false,IT1>, DynamicVector<T2,false,A2> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+
+template< typename T1, typename T2, typename IT2, typename A1 >
+struct CrossTrait< DynamicVector<T1,false,A1>, SplitCompressedVector<T2,false,IT2> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+
+template< typename T1, typename T2, typename IT1, typename IT2 >
+struct CrossTrait< SplitCompressedVector<T1,false,IT1>, SplitCompressedVector<T2,false,IT2> >
+{
+ private:
+   typedef typename MultTrait<T1,T2>::Type  T;
+
+ public:
+   typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename T2, typename IT1 >
+struct DivTrait< SplitCompressedVector<T1,TF,IT1>, T2 >
+{
+   typedef SplitCompressedVector< typename DivTrait<T1,T2>::Type, TF, IT1 >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct MathTrait< SplitCompressedVector<T1,TF,IT1>, SplitCompressedVector<T2,TF,IT2> >
+{
+   typedef SplitCompressedVector< typename MathTrait<T1,T2>::HighType, TF, typename MathTrait<IT1,IT2>::HighType >  HighType;
+   typedef SplitCompressedVector< typename MathTrait<T1,T2>::LowType , TF, typename MathTrait<IT1,IT2>::HighType >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTORTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename IT1 >
+struct SubvectorTrait< SplitCompressedVector<T1,TF,IT1> >
+{
+   typedef SplitCompressedVector<T1,TF,IT1>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
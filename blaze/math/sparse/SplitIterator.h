@@ -0,0 +1,385 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitIterator.h
+//  \brief Header file for the SplitIterator class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITITERATOR_H_
+#define _BLAZE_MATH_SPARSE_SPLITITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the non-zero elements of sparse vectors and matrices with split storage.
+// \ingroup math
+//
+// The SplitIterator class template represents an iterator over the non-zero elements of a sparse
+// vector or sparse matrix that stores the values and the indices of its non-zero elements in two
+// separate, contiguous arrays (see for instance the SplitCompressedVector and SplitCompressedMatrix
+// class templates). In contrast to a plain pointer to a ValueIndexPair, the iterator references
+// both arrays in parallel. It provides the same interface as the iterators of the CompressedVector
+// and CompressedMatrix class templates, i.e. the value and the index of the current element are
+// accessible via the \a value() and \a index() member functions. The type of the stored indices
+// can be specified via the second template parameter (by default \c size_t), the \a index()
+// function always returns the index as \c size_t:
+
+   \code
+   for( SplitIterator<double> it=begin; it!=end; ++it ) {
+      it->value() *= 2.0;          // Modification of the value of the non-zero element
+      const size_t j = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// In case the given data type \a Type is const qualified, the values of the non-zero elements
+// cannot be modified via the iterator. An iterator over non-const elements can be converted to
+// an iterator over const elements.
+*/
+template< typename Type           // Type of the values of the non-zero elements
+        , typename IT = size_t >  // Type of the indices of the non-zero elements
+class SplitIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Value-index-pair representing a single non-zero element.
+   typedef ValueIndexPair< typename RemoveConst<Type>::Type >  Element;
+
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef Element                          ValueType;         //!< Type of the underlying elements.
+   typedef ValueType*                       PointerType;       //!< Pointer return type.
+   typedef ValueType&                       ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Default constructor for the SplitIterator class.
+   */
+   inline SplitIterator()
+      : value_( NULL )  // Pointer to the value of the current non-zero element
+      , index_( NULL )  // Pointer to the index of the current non-zero element
+   {}
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Constructor for the SplitIterator class.
+   //
+   // \param value Pointer to the value of the non-zero element.
+   // \param index Pointer to the index of the non-zero element.
+   */
+   inline SplitIterator( Type* value, const IT* index )
+      : value_( value )  // Pointer to the value of the current non-zero element
+      , index_( index )  // Pointer to the index of the current non-zero element
+   {}
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Conversion constructor from different SplitIterator instances.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename Other >  // Type of the values of the foreign iterator
+   inline SplitIterator( const SplitIterator<Other,IT>& it )
+      : value_( it.value_ )  // Pointer to the value of the current non-zero element
+      , index_( it.index_ )  // Pointer to the index of the current non-zero element
+   {}
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline SplitIterator& operator++() {
+      ++value_;
+      ++index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SplitIterator operator++( int ) {
+      const SplitIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline SplitIterator& operator--() {
+      --value_;
+      --index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SplitIterator operator--( int ) {
+      const SplitIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return The incremented iterator.
+   */
+   inline SplitIterator& operator+=( ptrdiff_t inc ) {
+      value_ += inc;
+      index_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return The decremented iterator.
+   */
+   inline SplitIterator& operator-=( ptrdiff_t dec ) {
+      value_ -= dec;
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a SplitIterator and an integral value.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   inline const SplitIterator operator+( ptrdiff_t inc ) const {
+      return SplitIterator( value_+inc, index_+inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a SplitIterator and an integral value.
+   //
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   inline const SplitIterator operator-( ptrdiff_t dec ) const {
+      return SplitIterator( value_-dec, index_-dec );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the sparse element at the current iterator position.
+   //
+   // \return The current value-index-pair.
+   */
+   inline const Element operator*() const {
+      return Element( *value_, *index_ );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the sparse element at the current iterator position.
+   //
+   // \return Reference to the iterator itself, which provides the value() and index() functions.
+   */
+   inline const SplitIterator* operator->() const {
+      return this;
+   }
+   //**********************************************************************************************
+
+   //**Value function******************************************************************************
+   /*!\brief Access to the current value of the sparse element.
+   //
+   // \return The current value of the sparse element.
+   */
+   inline Type& value() const {
+      return *value_;
+   }
+   //**********************************************************************************************
+
+   //**Index function******************************************************************************
+   /*!\brief Access to the current index of the sparse element.
+   //
+   // \return The current index of the sparse element.
+   */
+   inline size_t index() const {
+      return *index_;
+   }
+   //**********************************************************************************************
+
+   //**Indices function****************************************************************************
+   /*!\brief Access to the contiguously stored indices of the current and all following elements.
+   //
+   // \return Pointer to the index of the current sparse element.
+   */
+   inline const IT* indices() const {
+      return index_;
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline bool operator==( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ == rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline bool operator!=( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ != rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline bool operator<( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ < rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline bool operator>( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ > rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline bool operator<=( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ <= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two SplitIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline bool operator>=( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ >= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two iterators.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   template< typename Other >  // Type of the values of the right-hand side iterator
+   inline DifferenceType operator-( const SplitIterator<Other,IT>& rhs ) const {
+      return index_ - rhs.index_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*         value_;  //!< Pointer to the value of the current non-zero element.
+   const IT*     index_;  //!< Pointer to the index of the current non-zero element.
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename Other, typename OtherIT > friend class SplitIterator;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
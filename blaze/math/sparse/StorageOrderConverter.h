@@ -0,0 +1,351 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/StorageOrderConverter.h
+//  \brief Header file for the StorageOrderConverter class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_STORAGEORDERCONVERTER_H_
+#define _BLAZE_MATH_SPARSE_STORAGEORDERCONVERTER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Execute.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel storage order conversion of sparse matrices.
+// \ingroup sparse_matrix
+//
+// The StorageOrderConverter class converts a row-major sparse matrix into the compressed storage
+// of a column-major sparse matrix and vice versa, which is equivalent to the transposition of
+// the compressed storage. The conversion is performed as a counting sort on the minor indices
+// of the given matrix:
+//
+//  -# During construction, the rows/columns of the given matrix are split into contiguous
+//     chunks and the elements of each chunk are counted per minor index (column-count
+//     histogram). The chunk histograms are then combined into the scatter positions of all
+//     chunks by an exclusive prefix sum.
+//  -# The fill() function scatters the elements of all chunks directly into the preallocated
+//     element storage of the target matrix.
+//
+// Both the counting and the scattering of the chunks are executed via the SMP backend. Since
+// every chunk writes to its own, precomputed section of each row/column and the chunks are
+// ordered by their major index, the resulting rows/columns are sorted without any further step.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+class StorageOrderConverter : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType    ET;           //!< Element type of the sparse matrix.
+   typedef typename MT::ConstIterator  RhsIterator;  //!< Iterator over the elements of the sparse matrix.
+   typedef ValueIndexPair<ET>          ElementType;  //!< Type of the converted elements.
+   //**********************************************************************************************
+
+   //**CountTask class definition******************************************************************
+   /*!\brief Task for the counting of the elements of a chunk per minor index.
+   */
+   struct CountTask
+   {
+      inline CountTask( const StorageOrderConverter& converter, size_t* counts )
+         : converter_( converter )  // The converter performing the conversion
+         , counts_   ( counts    )  // The per chunk minor index counts
+      {}
+
+      inline void operator()( size_t chunk ) const {
+         converter_.countChunk( chunk, counts_ + chunk*converter_.minors_ );
+      }
+
+      const StorageOrderConverter& converter_;  //!< The converter performing the conversion.
+      size_t* counts_;                          //!< The per chunk minor index counts.
+   };
+   //**********************************************************************************************
+
+   //**FillTask class definition*******************************************************************
+   /*!\brief Task for the scattering of the elements of a chunk into the element storage.
+   */
+   template< typename Element >  // Type of the elements of the target sparse matrix
+   struct FillTask
+   {
+      inline FillTask( StorageOrderConverter& converter, Element* elements )
+         : converter_( converter )  // The converter performing the conversion
+         , elements_ ( elements  )  // The element storage of the target matrix
+      {}
+
+      inline void operator()( size_t chunk ) const {
+         converter_.fillChunk( chunk, elements_ );
+      }
+
+      StorageOrderConverter& converter_;  //!< The converter performing the conversion.
+      Element* elements_;                 //!< The element storage of the target matrix.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline StorageOrderConverter( const SparseMatrix<MT,SO>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+
+   template< typename Element >
+   inline void fill( Element* elements, Element** begin, Element** end );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void countChunk( size_t chunk, size_t* counts ) const;
+
+   template< typename Element >
+   inline void fillChunk( size_t chunk, Element* elements );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const MT& sm_;                   //!< The sparse matrix to be converted.
+   size_t majors_;                  //!< The number of rows/columns of the sparse matrix.
+   size_t minors_;                  //!< The number of columns/rows of the sparse matrix.
+   size_t chunks_;                  //!< The number of chunks of the conversion.
+   size_t nonzeros_;                //!< The total number of counted elements.
+   std::vector<size_t> positions_;  //!< The per chunk scatter positions of all minor indices.
+   std::vector<size_t> offsets_;    //!< The offsets of all minor indices within the storage.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the StorageOrderConverter class template.
+//
+// \param sm The sparse matrix to be converted.
+//
+// This constructor counts the elements of the given sparse matrix per minor index and computes
+// the scatter positions of all chunks. Note that the given matrix is referenced and therefore
+// has to outlive the converter.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline StorageOrderConverter<MT,SO>::StorageOrderConverter( const SparseMatrix<MT,SO>& sm )
+   : sm_       ( ~sm )                                     // The sparse matrix to be converted
+   , majors_   ( SO ? (~sm).columns() : (~sm).rows() )     // The number of rows/columns of the sparse matrix
+   , minors_   ( SO ? (~sm).rows()    : (~sm).columns() )  // The number of columns/rows of the sparse matrix
+   , chunks_   ( 1UL )                                     // The number of chunks of the conversion
+   , nonzeros_ ( 0UL )                                     // The total number of counted elements
+   , positions_()                                          // The per chunk scatter positions
+   , offsets_  ( minors_+1UL, 0UL )                        // The offsets of all minor indices
+{
+   const size_t threads( getNumThreads() );
+
+   if( threads > 1UL && majors_ > 1UL && (~sm).nonZeros() >= SMP_SMATTRANSPOSE_THRESHOLD )
+      chunks_ = ( threads < majors_ )?( threads ):( majors_ );
+
+   if( majors_ == 0UL || minors_ == 0UL )
+      return;
+
+   // Counting the elements per chunk and minor index
+   positions_.resize( chunks_*minors_, 0UL );
+   smpExecute( CountTask( *this, &positions_[0] ), chunks_ );
+
+   // Computing the offsets of all minor indices and the scatter positions of all chunks
+   size_t offset( 0UL );
+
+   for( size_t j=0UL; j<minors_; ++j ) {
+      offsets_[j] = offset;
+      for( size_t chunk=0UL; chunk<chunks_; ++chunk ) {
+         const size_t count( positions_[chunk*minors_+j] );
+         positions_[chunk*minors_+j] = offset;
+         offset += count;
+      }
+   }
+
+   offsets_[minors_] = nonzeros_ = offset;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of elements of the converted matrix.
+//
+// \return The total number of elements.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline size_t StorageOrderConverter<MT,SO>::size() const
+{
+   return nonzeros_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters the elements of the sparse matrix into the given element storage.
+//
+// \param elements The element storage of at least size size().
+// \param begin Array of minors+1 pointers to the first element of each row/column.
+// \param end Array of pointers one past the last element of each row/column.
+// \return void
+//
+// This function scatters all elements of the sparse matrix into the given element storage and
+// sets the \a begin and \a end pointers of all rows/columns of the target matrix. The additional
+// last \a begin pointer is set one past the last element. Since the scatter positions are
+// consumed by this function, it must be called only once.
+*/
+template< typename MT         // Type of the sparse matrix
+        , bool SO >           // Storage order of the sparse matrix
+template< typename Element >  // Type of the elements of the target sparse matrix
+inline void StorageOrderConverter<MT,SO>::fill( Element* elements, Element** begin, Element** end )
+{
+   for( size_t j=0UL; j<minors_; ++j ) {
+      begin[j] = elements + offsets_[j];
+      end[j]   = elements + offsets_[j+1UL];
+   }
+   begin[minors_] = elements + nonzeros_;
+
+   if( majors_ == 0UL || minors_ == 0UL )
+      return;
+
+   smpExecute( FillTask<Element>( *this, elements ), chunks_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counts the elements of a single chunk per minor index.
+//
+// \param chunk The index of the chunk.
+// \param counts The minor index counts of the chunk.
+// \return void
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline void StorageOrderConverter<MT,SO>::countChunk( size_t chunk, size_t* counts ) const
+{
+   const size_t first( (   chunk     * majors_ ) / chunks_ );
+   const size_t last ( ( (chunk+1UL) * majors_ ) / chunks_ );
+
+   for( size_t i=first; i<last; ++i ) {
+      const RhsIterator end( sm_.end(i) );
+      for( RhsIterator element=sm_.begin(i); element!=end; ++element )
+         ++counts[element->index()];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scatters the elements of a single chunk into the given element storage.
+//
+// \param chunk The index of the chunk.
+// \param elements The element storage of the target matrix.
+// \return void
+*/
+template< typename MT         // Type of the sparse matrix
+        , bool SO >           // Storage order of the sparse matrix
+template< typename Element >  // Type of the elements of the target sparse matrix
+inline void StorageOrderConverter<MT,SO>::fillChunk( size_t chunk, Element* elements )
+{
+   const size_t first( (   chunk     * majors_ ) / chunks_ );
+   const size_t last ( ( (chunk+1UL) * majors_ ) / chunks_ );
+
+   size_t* const positions( &positions_[chunk*minors_] );
+
+   for( size_t i=first; i<last; ++i ) {
+      const RhsIterator end( sm_.end(i) );
+      for( RhsIterator element=sm_.begin(i); element!=end; ++element ) {
+         elements[positions[element->index()]++] = ElementType( element->value(), i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,545 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TriangularSolver.h
+//  \brief Header file for the sparse triangular solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIANGULARSOLVER_H_
+#define _BLAZE_MATH_SPARSE_TRIANGULARSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Execute.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solver for sparse triangular systems of equations.
+// \ingroup sparse_matrix
+//
+// The TriangularSolver class template solves triangular systems of equations \f$ A*x=b \f$ by
+// means of forward substitution (for lower triangular matrices) or backward substitution (for
+// upper triangular matrices). The type of the triangular matrix is given by the template argument
+// \a MT, which has to be a row-major, lower or upper sparse matrix type (as for instance the
+// LowerMatrix, UniLowerMatrix, UpperMatrix, and UniUpperMatrix adaptors for a CompressedMatrix).
+// For uni-triangular matrices the diagonal elements are not accessed. Strictly triangular
+// matrices are singular and therefore not supported.
+//
+// The solver performs a one-time analysis of the sparsity pattern of the given matrix during
+// construction: Every row is assigned to a level such that all rows it depends on belong to
+// preceding levels. Subsequently, the solve() function processes the rows level by level,
+// where all rows within a single level are independent of each other. In case a level contains
+// at least SMP_SMATSOLVE_THRESHOLD rows, the level is processed in parallel by means of the
+// active shared memory parallelization. Since the analysis only depends on the sparsity pattern,
+// a single solver can be used for an arbitrary number of solves as long as the sparsity pattern
+// of the matrix is not changed. Changes of the values of the non-zero elements, however, are
+// allowed. The following example demonstrates the application of an incomplete Cholesky factor
+// as preconditioner:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+   using blaze::UpperMatrix;
+
+   LowerMatrix< CompressedMatrix<double> > L;
+   UpperMatrix< CompressedMatrix<double> > U;
+   // ... Computing the incomplete factorization L*U (with U = trans(L))
+
+   const blaze::TriangularSolver< LowerMatrix< CompressedMatrix<double> > > forward ( L );
+   const blaze::TriangularSolver< UpperMatrix< CompressedMatrix<double> > > backward( U );
+
+   DynamicVector<double> r, z;
+   // ... Iterative solver loop
+
+   forward.solve ( z, r );  // Solving L*z=r
+   backward.solve( z, z );  // Solving U*z=z in-place
+   \endcode
+
+// Note that the solver holds a reference to the given matrix. Therefore the matrix must not be
+// destroyed before the solver. In case only a single system has to be solved, the solve() free
+// function provides a serial substitution without any analysis phase.
+*/
+template< typename MT >  // Type of the triangular sparse matrix
+class TriangularSolver : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ConstIterator  ConstIterator;  //!< Iterator over the non-zero elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the direction of the substitution.
+   enum { lower = IsLower<MT>::value };
+
+   //! Compilation switch for the handling of the diagonal elements.
+   enum { unit = IsUniTriangular<MT>::value };
+   //**********************************************************************************************
+
+   //**LevelTask class definition******************************************************************
+   /*!\brief Task for the parallel solution of a chunk of the rows of a single level.
+   */
+   template< typename VT1    // Type of the left-hand side dense vector
+           , typename VT2 >  // Type of the right-hand side dense vector
+   struct LevelTask
+   {
+      inline LevelTask( const TriangularSolver& solver, VT1& x, const VT2& b,
+                        size_t first, size_t last, size_t chunks )
+         : solver_( solver )  // The solver performing the substitution
+         , x_     ( x      )  // The left-hand side dense vector
+         , b_     ( b      )  // The right-hand side dense vector
+         , first_ ( first  )  // The index of the first row of the level
+         , last_  ( last   )  // The index one past the last row of the level
+         , chunks_( chunks )  // The total number of chunks
+      {}
+
+      inline void operator()( size_t chunk ) const {
+         const size_t rows( last_ - first_ );
+         solver_.solveRows( x_, b_, first_ + ( chunk*rows ) / chunks_,
+                                    first_ + ( (chunk+1UL)*rows ) / chunks_ );
+      }
+
+      const TriangularSolver& solver_;  //!< The solver performing the substitution.
+      VT1& x_;                          //!< The left-hand side dense vector.
+      const VT2& b_;                    //!< The right-hand side dense vector.
+      size_t first_;                    //!< The index of the first row of the level.
+      size_t last_;                     //!< The index one past the last row of the level.
+      size_t chunks_;                   //!< The total number of chunks.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit TriangularSolver( const MT& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows  () const;
+   inline size_t levels() const;
+
+   template< typename VT1, typename VT2 >
+   void solve( DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Substitution functions**********************************************************************
+   /*!\name Substitution functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void solveRows( VT1& x, const VT2& b, size_t first, size_t last ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const MT& A_;                  //!< The triangular sparse matrix.
+   std::vector<size_t> offsets_;  //!< The offsets of all levels within the row list.
+   std::vector<size_t> rows_;     //!< The indices of all rows sorted by level.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE                   ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE                ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE               ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE  ( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the TriangularSolver class template.
+//
+// \param A The triangular sparse matrix.
+// \exception std::invalid_argument Singular matrix detected.
+//
+// This constructor performs the level analysis of the given triangular sparse matrix. In case
+// a diagonal element of a matrix without unit diagonal is not stored, the matrix is singular
+// and a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the triangular sparse matrix
+TriangularSolver<MT>::TriangularSolver( const MT& A )
+   : A_      ( A )  // The triangular sparse matrix
+   , offsets_()     // The offsets of all levels within the row list
+   , rows_   ()     // The indices of all rows sorted by level
+{
+   const size_t n( A.rows() );
+
+   // Computing the level of every row
+   std::vector<size_t> level( n, 0UL );
+   size_t maxLevel( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( lower ? k : n-k-1UL );
+      bool diagonal( false );
+      size_t l( 0UL );
+
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j == i )
+            diagonal = true;
+         else if( level[j] >= l )
+            l = level[j] + 1UL;
+      }
+
+      if( !unit && !diagonal )
+         throw std::invalid_argument( "Singular matrix detected" );
+
+      level[i] = l;
+      if( l > maxLevel ) maxLevel = l;
+   }
+
+   // Sorting the rows by level
+   offsets_.resize( ( n > 0UL )?( maxLevel+2UL ):( 1UL ), 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++offsets_[level[i]+1UL];
+   }
+
+   for( size_t l=1UL; l<offsets_.size(); ++l ) {
+      offsets_[l] += offsets_[l-1UL];
+   }
+
+   std::vector<size_t> positions( offsets_.begin(), offsets_.end()-1 );
+   rows_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      rows_[positions[level[i]]++] = i;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the triangular matrix.
+//
+// \return The number of rows of the triangular matrix.
+*/
+template< typename MT >  // Type of the triangular sparse matrix
+inline size_t TriangularSolver<MT>::rows() const
+{
+   return rows_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the level schedule.
+//
+// \return The number of levels.
+//
+// This function returns the number of levels of the level schedule, i.e. the length of the
+// longest chain of dependencies within the triangular matrix. The number of levels corresponds
+// to the number of sequential steps of a solve.
+*/
+template< typename MT >  // Type of the triangular sparse matrix
+inline size_t TriangularSolver<MT>::levels() const
+{
+   return offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the triangular system of equations \f$ A*x=b \f$.
+//
+// \param x The left-hand side dense vector for the solution.
+// \param b The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the triangular system of equations \f$ A*x=b \f$ by means of forward or
+// backward substitution. All rows within a single level of the level schedule are solved
+// concurrently in case the level contains at least SMP_SMATSOLVE_THRESHOLD rows. The two given
+// vectors are allowed to be the same vector, in which case the system is solved in-place. In
+// case the sizes of the vectors don't match the number of rows of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the triangular sparse matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+void TriangularSolver<MT>::solve( DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b ) const
+{
+   if( (~x).size() != rows() || (~b).size() != rows() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   BLAZE_INTERNAL_ASSERT( A_.rows() == rows(), "Invalid matrix size detected" );
+
+   const size_t threads( getNumThreads() );
+
+   for( size_t l=0UL; l<levels(); ++l )
+   {
+      const size_t first( offsets_[l]     );
+      const size_t last ( offsets_[l+1UL] );
+
+      if( threads > 1UL && last - first >= SMP_SMATSOLVE_THRESHOLD ) {
+         smpExecute( LevelTask<VT1,VT2>( *this, ~x, ~b, first, last, threads ), threads );
+      }
+      else {
+         solveRows( ~x, ~b, first, last );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBSTITUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving a range of the rows sorted by level.
+//
+// \param x The left-hand side dense vector for the solution.
+// \param b The right-hand side dense vector.
+// \param first The index of the first row within the row list.
+// \param last The index one past the last row within the row list.
+// \return void
+//
+// This function computes the solution for all rows in the range \f$[first..last)\f$ of the
+// list of rows sorted by level. All rows the given rows depend on must already be solved.
+*/
+template< typename MT >  // Type of the triangular sparse matrix
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+void TriangularSolver<MT>::solveRows( VT1& x, const VT2& b, size_t first, size_t last ) const
+{
+   typedef typename VT1::ElementType  ET;
+
+   for( size_t k=first; k<last; ++k )
+   {
+      const size_t i( rows_[k] );
+
+      ConstIterator element( A_.begin(i) );
+      ConstIterator end    ( A_.end(i)   );
+      ET diagonal = ET();
+
+      if( lower && element != end ) {
+         ConstIterator back( end );
+         if( (--back)->index() == i ) {
+            diagonal = back->value();
+            end = back;
+         }
+      }
+      else if( !lower && element != end && element->index() == i ) {
+         diagonal = element->value();
+         ++element;
+      }
+
+      ET tmp( b[i] );
+
+      for( ; element!=end; ++element ) {
+         tmp -= element->value() * x[element->index()];
+      }
+
+      if( unit )
+         x[i] = tmp;
+      else
+         x[i] = tmp / diagonal;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name TriangularSolver functions */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serial solution of the triangular system of equations \f$ A*x=b \f$.
+// \ingroup sparse_matrix
+//
+// \param A The triangular sparse matrix.
+// \param x The left-hand side dense vector for the solution.
+// \param b The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Singular matrix detected.
+//
+// This function solves the triangular system of equations \f$ A*x=b \f$ by means of a serial
+// forward substitution (for lower triangular matrices) or backward substitution (for upper
+// triangular matrices). In contrast to the TriangularSolver class template, the function does
+// not perform an analysis of the sparsity pattern and supports both row-major and column-major
+// matrices. The matrix has to be a lower or upper sparse matrix type (as for instance the
+// LowerMatrix or UpperMatrix adaptors). The two given vectors are allowed to be the same vector,
+// in which case the system is solved in-place. In case the sizes of the vectors don't match
+// the number of rows of the matrix, or in case a required diagonal element is not stored, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT     // Type of the triangular sparse matrix
+        , bool SO         // Storage order of the triangular sparse matrix
+        , typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef typename VT1::ElementType   ET;
+
+   enum { lower = IsLower<MT>::value };
+   enum { unit  = IsUniTriangular<MT>::value };
+
+   const size_t n( (~A).rows() );
+
+   if( (~x).size() != n || (~b).size() != n )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   if( !SO )
+   {
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t i( lower ? k : n-k-1UL );
+         ET tmp( (~b)[i] );
+         ET diagonal = ET();
+         bool found( false );
+
+         for( ConstIterator element=(~A).begin(i); element!=(~A).end(i); ++element ) {
+            if( element->index() == i ) {
+               diagonal = element->value();
+               found = true;
+            }
+            else tmp -= element->value() * (~x)[element->index()];
+         }
+
+         if( unit )
+            (~x)[i] = tmp;
+         else if( found )
+            (~x)[i] = tmp / diagonal;
+         else
+            throw std::invalid_argument( "Singular matrix detected" );
+      }
+   }
+   else
+   {
+      for( size_t i=0UL; i<n; ++i ) {
+         (~x)[i] = (~b)[i];
+      }
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const size_t j( lower ? k : n-k-1UL );
+
+         if( !unit ) {
+            const ConstIterator diagonal( (~A).find( j, j ) );
+            if( diagonal == (~A).end(j) )
+               throw std::invalid_argument( "Singular matrix detected" );
+            (~x)[j] /= diagonal->value();
+         }
+
+         const ET xj( (~x)[j] );
+
+         for( ConstIterator element=(~A).begin(j); element!=(~A).end(j); ++element ) {
+            if( element->index() != j )
+               (~x)[element->index()] -= element->value() * xj;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
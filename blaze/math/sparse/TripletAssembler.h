@@ -0,0 +1,517 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TripletAssembler.h
+//  \brief Header file for the TripletAssembler class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIPLETASSEMBLER_H_
+#define _BLAZE_MATH_SPARSE_TRIPLETASSEMBLER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Execute.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel sorting backend for the assembly of compressed sparse matrices from triplets.
+// \ingroup sparse_matrix
+//
+// The TripletAssembler class sorts a set of unsorted coordinate triplets (major index, minor
+// index, value) into the compressed storage of a sparse matrix, i.e. into the rows of a row-major
+// or the columns of a column-major matrix. The sort is performed as a two-level radix sort:
+//
+//  -# During construction, the triplets are validated and distributed into buckets of
+//     consecutive major indices (the most significant digit of the major index). Each task
+//     counts and scatters a contiguous chunk of the input via the SMP backend, which keeps the
+//     distribution stable.
+//  -# The fill() function sorts each bucket independently (and in parallel) by a counting sort
+//     on the remaining digits of the major index directly into the final element storage,
+//     sorts the few elements of each row/column by their minor index and merges duplicates.
+//
+// Since all elements of a bucket end up in the same contiguous section of the final storage,
+// the result requires exactly one allocation of the size of the input. Duplicate elements are
+// combined in the order of their appearance in the input.
+*/
+template< typename Type >  // Data type of the sparse matrix
+class TripletAssembler : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef ValueIndexPair<Type>  ElementType;  //!< Type of the assembled elements.
+   //**********************************************************************************************
+
+   //**Triplet struct definition*******************************************************************
+   /*!\brief A single distributed coordinate triplet.
+   */
+   struct Triplet
+   {
+      size_t major_;  //!< The major index (row index of a row-major matrix).
+      size_t minor_;  //!< The minor index (column index of a row-major matrix).
+      Type   value_;  //!< The value of the triplet.
+   };
+   //**********************************************************************************************
+
+   //**CountTask class definition******************************************************************
+   /*!\brief Task for the validation and counting of a chunk of triplets per bucket.
+   */
+   template< typename IT >  // Type of the triplet indices
+   struct CountTask
+   {
+      inline CountTask( const TripletAssembler& assembler, const IT* major, const IT* minor,
+                        size_t nonzeros, size_t chunks, size_t* counts, char* invalid )
+         : assembler_( assembler )  // The assembler performing the distribution
+         , major_    ( major     )  // The major indices of all triplets
+         , minor_    ( minor     )  // The minor indices of all triplets
+         , nonzeros_ ( nonzeros  )  // The total number of triplets
+         , chunks_   ( chunks    )  // The total number of chunks
+         , counts_   ( counts    )  // The per chunk bucket counts
+         , invalid_  ( invalid   )  // The per chunk validation flags
+      {}
+
+      inline void operator()( size_t chunk ) const {
+         const size_t first( ( chunk     * nonzeros_ ) / chunks_ );
+         const size_t last ( ( (chunk+1UL) * nonzeros_ ) / chunks_ );
+         size_t* counts( counts_ + chunk*assembler_.buckets_ );
+
+         for( size_t k=first; k<last; ++k ) {
+            const size_t i( static_cast<size_t>( major_[k] ) );
+            const size_t j( static_cast<size_t>( minor_[k] ) );
+            if( i >= assembler_.majors_ || j >= assembler_.minors_ ) {
+               invalid_[chunk] = 1;
+               return;
+            }
+            ++counts[i >> assembler_.shift_];
+         }
+      }
+
+      const TripletAssembler& assembler_;  //!< The assembler performing the distribution.
+      const IT* major_;                    //!< The major indices of all triplets.
+      const IT* minor_;                    //!< The minor indices of all triplets.
+      size_t nonzeros_;                    //!< The total number of triplets.
+      size_t chunks_;                      //!< The total number of chunks.
+      size_t* counts_;                     //!< The per chunk bucket counts.
+      char* invalid_;                      //!< The per chunk validation flags.
+   };
+   //**********************************************************************************************
+
+   //**ScatterTask class definition****************************************************************
+   /*!\brief Task for the distribution of a chunk of triplets into the buckets.
+   */
+   template< typename IT       // Type of the triplet indices
+           , typename Other >  // Type of the triplet values
+   struct ScatterTask
+   {
+      inline ScatterTask( TripletAssembler& assembler, const IT* major, const IT* minor,
+                          const Other* values, size_t nonzeros, size_t chunks, size_t* positions )
+         : assembler_( assembler )  // The assembler performing the distribution
+         , major_    ( major     )  // The major indices of all triplets
+         , minor_    ( minor     )  // The minor indices of all triplets
+         , values_   ( values    )  // The values of all triplets
+         , nonzeros_ ( nonzeros  )  // The total number of triplets
+         , chunks_   ( chunks    )  // The total number of chunks
+         , positions_( positions )  // The per chunk bucket positions
+      {}
+
+      inline void operator()( size_t chunk ) const {
+         const size_t first( ( chunk     * nonzeros_ ) / chunks_ );
+         const size_t last ( ( (chunk+1UL) * nonzeros_ ) / chunks_ );
+         size_t* positions( positions_ + chunk*assembler_.buckets_ );
+         Triplet* triplets( &assembler_.triplets_[0] );
+
+         for( size_t k=first; k<last; ++k ) {
+            const size_t i( static_cast<size_t>( major_[k] ) );
+            Triplet& triplet( triplets[positions[i >> assembler_.shift_]++] );
+            triplet.major_ = i;
+            triplet.minor_ = static_cast<size_t>( minor_[k] );
+            triplet.value_ = values_[k];
+         }
+      }
+
+      TripletAssembler& assembler_;  //!< The assembler performing the distribution.
+      const IT* major_;              //!< The major indices of all triplets.
+      const IT* minor_;              //!< The minor indices of all triplets.
+      const Other* values_;          //!< The values of all triplets.
+      size_t nonzeros_;              //!< The total number of triplets.
+      size_t chunks_;                //!< The total number of chunks.
+      size_t* positions_;            //!< The per chunk bucket positions.
+   };
+   //**********************************************************************************************
+
+   //**FillTask class definition*******************************************************************
+   /*!\brief Task for the sorting of a single bucket into the final element storage.
+   */
+   template< typename Element     // Type of the elements of the sparse matrix
+           , typename Combiner >  // Type of the combiner for duplicate elements
+   struct FillTask
+   {
+      inline FillTask( const TripletAssembler& assembler, Element* elements,
+                       Element** begin, Element** end, Combiner combine )
+         : assembler_( assembler )  // The assembler performing the sort
+         , elements_ ( elements  )  // The final element storage
+         , begin_    ( begin     )  // Pointers to the first element of each row/column
+         , end_      ( end       )  // Pointers one past the last element of each row/column
+         , combine_  ( combine   )  // The combiner for duplicate elements
+      {}
+
+      inline void operator()( size_t bucket ) const {
+         assembler_.fillBucket( bucket, elements_, begin_, end_, combine_ );
+      }
+
+      const TripletAssembler& assembler_;  //!< The assembler performing the sort.
+      Element* elements_;                  //!< The final element storage.
+      Element** begin_;                    //!< Pointers to the first element of each row/column.
+      Element** end_;                      //!< Pointers one past the last element of each row/column.
+      Combiner combine_;                   //!< The combiner for duplicate elements.
+   };
+   //**********************************************************************************************
+
+   //**IndexLess class definition******************************************************************
+   /*!\brief Comparison of two elements by their index.
+   */
+   struct IndexLess
+   {
+      template< typename Element >
+      inline bool operator()( const Element& lhs, const Element& rhs ) const {
+         return lhs.index() < rhs.index();
+      }
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { maxBuckets = 1024UL };        //!< Maximum number of buckets of the first sorting level.
+   enum { insertionThreshold = 32UL };  //!< Row/column size up to which insertion sort is used.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename IT, typename Other >
+   explicit inline TripletAssembler( size_t majors, size_t minors, const IT* major,
+                                     const IT* minor, const Other* values, size_t nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+
+   template< typename Element, typename Combiner >
+   inline void fill( Element* elements, Element** begin, Element** end, Combiner combine ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Element, typename Combiner >
+   inline void fillBucket( size_t bucket, Element* elements,
+                           Element** begin, Element** end, Combiner combine ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t majors_;                  //!< The number of rows/columns of the sparse matrix.
+   size_t minors_;                  //!< The number of columns/rows of the sparse matrix.
+   size_t shift_;                   //!< The number of bits of the second sorting level.
+   size_t buckets_;                 //!< The number of buckets of the first sorting level.
+   bool parallel_;                  //!< Flag for the parallel execution of the sort.
+   std::vector<Triplet> triplets_;  //!< The triplets distributed into the buckets.
+   std::vector<size_t> offsets_;    //!< The offsets of all buckets within the triplets.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the TripletAssembler class template.
+//
+// \param majors The number of rows (row-major) or columns (column-major) of the sparse matrix.
+// \param minors The number of columns (row-major) or rows (column-major) of the sparse matrix.
+// \param major The array of major indices of the triplets.
+// \param minor The array of minor indices of the triplets.
+// \param values The array of values of the triplets.
+// \param nonzeros The total number of triplets.
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This constructor validates the given triplets and distributes them into the buckets of the
+// first sorting level. In case any index is out of bounds, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename IT      // Type of the triplet indices
+        , typename Other > // Type of the triplet values
+inline TripletAssembler<Type>::TripletAssembler( size_t majors, size_t minors, const IT* major,
+                                                 const IT* minor, const Other* values, size_t nonzeros )
+   : majors_  ( majors )  // The number of rows/columns of the sparse matrix
+   , minors_  ( minors )  // The number of columns/rows of the sparse matrix
+   , shift_   ( 0UL )     // The number of bits of the second sorting level
+   , buckets_ ( 0UL )     // The number of buckets of the first sorting level
+   , parallel_( false )   // Flag for the parallel execution of the sort
+   , triplets_()          // The triplets distributed into the buckets
+   , offsets_ ()          // The offsets of all buckets within the triplets
+{
+   while( ( majors_ >> shift_ ) > maxBuckets )
+      ++shift_;
+
+   buckets_ = ( majors_ > 0UL )?( ( ( majors_ - 1UL ) >> shift_ ) + 1UL ):( 0UL );
+
+   const size_t threads( getNumThreads() );
+
+   parallel_ = ( threads > 1UL && nonzeros >= SMP_SMATASSEMBLE_THRESHOLD );
+
+   const size_t chunks( parallel_ ? threads : 1UL );
+
+   // Validating and counting the triplets per chunk and bucket
+   std::vector<size_t> counts( chunks*buckets_, 0UL );
+   std::vector<char>   invalid( chunks, 0 );
+
+   if( nonzeros > 0UL && buckets_ == 0UL )
+      throw std::invalid_argument( "Invalid triplet index" );
+
+   if( nonzeros > 0UL )
+   {
+      smpExecute( CountTask<IT>( *this, major, minor, nonzeros, chunks, &counts[0], &invalid[0] ), chunks );
+
+      for( size_t chunk=0UL; chunk<chunks; ++chunk ) {
+         if( invalid[chunk] )
+            throw std::invalid_argument( "Invalid triplet index" );
+      }
+   }
+
+   // Computing the bucket offsets and the scatter positions of all chunks
+   offsets_.resize( buckets_+1UL );
+
+   size_t offset( 0UL );
+
+   for( size_t b=0UL; b<buckets_; ++b ) {
+      offsets_[b] = offset;
+      for( size_t chunk=0UL; chunk<chunks; ++chunk ) {
+         const size_t count( counts[chunk*buckets_+b] );
+         counts[chunk*buckets_+b] = offset;
+         offset += count;
+      }
+   }
+
+   offsets_[buckets_] = offset;
+
+   BLAZE_INTERNAL_ASSERT( offset == nonzeros, "Invalid number of distributed triplets" );
+
+   // Distributing the triplets into the buckets
+   if( nonzeros > 0UL ) {
+      triplets_.resize( nonzeros );
+      smpExecute( ScatterTask<IT,Other>( *this, major, minor, values, nonzeros, chunks, &counts[0] ), chunks );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of triplets.
+//
+// \return The total number of triplets.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t TripletAssembler<Type>::size() const
+{
+   return triplets_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorts the triplets into the given element storage.
+//
+// \param elements The element storage of size size().
+// \param begin Array of pointers to the first element of each row/column.
+// \param end Array of pointers one past the last element of each row/column.
+// \param combine The binary combiner for duplicate elements.
+// \return void
+//
+// This function sorts the distributed triplets into the given element storage and sets the
+// \a begin and \a end pointers of all rows/columns. Duplicate elements are merged by means of
+// the given combiner, elements that are default values after the merge are dropped. Note that
+// due to dropped and merged elements, the rows/columns may contain unused capacity.
+*/
+template< typename Type >     // Data type of the sparse matrix
+template< typename Element    // Type of the elements of the sparse matrix
+        , typename Combiner > // Type of the combiner for duplicate elements
+inline void TripletAssembler<Type>::fill( Element* elements, Element** begin,
+                                          Element** end, Combiner combine ) const
+{
+   if( parallel_ ) {
+      smpExecute( FillTask<Element,Combiner>( *this, elements, begin, end, combine ), buckets_ );
+   }
+   else {
+      for( size_t b=0UL; b<buckets_; ++b ) {
+         fillBucket( b, elements, begin, end, combine );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorts the triplets of a single bucket into the given element storage.
+//
+// \param bucket The index of the bucket.
+// \param elements The element storage of size size().
+// \param begin Array of pointers to the first element of each row/column.
+// \param end Array of pointers one past the last element of each row/column.
+// \param combine The binary combiner for duplicate elements.
+// \return void
+*/
+template< typename Type >     // Data type of the sparse matrix
+template< typename Element    // Type of the elements of the sparse matrix
+        , typename Combiner > // Type of the combiner for duplicate elements
+inline void TripletAssembler<Type>::fillBucket( size_t bucket, Element* elements,
+                                                Element** begin, Element** end,
+                                                Combiner combine ) const
+{
+   using blaze::isDefault;
+
+   const size_t first( bucket << shift_ );
+   const size_t last ( std::min( ( bucket+1UL ) << shift_, majors_ ) );
+
+   Element* const storage( elements + offsets_[bucket] );
+
+   // Counting sort of the bucket by the major index
+   std::vector<size_t> positions( last-first+1UL, 0UL );
+
+   for( size_t k=offsets_[bucket]; k<offsets_[bucket+1UL]; ++k ) {
+      ++positions[triplets_[k].major_-first+1UL];
+   }
+
+   for( size_t i=first; i<last; ++i ) {
+      positions[i-first+1UL] += positions[i-first];
+      begin[i] = storage + positions[i-first];
+   }
+
+   for( size_t k=offsets_[bucket]; k<offsets_[bucket+1UL]; ++k ) {
+      const Triplet& triplet( triplets_[k] );
+      storage[positions[triplet.major_-first]++] = ElementType( triplet.value_, triplet.minor_ );
+   }
+
+   // Sorting each row/column by the minor index and merging duplicate elements
+   for( size_t i=first; i<last; ++i )
+   {
+      Element* const rowBegin( begin[i] );
+      Element* const rowEnd  ( storage + positions[i-first] );
+
+      if( rowEnd - rowBegin <= static_cast<ptrdiff_t>( insertionThreshold ) ) {
+         for( Element* element=rowBegin+1; element<rowEnd; ++element ) {
+            const ElementType tmp( element->value(), element->index() );
+            Element* pos( element );
+            for( ; pos!=rowBegin && (pos-1)->index() > tmp.index(); --pos )
+               *pos = *(pos-1);
+            *pos = tmp;
+         }
+      }
+      else {
+         std::stable_sort( rowBegin, rowEnd, IndexLess() );
+      }
+
+      Element* target( rowBegin );
+
+      for( Element* element=rowBegin; element!=rowEnd; )
+      {
+         const size_t index( element->index() );
+         Type value( element->value() );
+
+         for( ++element; element!=rowEnd && element->index() == index; ++element )
+            value = combine( value, element->value() );
+
+         if( !isDefault( value ) ) {
+            *target = ElementType( value, index );
+            ++target;
+         }
+      }
+
+      end[i] = target;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
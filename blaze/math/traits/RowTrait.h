@@ -86,10 +86,10 @@ namespace blaze {
 // The following example shows the according specialization for the DynamicMatrix class template:
 
    \code
-   template< typename T1, bool SO >
-   struct RowTrait< DynamicMatrix<T1,SO> >
+   template< typename T1, bool SO, typename A1 >
+   struct RowTrait< DynamicMatrix<T1,SO,A1> >
    {
-      typedef DynamicVector<T1,true>  Type;
+      typedef DynamicVector<T1,true,A1>  Type;
    };
    \endcode
 
@@ -89,10 +89,10 @@ namespace blaze {
 // template:
 
    \code
-   template< typename T1, bool SO >
-   struct SubmatrixTrait< DynamicMatrix<T1,SO> >
+   template< typename T1, bool SO, typename A1 >
+   struct SubmatrixTrait< DynamicMatrix<T1,SO,A1> >
    {
-      typedef DynamicMatrix<T1,SO>  Type;
+      typedef DynamicMatrix<T1,SO,A1>  Type;
    };
    \endcode
 
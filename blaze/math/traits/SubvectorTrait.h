@@ -94,10 +94,10 @@ namespace blaze {
 // template:
 
    \code
-   template< typename T1, bool TF >
-   struct SubvectorTrait< DynamicVector<T1,TF> >
+   template< typename T1, bool TF, typename A1 >
+   struct SubvectorTrait< DynamicVector<T1,TF,A1> >
    {
-      typedef DynamicVector<T1,TF>  Type;
+      typedef DynamicVector<T1,TF,A1>  Type;
    };
    \endcode
 
@@ -0,0 +1,90 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/HugePages.h
+//  \brief System settings for huge page backed allocations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_HUGEPAGES_H_
+#define _BLAZE_SYSTEM_HUGEPAGES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+#include <blaze/config/HugePages.h>
+
+
+
+
+//=================================================================================================
+//
+//  HUGE PAGE MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the huge page allocation mode.
+// \ingroup system
+//
+// This compilation switch is set to 1 in case the huge page allocation mode is enabled (see the
+// BLAZE_USE_HUGE_PAGES switch) and the target platform provides huge pages. Otherwise it is
+// set to 0 and all memory blocks are allocated via the default allocation functions.
+*/
+#if BLAZE_USE_HUGE_PAGES && defined(__linux__)
+#define BLAZE_HUGE_PAGE_MODE 1
+#else
+#define BLAZE_HUGE_PAGE_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HUGE PAGE SETTINGS
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief The size of a single huge page in bytes (2 MiB).
+// \ingroup system
+*/
+const size_t hugePageSize = 2097152UL;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -86,4 +86,27 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  BLAZE_NEVER_INLINE KEYWORD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\def BLAZE_NEVER_INLINE
+// \brief Platform dependent setup of a keyword preventing the inlining of a function.
+// \ingroup system
+*/
+#if defined(_MSC_VER)
+#  define BLAZE_NEVER_INLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#  define BLAZE_NEVER_INLINE __attribute__((noinline))
+#else
+#  define BLAZE_NEVER_INLINE
+#endif
+//*************************************************************************************************
+
 #endif
@@ -0,0 +1,76 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/ThreadLocal.h
+//  \brief System settings for thread-local storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_THREADLOCAL_H_
+#define _BLAZE_SYSTEM_THREADLOCAL_H_
+
+
+//=================================================================================================
+//
+//  THREAD-LOCAL KEYWORD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\def BLAZE_THREAD_LOCAL
+// \brief Platform dependent setup of the thread-local storage class specifier.
+// \ingroup system
+//
+// This macro expands to the compiler-specific storage class specifier for thread-local variables.
+// Note that the specifier can only be applied to variables of POD type with static storage
+// duration and a constant initializer.
+*/
+// Intel compiler
+#if defined(__INTEL_COMPILER) || defined(__ICL) || defined(__ICC) || defined(__ECC)
+#  if defined(_WIN32)
+#    define BLAZE_THREAD_LOCAL __declspec(thread)
+#  else
+#    define BLAZE_THREAD_LOCAL __thread
+#  endif
+
+// GNU compiler
+#elif defined(__GNUC__)
+#  define BLAZE_THREAD_LOCAL __thread
+
+// Microsoft visual studio
+#elif defined(_MSC_VER)
+#  define BLAZE_THREAD_LOCAL __declspec(thread)
+
+// All other compilers
+#else
+#  error Thread-local storage is not supported by the current compiler
+#endif
+//*************************************************************************************************
+
+#endif
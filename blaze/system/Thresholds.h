@@ -119,6 +119,9 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATASSEMBLE_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSOLVE_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRANSPOSE_THRESHOLD  >= 0UL );
 
 }
 /*! \endcond */
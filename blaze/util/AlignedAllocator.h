@@ -42,7 +42,9 @@
 
 #include <blaze/util/Memory.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
 #include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 
 
 namespace blaze {
@@ -59,11 +61,11 @@ namespace blaze {
 //
 // The AlignedAllocator class template represents an implementation of the allocator concept of
 // the standard library for the allocation of type-specific, aligned, uninitialized memory. The
-// allocator performs its allocation via the blaze::allocate() and blaze::deallocate() functions
-// to guarantee properly aligned memory based on the alignment restrictions of the specified type
-// \a Type. For instance, in case the given type is a fundamental, built-in data type and in case
-// SSE vectorization is possible, the returned memory is guaranteed to be at least 16-byte aligned.
-// In case AVX is active, the memory is even guaranteed to be at least 32-byte aligned.
+// allocator guarantees properly aligned memory based on the alignment restrictions of the
+// specified type \a Type. For instance, in case the given type is a fundamental, built-in data
+// type and in case SSE vectorization is possible, the returned memory is guaranteed to be at
+// least 16-byte aligned. In case AVX is active, the memory is even guaranteed to be at least
+// 32-byte aligned.
 */
 template< typename Type >
 class AlignedAllocator
@@ -231,18 +233,25 @@ inline typename AlignedAllocator<Type>::ConstPointer
 // \param localityHint Hint for improved locality.
 // \return Pointer to the newly allocated memory.
 //
-// This function allocates a junk of memory for the specified number of objects of type \a Type.
-// The returned pointer is guaranteed to be aligned according to the alignment restrictions of
-// the data type \a Type. For instance, in case the type is a fundamental, built-in data type
-// and in case SSE vectorization is possible, the returned memory is guaranteed to be at least
-// 16-byte aligned. In case AVX is active, the memory is even guaranteed to be 32-byte aligned.
+// This function allocates a junk of uninitialized memory for the specified number of objects of
+// type \a Type. The returned pointer is guaranteed to be aligned according to the alignment
+// restrictions of the data type \a Type. For instance, in case the type is a fundamental,
+// built-in data type and in case SSE vectorization is possible, the returned memory is
+// guaranteed to be at least 16-byte aligned. In case AVX is active, the memory is even
+// guaranteed to be 32-byte aligned.
 */
 template< typename Type >
 inline typename AlignedAllocator<Type>::Pointer
    AlignedAllocator<Type>::allocate( size_t numObjects, const void* localityHint )
 {
    UNUSED_PARAMETER( localityHint );
-   return blaze::allocate<Type>( numObjects );
+
+   const size_t alignment( AlignmentOf<Type>::value );
+
+   if( alignment >= 8UL ) {
+      return reinterpret_cast<Pointer>( allocate_backend( numObjects*sizeof(Type), alignment ) );
+   }
+   else return static_cast<Pointer>( ::operator new( numObjects*sizeof(Type) ) );
 }
 //*************************************************************************************************
 
@@ -262,7 +271,16 @@ template< typename Type >
 inline void AlignedAllocator<Type>::deallocate( Pointer ptr, size_t numObjects )
 {
    UNUSED_PARAMETER( numObjects );
-   blaze::deallocate( ptr );
+
+   if( ptr == NULL )
+      return;
+
+   const size_t alignment( AlignmentOf<Type>::value );
+
+   if( alignment >= 8UL ) {
+      deallocate_backend( ptr );
+   }
+   else ::operator delete( ptr );
 }
 //*************************************************************************************************
 
@@ -46,51 +46,781 @@
 #include <cstdlib>
 #include <new>
 #include <stdexcept>
+#include <blaze/system/HugePages.h>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/system/Workspace.h>
+#include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/NonCopyable.h>
 #include <blaze/util/Null.h>
+#include <blaze/util/Template.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 
+#if BLAZE_HUGE_PAGE_MODE
+#  include <sys/mman.h>
+#endif
+
 
 namespace blaze {
 
 //=================================================================================================
 //
-//  BACKEND ALLOCATION FUNCTIONS
+//  HUGE PAGE STATUS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Page backing of an allocated memory block.
+// \ingroup util
+//
+// This enumeration represents the outcome of the huge page allocation mode for a particular
+// memory block (see the BLAZE_USE_HUGE_PAGES switch and the hugePageStatus() function).
+*/
+enum HugePageStatus
+{
+   noHugePages          = 0,  //!< The memory block is backed by default pages.
+   transparentHugePages = 1,  //!< The memory block is advised to use transparent huge pages.
+   hugetlbPages         = 2   //!< The memory block is backed by reserved huge pages (hugetlbfs).
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYSTEM ALLOCATION FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Backend implementation for aligned array allocation.
+/*!\brief Returns the size of the header for the given alignment.
+// \ingroup util
+//
+// \param alignment The required minimum alignment.
+// \return The size of the header in bytes.
+*/
+inline size_t block_header_size( size_t alignment )
+{
+   return ( alignment < 2UL*sizeof(size_t) )?( 2UL*sizeof(size_t) ):( alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the header of the given memory block.
+// \ingroup util
+//
+// \param address The address of the memory block.
+// \return Pointer to the header containing the size and the offset of the memory block.
+*/
+inline size_t* block_header( const void* address )
+{
+   return static_cast<size_t*>( const_cast<void*>( address ) ) - 2UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_HUGE_PAGE_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of a huge page backed memory block from the system.
 // \ingroup util
 //
 // \param size The number of bytes to be allocated.
 // \param alignment The required minimum alignment.
-// \return Byte pointer to the first element of the aligned array.
+// \return Byte pointer to the first element of the aligned memory block.
 // \exception std::bad_alloc Allocation failed.
 //
-// This function provides the functionality to allocate memory based on the given alignment
-// restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// This function allocates the memory block as anonymous mapping, whose size is rounded up to a
+// multiple of the huge page size. In case the hugetlbfs is enabled (see the BLAZE_USE_HUGETLBFS
+// switch), the mapping is first requested from the reserved huge pages. Otherwise or in case no
+// reserved huge pages are available, a 2 MiB-aligned mapping is created and the kernel is advised
+// to back it with transparent huge pages. In addition to the size and the offset, the header of
+// the memory block stores the resulting HugePageStatus.
 */
-inline byte* allocate_backend( size_t size, size_t alignment )
+inline byte* allocate_hugepages( size_t size, size_t alignment )
 {
+   const size_t headersize( ( block_header_size( alignment ) < 64UL )
+                            ?( 64UL ):( block_header_size( alignment ) ) );
+   const size_t length( ( size + headersize + hugePageSize - 1UL ) & ~( hugePageSize - 1UL ) );
+
+   HugePageStatus status( noHugePages );
+   void* raw( MAP_FAILED );
+
+#  if BLAZE_USE_HUGETLBFS && defined(MAP_HUGETLB)
+   if( headersize <= hugePageSize ) {
+      raw = mmap( NULL, length, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+      if( raw != MAP_FAILED )
+         status = hugetlbPages;
+   }
+#  endif
+
+   if( raw == MAP_FAILED )
+   {
+      const size_t mapAlignment( ( headersize > hugePageSize )?( headersize ):( hugePageSize ) );
+
+      void* const mapping( mmap( NULL, length+mapAlignment, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) );
+
+      if( mapping == MAP_FAILED )
+         throw std::bad_alloc();
+
+      byte* const begin( static_cast<byte*>( mapping ) );
+      const size_t offset( ( mapAlignment - reinterpret_cast<size_t>( begin ) % mapAlignment )
+                           % mapAlignment );
+
+      if( offset > 0UL )
+         munmap( begin, offset );
+      munmap( begin+offset+length, mapAlignment-offset );
+
+      raw = begin + offset;
+
+#  if defined(MADV_HUGEPAGE)
+      if( madvise( raw, length, MADV_HUGEPAGE ) == 0 )
+         status = transparentHugePages;
+#  endif
+   }
+
+   byte* const address( static_cast<byte*>( raw ) + headersize );
+
+   size_t* const info( block_header( address ) );
+   info[0] = size;
+   info[1] = headersize;
+   *( info - 1 ) = status;
+
+   return address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deallocation of a huge page backed memory block to the system.
+// \ingroup util
+//
+// \param address The address of the memory block to be deallocated.
+// \return void
+*/
+inline void deallocate_hugepages( const void* address )
+{
+   const size_t* const info( block_header( address ) );
+   const size_t length( ( info[0] + info[1] + hugePageSize - 1UL ) & ~( hugePageSize - 1UL ) );
+   const byte* const raw( static_cast<const byte*>( address ) - info[1] );
+
+   munmap( const_cast<byte*>( raw ), length );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of an aligned memory block from the system.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the first element of the aligned memory block.
+// \exception std::bad_alloc Allocation failed.
+//
+// Each memory block is preceded by a header that stores the size of the memory block and the
+// distance to the beginning of the memory that was allocated from the system. In case the huge
+// page allocation mode is active, memory blocks of at least \a hugePageThreshold bytes are
+// allocated via the allocate_hugepages() function.
+*/
+inline byte* allocate_system( size_t size, size_t alignment )
+{
+#if BLAZE_HUGE_PAGE_MODE
+   if( size >= hugePageThreshold )
+      return allocate_hugepages( size, alignment );
+#endif
+
+   const size_t headersize( block_header_size( alignment ) );
    void* raw( NULL );
 
 #if defined(_MSC_VER)
-   raw = _aligned_malloc( size, alignment );
+   raw = _aligned_malloc( size+headersize, headersize );
    if( raw == NULL )
 #else
-   if( posix_memalign( &raw, alignment, size ) )
+   if( posix_memalign( &raw, headersize, size+headersize ) )
 #endif
       throw std::bad_alloc();
 
-   return reinterpret_cast<byte*>( raw );
+   byte* const address( reinterpret_cast<byte*>( raw ) + headersize );
+
+   size_t* const info( block_header( address ) );
+   info[0] = size;
+   info[1] = headersize;
+
+   return address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deallocation of an aligned memory block to the system.
+// \ingroup util
+//
+// \param address The address of the memory block to be deallocated.
+// \return void
+*/
+inline void deallocate_system( const void* address )
+{
+#if BLAZE_HUGE_PAGE_MODE
+   if( block_header( address )[0] >= hugePageThreshold ) {
+      deallocate_hugepages( address );
+      return;
+   }
+#endif
+
+   const byte* const raw( static_cast<const byte*>( address ) - block_header( address )[1] );
+
+#if defined(_MSC_VER)
+   _aligned_free( const_cast<byte*>( raw ) );
+#else
+   free( const_cast<byte*>( raw ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS WORKSPACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local workspace for the recycling of temporary memory.
+// \ingroup util
+//
+// The Workspace class is the backend of all aligned memory allocations of the Blaze library
+// (see the allocate_backend() and deallocate_backend() functions). By default, all requests are
+// directly forwarded to the system allocation functions. However, in case a WorkspaceScope is
+// active on the calling thread, all released memory blocks are not returned to the system but
+// cached in size classes and handed out again for subsequent requests of the same size class. Therefore a loop that repeatedly evaluates expressions requiring temporaries
+// (as for instance \f$ A*(B+C) \f$ or \f$ (A*B)*x \f$) performs heap allocations only during
+// its first iteration:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Initialization of the matrices
+
+   {
+      blaze::WorkspaceScope scope;  // Activating the workspace for the current thread
+
+      for( size_t step=0UL; step<steps; ++step ) {
+         D = A * ( B + C );  // The temporary for B+C is recycled in each iteration
+      }
+   }  // All cached memory blocks are released
+   \endcode
+
+// Note that each thread owns its own workspace. Memory blocks that are released by a thread
+// without active WorkspaceScope are directly returned to the system, irrespective of the thread
+// that allocated them. Additionally, only requests with an alignment of at most 64 bytes are
+// served by the workspace.
+//
+// The cached memory blocks are retained until the workspace is cleared or destroyed. In order to
+// bound the memory footprint of a workspace (for instance in case the sizes of the temporaries
+// change over time), the total size of the cached memory blocks is limited by the capacity of
+// the workspace (see the workspaceCapacity setting and the setCapacity() function). In case a
+// released memory block would exceed the capacity, the cached memory blocks of all other size
+// classes are returned to the system, starting with the largest blocks. Memory blocks that are
+// larger than the capacity are never cached.
+//
+// Serving requests from size classes comes at the price of some memory overhead: While a
+// workspace is active, each request is rounded up to its size class. Since there are eight size
+// classes per power of two, the rounding increases a request by at most 12.5% (and to at least
+// 64 bytes). Requests that are larger than the capacity of the workspace are never rounded.
+// Additionally, each memory block allocated by Blaze (irrespective of an active workspace) is
+// preceded by a header of \f$ \max(2 \cdot sizeof(size\_t),alignment) \f$ bytes that stores the
+// size of the memory block (64 bytes for the memory blocks of a workspace). Thus small memory
+// blocks should not be allocated via the aligned allocation functions of Blaze.
+//
+// In case the huge page allocation mode is active (see the BLAZE_USE_HUGE_PAGES switch), all
+// memory blocks of at least \a hugePageThreshold bytes are requested from the system as 2 MiB
+// aligned mappings that are backed by huge pages (see the allocate_system() function). These
+// memory blocks are cached and recycled by an active workspace like any other memory block.
+*/
+class Workspace : private NonCopyable
+{
+ private:
+   //**Constants***********************************************************************************
+   static const size_t blockAlignment = 64UL;   //!< The alignment of all cached memory blocks.
+   static const size_t minOctave      = 6UL;    //!< The octave of the smallest size class (64 bytes).
+   static const size_t maxOctave      = 47UL;   //!< The octave of the largest size class (256 terabytes).
+   static const size_t classes        = 8UL;    //!< The number of size classes per octave.
+   static const size_t maxClass       = 336UL;  //!< The index of the largest size class.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Workspace( size_t capacity = workspaceCapacity );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Workspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size       () const;
+   inline size_t bytes      () const;
+   inline size_t capacity   () const;
+   inline void   setCapacity( size_t capacity );
+   inline void   clear      ();
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   static inline Workspace* current();
+   static inline byte*      allocate  ( size_t size, size_t alignment );
+   static inline void       deallocate( const void* address );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline byte* acquire( size_t size );
+   inline bool  release( byte* address );
+   inline void  trim   ( size_t bytes, size_t keep );
+
+   static inline size_t      sizeClass( size_t size );
+   static inline size_t      classSize( size_t sizeClass );
+   static inline Workspace*& instance();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte*  freeList_[maxClass+1UL];  //!< Free lists of cached memory blocks for each size class.
+   size_t size_;                    //!< The current number of cached memory blocks.
+   size_t bytes_;                   //!< The current total size of the cached memory blocks.
+   size_t capacity_;                //!< The maximum total size of the cached memory blocks.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class WorkspaceScope;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for Workspace.
+//
+// \param capacity The maximum total size of the cached memory blocks in bytes.
+*/
+inline Workspace::Workspace( size_t capacity )
+   : size_    ( 0UL      )  // The current number of cached memory blocks
+   , bytes_   ( 0UL      )  // The current total size of the cached memory blocks
+   , capacity_( capacity )  // The maximum total size of the cached memory blocks
+{
+   for( size_t i=0UL; i<=maxClass; ++i )
+      freeList_[i] = NULL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Workspace.
+//
+// The destructor returns all cached memory blocks to the system.
+*/
+inline Workspace::~Workspace()
+{
+   clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of cached memory blocks.
+//
+// \return The number of cached memory blocks.
+*/
+inline size_t Workspace::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current total size of the cached memory blocks.
+//
+// \return The total size of the cached memory blocks in bytes.
+*/
+inline size_t Workspace::bytes() const
+{
+   return bytes_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum total size of the cached memory blocks.
+//
+// \return The capacity of the workspace in bytes.
+*/
+inline size_t Workspace::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the maximum total size of the cached memory blocks.
+//
+// \param capacity The new capacity of the workspace in bytes.
+// \return void
+//
+// In case the cached memory blocks exceed the new capacity, memory blocks are returned to the
+// system, starting with the largest blocks.
+*/
+inline void Workspace::setCapacity( size_t capacity )
+{
+   capacity_ = capacity;
+   trim( capacity_, maxClass+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all cached memory blocks to the system.
+//
+// \return void
+*/
+inline void Workspace::clear()
+{
+   for( size_t i=0UL; i<=maxClass; ++i ) {
+      while( freeList_[i] != NULL ) {
+         byte* const address( freeList_[i] );
+         freeList_[i] = *reinterpret_cast<byte**>( address );
+         deallocate_system( address );
+      }
+   }
+
+   size_  = 0UL;
+   bytes_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the active workspace of the calling thread.
+//
+// \return Pointer to the active workspace, \a NULL in case no workspace is active.
+*/
+inline Workspace* Workspace::current()
+{
+   return instance();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of aligned memory.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates a memory block of at least \a size bytes with the given alignment.
+// In case a workspace is active on the calling thread, the memory block is taken from the
+// workspace. Otherwise it is requested from the system.
+*/
+inline byte* Workspace::allocate( size_t size, size_t alignment )
+{
+   Workspace* const workspace( instance() );
+
+   if( workspace != NULL && alignment <= blockAlignment )
+      return workspace->acquire( size );
+   else
+      return allocate_system( size, alignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of aligned memory.
+//
+// \param address The address of the memory block to be deallocated.
+// \return void
+//
+// This function deallocates the given memory block that was previously allocated via the
+// allocate() function. In case a workspace is active on the calling thread, the memory block
+// is cached for subsequent allocations. Otherwise it is returned to the system.
+*/
+inline void Workspace::deallocate( const void* address )
+{
+   if( address == NULL )
+      return;
+
+   Workspace* const workspace( instance() );
+   byte* const block( const_cast<byte*>( static_cast<const byte*>( address ) ) );
+
+   if( workspace == NULL || !workspace->release( block ) )
+      deallocate_system( block );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquires a memory block from the workspace.
+//
+// \param size The minimum number of bytes of the memory block.
+// \return Byte pointer to the first element of the memory block.
+// \exception std::bad_alloc Allocation failed.
+//
+// The size of the memory block is rounded up to the according size class. Memory blocks that
+// cannot be cached by the workspace (since they exceed its capacity) are allocated with the
+// exact size.
+*/
+inline byte* Workspace::acquire( size_t size )
+{
+   const size_t index( sizeClass( size ) );
+
+   if( index > maxClass || classSize( index ) > capacity_ )
+      return allocate_system( size, blockAlignment );
+
+   byte* const address( freeList_[index] );
+
+   if( address == NULL )
+      return allocate_system( classSize( index ), blockAlignment );
+
+   freeList_[index] = *reinterpret_cast<byte**>( address );
+   --size_;
+   bytes_ -= classSize( index );
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases a memory block to the workspace.
+//
+// \param address The address of the memory block to be released.
+// \return \a true if the memory block is cached by the workspace, \a false if not.
+//
+// Only memory blocks with the alignment and the exact size of a size class of the workspace are
+// cached. In case the memory block would exceed the capacity of the workspace, the cached memory
+// blocks of all other size classes are released first. All memory blocks that are not cached
+// have to be returned to the system by the caller.
+*/
+inline bool Workspace::release( byte* address )
+{
+   const size_t* const info( block_header( address ) );
+   const size_t blocksize( info[0] );
+
+   if( info[1] != block_header_size( blockAlignment ) || blocksize > capacity_ )
+      return false;
+
+   const size_t index( sizeClass( blocksize ) );
+
+   if( index > maxClass || classSize( index ) != blocksize )
+      return false;
+
+   if( bytes_ > capacity_ - blocksize )
+      trim( capacity_ - blocksize, index );
+
+   if( bytes_ > capacity_ - blocksize )
+      return false;
+
+   *reinterpret_cast<byte**>( address ) = freeList_[index];
+   freeList_[index] = address;
+   ++size_;
+   bytes_ += blocksize;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns cached memory blocks to the system until the given total size is reached.
+//
+// \param bytes The maximum total size of the remaining cached memory blocks.
+// \param keep The size class to be kept (\a maxClass+1 to release blocks of all size classes).
+// \return void
+//
+// This function releases the cached memory blocks starting with the largest size class. The
+// memory blocks of the given size class are kept, since they are the most recently used ones.
+*/
+inline void Workspace::trim( size_t bytes, size_t keep )
+{
+   for( size_t i=maxClass+1UL; i>0UL && bytes_ > bytes; --i )
+   {
+      const size_t index( i-1UL );
+
+      if( index == keep ) continue;
+
+      while( freeList_[index] != NULL && bytes_ > bytes ) {
+         byte* const address( freeList_[index] );
+         freeList_[index] = *reinterpret_cast<byte**>( address );
+         deallocate_system( address );
+         --size_;
+         bytes_ -= classSize( index );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the size class for the given number of bytes.
+//
+// \param size The number of bytes.
+// \return The index of the size class (larger than \a maxClass in case the size is too large).
+//
+// Each octave \f$ (2^k,2^{k+1}] \f$ is split into eight size classes of equal width. All
+// requests of at most 64 bytes are served by the smallest size class.
+*/
+inline size_t Workspace::sizeClass( size_t size )
+{
+   if( size <= ( size_t(1) << minOctave ) )
+      return 0UL;
+
+   size_t octave( minOctave );
+   while( ( size_t(1) << ( octave+1UL ) ) < size && octave <= maxOctave )
+      ++octave;
+
+   if( octave > maxOctave )
+      return maxClass+1UL;
+
+   const size_t step( size_t(1) << ( octave-3UL ) );
+
+   return ( octave-minOctave )*classes + ( size+step-1UL ) / step - classes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes of the given size class.
+//
+// \param sizeClass The index of the size class.
+// \return The number of bytes of the memory blocks of the size class.
+*/
+inline size_t Workspace::classSize( size_t sizeClass )
+{
+   if( sizeClass == 0UL )
+      return size_t(1) << minOctave;
+
+   const size_t octave( minOctave + ( sizeClass-1UL ) / classes );
+   const size_t factor( classes + 1UL + ( sizeClass-1UL ) % classes );
+
+   return factor << ( octave-3UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a reference to the pointer to the active workspace of the calling thread.
+//
+// \return Reference to the thread-local workspace pointer.
+*/
+inline Workspace*& Workspace::instance()
+{
+   static BLAZE_THREAD_LOCAL Workspace* workspace = NULL;
+   return workspace;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKEND ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation for aligned array allocation.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the first element of the aligned array.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function provides the functionality to allocate memory based on the given alignment
+// restrictions. For that purpose it uses the according system-specific memory allocation
+// functions. In case a WorkspaceScope is active on the calling thread, the memory is taken
+// from the thread-local workspace (see the Workspace class description).
+*/
+inline byte* allocate_backend( size_t size, size_t alignment )
+{
+   return Workspace::allocate( size, alignment );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -106,14 +836,12 @@ inline byte* allocate_backend( size_t size, size_t alignment )
 //
 // This function deallocates the given memory that was previously allocated via the allocate()
 // function. For that purpose it uses the according system-specific memory deallocation functions.
+// In case a WorkspaceScope is active on the calling thread, the memory is cached in the
+// thread-local workspace for subsequent allocations.
 */
 inline void deallocate_backend( const void* address )
 {
-#if defined(_MSC_VER)
-   _aligned_free( const_cast<void*>( address ) );
-#else
-   free( const_cast<void*>( address ) );
-#endif
+   Workspace::deallocate( address );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -274,6 +1002,161 @@ typename DisableIf< IsBuiltin<T> >::Type deallocate( T* address )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Array allocation via the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator to be used for the allocation.
+// \param size The number of elements to be allocated.
+// \return Pointer to the first element of the allocated array.
+// \exception std::bad_alloc Allocation failed.
+// \exception std::invalid_argument Invalid alignment of the allocated memory.
+//
+// This function allocates an array of \a size elements of type \a T via the given allocator,
+// which is rebound to the type \a T if necessary. Since an allocator only provides uninitialized
+// memory, all elements of user-specific class types are default constructed. The vectorized
+// kernels of Blaze rely on the alignment restrictions of the element type (see the AlignmentOf
+// type trait). Therefore the function checks the alignment of the memory provided by the
+// allocator and throws a \a std::invalid_argument exception in case the memory is not properly
+// aligned. Memory allocated via this function must be released via the deallocate() function
+// with an equal allocator and the same size.
+
+   \code
+   blaze::AlignedAllocator<double> alloc;
+   double* dp = allocate<double>( alloc, 10UL );
+   // ...
+   deallocate( alloc, dp, 10UL );
+   \endcode
+*/
+template< typename T        // Type of the elements
+        , typename Alloc >  // Type of the allocator
+T* allocate( const Alloc& alloc, size_t size )
+{
+   typename Alloc::BLAZE_TEMPLATE rebind<T>::other a( alloc );
+
+   T* const address( a.allocate( size ) );
+
+   if( !checkAlignment( address ) ) {
+      a.deallocate( address, size );
+      throw std::invalid_argument( "Invalid alignment of allocated memory" );
+   }
+
+   if( !IsBuiltin<T>::value )
+   {
+      size_t i( 0UL );
+
+      try {
+         for( ; i<size; ++i )
+            ::new (address+i) T();
+      }
+      catch( ... ) {
+         while( i != 0UL )
+            address[--i].~T();
+         a.deallocate( address, size );
+         throw;
+      }
+   }
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of an array via the given allocator.
+// \ingroup util
+//
+// \param alloc The allocator to be used for the deallocation.
+// \param address The address of the first element of the array to be deallocated.
+// \param size The number of elements of the array.
+// \return void
+//
+// This function deallocates the given memory that was previously allocated via the allocate()
+// function with an equal allocator. In case the elements are of user-specific class type, all
+// elements are destroyed before the memory is returned to the allocator.
+*/
+template< typename T        // Type of the elements
+        , typename Alloc >  // Type of the allocator
+void deallocate( const Alloc& alloc, T* address, size_t size )
+{
+   if( address == NULL )
+      return;
+
+   if( !IsBuiltin<T>::value ) {
+      for( size_t i=0UL; i<size; ++i )
+         address[i].~T();
+   }
+
+   typename Alloc::BLAZE_TEMPLATE rebind<T>::other a( alloc );
+   a.deallocate( address, size );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HUGE PAGE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the page backing of the given array.
+// \ingroup util
+//
+// \param address The address of the first element of the array.
+// \return The page backing of the array.
+//
+// This function reports the outcome of the huge page allocation mode (see the configuration
+// switch BLAZE_USE_HUGE_PAGES) for the given array. In case the array is backed by huge pages,
+// the function returns either \a transparentHugePages or \a hugetlbPages. In case the huge page
+// allocation mode is not active, in case the array is smaller than \a hugePageThreshold bytes,
+// or in case the kernel rejected the use of huge pages, the function returns \a noHugePages.
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+
+   if( blaze::hugePageStatus( A.data() ) == blaze::transparentHugePages ) {
+      // ... The matrix is backed by transparent huge pages
+   }
+   \endcode
+
+// \note The function inspects the allocation header in front of the given array. Therefore the
+// array must have been allocated via the AlignedAllocator (as for instance the elements of a
+// DynamicVector or DynamicMatrix) or via the allocate() function for built-in data types. For
+// any other address (as for instance the externally owned memory of a CustomVector or of a
+// CustomMatrix) the behavior is undefined. Headers that are not consistent with a huge page
+// backed memory block are reported as \a noHugePages.
+*/
+template< typename T >
+HugePageStatus hugePageStatus( const T* address )
+{
+   const size_t alignment( AlignmentOf<T>::value );
+
+   if( alignment < 8UL || address == NULL )
+      return noHugePages;
+
+#if BLAZE_HUGE_PAGE_MODE
+   const size_t* const info( block_header( address ) );
+   const byte* const raw( reinterpret_cast<const byte*>( address ) - info[1] );
+
+   if( info[0] < hugePageThreshold || info[1] < 64UL || info[1] % 64UL != 0UL ||
+       reinterpret_cast<size_t>( raw ) % hugePageSize != 0UL )
+      return noHugePages;
+
+   switch( *( info - 1 ) ) {
+      case transparentHugePages: return transparentHugePages;
+      case hugetlbPages        : return hugetlbPages;
+      default                  : return noHugePages;
+   }
+#else
+   return noHugePages;
+#endif
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
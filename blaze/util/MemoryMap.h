@@ -0,0 +1,336 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_MEMORYMAP_H_
+#define _BLAZE_UTIL_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <stdexcept>
+#include <string>
+#include <blaze/util/Byte.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MAPPING MODES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access mode of a memory mapped file.
+// \ingroup util
+//
+// This enumeration specifies how the pages of a memory mapped file can be accessed (see the
+// MemoryMap class).
+*/
+enum MappingMode
+{
+   readOnly    = 0,  //!< The mapping can only be read. Any write access results in a segfault.
+   copyOnWrite = 1   //!< The mapping can be written. Modified pages are private copies.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping of a file.
+// \ingroup util
+//
+// The MemoryMap class maps the complete content of a file into the address space of the process.
+// The mapping is established by the constructor and released by the destructor. In contrast to
+// reading the file, no data is copied: the pages of the file are loaded on demand by the
+// operating system and shared with the page cache, which makes it possible to work on files
+// that are larger than the available main memory:
+
+   \code
+   blaze::MemoryMap map( "matrix.bin", blaze::readOnly );
+
+   const blaze::byte* data( map.data() );  // Pointer to the first byte of the file
+   const size_t size( map.size() );         // Size of the file in bytes
+   \endcode
+
+// The mapping mode determines the access to the mapped pages. A \a readOnly mapping may only be
+// read; any attempt to write to its pages results in a segmentation fault. A \a copyOnWrite
+// mapping can be modified, but all modifications are private to the process: each modified page
+// is copied on its first write access and the file itself remains unchanged.
+//
+// The first byte of a mapping is always aligned to the page size of the system. In case the
+// mapping cannot be established (as for instance in case the file does not exist), a
+// \a std::runtime_error exception is thrown.
+*/
+class MemoryMap : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemoryMap( const std::string& file, MappingMode mode=readOnly );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline byte*        data();
+   inline const byte*  data() const;
+   inline size_t       size() const;
+   inline MappingMode  mode() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte*       data_;  //!< The first byte of the mapping.
+   size_t      size_;  //!< The size of the mapping in bytes.
+   MappingMode mode_;  //!< The access mode of the mapping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MemoryMap class.
+//
+// \param file The name of the file to be mapped.
+// \param mode The access mode of the mapping.
+// \exception std::runtime_error File could not be mapped.
+//
+// This constructor maps the complete content of the given file with the given access mode. In
+// case the file cannot be opened or mapped, a \a std::runtime_error exception is thrown. Note
+// that the mapping of an empty file results in a mapping of size 0 without accessible data.
+*/
+inline MemoryMap::MemoryMap( const std::string& file, MappingMode mode )
+   : data_( NULL )  // The first byte of the mapping
+   , size_( 0UL )   // The size of the mapping in bytes
+   , mode_( mode )  // The access mode of the mapping
+{
+#if defined(_MSC_VER)
+   const HANDLE handle( CreateFileA( file.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL ) );
+   if( handle == INVALID_HANDLE_VALUE )
+      throw std::runtime_error( "File could not be opened" );
+
+   LARGE_INTEGER filesize;
+   if( !GetFileSizeEx( handle, &filesize ) ) {
+      CloseHandle( handle );
+      throw std::runtime_error( "File could not be opened" );
+   }
+
+   size_ = static_cast<size_t>( filesize.QuadPart );
+
+   if( size_ > 0UL )
+   {
+      const DWORD protect( ( mode == readOnly )?( PAGE_READONLY ):( PAGE_WRITECOPY ) );
+      const DWORD access ( ( mode == readOnly )?( FILE_MAP_READ ):( FILE_MAP_COPY ) );
+
+      const HANDLE mapping( CreateFileMappingA( handle, NULL, protect, 0, 0, NULL ) );
+      CloseHandle( handle );
+
+      if( mapping == NULL )
+         throw std::runtime_error( "File could not be mapped" );
+
+      data_ = static_cast<byte*>( MapViewOfFile( mapping, access, 0, 0, 0 ) );
+      CloseHandle( mapping );
+
+      if( data_ == NULL )
+         throw std::runtime_error( "File could not be mapped" );
+   }
+   else {
+      CloseHandle( handle );
+   }
+#else
+   const int fd( open( file.c_str(), O_RDONLY ) );
+   if( fd == -1 )
+      throw std::runtime_error( "File could not be opened" );
+
+   struct stat info;
+   if( fstat( fd, &info ) != 0 ) {
+      close( fd );
+      throw std::runtime_error( "File could not be opened" );
+   }
+
+   size_ = static_cast<size_t>( info.st_size );
+
+   if( size_ > 0UL )
+   {
+      void* const mapping( mmap( NULL, size_,
+                                 ( mode == readOnly )?( PROT_READ ):( PROT_READ | PROT_WRITE ),
+                                 ( mode == readOnly )?( MAP_SHARED ):( MAP_PRIVATE ), fd, 0 ) );
+      close( fd );
+
+      if( mapping == MAP_FAILED )
+         throw std::runtime_error( "File could not be mapped" );
+
+      data_ = static_cast<byte*>( mapping );
+   }
+   else {
+      close( fd );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for the MemoryMap class.
+//
+// The destructor releases the mapping. All modifications of a \a copyOnWrite mapping are lost.
+*/
+inline MemoryMap::~MemoryMap()
+{
+   if( data_ == NULL ) return;
+
+#if defined(_MSC_VER)
+   UnmapViewOfFile( data_ );
+#else
+   munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first byte of the mapping.
+//
+// Note that the pages of a \a readOnly mapping must not be written via the returned pointer.
+*/
+inline byte* MemoryMap::data()
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first byte of the mapping.
+*/
+inline const byte* MemoryMap::data() const
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapping.
+//
+// \return The size of the mapping in bytes.
+*/
+inline size_t MemoryMap::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+inline MappingMode MemoryMap::mode() const
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,11 +40,21 @@
 // Includes
 //*************************************************************************************************
 
+#include <new>
 #include <vector>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
+#include <blaze/util/Memory.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 
 
 namespace blaze {
@@ -56,55 +66,155 @@ namespace blaze {
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Memory pool for small objects.
+/*!\brief Thread-safe memory pool for small objects.
 // \ingroup util
 //
 // The memory pool efficiently improves the performance of dynamic memory allocations for small
 // objects. By allocating a large block of memory that can be dynamically assigned to small
 // objects, the memory allocation is reduced from a few hundred cycles to only a few cycles.\n
-// The memory pool is build from memory blocks of type Block, which hold the memory for a
-// specified number of objects. The memory of these blocks is managed as a single free list.
+// The memory pool is build from memory blocks, which hold the memory for \a Blocksize objects
+// of type \a Type. The size of each object slot is rounded up to a multiple of the alignment of
+// \a Type (see the AlignmentOf type trait), i.e. all objects are properly aligned. Each free
+// object stores only the link to the next free object. All memory blocks are owned by a shared
+// depot. Each thread that uses the pool owns a private cache of free objects, which serves all
+// allocations and deallocations of the thread without any synchronization. Free objects are
+// transferred between the caches and the depot in batches of \a Blocksize objects: A cache that
+// runs empty takes a batch from the depot (or a fresh memory block in case the depot is empty),
+// a cache that holds more than two batches returns one batch to the depot. The batches of the
+// depot are described by separate batch headers, which are kept in a lock-free stack, i.e.
+// batches are transferred without locking. Only the allocation of a new memory block or batch
+// header requires a lock. Thus objects can be freely allocated and released by different
+// threads. When a thread terminates, all objects in its cache are returned to the depot. The
+// memory blocks are released as soon as the pool and all thread caches have been destroyed.
 */
 template< typename Type, size_t Blocksize >
 class MemoryPool : private NonCopyable
 {
  private:
+   //**Constants***********************************************************************************
+   //! Alignment of the objects of the memory pool.
+   static const size_t alignment = AlignmentOf<Type>::value;
+
+   //! Minimum size of a single object slot of the memory pool.
+   static const size_t minSize = ( sizeof(Type) > sizeof(void*) )?( sizeof(Type) ):( sizeof(void*) );
+
+   //! Size of a single object slot of the memory pool.
+   static const size_t slotSize = ( minSize + alignment - 1UL ) / alignment * alignment;
+   //**********************************************************************************************
+
    //**union FreeObject****************************************************************************
    /*!\brief A single element of the free list of the memory pool.
    */
    union FreeObject {
-      FreeObject* next_;            //!< Pointer to the next free object.
-      byte dummy_[ sizeof(Type) ];  //!< Dummy array to create an object of the appropriate size.
+      FreeObject* next_;        //!< Pointer to the next free object.
+      byte dummy_[ slotSize ];  //!< Dummy array to create an object slot of the appropriate size.
    };
    //**********************************************************************************************
 
-   //**struct Block********************************************************************************
-   /*!\brief Memory block within the memory bool.
+   //**struct Batch********************************************************************************
+   /*!\brief Header of a batch of free objects within the depot of the memory pool.
+   */
+   struct Batch
+   {
+      Batch*      next_;     //!< Pointer to the next batch header of the stack.
+      FreeObject* objects_;  //!< The first free object of the batch.
+      size_t      size_;     //!< The number of free objects of the batch.
+   };
+   //**********************************************************************************************
+
+   //**struct Depot********************************************************************************
+   /*!\brief Shared depot of the memory pool.
    //
-   // One memory block holds the memory for exactly \a Blocksize objects of type \a Type.
+   // The depot owns all memory blocks and batch headers of the memory pool and holds the batches
+   // of free objects that are not assigned to any thread cache.
    */
-   struct Block
+   struct Depot : private NonCopyable
    {
     public:
+      //**Type definitions*************************************************************************
+      //! Tagged pointer to the top of a stack of batch headers.
+      typedef boost::uint64_t  TaggedPointer;
+      //*******************************************************************************************
+
+      //**Constants********************************************************************************
+      //! Position of the modification counter within a tagged pointer.
+      static const size_t tagShift = ( sizeof(Batch*) < 8UL )?( 32UL ):( 48UL );
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\name Constructor */
+      //@{
+      explicit inline Depot();
+      //@}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\name Destructor */
+      //@{
+      inline ~Depot();
+      //@}
+      //*******************************************************************************************
+
       //**Memory management functions**************************************************************
       /*!\name Memory management functions */
       //@{
-      void init();
-      void free();
+      inline FreeObject* allocateBlock();
+      inline Batch*      allocateBatch();
+      inline void        releaseBatch( Batch* batch );
+      inline void        push( Batch* batch );
+      inline Batch*      pop();
+      inline bool        contains( const FreeObject* object );
+
+      static inline void          push   ( boost::atomic<TaggedPointer>& stack, Batch* batch );
+      static inline Batch*        pop    ( boost::atomic<TaggedPointer>& stack );
+      static inline TaggedPointer tag    ( Batch* batch, TaggedPointer previous );
+      static inline Batch*        pointer( TaggedPointer tagged );
       //@}
       //*******************************************************************************************
 
       //**Member variables*************************************************************************
       /*!\name Member variables */
       //@{
-      FreeObject* rawMemory_;  //!< Allocated memory pool of the block.
+      boost::atomic<TaggedPointer> batches_;    //!< Stack of batches of free objects.
+      boost::atomic<TaggedPointer> headers_;    //!< Stack of unused batch headers.
+      boost::mutex                 mutex_;      //!< Synchronization mutex for the allocations.
+      std::vector<FreeObject*>     blocks_;     //!< Vector of available memory blocks.
+      std::vector<Batch*>          allocated_;  //!< Vector of all allocated batch headers.
       //@}
       //*******************************************************************************************
    };
    //**********************************************************************************************
 
-   //**Type definitions****************************************************************************
-   typedef std::vector<Block> Blocks;  //!< Vector of memory blocks.
+   //**struct Cache********************************************************************************
+   /*!\brief Thread-local cache of free objects.
+   */
+   struct Cache : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\name Constructor */
+      //@{
+      explicit inline Cache( const boost::shared_ptr<Depot>& depot );
+      //@}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\name Destructor */
+      //@{
+      inline ~Cache();
+      //@}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      /*!\name Member variables */
+      //@{
+      boost::shared_ptr<Depot> depot_;     //!< The depot of the memory pool.
+      FreeObject*              freeList_;  //!< Head of the free list of the thread.
+      size_t                   size_;      //!< The current number of free objects in the cache.
+      Batch*                   spare_;     //!< Reserved batch header of the cache.
+      //@}
+      //*******************************************************************************************
+   };
    //**********************************************************************************************
 
  public:
@@ -134,57 +244,357 @@ class MemoryPool : private NonCopyable
    //**Memory management functions*****************************************************************
    /*!\name Memory management functions */
    //@{
-   inline bool checkMemory( FreeObject* rawMemory ) const;
+   inline Cache& cache();
+   inline bool   checkMemory( FreeObject* rawMemory );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   FreeObject* freeList_;  //!< Head of the free list.
-   Blocks blocks_;         //!< Vector of available memory blocks.
+   boost::shared_ptr<Depot>         depot_;   //!< The shared depot of the memory pool.
+   boost::thread_specific_ptr<Cache> caches_;  //!< The thread-local caches of free objects.
    //@}
    //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( Blocksize > 0UL );
+   BLAZE_STATIC_ASSERT( sizeof(FreeObject) == slotSize );
+   /*! \endcond */
+   //**********************************************************************************************
 };
+//*************************************************************************************************
 
 
 
 
 //=================================================================================================
 //
-//  CLASS MEMORYPOOL::BLOCK
+//  CLASS MEMORYPOOL::DEPOT
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Initialization of a memory block.
+/*!\brief The default constructor for the depot of the memory pool.
+*/
+template< typename Type, size_t Blocksize >
+inline MemoryPool<Type,Blocksize>::Depot::Depot()
+   : batches_  ( 0U )  // Stack of batches of free objects
+   , headers_  ( 0U )  // Stack of unused batch headers
+   , mutex_    ()      // Synchronization mutex for the allocations
+   , blocks_   ()      // Vector of available memory blocks
+   , allocated_()      // Vector of all allocated batch headers
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for the depot of the memory pool.
+//
+// The destructor releases all memory blocks and batch headers of the memory pool.
+*/
+template< typename Type, size_t Blocksize >
+inline MemoryPool<Type,Blocksize>::Depot::~Depot()
+{
+   for( typename std::vector<FreeObject*>::iterator it=blocks_.begin(); it!=blocks_.end(); ++it )
+      deallocate_backend( *it );
+
+   for( typename std::vector<Batch*>::iterator it=allocated_.begin(); it!=allocated_.end(); ++it )
+      delete *it;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of a new memory block.
+//
+// \return Pointer to the first free object of the new memory block.
+// \exception std::bad_alloc Allocation failed.
 //
+// This function allocates a single memory block for \a Blocksize objects of type \a Type. This
+// memory is already prepared as a free list of \a Blocksize objects. The memory block is aligned
+// to the cache line size or the alignment restrictions of \a Type, whichever is larger.
+*/
+template< typename Type, size_t Blocksize >
+inline typename MemoryPool<Type,Blocksize>::FreeObject*
+   MemoryPool<Type,Blocksize>::Depot::allocateBlock()
+{
+   const size_t blockAlignment( ( alignment > 64UL )?( alignment ):( 64UL ) );
+
+   FreeObject* const rawMemory(
+      reinterpret_cast<FreeObject*>( allocate_backend( Blocksize*slotSize, blockAlignment ) ) );
+
+   try {
+      boost::mutex::scoped_lock lock( mutex_ );
+      blocks_.push_back( rawMemory );
+   }
+   catch( ... ) {
+      deallocate_backend( rawMemory );
+      throw;
+   }
+
+   for( size_t i=0UL; i<Blocksize-1UL; ++i ) {
+      rawMemory[i].next_ = &rawMemory[i+1UL];
+   }
+   rawMemory[Blocksize-1UL].next_ = NULL;
+
+   return rawMemory;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of a batch header.
+//
+// \return Pointer to the batch header, \a NULL in case the allocation failed.
+//
+// This function takes an unused batch header from the depot or allocates a new one. Batch
+// headers are never released before the depot is destroyed. In contrast to the allocation of
+// memory blocks, this function does not throw in case the allocation fails.
+*/
+template< typename Type, size_t Blocksize >
+inline typename MemoryPool<Type,Blocksize>::Batch*
+   MemoryPool<Type,Blocksize>::Depot::allocateBatch()
+{
+   Batch* batch( pop( headers_ ) );
+
+   if( batch != NULL )
+      return batch;
+
+   batch = new( std::nothrow ) Batch();
+
+   if( batch == NULL )
+      return NULL;
+
+   try {
+      boost::mutex::scoped_lock lock( mutex_ );
+      allocated_.push_back( batch );
+   }
+   catch( ... ) {
+      delete batch;
+      return NULL;
+   }
+
+   return batch;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning an unused batch header to the depot.
+//
+// \param batch The unused batch header.
+// \return void
+*/
+template< typename Type, size_t Blocksize >
+inline void MemoryPool<Type,Blocksize>::Depot::releaseBatch( Batch* batch )
+{
+   push( headers_, batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a batch of free objects to the depot.
+//
+// \param batch The header of the batch.
 // \return void
+*/
+template< typename Type, size_t Blocksize >
+inline void MemoryPool<Type,Blocksize>::Depot::push( Batch* batch )
+{
+   push( batches_, batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a batch of free objects from the depot.
+//
+// \return The header of the batch, \a NULL in case the depot is empty.
 //
-// The \a init function allocates a single memory block for \a Blocksize objects of type \a Type.
-// This memory is already prepared for the inclusion in the free list of the memory pool.
+// The returned batch header has to be returned to the depot via releaseBatch() as soon as the
+// batch has been taken over.
 */
 template< typename Type, size_t Blocksize >
-inline void MemoryPool<Type,Blocksize>::Block::init()
+inline typename MemoryPool<Type,Blocksize>::Batch*
+   MemoryPool<Type,Blocksize>::Depot::pop()
 {
-   rawMemory_ = new FreeObject[ Blocksize ];
-   for( size_t i=0; i<Blocksize-1; ++i ) {
-      rawMemory_[i].next_ = &rawMemory_[i+1];
+   return pop( batches_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given object is part of any memory block of the depot.
+//
+// \param object Pointer to the object to be checked.
+// \return \a true if the object is part of a memory block, \a false if not.
+*/
+template< typename Type, size_t Blocksize >
+inline bool MemoryPool<Type,Blocksize>::Depot::contains( const FreeObject* object )
+{
+   boost::mutex::scoped_lock lock( mutex_ );
+
+   for( typename std::vector<FreeObject*>::const_iterator it=blocks_.begin(); it!=blocks_.end(); ++it )
+   {
+      if( object >= *it && object < *it+Blocksize )
+      {
+         const byte* const ptr1( reinterpret_cast<const byte*>( object ) );
+         const byte* const ptr2( reinterpret_cast<const byte*>( *it ) );
+
+         return ( ptr1 - ptr2 ) % sizeof(FreeObject) == 0;
+      }
    }
-   rawMemory_[Blocksize-1].next_ = 0;
+
+   return false;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Release of the entire memory block.
+/*!\brief Adding a batch header to the given lock-free stack.
 //
+// \param stack The tagged pointer to the top of the stack.
+// \param batch The batch header to be added.
 // \return void
 */
 template< typename Type, size_t Blocksize >
-inline void MemoryPool<Type,Blocksize>::Block::free()
+inline void
+   MemoryPool<Type,Blocksize>::Depot::push( boost::atomic<TaggedPointer>& stack, Batch* batch )
+{
+   TaggedPointer head( stack.load( boost::memory_order_relaxed ) );
+
+   do {
+      batch->next_ = pointer( head );
+   } while( !stack.compare_exchange_weak( head, tag( batch, head ), boost::memory_order_release,
+                                                                    boost::memory_order_relaxed ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a batch header from the given lock-free stack.
+//
+// \param stack The tagged pointer to the top of the stack.
+// \return The removed batch header, \a NULL in case the stack is empty.
+//
+// Since every modification of the stack increments the modification counter of the top of the
+// stack, the compare-and-swap fails in case the top batch header has been removed and added
+// again in the meantime (ABA problem). Note that this protection is probabilistic: The counter
+// wraps around after \f$ 2^{16} \f$ (64-bit platforms) or \f$ 2^{32} \f$ (32-bit platforms)
+// modifications, i.e. the ABA problem can still occur in case a thread is suspended between
+// the load and the compare-and-swap for exactly a multiple of this number of modifications.
+// Also note that the link of the top batch header may be read after another thread has removed
+// it. This is safe since batch headers are not released before the depot is destroyed.
+*/
+template< typename Type, size_t Blocksize >
+inline typename MemoryPool<Type,Blocksize>::Batch*
+   MemoryPool<Type,Blocksize>::Depot::pop( boost::atomic<TaggedPointer>& stack )
+{
+   TaggedPointer head( stack.load( boost::memory_order_acquire ) );
+   Batch* batch( pointer( head ) );
+
+   while( batch != NULL &&
+          !stack.compare_exchange_weak( head, tag( batch->next_, head ),
+                                        boost::memory_order_acquire,
+                                        boost::memory_order_acquire ) ) {
+      batch = pointer( head );
+   }
+
+   return batch;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a tagged pointer to the given batch header.
+//
+// \param batch Pointer to the batch header (may be \a NULL).
+// \param previous The tagged pointer to be replaced.
+// \return The tagged pointer to the batch header.
+//
+// The modification counter of the resulting tagged pointer is the incremented counter of the
+// given previous tagged pointer. On 64-bit platforms the counter is stored in the upper 16 bits
+// of the tagged pointer, which requires all addresses to fit into 48 bits.
+*/
+template< typename Type, size_t Blocksize >
+inline typename MemoryPool<Type,Blocksize>::Depot::TaggedPointer
+   MemoryPool<Type,Blocksize>::Depot::tag( Batch* batch, TaggedPointer previous )
+{
+   const TaggedPointer address( reinterpret_cast<size_t>( batch ) );
+   const TaggedPointer counter( ( previous >> tagShift ) + 1U );
+
+   BLAZE_INTERNAL_ASSERT( ( address >> tagShift ) == 0U, "Address exceeds the tagged pointer range" );
+
+   return address | ( counter << tagShift );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracts the pointer to the batch header from the given tagged pointer.
+//
+// \param tagged The tagged pointer.
+// \return Pointer to the batch header.
+*/
+template< typename Type, size_t Blocksize >
+inline typename MemoryPool<Type,Blocksize>::Batch*
+   MemoryPool<Type,Blocksize>::Depot::pointer( TaggedPointer tagged )
+{
+   const TaggedPointer mask( ( TaggedPointer( 1U ) << tagShift ) - 1U );
+   return reinterpret_cast<Batch*>( static_cast<size_t>( tagged & mask ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MEMORYPOOL::CACHE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread-local cache of the memory pool.
+//
+// \param depot The depot of the memory pool.
+// \exception std::bad_alloc Allocation failed.
+//
+// The cache reserves a batch header, which guarantees that the destructor can return the free
+// objects of the cache to the depot without any allocation.
+*/
+template< typename Type, size_t Blocksize >
+inline MemoryPool<Type,Blocksize>::Cache::Cache( const boost::shared_ptr<Depot>& depot )
+   : depot_   ( depot                  )  // The depot of the memory pool
+   , freeList_( NULL                   )  // Head of the free list of the thread
+   , size_    ( 0UL                    )  // The current number of free objects in the cache
+   , spare_   ( depot->allocateBatch() )  // Reserved batch header of the cache
 {
-   delete [] rawMemory_;
+   if( spare_ == NULL )
+      throw std::bad_alloc();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for the thread-local cache of the memory pool.
+//
+// The destructor returns all free objects of the cache as a single batch to the depot.
+*/
+template< typename Type, size_t Blocksize >
+inline MemoryPool<Type,Blocksize>::Cache::~Cache()
+{
+   if( freeList_ != NULL ) {
+      spare_->objects_ = freeList_;
+      spare_->size_    = size_;
+      depot_->push( spare_ );
+   }
+   else {
+      depot_->releaseBatch( spare_ );
+   }
 }
 //*************************************************************************************************
 
@@ -202,23 +612,22 @@ inline void MemoryPool<Type,Blocksize>::Block::free()
 */
 template< typename Type, size_t Blocksize >
 inline MemoryPool<Type,Blocksize>::MemoryPool()
-{
-   blocks_.push_back( Block() );
-   Block& block = blocks_.back();
-   block.init();
-   freeList_ = block.rawMemory_;
-}
+   : depot_ ( new Depot() )  // The shared depot of the memory pool
+   , caches_()               // The thread-local caches of free objects
+{}
 //*************************************************************************************************
 
 
 //*************************************************************************************************
 /*!\brief Destructor of the memory pool.
+//
+// The destructor returns the cache of the calling thread to the depot. The memory blocks of the
+// pool are released as soon as the caches of all other threads have been destroyed.
 */
 template< typename Type, size_t Blocksize >
 inline MemoryPool<Type,Blocksize>::~MemoryPool()
 {
-   for( typename Blocks::iterator it=blocks_.begin(); it!=blocks_.end(); ++it )
-      it->free();
+   caches_.reset();
 }
 //*************************************************************************************************
 
@@ -227,19 +636,31 @@ inline MemoryPool<Type,Blocksize>::~MemoryPool()
 /*!\brief Allocation of raw memory for an object of type \a Type.
 //
 // \return Pointer to the raw memory.
+// \exception std::bad_alloc Allocation failed.
 */
 template< typename Type, size_t Blocksize >
 inline void* MemoryPool<Type,Blocksize>::malloc()
 {
-   if( !freeList_ ) {
-      blocks_.push_back( Block() );
-      Block& block = blocks_.back();
-      block.init();
-      freeList_ = block.rawMemory_;
+   Cache& local( cache() );
+
+   if( local.freeList_ == NULL )
+   {
+      Batch* const batch( depot_->pop() );
+
+      if( batch != NULL ) {
+         local.freeList_ = batch->objects_;
+         local.size_ = batch->size_;
+         depot_->releaseBatch( batch );
+      }
+      else {
+         local.freeList_ = depot_->allocateBlock();
+         local.size_ = Blocksize;
+      }
    }
 
-   void* ptr = freeList_;
-   freeList_ = freeList_->next_;
+   void* ptr = local.freeList_;
+   local.freeList_ = local.freeList_->next_;
+   --local.size_;
    return ptr;
 }
 //*************************************************************************************************
@@ -250,49 +671,97 @@ inline void* MemoryPool<Type,Blocksize>::malloc()
 //
 // \param rawMemory Pointer to the raw memory.
 // \return void
+//
+// The released memory is added to the cache of the calling thread. In case the cache holds
+// two batches of free objects, one batch is transferred to the depot of the memory pool. In
+// case no batch header can be allocated, the free objects remain in the cache.
 */
 template< typename Type, size_t Blocksize >
 inline void MemoryPool<Type,Blocksize>::free( void* rawMemory )
 {
    FreeObject* ptr = reinterpret_cast<FreeObject*>( rawMemory );
    BLAZE_INTERNAL_ASSERT( checkMemory( ptr ), "Memory pool check failed" );
-   ptr->next_ = freeList_;
-   freeList_ = ptr;
+
+   Cache& local( cache() );
+
+   ptr->next_ = local.freeList_;
+   local.freeList_ = ptr;
+   ++local.size_;
+
+   if( local.size_ >= 2UL*Blocksize )
+   {
+      Batch* const batch( depot_->allocateBatch() );
+
+      if( batch == NULL )
+         return;
+
+      FreeObject* last( local.freeList_ );
+      for( size_t i=1UL; i<Blocksize; ++i )
+         last = last->next_;
+
+      batch->objects_ = local.freeList_;
+      batch->size_    = Blocksize;
+
+      local.freeList_ = last->next_;
+      local.size_ -= Blocksize;
+
+      last->next_ = NULL;
+      depot_->push( batch );
+   }
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Performing a number of checks on the memory to be released.
+/*!\brief Returns the cache of the calling thread.
 //
-// \param toRelease Pointer to the memory to be released.
-// \return \a true if the memory check succeeds, \a false if an error is encountered.
+// \return Reference to the thread-local cache.
+//
+// In case the calling thread has not used the memory pool before, a new cache is created. Since
+// the thread-local storage is keyed by the address of the memory pool, the calling thread may
+// still own a cache of a destroyed memory pool at the same address. Such a cache is identified
+// by its depot, which is kept alive by the cache and can therefore not share its address with
+// the depot of this memory pool. The cache is replaced, which returns its free objects to the
+// depot of the destroyed memory pool.
 */
 template< typename Type, size_t Blocksize >
-inline bool MemoryPool<Type,Blocksize>::checkMemory( FreeObject* toRelease ) const
+inline typename MemoryPool<Type,Blocksize>::Cache& MemoryPool<Type,Blocksize>::cache()
 {
-   for( typename Blocks::const_iterator it=blocks_.begin(); it!=blocks_.end(); ++it )
-   {
-      // Range check
-      if( toRelease >= it->rawMemory_ && toRelease < it->rawMemory_+Blocksize )
-      {
-         // Alignment check
-         const byte* const ptr1( reinterpret_cast<const byte*>(toRelease) );
-         const byte* const ptr2( reinterpret_cast<const byte*>(it->rawMemory_) );
+   Cache* local( caches_.get() );
+
+   if( local == NULL || local->depot_ != depot_ ) {
+      local = new Cache( depot_ );
+      caches_.reset( local );
+   }
 
-         if( ( ptr1 - ptr2 ) % sizeof(FreeObject) != 0 ) return false;
+   return *local;
+}
+//*************************************************************************************************
 
-         // Duplicate free check
-         FreeObject* ptr( freeList_ );
-         while( ptr ) {
-            if( ptr == toRelease ) return false;
-            ptr = ptr->next_;
-         }
 
-         return true;
-      }
+//*************************************************************************************************
+/*!\brief Performing a number of checks on the memory to be released.
+//
+// \param toRelease Pointer to the memory to be released.
+// \return \a true if the memory check succeeds, \a false if an error is encountered.
+//
+// This function checks that the given memory is part of a memory block of the pool and that it
+// has not already been released to the cache of the calling thread.
+*/
+template< typename Type, size_t Blocksize >
+inline bool MemoryPool<Type,Blocksize>::checkMemory( FreeObject* toRelease )
+{
+   // Range and alignment check
+   if( !depot_->contains( toRelease ) ) return false;
+
+   // Duplicate free check
+   FreeObject* ptr( cache().freeList_ );
+   while( ptr ) {
+      if( ptr == toRelease ) return false;
+      ptr = ptr->next_;
    }
-   return false;
+
+   return true;
 }
 //*************************************************************************************************
 
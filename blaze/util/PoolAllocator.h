@@ -0,0 +1,558 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/PoolAllocator.h
+//  \brief Header file for the PoolAllocator implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_POOLALLOCATOR_H_
+#define _BLAZE_UTIL_POOLALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/thread/once.hpp>
+#include <blaze/util/Byte.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/MemoryPool.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SIZE CLASSES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Memory chunk of a single size class of the PoolAllocator.
+// \ingroup util
+*/
+template< size_t N >  // Size of the memory chunk in bytes
+struct PoolChunk
+{
+   byte data_[N];  //!< The raw memory of the chunk.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The memory pool of the size class of \a N bytes.
+// \ingroup util
+//
+// Each memory pool holds memory blocks of 64 KiB. The memory pools are intentionally never
+// destroyed in order to allow the deallocation of pool memory during static destruction. Both
+// static data members are constant initialized, i.e. they are valid before any dynamic
+// initialization takes place.
+*/
+template< size_t N >  // Size of the memory chunks in bytes
+struct PoolOf
+{
+   //**Type definitions****************************************************************************
+   typedef MemoryPool< PoolChunk<N>, 65536UL/N >  Pool;  //!< Type of the memory pool.
+   //**********************************************************************************************
+
+   //**Create function*****************************************************************************
+   /*!\brief Creates the memory pool of the size class.
+   //
+   // \return void
+   */
+   static void create() {
+      pool_ = new Pool();
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   static Pool*            pool_;  //!< The memory pool of the size class.
+   static boost::once_flag flag_;  //!< Initialization flag of the memory pool.
+   //**********************************************************************************************
+};
+
+template< size_t N >
+typename PoolOf<N>::Pool* PoolOf<N>::pool_ = NULL;
+
+template< size_t N >
+boost::once_flag PoolOf<N>::flag_ = BOOST_ONCE_INIT;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory pool of the size class of \a N bytes.
+// \ingroup util
+//
+// \return Reference to the memory pool of the size class.
+//
+// The memory pool is created by the first call of any thread. In contrast to a function-local
+// static variable, the creation via boost::call_once() is thread-safe in C++98.
+*/
+template< size_t N >  // Size of the memory chunks in bytes
+inline MemoryPool< PoolChunk<N>, 65536UL/N >& poolOf()
+{
+   boost::call_once( &PoolOf<N>::create, PoolOf<N>::flag_ );
+   return *PoolOf<N>::pool_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size class for the given number of bytes.
+// \ingroup util
+//
+// \param bytes The number of bytes to be allocated.
+// \return The index of the size class, \a poolSizeClasses in case no size class is available.
+//
+// The size classes of the PoolAllocator cover 64, 128, 256, 512, 1024, 2048, and 4096 bytes.
+*/
+const size_t poolSizeClasses = 7UL;
+
+inline size_t poolSizeClass( size_t bytes )
+{
+   size_t sizeClass( 0UL );
+   while( sizeClass < poolSizeClasses && ( 64UL << sizeClass ) < bytes )
+      ++sizeClass;
+   return sizeClass;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of memory from the size class memory pools.
+// \ingroup util
+//
+// \param bytes The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Pointer to the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// Requests of up to 4 KiB with an alignment restriction of up to 64 bytes are served by the
+// memory pool of the according size class. All other requests are forwarded to the allocation
+// backend.
+*/
+inline void* pool_allocate( size_t bytes, size_t alignment )
+{
+   if( alignment > 64UL )
+      return allocate_backend( bytes, alignment );
+
+   switch( poolSizeClass( bytes ) ) {
+      case 0UL: return poolOf<  64UL>().malloc();
+      case 1UL: return poolOf< 128UL>().malloc();
+      case 2UL: return poolOf< 256UL>().malloc();
+      case 3UL: return poolOf< 512UL>().malloc();
+      case 4UL: return poolOf<1024UL>().malloc();
+      case 5UL: return poolOf<2048UL>().malloc();
+      case 6UL: return poolOf<4096UL>().malloc();
+      default : return allocate_backend( bytes, ( alignment < 64UL )?( 64UL ):( alignment ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deallocation of memory acquired via the pool_allocate() function.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory to be deallocated.
+// \param bytes The number of bytes passed to the according pool_allocate() call.
+// \param alignment The alignment passed to the according pool_allocate() call.
+// \return void
+*/
+inline void pool_deallocate( void* address, size_t bytes, size_t alignment )
+{
+   if( alignment > 64UL ) {
+      deallocate_backend( address );
+      return;
+   }
+
+   switch( poolSizeClass( bytes ) ) {
+      case 0UL: poolOf<  64UL>().free( address ); break;
+      case 1UL: poolOf< 128UL>().free( address ); break;
+      case 2UL: poolOf< 256UL>().free( address ); break;
+      case 3UL: poolOf< 512UL>().free( address ); break;
+      case 4UL: poolOf<1024UL>().free( address ); break;
+      case 5UL: poolOf<2048UL>().free( address ); break;
+      case 6UL: poolOf<4096UL>().free( address ); break;
+      default : deallocate_backend( address ); break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocator for small, thread-safe pooled memory.
+// \ingroup util
+//
+// The PoolAllocator class template represents an implementation of the allocator concept of the
+// standard library for the allocation of uninitialized memory from a set of global, thread-safe
+// memory pools (see the MemoryPool class template). Allocations of up to 4 KiB are rounded up
+// to the next power of two size class (64, 128, ..., 4096 bytes) and served by the thread-local
+// cache of the according memory pool, which avoids any synchronization in the common case and
+// allows to release the memory from any thread. Larger allocations are forwarded to the default
+// allocation backend. The returned memory is guaranteed to be at least 64-byte aligned and
+// therefore satisfies the alignment restrictions of all vectorizable data types. The allocator
+// can for instance be used for the dynamic Blaze containers:
+
+   \code
+   typedef blaze::PoolAllocator<double>  Allocator;
+
+   blaze::DynamicVector<double,blaze::columnVector,Allocator> x( 10UL );
+   blaze::DynamicMatrix<double,blaze::rowMajor,Allocator> A( 6UL, 6UL );
+   \endcode
+*/
+template< typename Type >
+class PoolAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type            ValueType;        //!< Type of the allocated values.
+   typedef Type*           Pointer;          //!< Type of a pointer to the allocated values.
+   typedef const Type*     ConstPointer;     //!< Type of a pointer-to-const to the allocated values.
+   typedef Type&           Reference;        //!< Type of a reference to the allocated values.
+   typedef const Type&     ConstReference;   //!< Type of a reference-to-const to the allocated values.
+   typedef std::size_t     SizeType;         //!< Size type of the pool allocator.
+   typedef std::ptrdiff_t  DifferenceType;   //!< Difference type of the pool allocator.
+
+   // STL allocator requirements
+   typedef ValueType       value_type;       //!< Type of the allocated values.
+   typedef Pointer         pointer;          //!< Type of a pointer to the allocated values.
+   typedef ConstPointer    const_pointer;    //!< Type of a pointer-to-const to the allocated values.
+   typedef Reference       reference;        //!< Type of a reference to the allocated values.
+   typedef ConstReference  const_reference;  //!< Type of a reference-to-const to the allocated values.
+   typedef SizeType        size_type;        //!< Size type of the pool allocator.
+   typedef DifferenceType  difference_type;  //!< Difference type of the pool allocator.
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the PoolAllocator rebind mechanism.
+   */
+   template< typename Type2 >
+   struct rebind
+   {
+      typedef PoolAllocator<Type2>  other;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PoolAllocator();
+
+   template< typename Type2 >
+   inline PoolAllocator( const PoolAllocator<Type2>& );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t       max_size() const;
+   inline Pointer      address( Reference x ) const;
+   inline ConstPointer address( ConstReference x ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline Pointer allocate  ( size_t numObjects, const void* localityHint = NULL );
+   inline void    deallocate( Pointer ptr, size_t numObjects );
+   //@}
+   //**********************************************************************************************
+
+   //**Construction functions**********************************************************************
+   /*!\name Construction functions */
+   //@{
+   inline void construct( Pointer ptr, const Type& value );
+   inline void destroy  ( Pointer ptr );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PoolAllocator.
+*/
+template< typename Type >
+inline PoolAllocator<Type>::PoolAllocator()
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different PoolAllocator instances.
+//
+// \param allocator The foreign pool allocator to be copied.
+*/
+template< typename Type >
+template< typename Type2 >
+inline PoolAllocator<Type>::PoolAllocator( const PoolAllocator<Type2>& allocator )
+{
+   UNUSED_PARAMETER( allocator );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum possible number of elements that can be allocated together.
+//
+// \return The maximum number of elements that can be allocated together.
+*/
+template< typename Type >
+inline size_t PoolAllocator<Type>::max_size() const
+{
+   return size_t(-1) / sizeof( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given element.
+//
+// \return The address of the given element.
+*/
+template< typename Type >
+inline typename PoolAllocator<Type>::Pointer
+   PoolAllocator<Type>::address( Reference x ) const
+{
+   return &x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the address of the given element.
+//
+// \return The address of the given element.
+*/
+template< typename Type >
+inline typename PoolAllocator<Type>::ConstPointer
+   PoolAllocator<Type>::address( ConstReference x ) const
+{
+   return &x;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates pooled memory for the specified number of objects.
+//
+// \param numObjects The number of objects to be allocated.
+// \param localityHint Hint for improved locality.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates a junk of uninitialized memory for the specified number of objects of
+// type \a Type. The returned pointer is guaranteed to be at least 64-byte aligned or aligned
+// according to the alignment restrictions of the data type \a Type, whichever is larger.
+*/
+template< typename Type >
+inline typename PoolAllocator<Type>::Pointer
+   PoolAllocator<Type>::allocate( size_t numObjects, const void* localityHint )
+{
+   UNUSED_PARAMETER( localityHint );
+
+   return reinterpret_cast<Pointer>(
+      pool_allocate( numObjects*sizeof(Type), AlignmentOf<Type>::value ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory.
+//
+// \param ptr The address of the first element of the array to be deallocated.
+// \param numObjects The number of objects to be deallocated.
+// \return void
+//
+// This function deallocates a junk of memory that was previously allocated via the allocate()
+// function. Note that the argument \a numObjects must be equal to the first argument of the call
+// to allocate() that originally produced \a ptr. The memory may be deallocated by any thread.
+*/
+template< typename Type >
+inline void PoolAllocator<Type>::deallocate( Pointer ptr, size_t numObjects )
+{
+   if( ptr == NULL )
+      return;
+
+   pool_deallocate( ptr, numObjects*sizeof(Type), AlignmentOf<Type>::value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructs an object of type \a Type at the specified memory location.
+//
+// \param ptr Pointer to the allocated, uninitialized storage.
+// \param value The initialization value.
+// \return void
+//
+// This function constructs an object of type \a Type in the allocated, uninitialized storage
+// pointed to by \a ptr. This construction is performed via placement-new.
+*/
+template< typename Type >
+inline void PoolAllocator<Type>::construct( Pointer ptr, ConstReference value )
+{
+   ::new( ptr ) Type( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the object of type \a Type at the specified memory location.
+//
+// \param ptr Pointer to the object to be destroyed.
+// \return void
+//
+// This function destroys the object at the specified memory location via a direct call to its
+// destructor.
+*/
+template< typename Type >
+inline void PoolAllocator<Type>::destroy( Pointer ptr )
+{
+   ptr->~Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PoolAllocator operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const PoolAllocator<T1>& lhs, const PoolAllocator<T2>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator!=( const PoolAllocator<T1>& lhs, const PoolAllocator<T2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two PoolAllocator objects.
+//
+// \param lhs The left-hand side pool allocator.
+// \param rhs The right-hand side pool allocator.
+// \return \a true.
+*/
+template< typename T1    // Type of the left-hand side pool allocator
+        , typename T2 >  // Type of the right-hand side pool allocator
+inline bool operator==( const PoolAllocator<T1>& lhs, const PoolAllocator<T2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two PoolAllocator objects.
+//
+// \param lhs The left-hand side pool allocator.
+// \param rhs The right-hand side pool allocator.
+// \return \a false.
+*/
+template< typename T1    // Type of the left-hand side pool allocator
+        , typename T2 >  // Type of the right-hand side pool allocator
+inline bool operator!=( const PoolAllocator<T1>& lhs, const PoolAllocator<T2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
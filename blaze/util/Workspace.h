@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Workspace.h
+//  \brief Header file for the WorkspaceScope class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSPACE_H_
+#define _BLAZE_UTIL_WORKSPACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS WORKSPACESCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope guard for the activation of a thread-local workspace.
+// \ingroup util
+//
+// A WorkspaceScope activates a Workspace for the calling thread for its lifetime. All memory
+// blocks that are released by the thread during this time are cached and recycled for later
+// allocations (see the Workspace class description). On destruction, all cached memory blocks
+// are returned to the system. The total size of the cached memory blocks is limited by the
+// given capacity (by default workspaceCapacity). In case a workspace is already active on the
+// calling thread, the new scope has no effect and the active workspace remains in use.
+*/
+class WorkspaceScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkspaceScope( size_t capacity = workspaceCapacity );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~WorkspaceScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Workspace& workspace();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Workspace  workspace_;  //!< The workspace owned by the scope.
+   Workspace* active_;     //!< The workspace that is active during the lifetime of the scope.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The constructor for WorkspaceScope.
+//
+// \param capacity The maximum total size of the cached memory blocks in bytes.
+//
+// In case a workspace is already active on the calling thread, the given capacity is ignored.
+*/
+inline WorkspaceScope::WorkspaceScope( size_t capacity )
+   : workspace_( capacity )              // The workspace owned by the scope
+   , active_   ( Workspace::current() )  // The workspace that is active during the lifetime of the scope
+{
+   if( active_ == NULL ) {
+      active_ = &workspace_;
+      Workspace::instance() = active_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for WorkspaceScope.
+*/
+inline WorkspaceScope::~WorkspaceScope()
+{
+   if( active_ == &workspace_ ) {
+      BLAZE_INTERNAL_ASSERT( Workspace::instance() == active_, "Invalid workspace detected" );
+      Workspace::instance() = NULL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the workspace that is active during the lifetime of the scope.
+//
+// \return Reference to the active workspace.
+*/
+inline Workspace& WorkspaceScope::workspace()
+{
+   return *active_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -101,10 +101,13 @@ class ClassTest
    void testSet         ();
    void testInsert      ();
    void testAppend      ();
+   void testAssemble    ();
+   void testAssemblyMap ();
    void testErase       ();
    void testResize      ();
    void testReserve     ();
    void testTrim        ();
+   void testCompact     ();
    void testTranspose   ();
    void testSwap        ();
    void testFind        ();
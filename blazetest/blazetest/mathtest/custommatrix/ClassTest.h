@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/custommatrix/ClassTest.h
+//  \brief Header file for the CustomMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CUSTOMMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_CUSTOMMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace custommatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CustomMatrix class template.
+//
+// This class represents a test suite for the blaze::CustomMatrix class template. It performs
+// a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAddAssign   ();
+   void testSubAssign   ();
+   void testMultAssign  ();
+   void testScaling     ();
+   void testFunctionCall();
+   void testIterator    ();
+   void testNonZeros    ();
+   void testReset       ();
+   void testClear       ();
+   void testSwap        ();
+   void testIsDefault   ();
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::CustomMatrix<int,blaze::unaligned,blaze::unpadded,blaze::rowMajor>  UUMT;  //!< Type of the unaligned, unpadded custom matrix.
+   typedef blaze::CustomMatrix<int,blaze::aligned,blaze::padded,blaze::columnMajor>   APMT;  //!< Type of the aligned, padded custom matrix.
+   typedef UUMT::Rebind<double>::Other                                                RMT;   //!< Rebound custom matrix type.
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>                                  DMT;   //!< Result type of the row-major custom matrix.
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>                               ODMT;  //!< Result type of the column-major custom matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( UUMT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( APMT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( RMT  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UUMT::ResultType, DMT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UUMT::OppositeType, ODMT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( APMT::ResultType, ODMT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( APMT::TransposeType, DMT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType, double );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given custom matrix.
+//
+// \param matrix The custom matrix to be checked.
+// \param expectedRows The expected number of rows of the custom matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given custom matrix. In case the actual number
+// of rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the custom matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given custom matrix.
+//
+// \param matrix The custom matrix to be checked.
+// \param expectedColumns The expected number of columns of the custom matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given custom matrix. In case the
+// actual number of columns does not correspond to the given expected number of columns,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the custom matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given custom matrix.
+//
+// \param matrix The custom matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the custom matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given custom matrix. In
+// case the actual number of non-zero elements does not correspond to the given expected
+// number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the custom matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements in a specific row/column of the given custom matrix.
+//
+// \param matrix The custom matrix to be checked.
+// \param index The row/column to be checked.
+// \param expectedNonZeros The expected number of non-zero elements in the specified row/column.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements in the specified row/column of the
+// given custom matrix. In case the actual number of non-zero elements does not correspond
+// to the given expected number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the custom matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix, index ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements in "
+          << ( blaze::IsRowMajorMatrix<Type>::value ? "row " : "column " ) << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix, index ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CustomMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CustomMatrix class test.
+*/
+#define RUN_CUSTOMMATRIX_CLASS_TEST \
+   blazetest::mathtest::custommatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace custommatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
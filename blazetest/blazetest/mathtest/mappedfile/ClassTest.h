@@ -0,0 +1,318 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mappedfile/ClassTest.h
+//  \brief Header file for the memory mapped file test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MAPPEDFILE_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MAPPEDFILE_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MappedFile.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedfile {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the memory mapped file format.
+//
+// This class represents a test suite for the memory mapped file format of dense vectors and
+// matrices. It performs a series of runtime tests that write vectors and matrices into a file
+// and adapt the memory mapped file by means of CustomVector and CustomMatrix.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVectors    ();
+   void testMatrices   ();
+   void testCopyOnWrite();
+   void testFailures   ();
+
+   template< typename VT >
+   void runVectorTest( const VT& src );
+
+   template< typename MT >
+   void runMatrixTest( const MT& src );
+
+   template< typename T1, typename T2 >
+   void compare( const T1& src, const T2& dst );
+
+   template< typename Type >
+   void checkPadding( const Type* begin, const Type* end );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< The name of the temporary file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping test with the given source vector.
+//
+// \param src The source vector to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given vector into the temporary file and adapts the read-only
+// mapped file by both an aligned and padded and an unaligned and unpadded custom vector. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the vector
+void ClassTest::runVectorTest( const VT& src )
+{
+   typedef typename VT::ElementType  ET;
+
+   const bool TF( blaze::IsRowVector<VT>::value );
+
+   blaze::writeMappedFile( file_, src );
+
+   blaze::MemoryMap map( file_, blaze::readOnly );
+
+   {
+      blaze::CustomVector<ET,blaze::aligned,blaze::padded,TF> dst;
+      blaze::mapVector( map, dst );
+
+      compare( src, dst );
+      checkPadding( dst.data()+dst.size(), dst.data()+dst.capacity() );
+   }
+
+   {
+      blaze::CustomVector<ET,blaze::unaligned,blaze::unpadded,TF> dst;
+      blaze::mapVector( map, dst );
+
+      compare( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping test with the given source matrix.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given matrix into the temporary file and adapts the read-only
+// mapped file by both an aligned and padded and an unaligned and unpadded custom matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runMatrixTest( const MT& src )
+{
+   typedef typename MT::ElementType  ET;
+
+   const bool SO( blaze::IsColumnMajorMatrix<MT>::value );
+
+   blaze::writeMappedFile( file_, src );
+
+   blaze::MemoryMap map( file_, blaze::readOnly );
+
+   {
+      blaze::CustomMatrix<ET,blaze::aligned,blaze::padded,SO> dst;
+      blaze::mapMatrix( map, dst );
+
+      compare( src, dst );
+
+      const size_t outer( SO ? dst.columns() : dst.rows()    );
+      const size_t inner( SO ? dst.rows()    : dst.columns() );
+
+      for( size_t i=0UL; i<outer; ++i )
+         checkPadding( dst.data(i)+inner, dst.data(i)+dst.spacing() );
+   }
+
+   {
+      blaze::CustomMatrix<ET,blaze::unaligned,blaze::unpadded,SO> dst;
+      blaze::mapMatrix( map, dst );
+
+      compare( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the given source and destination vector or matrix.
+//
+// \param src The source vector/matrix.
+// \param dst The adapting custom vector/matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the source vector/matrix
+        , typename T2 >  // Type of the destination vector/matrix
+void ClassTest::compare( const T1& src, const T2& dst )
+{
+   if( src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Comparison failed\n"
+          << " Details:\n"
+          << "   Source type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Destination type:\n"
+          << "     " << typeid( T2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that all padding elements in the given range are zero.
+//
+// \param begin Pointer to the first padding element.
+// \param end Pointer one past the last padding element.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the padding elements
+void ClassTest::checkPadding( const Type* begin, const Type* end )
+{
+   for( ; begin!=end; ++begin ) {
+      if( !blaze::isDefault( *begin ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-zero padding element detected\n"
+             << " Details:\n"
+             << "   Padding element: " << *begin << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the memory mapped file format.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the memory mapped file test.
+*/
+#define RUN_MAPPEDFILE_CLASS_TEST \
+   blazetest::mathtest::mappedfile::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mappedfile
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
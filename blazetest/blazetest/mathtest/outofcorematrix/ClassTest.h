@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/outofcorematrix/ClassTest.h
+//  \brief Header file for the OutOfCoreMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_OUTOFCOREMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_OUTOFCOREMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/OutOfCoreMatrix.h>
+#include <blaze/math/serialization/MappedFile.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace outofcorematrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the OutOfCoreMatrix class template.
+//
+// This class represents a test suite for the blaze::OutOfCoreMatrix class template. It performs
+// a series of runtime tests that write matrices into a file and compute products and reductions
+// with the tiled out-of-core matrix.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DRMT;  //!< Row-major matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  DCMT;  //!< Column-major matrix type.
+   typedef blaze::DynamicVector<double,blaze::columnVector> DVT;   //!< Vector type.
+   //**********************************************************************************************
+
+   //**Private class TileSum***********************************************************************
+   /*!\brief Tile operation for the summation of all matrix elements.
+   */
+   struct TileSum
+   {
+      TileSum() : sum_( 0.0 ), tiles_( 0UL ) {}
+
+      template< typename MT >
+      void operator()( const MT& tile, size_t /*offset*/ ) {
+         for( size_t i=0UL; i<tile.rows(); ++i )
+            for( size_t j=0UL; j<tile.columns(); ++j )
+               sum_ += tile(i,j);
+         ++tiles_;
+      }
+
+      double sum_;    //!< The sum of all elements.
+      size_t tiles_;  //!< The number of processed tiles.
+   };
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMatVecMult();
+   void testMatMatMult();
+   void testStream    ();
+   void testFailures  ();
+
+   template< typename MT >
+   void runMatVecTest( const MT& A, size_t tileSize );
+
+   template< typename MT >
+   void runMatMatTest( const MT& A, size_t tileSize );
+
+   template< typename T1, typename T2 >
+   void compare( const T1& result, const T2& ref );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< The name of the temporary file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Out-of-core matrix/vector multiplication test with the given matrix.
+//
+// \param A The matrix to be tested.
+// \param tileSize The number of rows/columns per tile.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runMatVecTest( const MT& A, size_t tileSize )
+{
+   blaze::writeMappedFile( file_, A );
+
+   blaze::OutOfCoreMatrix<double,blaze::IsColumnMajorMatrix<MT>::value> ooc( file_, tileSize );
+
+   DVT x( A.columns() );
+   randomize( x );
+
+   DVT y( 3UL );
+   multiply( ooc, x, y );
+
+   const DVT ref( A * x );
+   compare( y, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core matrix/matrix multiplication test with the given matrix.
+//
+// \param A The matrix to be tested.
+// \param tileSize The number of rows/columns per tile.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runMatMatTest( const MT& A, size_t tileSize )
+{
+   blaze::writeMappedFile( file_, A );
+
+   blaze::OutOfCoreMatrix<double,blaze::IsColumnMajorMatrix<MT>::value> ooc( file_, tileSize );
+
+   DCMT B( A.columns(), 5UL );
+   randomize( B );
+
+   DRMT C;
+   multiply( ooc, B, C );
+
+   const DRMT ref( A * B );
+   compare( C, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the computed result and the reference result.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the reference result
+void ClassTest::compare( const T1& result, const T2& ref )
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the OutOfCoreMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the OutOfCoreMatrix class test.
+*/
+#define RUN_OUTOFCOREMATRIX_CLASS_TEST \
+   blazetest::mathtest::outofcorematrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace outofcorematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
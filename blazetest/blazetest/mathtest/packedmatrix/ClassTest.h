@@ -0,0 +1,536 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/packedmatrix/ClassTest.h
+//  \brief Header file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PackedMatrix class template.
+//
+// This class represents a test suite for the blaze::PackedMatrix class template. It performs
+// a series of runtime tests for all structures and storage orders of packed matrices and
+// compares all results with the results of an according DynamicMatrix.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DRMT;  //!< Row-major matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  DCMT;  //!< Column-major matrix type.
+   typedef blaze::DynamicVector<double,blaze::columnVector> DVT;   //!< Vector type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors ();
+   void testElementAccess();
+   void testAssignment   ();
+   void testResize       ();
+   void testMatVecMult   ();
+   void testMatMatMult   ();
+   void testBlockMatrix  ();
+   void testFailures     ();
+
+   template< blaze::PackedStructure PS, bool SO >
+   void runConstructorTest( size_t n );
+
+   template< blaze::PackedStructure PS, bool SO >
+   void runAssignmentTest( size_t n );
+
+   template< blaze::PackedStructure PS, bool SO >
+   void runResizeTest( size_t n );
+
+   template< blaze::PackedStructure PS, bool SO >
+   void runMatVecTest( size_t n );
+
+   template< blaze::PackedStructure PS, bool SO >
+   void runMatMatTest( size_t n );
+
+   template< blaze::PackedStructure PS, typename MT >
+   void initialize( MT& A, bool random=true );
+
+   template< typename MT >
+   DRMT leading( const MT& A, size_t n );
+
+   template< typename T1, typename T2 >
+   void compare( const T1& result, const T2& ref );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Construction test with a packed matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< blaze::PackedStructure PS  // Structure of the matrix
+        , bool SO >                  // Storage order
+void ClassTest::runConstructorTest( size_t n )
+{
+   DRMT A( n, n );
+   initialize<PS>( A );
+
+   const blaze::PackedMatrix<double,PS,SO> P1( A );
+   compare( P1, A );
+
+   const blaze::PackedMatrix<double,PS,SO> P2( P1 );
+   compare( P2, A );
+
+   const blaze::PackedMatrix<double,PS,SO> P3( trans( trans( A ) ) );
+   compare( P3, A );
+
+   const blaze::PackedMatrix<double,PS,SO> P4( 2.0 * A );
+   compare( P4, 2.0 * A );
+
+   const blaze::CompressedMatrix<double,SO> S( A );
+   const blaze::PackedMatrix<double,PS,SO> P5( S );
+   compare( P5, A );
+
+   if( P1.rows() != n || P1.columns() != n || P1.nonZeros() != A.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << P1.rows() << "\n"
+          << "   Number of columns      : " << P1.columns() << "\n"
+          << "   Number of non-zeros    : " << P1.nonZeros() << "\n"
+          << "   Expected size          : " << n << "\n"
+          << "   Expected non-zeros     : " << A.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment test with a packed matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< blaze::PackedStructure PS  // Structure of the matrix
+        , bool SO >                  // Storage order
+void ClassTest::runAssignmentTest( size_t n )
+{
+   DRMT A( n, n );
+   initialize<PS>( A );
+
+   DCMT B( n, n );
+   initialize<PS>( B );
+
+   blaze::PackedMatrix<double,PS,SO> P;
+
+   P = A;
+   compare( P, A );
+
+   P = B;
+   compare( P, B );
+
+   P += A;
+   compare( P, A + B );
+
+   P -= 2.0 * B;
+   compare( P, A - B );
+
+   P = A + B;
+   compare( P, A + B );
+
+   P = P + P;
+   compare( P, 2.0 * ( A + B ) );
+
+   P *= 0.5;
+   compare( P, A + B );
+
+   P /= 2.0;
+   compare( P, 0.5 * ( A + B ) );
+
+   const blaze::CompressedMatrix<double,!SO> S( A );
+   P = S;
+   compare( P, A );
+
+   P += S;
+   compare( P, 2.0 * A );
+
+   P -= S;
+   compare( P, A );
+
+   const blaze::PackedMatrix<double,PS,SO> Q( B );
+   P = Q;
+   compare( P, B );
+
+   reset( P );
+   compare( P, DRMT( n, n, 0.0 ) );
+
+   P = Q;
+   P = 3.0;
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = 3.0;
+      }
+   }
+   initialize<PS>( A, false );
+   compare( P, A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resize test with a packed matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< blaze::PackedStructure PS  // Structure of the matrix
+        , bool SO >                  // Storage order
+void ClassTest::runResizeTest( size_t n )
+{
+   DRMT A( n, n );
+   initialize<PS>( A );
+
+   blaze::PackedMatrix<double,PS,SO> P( A );
+
+   P.resize( n+5UL );
+   compare( leading( P, n ), A );
+
+   P.resize( n/2UL );
+   compare( P, leading( A, n/2UL ) );
+
+   P.resize( n+1UL );
+   compare( leading( P, n/2UL ), leading( A, n/2UL ) );
+
+   clear( P );
+   if( P.rows() != 0UL || P.columns() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the matrix failed\n"
+          << " Details:\n"
+          << "   Number of rows   : " << P.rows() << "\n"
+          << "   Number of columns: " << P.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packed matrix/vector multiplication test with a matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< blaze::PackedStructure PS  // Structure of the matrix
+        , bool SO >                  // Storage order
+void ClassTest::runMatVecTest( size_t n )
+{
+   DRMT A( n, n );
+   initialize<PS>( A );
+
+   const blaze::PackedMatrix<double,PS,SO> P( A );
+
+   DVT x( n );
+   randomize( x );
+
+   DVT y( P * x );
+   DVT ref( A * x );
+   compare( y, ref );
+
+   y += P * x;
+   ref += A * x;
+   compare( y, ref );
+
+   y -= P * x;
+   ref -= A * x;
+   compare( y, ref );
+
+   y = 2.0 * ( P * x );
+   ref = 2.0 * ( A * x );
+   compare( y, ref );
+
+   y = P * ( x + x );
+   ref = A * ( x + x );
+   compare( y, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Packed matrix/matrix multiplication test with a matrix of the given size.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< blaze::PackedStructure PS  // Structure of the matrix
+        , bool SO >                  // Storage order
+void ClassTest::runMatMatTest( size_t n )
+{
+   DRMT A( n, n );
+   initialize<PS>( A );
+
+   const blaze::PackedMatrix<double,PS,SO> P( A );
+
+   DRMT B( n, 23UL );
+   randomize( B );
+
+   DCMT C( n, 23UL );
+   randomize( C );
+
+   {
+      DRMT result( P * B );
+      DRMT ref( A * B );
+      compare( result, ref );
+
+      result += P * C;
+      ref += A * C;
+      compare( result, ref );
+
+      result -= P * B;
+      ref -= A * B;
+      compare( result, ref );
+   }
+
+   {
+      DCMT result( P * C );
+      DCMT ref( A * C );
+      compare( result, ref );
+
+      result += P * B;
+      ref += A * B;
+      compare( result, ref );
+
+      result -= P * C;
+      ref -= A * C;
+      compare( result, ref );
+   }
+
+   {
+      DRMT result( A * P );
+      DRMT ref( A * A );
+      compare( result, ref );
+
+      result += P * P;
+      ref += A * A;
+      compare( result, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of the given matrix according to the given structure.
+//
+// \param A The matrix to be initialized.
+// \param random \a true in case the matrix should be randomized first, \a false if not.
+// \return void
+*/
+template< blaze::PackedStructure PS  // Structure of the matrix
+        , typename MT >              // Type of the matrix
+void ClassTest::initialize( MT& A, bool random )
+{
+   if( random )
+      randomize( A );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( PS == blaze::packedSymmetric )
+            A(j,i) = A(i,j);
+         else if( PS == blaze::packedLower )
+            A(j,i) = 0.0;
+         else
+            A(i,j) = 0.0;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the leading \f$ n \times n \f$ part of the given matrix.
+//
+// \param A The given matrix.
+// \param n The number of rows and columns of the leading part.
+// \return The leading part of the matrix.
+*/
+template< typename MT >  // Type of the matrix
+ClassTest::DRMT ClassTest::leading( const MT& A, size_t n )
+{
+   DRMT B( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B(i,j) = A(i,j);
+      }
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the computed result and the reference result.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the reference result
+void ClassTest::compare( const T1& result, const T2& ref )
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PackedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PackedMatrix class test.
+*/
+#define RUN_PACKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::packedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
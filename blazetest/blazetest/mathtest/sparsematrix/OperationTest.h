@@ -43,6 +43,8 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
+#include <blazetest/system/Types.h>
 
 
 namespace blazetest {
@@ -96,6 +98,12 @@ class OperationTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testBandwidth();
+   void testReverseCuthillMcKee();
+   void testNestedDissection();
+   void testPermute();
+   void testTriangularSolve();
+   void testSemiring();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -111,6 +119,11 @@ class OperationTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   void checkPermutation( const std::vector<size_t>& perm, size_t expectedSize ) const;
+
+   template< typename Type, typename VT >
+   void checkSolve( const Type& matrix, const VT& rhs, const VT& expected );
    //@}
    //**********************************************************************************************
 
@@ -295,6 +308,100 @@ void OperationTest::checkNonZeros( const Type& matrix, size_t index, size_t expe
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the validity of the given permutation vector.
+//
+// \param perm The permutation vector to be checked.
+// \param expectedSize The expected size of the permutation vector.
+// 
+eturn void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether the given vector is a permutation of the indices
+// $ [0..expectedSize) $. In case the size does not match or any index is out of
+// bounds or contained more than once, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkPermutation( const std::vector<size_t>& perm, size_t expectedSize ) const
+{
+   if( perm.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size of the permutation vector\n"
+          << " Details:\n"
+          << "   Size         : " << perm.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector<bool> found( expectedSize, false );
+
+   for( size_t i=0UL; i<perm.size(); ++i ) {
+      if( perm[i] >= expectedSize || found[perm[i]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation index detected\n"
+             << " Details:\n"
+             << "   Index " << i << ": " << perm[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      found[perm[i]] = true;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a triangular system of equations.
+//
+// \param matrix The triangular sparse matrix.
+// \param rhs The right-hand side vector.
+// \param expected The expected solution.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves the triangular system of equations defined by the given matrix and
+// right-hand side vector by means of the TriangularSolver class template (both out-of-place
+// and in-place) and by means of the solve() function for both storage orders. In case any of
+// the solutions differs from the given expected solution, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type  // Type of the triangular sparse matrix
+        , typename VT >  // Type of the dense vectors
+void OperationTest::checkSolve( const Type& matrix, const VT& rhs, const VT& expected )
+{
+   const blaze::TriangularSolver<Type> solver( matrix );
+
+   VT res1( rhs.size() );
+   solver.solve( res1, rhs );
+
+   VT res2( rhs );
+   solver.solve( res2, res2 );
+
+   VT res3( rhs.size() );
+   solve( matrix, res3, rhs );
+
+   const typename Type::OppositeType tmat( matrix );
+   VT res4( rhs.size() );
+   solve( tmat, res4, rhs );
+
+   if( res1 != expected || res2 != expected || res3 != expected || res4 != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Triangular solve failed\n"
+          << " Details:\n"
+          << "   Matrix:\n" << matrix << "\n"
+          << "   Right-hand side:\n" << rhs << "\n"
+          << "   Level-scheduled result:\n" << res1 << "\n"
+          << "   Level-scheduled in-place result:\n" << res2 << "\n"
+          << "   Row-major serial result:\n" << res3 << "\n"
+          << "   Column-major serial result:\n" << res4 << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -83,6 +83,7 @@ class OperationTest
    void testBuiltinTypes();
    void testClassTypes();
    void testNullPointer();
+   void testHugePages();
    //@}
    //**********************************************************************************************
 
@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/memorypool/ClassTest.h
+//  \brief Header file for the MemoryPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_MEMORYPOOL_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_MEMORYPOOL_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/thread/barrier.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/MemoryPool.h>
+#include <blaze/util/PoolAllocator.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace memorypool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the MemoryPool class template.
+//
+// This class represents the collection of tests for the MemoryPool and PoolAllocator class
+// templates.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::MemoryPool<double,64UL>           Pool;         //!< Type of the tested memory pool.
+   typedef std::vector<void*>                       Pointers;     //!< Vector of allocated objects.
+   typedef boost::aligned_storage<16UL,16UL>::type  AlignedType;  //!< Over-aligned object type.
+   typedef boost::aligned_storage<8UL,8UL>::type    SmallType;    //!< Small object type.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSingleThread ();
+   void testMultiThread  ();
+   void testReusedAddress();
+   void testAlignment    ();
+   void testAllocator    ();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void allocateObjects( Pool* pool, Pointers* pointers, size_t first, size_t last );
+   static void releaseObjects ( Pool* pool, Pointers* pointers, size_t first, size_t last );
+   static void reuseObjects   ( Pool* pool, Pointers* pointers, boost::barrier* barrier );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MemoryPool class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MemoryPool class test.
+*/
+#define RUN_MEMORYPOOL_CLASS_TEST \
+   blazetest::utiltest::memorypool::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace memorypool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
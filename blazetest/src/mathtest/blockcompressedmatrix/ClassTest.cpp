@@ -0,0 +1,1090 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (0x4)";
+
+      MT mat( 0UL, 4UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (6x4)";
+
+      MT mat( 6UL, 4UL );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 5UL, 0UL );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (invalid size)";
+
+      try {
+         MT mat( 5UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 4UL, 6UL );
+      sm(0,0) = 1;
+      sm(0,4) = 2;
+      sm(0,5) = 3;
+      sm(1,1) = 4;
+      sm(3,0) = 5;
+      sm(3,5) = 6;
+
+      MT mat( sm );
+
+      checkRows    ( mat,  4UL );
+      checkColumns ( mat,  6UL );
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 16UL );
+      checkNonZeros( mat,  0UL, 4UL );
+      checkNonZeros( mat,  1UL, 4UL );
+      checkNonZeros( mat,  2UL, 4UL );
+      checkNonZeros( mat,  3UL, 4UL );
+
+      if( mat != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.blockRows() != 2UL || mat.blockColumns() != 3UL || mat.nonZeroBlocks() != 4UL ||
+          mat.blockOffset( 1UL ) != 2UL || mat.indices()[0] != 0UL || mat.indices()[1] != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block structure detected\n"
+             << " Details:\n"
+             << "   Number of block rows   : " << mat.blockRows() << "\n"
+             << "   Number of block columns: " << mat.blockColumns() << "\n"
+             << "   Number of blocks       : " << mat.nonZeroBlocks() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> sm( 6UL, 4UL );
+      sm(0,3) = 1;
+      sm(3,0) = 2;
+      sm(4,2) = 3;
+      sm(5,3) = 4;
+
+      MT mat( sm );
+
+      checkRows    ( mat,  6UL );
+      checkColumns ( mat,  4UL );
+      checkNonZeros( mat, 12UL );
+      checkNonZeros( mat,  0UL, 2UL );
+      checkNonZeros( mat,  2UL, 2UL );
+      checkNonZeros( mat,  4UL, 2UL );
+
+      if( mat != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dm( 2UL, 4UL, 0 );
+      dm(0,0) =  1;
+      dm(1,3) = -2;
+
+      MT mat( dm );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 8UL );
+
+      if( mat != dm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 4UL, 2UL );
+      sm(0,0) = 1;
+      sm(3,1) = 2;
+
+      MT mat1( sm );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 4UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 8UL );
+
+      if( mat2 != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 2UL, 4UL );
+      sm(1,0) = 1;
+      sm(1,3) = 2;
+
+      MT mat1( sm );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 8UL );
+
+      if( mat2 != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> sm( 6UL, 2UL );
+      sm(0,1) = 2;
+      sm(5,0) = 3;
+
+      MT mat( 2UL, 2UL );
+      mat = sm;
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 8UL );
+
+      if( mat != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment (invalid size)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 3UL, 2UL );
+      sm(2,1) = 1;
+
+      MT mat( 2UL, 2UL );
+
+      try {
+         mat = sm;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dm( 2UL, 4UL, 0 );
+      dm(0,2) = 1;
+      dm(1,1) = 2;
+
+      MT mat;
+      mat = dm;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 8UL );
+
+      if( mat != dm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "BlockCompressedMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 6UL, 8UL );
+   sm(0,7) = 1;
+   sm(2,0) = 2;
+   sm(2,1) = 3;
+   sm(3,3) = 4;
+   sm(5,2) = 5;
+
+   const MT mat( sm );
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      for( size_t j=0UL; j<sm.columns(); ++j ) {
+         if( mat(i,j) != sm(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << sm << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 4UL, 6UL );
+   sm(0,1) =  1;
+   sm(1,4) = -2;
+   sm(3,0) =  3;
+
+   const MT mat( sm );
+
+   // Counting the number of elements in 0th row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( mat.end(0) - mat.begin(0) );
+
+      if( number != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in 2nd row
+   {
+      test_ = "Iterator subtraction (row without non-zero elements)";
+
+      const size_t number( mat.cend(2) - mat.cbegin(2) );
+
+      if( number != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Traversing the 1st row
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      const size_t indices[4] = { 0UL, 1UL, 4UL, 5UL };
+      const int    values [4] = { 0, 0, -2, 0 };
+
+      ConstIterator it( mat.cbegin(1) );
+      const ConstIterator end( mat.cend(1) );
+
+      for( size_t k=0UL; k<4UL; ++k, ++it ) {
+         if( it == end || it->index() != indices[k] || it->value() != values[k] ||
+             (*it).index() != indices[k] || (*it).value() != values[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator detected\n"
+                << " Details:\n"
+                << "   Element       : " << k << "\n"
+                << "   Expected index: " << indices[k] << "\n"
+                << "   Expected value: " << values[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator end detection failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "BlockCompressedMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 12UL, 8UL );
+   blaze::randomize( sm, 20UL );
+
+   const MT mat( sm );
+
+   checkRows    ( mat, 12UL );
+   checkColumns ( mat,  8UL );
+   checkNonZeros( mat, mat.nonZeroBlocks()*4UL );
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      checkNonZeros( mat, i, ( mat.blockOffset( i/2UL+1UL ) - mat.blockOffset( i/2UL ) )*2UL );
+   }
+
+   if( mat != sm ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << sm << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "BlockCompressedMatrix::reset()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 4UL, 4UL );
+   sm(0,0) = 1;
+   sm(2,3) = 2;
+
+   MT mat( sm );
+   reset( mat );
+
+   checkRows    ( mat, 4UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 0UL );
+   checkNonZeros( mat, 0UL, 0UL );
+   checkNonZeros( mat, 2UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BlockCompressedMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 4UL, 4UL );
+   sm(0,0) = 1;
+   sm(2,3) = 2;
+
+   MT mat( sm );
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm1( 2UL, 2UL );
+   sm1(0,0) = 1;
+   sm1(1,1) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm2( 4UL, 2UL );
+   sm2(2,0) = 3;
+
+   MT mat1( sm1 );
+   MT mat2( sm2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 4UL );
+   checkColumns ( mat1, 2UL );
+   checkNonZeros( mat1, 4UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 4UL );
+
+   if( mat1 != sm2 || mat2 != sm1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n"
+          << "   Expected result:\n" << sm2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "BlockCompressedMatrix::find()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 4UL, 6UL );
+   sm(0,1) = 1;
+   sm(1,4) = 2;
+   sm(3,5) = 3;
+
+   const MT mat( sm );
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      for( size_t j=0UL; j<sm.columns(); ++j )
+      {
+         const ConstIterator pos( mat.find( i, j ) );
+         const bool stored( j/2UL == 2UL || ( i < 2UL && j/2UL == 0UL ) );
+
+         if( ( !stored && pos != mat.end( i ) ) ||
+             ( stored && ( pos == mat.end( i ) || pos->index() != j || pos->value() != sm(i,j) ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element search failed\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "BlockCompressedMatrix::lowerBound()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 2UL, 8UL );
+   sm(1,1) = 1;
+   sm(0,5) = 2;
+
+   const MT mat( sm );
+
+   const size_t expected[8] = { 0UL, 1UL, 4UL, 4UL, 4UL, 5UL, 8UL, 8UL };
+
+   for( size_t j=0UL; j<8UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 8UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound search failed\n"
+             << " Details:\n"
+             << "   Required position = (1," << j << ")\n"
+             << "   Found index       = " << index << "\n"
+             << "   Expected index    = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "BlockCompressedMatrix::upperBound()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 2UL, 8UL );
+   sm(1,1) = 1;
+   sm(0,5) = 2;
+
+   const MT mat( sm );
+
+   const size_t expected[8] = { 1UL, 4UL, 4UL, 4UL, 5UL, 8UL, 8UL, 8UL };
+
+   for( size_t j=0UL; j<8UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 8UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound search failed\n"
+             << " Details:\n"
+             << "   Required position = (1," << j << ")\n"
+             << "   Found index       = " << index << "\n"
+             << "   Expected index    = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with 0x0 matrix
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-empty matrix
+   {
+      MT mat( 2UL, 4UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a BlockCompressedMatrix with dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a BlockCompressedMatrix with dense
+// vectors and matrices by comparing the results to the according multiplications with a
+// CompressedMatrix. Both the default and the vectorized block kernels are tested. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   // Integral matrix/dense vector multiplication
+   {
+      test_ = "BlockCompressedMatrix/dense vector multiplication (int)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 66UL, 42UL );
+      blaze::randomize( sm, 300UL, -10, 10 );
+
+      const MT mat( sm );
+
+      blaze::DynamicVector<int,blaze::columnVector> x( 42UL );
+      blaze::randomize( x, -10, 10 );
+
+      const blaze::DynamicVector<int,blaze::columnVector> ref( sm * x );
+      blaze::DynamicVector<int,blaze::columnVector> y( mat * x );
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y += mat * x;
+      y -= mat * x;
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition/subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Floating point matrix/dense vector multiplication
+   {
+      test_ = "BlockCompressedMatrix/dense vector multiplication (double)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> sm( 96UL, 72UL );
+      for( size_t i=0UL; i<sm.rows(); ++i ) {
+         for( size_t j=0UL; j<( i*7UL ) % 11UL; ++j )
+            sm( i, ( i + j*13UL ) % sm.columns() ) = blaze::rand<double>( -1.0, 1.0 );
+      }
+
+      const blaze::BlockCompressedMatrix<double,3UL> mat( sm );
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 72UL );
+      blaze::randomize( x, -1.0, 1.0 );
+
+      const blaze::DynamicVector<double,blaze::columnVector> ref( sm * x );
+      blaze::DynamicVector<double,blaze::columnVector> y( 96UL, 1.0 );
+
+      y = mat * x;
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y += mat * x;
+
+      if( y != 2.0 * ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << ( 2.0 * ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Integral matrix/dense matrix multiplication
+   {
+      test_ = "BlockCompressedMatrix/dense matrix multiplication (int)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 22UL, 18UL );
+      blaze::randomize( sm, 80UL, -10, 10 );
+
+      const MT mat( sm );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dm( 18UL, 7UL );
+      blaze::randomize( dm, -10, 10 );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref( sm * dm );
+      blaze::DynamicMatrix<int,blaze::rowMajor> res( mat * dm );
+
+      if( res != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      res += mat * dm;
+      res -= mat * dm;
+
+      if( res != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition/subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> tres( mat * dm );
+
+      if( tres != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication to column-major matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tres << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Floating point matrix/dense matrix multiplication
+   {
+      test_ = "BlockCompressedMatrix/dense matrix multiplication (double)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> sm( 36UL, 30UL );
+      blaze::randomize( sm, 150UL, -1.0, 1.0 );
+
+      const blaze::BlockCompressedMatrix<double,6UL> mat( sm );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> dm( 30UL, 13UL );
+      blaze::randomize( dm, -1.0, 1.0 );
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( sm * dm );
+      blaze::DynamicMatrix<double,blaze::rowMajor> res( mat * dm );
+
+      if( res != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      res += mat * dm;
+
+      if( res != 2.0 * ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ( 2.0 * ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -38,7 +38,10 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <vector>
+#include <blaze/math/AssemblyMap.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
@@ -84,10 +87,13 @@ ClassTest::ClassTest()
    testSet();
    testInsert();
    testAppend();
+   testAssemble();
+   testAssemblyMap();
    testErase();
    testResize();
    testReserve();
    testTrim();
+   testCompact();
    testTranspose();
    testSwap();
    testFind();
@@ -6938,6 +6944,563 @@ void ClassTest::testAppend()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c assemble() member function of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assembly of a CompressedMatrix from coordinate triplets
+// via the triplet constructor and the \c assemble() member function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssemble()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::assemble()";
+
+      // Construction from unsorted triplets
+      {
+         const size_t rows   [4] = { 2UL, 0UL, 3UL, 0UL };
+         const size_t columns[4] = { 1UL, 3UL, 2UL, 0UL };
+         const int    values [4] = { 1, 3, 5, 2 };
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 4UL, 4UL, rows, columns, values, 4UL );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+
+         if( mat(0,0) != 2 || mat(0,3) != 3 || mat(2,1) != 1 || mat(3,2) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction from triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 2 0 0 3 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 0 5 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with summation of duplicates
+      {
+         const unsigned int rows   [5] = { 1U, 0U, 1U, 0U, 2U };
+         const unsigned int columns[5] = { 1U, 2U, 1U, 2U, 0U };
+         const int          values [5] = { 4, 1, -4, 2, 3 };
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+         mat(1,0) = 7;
+         mat.assemble( rows, columns, values, 5UL );
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 2UL );
+
+         if( mat(0,2) != 3 || mat(2,0) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with duplicate triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 3 )\n( 0 0 0 )\n( 3 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with a user-defined combiner
+      {
+         const size_t rows   [4] = { 0UL, 1UL, 0UL, 0UL };
+         const size_t columns[4] = { 2UL, 0UL, 2UL, 2UL };
+         const int    values [4] = { 2, 5, 3, 4 };
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 3UL );
+         mat.assemble( rows, columns, values, 4UL, std::multiplies<int>() );
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 2UL );
+
+         if( mat(0,2) != 24 || mat(1,0) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with user-defined combiner failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 24 )\n( 5 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly of a large number of triplets
+      {
+         const size_t nonzeros( 5000UL );
+
+         std::vector<size_t> rows( nonzeros ), columns( nonzeros );
+         std::vector<int> values( nonzeros );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3000UL, 50UL );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            rows[k]    = ( k*7919UL ) % 3000UL;
+            columns[k] = ( k*31UL ) % 50UL;
+            values[k]  = static_cast<int>( k % 5UL ) + 1;
+            ref(rows[k],columns[k]) += values[k];
+         }
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3000UL, 50UL );
+         mat.assemble( &rows[0], &columns[0], &values[0], nonzeros );
+
+         checkRows    ( mat, 3000UL );
+         checkColumns ( mat, 50UL );
+         checkNonZeros( mat, ref.nonZeros() );
+
+         if( mat != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly of a large number of triplets failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with an invalid triplet index
+      {
+         const size_t rows   [2] = { 0UL, 3UL };
+         const size_t columns[2] = { 1UL, 0UL };
+         const int    values [2] = { 1, 2 };
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+         mat(1,1) = 4;
+
+         try {
+            mat.assemble( rows, columns, values, 2UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with invalid triplet index succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkNonZeros( mat, 1UL );
+
+         if( mat(1,1) != 4 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed assembly modified the matrix\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 )\n( 0 4 0 )\n( 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix::assemble()";
+
+      // Construction from unsorted triplets
+      {
+         const size_t rows   [4] = { 2UL, 0UL, 3UL, 0UL };
+         const size_t columns[4] = { 1UL, 3UL, 2UL, 0UL };
+         const int    values [4] = { 1, 3, 5, 2 };
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 4UL, 4UL, rows, columns, values, 4UL );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+
+         if( mat(0,0) != 2 || mat(0,3) != 3 || mat(2,1) != 1 || mat(3,2) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction from triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 2 0 0 3 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 0 5 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with summation of duplicates
+      {
+         const unsigned int rows   [5] = { 1U, 0U, 1U, 0U, 2U };
+         const unsigned int columns[5] = { 1U, 2U, 1U, 2U, 0U };
+         const int          values [5] = { 4, 1, -4, 2, 3 };
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+         mat(1,0) = 7;
+         mat.assemble( rows, columns, values, 5UL );
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 2UL );
+
+         if( mat(0,2) != 3 || mat(2,0) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with duplicate triplets failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 3 )\n( 0 0 0 )\n( 3 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with a user-defined combiner
+      {
+         const size_t rows   [4] = { 0UL, 1UL, 0UL, 0UL };
+         const size_t columns[4] = { 2UL, 0UL, 2UL, 2UL };
+         const int    values [4] = { 2, 5, 3, 4 };
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 3UL );
+         mat.assemble( rows, columns, values, 4UL, std::multiplies<int>() );
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 2UL );
+
+         if( mat(0,2) != 24 || mat(1,0) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with user-defined combiner failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 24 )\n( 5 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly of a large number of triplets
+      {
+         const size_t nonzeros( 5000UL );
+
+         std::vector<size_t> rows( nonzeros ), columns( nonzeros );
+         std::vector<int> values( nonzeros );
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> ref( 3000UL, 50UL );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            rows[k]    = ( k*7919UL ) % 3000UL;
+            columns[k] = ( k*31UL ) % 50UL;
+            values[k]  = static_cast<int>( k % 5UL ) + 1;
+            ref(rows[k],columns[k]) += values[k];
+         }
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3000UL, 50UL );
+         mat.assemble( &rows[0], &columns[0], &values[0], nonzeros );
+
+         checkRows    ( mat, 3000UL );
+         checkColumns ( mat, 50UL );
+         checkNonZeros( mat, ref.nonZeros() );
+
+         if( mat != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly of a large number of triplets failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with an invalid triplet index
+      {
+         const size_t rows   [2] = { 0UL, 3UL };
+         const size_t columns[2] = { 1UL, 0UL };
+         const int    values [2] = { 1, 2 };
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+         mat(1,1) = 4;
+
+         try {
+            mat.assemble( rows, columns, values, 2UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with invalid triplet index succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkNonZeros( mat, 1UL );
+
+         if( mat(1,1) != 4 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed assembly modified the matrix\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 0 0 0 )\n( 0 4 0 )\n( 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the value-only assembly of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resetValues() member function of the CompressedMatrix
+// class template and of the assembly via the AssemblyMap class. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssemblyMap()
+{
+   // Contributions of four linear 1D finite elements with the element matrices
+   // (e+1)*[1 -1; -1 1] on a mesh with five nodes
+   std::vector<size_t> rows, columns;
+   std::vector<int> values;
+
+   for( size_t e=0UL; e<4UL; ++e ) {
+      for( size_t a=0UL; a<2UL; ++a ) {
+         for( size_t b=0UL; b<2UL; ++b ) {
+            rows.push_back( e+a );
+            columns.push_back( e+b );
+            values.push_back( ( a == b ? 1 : -1 ) * int( e+1UL ) );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::resetValues()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 5UL, 5UL, &rows[0], &columns[0], &values[0], rows.size() );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref( mat );
+
+      mat.resetValues();
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 13UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 2UL, 3UL );
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator element=mat.begin(i);
+              element!=mat.end(i); ++element ) {
+            if( element->value() != 0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Resetting the values failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      test_ = "Row-major AssemblyMap::assemble()";
+
+      const blaze::AssemblyMap map( mat, &rows[0], &columns[0], rows.size() );
+
+      if( map.rows() != 5UL || map.columns() != 5UL || map.nonZeros() != 13UL ||
+          map.contributions() != 16UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid assembly map\n"
+             << " Details:\n"
+             << "   Rows/columns : " << map.rows() << "/" << map.columns() << "\n"
+             << "   Non-zeros    : " << map.nonZeros() << "\n"
+             << "   Contributions: " << map.contributions() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      std::vector<int> values2( values.size() );
+      for( size_t k=0UL; k<values.size(); ++k )
+         values2[k] = 2*values[k];
+
+      mat(0,0) = 100;
+      map.assemble( mat, &values2[0] );
+
+      checkNonZeros( mat, 13UL );
+
+      if( mat != 2*ref || mat(2,2) != 10 || mat(2,1) != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Value-only assembly failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ( 2*ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "Row-major AssemblyMap::accumulate()";
+
+      map.accumulate( mat, &values[0] );
+
+      if( mat != 3*ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Value-only accumulation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ( 3*ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "Row-major AssemblyMap::assemble() (shared sparsity pattern)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat2( 5UL, 5UL, 20UL );
+      for( size_t i=0UL; i<5UL; ++i ) {
+         for( size_t j=( i > 0UL ? i-1UL : 0UL ); j<=i+1UL && j<5UL; ++j )
+            mat2.append( i, j, 42, true );
+         mat2.finalize( i );
+      }
+
+      map.assemble( mat2, &values[0] );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly with shared sparsity pattern failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "Row-major AssemblyMap (invalid contributions)";
+
+      try {
+         const size_t i[1] = { 0UL };
+         const size_t j[1] = { 2UL };
+         const blaze::AssemblyMap invalid( mat, i, j, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a contribution outside of the sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat3( 5UL, 5UL );
+         map.assemble( mat3, &values[0] );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly of a matrix with a different sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix::resetValues()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 5UL, 5UL, &rows[0], &columns[0], &values[0], rows.size() );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> ref( mat );
+
+      mat.resetValues();
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 13UL );
+      checkNonZeros( mat, 4UL, 2UL );
+
+      if( mat != blaze::CompressedMatrix<int,blaze::columnMajor>( 5UL, 5UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resetting the values failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = "Column-major AssemblyMap::assemble()";
+
+      const blaze::AssemblyMap map( mat, &rows[0], &columns[0], rows.size() );
+
+      map.assemble( mat, &values[0] );
+      map.accumulate( mat, &values[0] );
+
+      checkNonZeros( mat, 13UL );
+
+      if( mat != 2*ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Value-only assembly failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ( 2*ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat2( ref );
+         map.assemble( mat2, &values[0] );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly of a matrix with different storage order succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Large matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "AssemblyMap::assemble() (large matrix)";
+
+      const size_t n( 200UL );
+      std::vector<size_t> i, j;
+      std::vector<double> v;
+
+      for( size_t k=0UL; k<100000UL; ++k ) {
+         i.push_back( blaze::rand<size_t>( 0UL, n-1UL ) );
+         j.push_back( blaze::rand<size_t>( 0UL, n-1UL ) );
+         v.push_back( blaze::rand<double>( -1.0, 1.0 ) );
+      }
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> ref( n, n, &i[0], &j[0], &v[0], i.size() );
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( ref );
+
+      const blaze::AssemblyMap map( mat, &i[0], &j[0], i.size() );
+      map.assemble( mat, &v[0] );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Value-only assembly failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c erase() member function of the CompressedMatrix class template.
 //
@@ -8617,6 +9180,142 @@ void ClassTest::testTrim()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c compact() member function of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c compact() member function of the CompressedMatrix
+// class template in combination with the insertion of elements in random order. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompact()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix::compact()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 50UL, 40UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( 50UL, 40UL, 0 );
+
+      // Inserting elements in random order
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 49UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 39UL ) );
+         const int value( blaze::rand<int>( 1, 100 ) );
+         mat(i,j) = value;
+         ref(i,j) = value;
+      }
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements in random order failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Compacting the matrix
+      const size_t nonzeros( mat.nonZeros() );
+      mat.compact();
+
+      checkRows    ( mat, 50UL );
+      checkColumns ( mat, 40UL );
+      checkNonZeros( mat, nonzeros );
+
+      for( size_t i=0UL; i<mat.rows(); ++i )
+         checkCapacity( mat, i, mat.nonZeros( i ) );
+
+      if( mat.capacity() != nonzeros || mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compacting the matrix failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: " << nonzeros << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Inserting into the compacted matrix
+      mat(49,39) = 7;
+      ref(49,39) = 7;
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting into a compacted matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix::compact()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 40UL, 50UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 40UL, 50UL, 0 );
+
+      // Inserting elements in random order
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 39UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 49UL ) );
+         const int value( blaze::rand<int>( 1, 100 ) );
+         mat(i,j) = value;
+         ref(i,j) = value;
+      }
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements in random order failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Compacting the matrix
+      const size_t nonzeros( mat.nonZeros() );
+      mat.compact();
+
+      checkRows    ( mat, 40UL );
+      checkColumns ( mat, 50UL );
+      checkNonZeros( mat, nonzeros );
+
+      for( size_t j=0UL; j<mat.columns(); ++j )
+         checkCapacity( mat, j, mat.nonZeros( j ) );
+
+      if( mat.capacity() != nonzeros || mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compacting the matrix failed\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: " << nonzeros << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c transpose() member function of the CompressedMatrix class template.
 //
@@ -8783,6 +9482,89 @@ void ClassTest::testTranspose()
       }
    }
 
+   {
+      test_ = "Row-major/column-major CompressedMatrix transpose stress test";
+
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor>  RandomMatrixType;
+
+      const int min( randmin );
+      const int max( randmax );
+
+      for( size_t i=0UL; i<4UL; ++i )
+      {
+         const size_t rows    ( blaze::rand<size_t>( 200UL, 400UL ) );
+         const size_t columns ( blaze::rand<size_t>( 200UL, 400UL ) );
+         const size_t nonzeros( blaze::rand<size_t>( 0UL, rows*columns/2UL ) );
+
+         const RandomMatrixType mat1( blaze::rand<RandomMatrixType>( rows, columns, nonzeros, min, max ) );
+         const blaze::DynamicMatrix<int,blaze::rowMajor> ref( mat1 );
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor> mat2( mat1 );
+         const blaze::CompressedMatrix<int,blaze::rowMajor> mat3( trans( mat1 ) );
+
+         if( mat2 != ref || mat3 != trans( ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation failed\n"
+                << " Details:\n"
+                << "   Rows     : " << rows << "\n"
+                << "   Columns  : " << columns << "\n"
+                << "   Non-zeros: " << mat1.nonZeros() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major/column-major CompressedMatrix parallel transpose test";
+
+      // Fixed pattern exceeding the SMP threshold, including empty rows and columns
+      const size_t rows   ( 512UL );
+      const size_t columns( 384UL );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( rows, columns );
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( rows, columns, 0 );
+
+      mat1.reserve( rows*columns );
+      for( size_t i=0UL; i<rows; ++i ) {
+         for( size_t j=0UL; j<columns; ++j ) {
+            if( i%16UL != 3UL && j%29UL != 7UL && ( i+2UL*j )%3UL != 0UL ) {
+               const int value( static_cast<int>( i*columns+j+1UL ) );
+               mat1.append( i, j, value );
+               ref(i,j) = value;
+            }
+         }
+         mat1.finalize( i );
+      }
+
+      if( mat1.nonZeros() < blaze::SMP_SMATTRANSPOSE_THRESHOLD ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Test matrix does not exceed the SMP threshold\n"
+             << " Details:\n"
+             << "   Non-zeros: " << mat1.nonZeros() << "\n"
+             << "   Threshold: " << blaze::SMP_SMATTRANSPOSE_THRESHOLD << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> mat2( mat1 );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> mat3( trans( mat1 ) );
+
+      checkNonZeros( mat2, mat1.nonZeros() );
+      checkNonZeros( mat3, mat1.nonZeros() );
+
+      if( mat2 != ref || mat3 != trans( ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Rows     : " << rows << "\n"
+             << "   Columns  : " << columns << "\n"
+             << "   Non-zeros: " << mat1.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -9207,6 +9989,50 @@ void ClassTest::testFind()
       }
    }
 
+   {
+      test_ = "Row-major CompressedMatrix::find() after insertions and erasures";
+
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor>::ConstIterator  ConstIterator;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 30UL, 20UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( 30UL, 20UL, 0 );
+
+      // Inserting and erasing elements in random order
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 29UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 19UL ) );
+
+         if( k % 4UL == 3UL ) {
+            mat.erase( i, j );
+            ref(i,j) = 0;
+         }
+         else {
+            const int value( blaze::rand<int>( 1, 100 ) );
+            mat(i,j) = value;
+            ref(i,j) = value;
+         }
+      }
+
+      // Searching for all elements
+      for( size_t i=0UL; i<30UL; ++i ) {
+         for( size_t j=0UL; j<20UL; ++j ) {
+            ConstIterator pos( mat.find( i, j ) );
+
+            if( ( ref(i,j) == 0 ) != ( pos == mat.end( i ) ) ||
+                ( ref(i,j) != 0 && pos->value() != ref(i,j) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Wrong search result\n"
+                   << " Details:\n"
+                   << "   Required position = (" << i << "," << j << ")\n"
+                   << "   Expected value    = " << ref(i,j) << "\n"
+                   << "   Current matrix:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -9333,6 +10159,50 @@ void ClassTest::testFind()
          }
       }
    }
+
+   {
+      test_ = "Column-major CompressedMatrix::find() after insertions and erasures";
+
+      typedef blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator  ConstIterator;
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 20UL, 30UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( 20UL, 30UL, 0 );
+
+      // Inserting and erasing elements in random order
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 19UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 29UL ) );
+
+         if( k % 4UL == 3UL ) {
+            mat.erase( i, j );
+            ref(i,j) = 0;
+         }
+         else {
+            const int value( blaze::rand<int>( 1, 100 ) );
+            mat(i,j) = value;
+            ref(i,j) = value;
+         }
+      }
+
+      // Searching for all elements
+      for( size_t i=0UL; i<20UL; ++i ) {
+         for( size_t j=0UL; j<30UL; ++j ) {
+            ConstIterator pos( mat.find( i, j ) );
+
+            if( ( ref(i,j) == 0 ) != ( pos == mat.end( j ) ) ||
+                ( ref(i,j) != 0 && pos->value() != ref(i,j) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Wrong search result\n"
+                   << " Details:\n"
+                   << "   Required position = (" << i << "," << j << ")\n"
+                   << "   Expected value    = " << ref(i,j) << "\n"
+                   << "   Current matrix:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,1161 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/custommatrix/ClassTest.cpp
+//  \brief Source file for the CustomMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/AlignedArray.h>
+#include <blazetest/mathtest/custommatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace custommatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CustomMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix default constructor";
+
+      UUMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Unpadded constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix unpadded constructor (row-major)";
+
+      int array[7] = { 0, 1, 2, 0, 4, 5, 6 };
+      UUMT mat( array+1, 2UL, 3UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 3UL );
+
+      if( mat.data() != array+1 ||
+          mat(0,0) != 1 || mat(0,1) != 2 || mat(0,2) != 0 ||
+          mat(1,0) != 4 || mat(1,1) != 5 || mat(1,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomMatrix unpadded constructor (NULL pointer)";
+
+      try {
+         UUMT mat( NULL, 2UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of custom matrix with NULL pointer succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CustomMatrix unpadded constructor (insufficient spacing)";
+
+      int array[6] = { 1, 2, 3, 4, 5, 6 };
+
+      try {
+         UUMT mat( array, 2UL, 3UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of custom matrix with insufficient spacing succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Padded constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix padded constructor (column-major)";
+
+      blaze::AlignedArray<int,64UL> array;
+      for( size_t i=0UL; i<64UL; ++i )
+         array[i] = -1;
+      array[ 0] = 1;
+      array[17] = 2;
+
+      APMT mat( array.data(), 3UL, 4UL, 16UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 12UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 || mat(2,3) != -1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t j=0UL; j<4UL; ++j ) {
+         for( size_t i=3UL; i<16UL; ++i ) {
+            if( array[i+j*16UL] != 0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Padding elements are not initialized\n"
+                   << " Details:\n"
+                   << "   Column : " << j << "\n"
+                   << "   Index  : " << i << "\n"
+                   << "   Element: " << array[i+j*16UL] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "CustomMatrix padded constructor (misaligned pointer)";
+
+      blaze::AlignedArray<int,64UL> array;
+
+      try {
+         APMT mat( array.data()+1UL, 3UL, 3UL, 16UL );
+
+         if( blaze::IntrinsicTrait<int>::size > 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setup of custom matrix with misaligned pointer succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix copy constructor";
+
+      int array[6] = { 1, 2, 0, 4, 5, 6 };
+      UUMT mat1( array, 2UL, 3UL );
+      UUMT mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2.data() != array ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Copy construction does not refer to the original array\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CustomMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix homogeneous assignment";
+
+      int array[8] = { 0, 0, 0, 7, 0, 0, 0, 7 };
+      UUMT mat( array, 2UL, 3UL, 4UL );
+      mat = 2;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 2 ||
+          mat(1,0) != 2 || mat(1,1) != 2 || mat(1,2) != 2 ||
+          array[3] != 7 || array[7] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Array assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix array assignment";
+
+      const int init[2][3] = { { 1, 2, 3 }, { 4, 5 } };
+      int array[6];
+      UUMT mat( array, 2UL, 3UL );
+      mat = init;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(0,2) != 3 ||
+          mat(1,0) != 4 || mat(1,1) != 5 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix copy assignment";
+
+      int array1[6] = { 1, 2, 0, 4, 5, 6 };
+      int array2[6] = { 0, 0, 0, 0, 0, 0 };
+      UUMT mat1( array1, 2UL, 3UL );
+      UUMT mat2( array2, 2UL, 3UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2.data() != array2 ||
+          array2[0] != 1 || array2[1] != 2 || array2[2] != 0 ||
+          array2[3] != 4 || array2[4] != 5 || array2[5] != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomMatrix copy assignment (size mismatch)";
+
+      int array1[6] = { 1, 2, 0, 4, 5, 6 };
+      int array2[6] = { 0, 0, 0, 0, 0, 0 };
+      UUMT mat1( array1, 2UL, 3UL );
+      UUMT mat2( array2, 3UL, 2UL );
+
+      try {
+         mat2 = mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of matrices with different sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix dense matrix assignment";
+
+      DMT mat1( 3UL, 4UL, 0 );
+      mat1(0,0) = 1;
+      mat1(1,1) = 2;
+      mat1(2,2) = 3;
+      mat1(2,3) = 4;
+
+      blaze::AlignedArray<int,64UL> array;
+      APMT mat2( array.data(), 3UL, 4UL, 16UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat2, 3UL, 1UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat1( 2UL, 3UL, 3UL );
+      mat1(0,0) = 1;
+      mat1(0,2) = 2;
+      mat1(1,1) = 3;
+
+      int array[6] = { 9, 9, 9, 9, 9, 9 };
+      UUMT mat2( array, 2UL, 3UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 2 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   //=====================================================================================
+   // Row-major dense matrix addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix dense matrix addition assignment (row-major)";
+
+      DMT mat1( 2UL, 3UL, 0 );
+      mat1(0,1) =  1;
+      mat1(1,0) = -2;
+      mat1(1,2) =  3;
+
+      int array[7] = { 0, 1, 0, 0, 2, 0, -3 };
+      UUMT mat2( array+1, 2UL, 3UL );
+
+      mat2 += mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 1 || mat2(0,2) != 0 ||
+          mat2(1,0) != 0 || mat2(1,1) != 0 || mat2(1,2) != 0 || array[0] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 1 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix dense matrix addition assignment (column-major)";
+
+      ODMT mat1( 3UL, 4UL, 1 );
+
+      blaze::AlignedArray<int,64UL> array;
+      APMT mat2( array.data(), 3UL, 4UL, 16UL );
+      mat2 = -1;
+      mat2(2,3) = 5;
+
+      mat2 += mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 1UL );
+
+      if( mat2(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   //=====================================================================================
+   // Dense matrix subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix dense matrix subtraction assignment";
+
+      DMT mat1( 2UL, 3UL, 0 );
+      mat1(0,1) = -1;
+      mat1(1,0) =  2;
+      mat1(1,2) = -3;
+
+      int array[7] = { 0, 1, 0, 0, 2, 0, -3 };
+      UUMT mat2( array+1, 2UL, 3UL );
+
+      mat2 -= mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 1 || mat2(0,2) != 0 ||
+          mat2(1,0) != 0 || mat2(1,1) != 0 || mat2(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 1 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix sparse matrix subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 3UL, 4UL, 2UL );
+      mat1(0,0) = 1;
+      mat1(2,3) = 2;
+
+      blaze::AlignedArray<int,64UL> array;
+      APMT mat2( array.data(), 3UL, 4UL, 16UL );
+      mat2 = 2;
+
+      mat2 -= mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 11UL );
+
+      if( mat2(0,0) != 1 || mat2(2,3) != 0 || mat2(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   //=====================================================================================
+   // Dense matrix multiplication assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix dense matrix multiplication assignment";
+
+      DMT mat1( 3UL, 3UL, 0 );
+      mat1(0,1) = 2;
+      mat1(1,0) = 1;
+      mat1(2,2) = 3;
+
+      int array[6] = { 1, 2, 3, 4, 5, 6 };
+      UUMT mat2( array, 2UL, 3UL );
+
+      mat2 *= mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2(0,0) != 2 || mat2(0,1) != 2 || mat2(0,2) !=  9 ||
+          mat2(1,0) != 5 || mat2(1,1) != 8 || mat2(1,2) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 2 2 9 )\n( 5 8 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomMatrix dense matrix multiplication assignment (size mismatch)";
+
+      DMT mat1( 2UL, 3UL, 1 );
+
+      int array[6] = { 1, 2, 3, 4, 5, 6 };
+      UUMT mat2( array, 2UL, 3UL );
+
+      try {
+         mat2 *= mat1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment with non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CustomMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   //=====================================================================================
+   // Self-scaling (M*=s)
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix self-scaling (M*=s)";
+
+      int array[7] = { 0, 1, 0, -2, 0, 3, 0 };
+      UUMT mat( array+1, 2UL, 3UL );
+
+      mat *= 2;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(0,2) != -4 ||
+          mat(1,0) != 0 || mat(1,1) != 6 || mat(1,2) !=  0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 -4 )\n( 0 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (M/=s)
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix self-scaling (M/=s)";
+
+      blaze::AlignedArray<int,64UL> array;
+      APMT mat( array.data(), 3UL, 4UL, 16UL );
+      mat = 4;
+      mat(1,2) = 0;
+
+      mat /= 2;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 11UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != 0 || mat(2,3) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // CustomMatrix::scale()
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix::scale()";
+
+      int array[6] = { 1, 2, 3, 4, 5, 6 };
+      UUMT mat( array, 3UL, 2UL );
+
+      mat.scale( 3 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 6UL );
+
+      if( mat(0,0) !=  3 || mat(0,1) !=  6 || mat(1,0) != 9 ||
+          mat(1,1) != 12 || mat(2,0) != 15 || mat(2,1) != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scale operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 6 )\n( 9 12 )\n( 15 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the CustomMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "CustomMatrix::operator()";
+
+   blaze::AlignedArray<int,64UL> array;
+   APMT mat( array.data(), 3UL, 4UL, 16UL );
+   mat = 0;
+
+   mat(2,1) = 1;
+   mat(0,3) = 2;
+   mat(1,2) = mat(2,1) + mat(0,3);
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 1UL );
+
+   if( array[2+1*16] != 1 || array[0+3*16] != 2 || array[1+2*16] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef UUMT::Iterator       Iterator;
+   typedef UUMT::ConstIterator  ConstIterator;
+
+   int array[8] = { 1, 0, -2, 9, -3, 0, 4, 9 };
+   UUMT mat( array, 2UL, 3UL, 4UL );
+
+   // Counting the number of elements in row 1 via Iterator
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it( cbegin( mat, 1UL ) );
+
+      if( it == cend( mat, 1UL ) || *it != -3 || *(++it) != 0 || *(it+1) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element access\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      int value = 7;
+
+      for( Iterator it=begin( mat, 0UL ); it!=end( mat, 0UL ); ++it ) {
+         *it = value++;
+      }
+
+      if( mat(0,0) != 7 || mat(0,1) != 8 || mat(0,2) != 9 || array[3] != 9 || mat(1,0) != -3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 7 8 9 )\n( -3 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "CustomMatrix::nonZeros()";
+
+   int array[8] = { 1, 0, 2, 5, 0, 0, 3, 5 };
+   UUMT mat( array, 2UL, 3UL, 4UL );
+
+   checkRows    ( mat, 2UL );
+   checkColumns ( mat, 3UL );
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   //=====================================================================================
+   // Resetting a single row
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix::reset( size_t )";
+
+      int array[8] = { 1, 2, 3, 7, 4, 5, 6, 7 };
+      UUMT mat( array, 2UL, 3UL, 4UL );
+
+      reset( mat, 1UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Resetting the elements
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix::reset()";
+
+      int array[8] = { 1, 2, 3, 7, 4, 5, 6, 7 };
+      UUMT mat( array, 2UL, 3UL, 4UL );
+
+      reset( mat );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+
+      if( array[3] != 7 || array[7] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation modified elements beyond the matrix\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Replacing the array of elements
+   //=====================================================================================
+
+   {
+      test_ = "CustomMatrix::reset( Type*, size_t, size_t )";
+
+      int array1[4] = { 1, 2, 3, 4 };
+      int array2[6] = { 0, 4, 0, 5, 6, 0 };
+      UUMT mat( array1, 2UL, 2UL );
+
+      mat.reset( array2, 3UL, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat.data() != array2 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 4 )\n( 0 5 )\n( 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "CustomMatrix::clear()";
+
+   int array[6] = { 1, 2, 3, 4, 5, 6 };
+   UUMT mat( array, 2UL, 3UL );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+
+   if( array[0] != 1 || array[5] != 6 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clear operation modified the adapted array\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the CustomMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "CustomMatrix swap";
+
+   int array1[4] = { 1, 2, 0, 3 };
+   int array2[6] = { 0, 4, 0, 5, 6, 0 };
+   UUMT mat1( array1, 2UL, 2UL );
+   UUMT mat2( array2, 3UL, 2UL );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 2UL );
+   checkNonZeros( mat1, 3UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 3UL );
+
+   if( mat1.data() != array2 || mat2.data() != array1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the matrices failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the CustomMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with default matrix
+   {
+      APMT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-default matrix
+   {
+      int array[4] = { 0, 0, 0, 0 };
+      UUMT mat( array, 2UL, 2UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace custommatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CustomMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOMMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CustomMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
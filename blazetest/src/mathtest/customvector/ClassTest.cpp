@@ -0,0 +1,1139 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/customvector/ClassTest.cpp
+//  \brief Source file for the CustomVector class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/AlignedArray.h>
+#include <blazetest/mathtest/customvector/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace customvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testMultAssign();
+   testScaling();
+   testSubscript();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testIsDefault();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CustomVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector default constructor";
+
+      UUVT vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Unpadded constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector unpadded constructor";
+
+      int array[6] = { 0, 1, 2, 0, 4, 5 };
+      UUVT vec( array+1, 5UL );
+
+      checkSize    ( vec, 5UL );
+      checkCapacity( vec, 5UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec.data() != array+1 || vec[0] != 1 || vec[1] != 2 || vec[2] != 0 || vec[3] != 4 || vec[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 2 0 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomVector unpadded constructor (NULL pointer)";
+
+      try {
+         UUVT vec( NULL, 5UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of custom vector with NULL pointer succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Padded constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector padded constructor";
+
+      blaze::AlignedArray<int,32UL> array;
+      for( size_t i=0UL; i<32UL; ++i )
+         array[i] = -1;
+      array[0] = 1;
+      array[2] = 3;
+
+      APVT vec( array.data(), 3UL, 32UL );
+
+      checkSize    ( vec, 3UL );
+      checkCapacity( vec, 32UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 1 || vec[1] != -1 || vec[2] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 -1 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=3UL; i<32UL; ++i ) {
+         if( array[i] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Padding elements are not initialized\n"
+                << " Details:\n"
+                << "   Index  : " << i << "\n"
+                << "   Element: " << array[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "CustomVector padded constructor (insufficient spacing)";
+
+      blaze::AlignedArray<int,32UL> array;
+
+      try {
+         APVT vec( array.data(), 3UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of custom vector with insufficient spacing succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CustomVector padded constructor (misaligned pointer)";
+
+      blaze::AlignedArray<int,32UL> array;
+
+      try {
+         APVT vec( array.data()+1UL, 3UL, 16UL );
+
+         if( blaze::IntrinsicTrait<int>::size > 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setup of custom vector with misaligned pointer succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << vec << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector copy constructor";
+
+      int array[5] = { 1, 2, 0, 4, 5 };
+      UUVT vec1( array, 5UL );
+      UUVT vec2( vec1 );
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2.data() != array ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Copy construction does not refer to the original array\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CustomVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector homogeneous assignment";
+
+      int array[4];
+      UUVT vec( array, 3UL );
+      array[3] = 7;
+      vec = 2;
+
+      checkSize    ( vec, 3UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 2 || vec[1] != 2 || vec[2] != 2 || array[3] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Array assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector array assignment";
+
+      const int init[4] = { 1, 2, 3 };
+      int array[4];
+      UUVT vec( array, 4UL );
+      vec = init;
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 1 || vec[1] != 2 || vec[2] != 3 || vec[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector copy assignment";
+
+      int array1[5] = { 1, 2, 0, 4, 5 };
+      int array2[5] = { 0, 0, 0, 0, 0 };
+      UUVT vec1( array1, 5UL );
+      UUVT vec2( array2, 5UL );
+      vec2 = vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2.data() != array2 || array2[0] != 1 || array2[1] != 2 || array2[2] != 0 ||
+          array2[3] != 4 || array2[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 0 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomVector copy assignment (size mismatch)";
+
+      int array1[5] = { 1, 2, 0, 4, 5 };
+      int array2[4] = { 0, 0, 0, 0 };
+      UUVT vec1( array1, 5UL );
+      UUVT vec2( array2, 4UL );
+
+      try {
+         vec2 = vec1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of vectors with different sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Dense vector assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] = 1;
+      vec1[1] = 2;
+      vec1[3] = 4;
+      vec1[4] = 5;
+
+      blaze::AlignedArray<int,32UL> array;
+      APVT vec2( array.data(), 5UL, 32UL );
+      vec2 = vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 1 || vec2[1] != 2 || vec2[2] != 0 || vec2[3] != 4 || vec2[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 2 0 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL, 3UL );
+      vec1[0] = 1;
+      vec1[2] = 2;
+      vec1[3] = 3;
+
+      int array[5] = { 9, 9, 9, 9, 9 };
+      UUVT vec2( array, 5UL );
+      vec2 = vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 3UL );
+
+      if( vec2[0] != 1 || vec2[1] != 0 || vec2[2] != 2 || vec2[3] != 3 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 0 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   //=====================================================================================
+   // Dense vector addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector addition assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] =  1;
+      vec1[2] = -2;
+      vec1[3] =  3;
+
+      int array[6] = { 0, 0, 4, 2, -6, 7 };
+      UUVT vec2( array+1, 5UL );
+
+      vec2 += vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 1 || vec2[1] != 4 || vec2[2] != 0 || vec2[3] != -3 || vec2[4] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 4 0 -3 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector addition assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL, 3UL );
+      vec1[0] =  1;
+      vec1[2] = -2;
+      vec1[3] =  3;
+
+      blaze::AlignedArray<int,32UL> array;
+      APVT vec2( array.data(), 5UL, 32UL );
+      vec2[0] =  0;
+      vec2[1] =  4;
+      vec2[2] =  2;
+      vec2[3] = -6;
+      vec2[4] =  7;
+
+      vec2 += vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 1 || vec2[1] != 4 || vec2[2] != 0 || vec2[3] != -3 || vec2[4] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 4 0 -3 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the CustomVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   //=====================================================================================
+   // Dense vector subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector subtraction assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] = -1;
+      vec1[2] =  2;
+      vec1[3] = -3;
+
+      int array[6] = { 0, 0, 4, 2, -6, 7 };
+      UUVT vec2( array+1, 5UL );
+
+      vec2 -= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 1 || vec2[1] != 4 || vec2[2] != 0 || vec2[3] != -3 || vec2[4] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 4 0 -3 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector subtraction assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL, 3UL );
+      vec1[0] = -1;
+      vec1[2] =  2;
+      vec1[3] = -3;
+
+      blaze::AlignedArray<int,32UL> array;
+      APVT vec2( array.data(), 5UL, 32UL );
+      vec2[0] =  0;
+      vec2[1] =  4;
+      vec2[2] =  2;
+      vec2[3] = -6;
+      vec2[4] =  7;
+
+      vec2 -= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 4UL );
+
+      if( vec2[0] != 1 || vec2[1] != 4 || vec2[2] != 0 || vec2[3] != -3 || vec2[4] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 4 0 -3 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the CustomVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   //=====================================================================================
+   // Dense vector multiplication assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector dense vector multiplication assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> vec1( 5UL, 0 );
+      vec1[0] =  1;
+      vec1[2] = -2;
+      vec1[3] =  3;
+
+      int array[6] = { 0, 0, 4, 2, -6, 7 };
+      UUVT vec2( array+1, 5UL );
+
+      vec2 *= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != 0 || vec2[1] != 0 || vec2[2] != -4 || vec2[3] != -18 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 0 -4 -18 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse vector multiplication assignment
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector sparse vector multiplication assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> vec1( 5UL, 3UL );
+      vec1[0] =  1;
+      vec1[2] = -2;
+      vec1[3] =  3;
+
+      blaze::AlignedArray<int,32UL> array;
+      APVT vec2( array.data(), 5UL, 32UL );
+      vec2[0] =  0;
+      vec2[1] =  4;
+      vec2[2] =  2;
+      vec2[3] = -6;
+      vec2[4] =  7;
+
+      vec2 *= vec1;
+
+      checkSize    ( vec2, 5UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[0] != 0 || vec2[1] != 0 || vec2[2] != -4 || vec2[3] != -18 || vec2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 0 -4 -18 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CustomVector (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the CustomVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   //=====================================================================================
+   // Self-scaling (v*=s)
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector self-scaling (v*=s)";
+
+      int array[6] = { 0, 1, 0, -2, 3, 0 };
+      UUVT vec( array+1, 5UL );
+
+      vec *= 2;
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 2 || vec[1] != 0 || vec[2] != -4 || vec[3] != 6 || vec[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 0 -4 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (v/=s)
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector self-scaling (v/=s)";
+
+      blaze::AlignedArray<int,32UL> array;
+      APVT vec( array.data(), 5UL, 32UL );
+      vec[0] =  2;
+      vec[1] =  0;
+      vec[2] = -4;
+      vec[3] =  6;
+      vec[4] =  0;
+
+      vec /= 2;
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 1 || vec[1] != 0 || vec[2] != -2 || vec[3] != 3 || vec[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 0 -2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // CustomVector::scale()
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector::scale()";
+
+      int array[4] = { 1, 2, 3, 4 };
+      UUVT vec( array, 4UL );
+
+      vec.scale( 3 );
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec[0] != 3 || vec[1] != 6 || vec[2] != 9 || vec[3] != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scale operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 3 6 9 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector subscript operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the subscript operator
+// of the CustomVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSubscript()
+{
+   test_ = "CustomVector::operator[]";
+
+   int array[7] = { 0, 0, 0, 0, 0, 0, 0 };
+   UUVT vec( array, 7UL );
+
+   vec[2] = 1;
+   vec[5] = 2;
+   vec[3] = vec[2] + vec[5];
+
+   checkSize    ( vec, 7UL );
+   checkNonZeros( vec, 3UL );
+
+   if( array[0] != 0 || array[1] != 0 || array[2] != 1 || array[3] != 3 ||
+       array[4] != 0 || array[5] != 2 || array[6] != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Subscript operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n( 0 0 1 3 0 2 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef UUVT::Iterator       Iterator;
+   typedef UUVT::ConstIterator  ConstIterator;
+
+   int array[5] = { 1, 0, -2, -3, 0 };
+   UUVT vec( array+1, 4UL );
+
+   // Counting the number of elements via Iterator
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( end( vec ) - begin( vec ) );
+
+      if( number != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it( cbegin( vec ) );
+
+      if( it == cend( vec ) || *it != 0 || *(++it) != -2 || *(it+2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element access\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      int value = 7;
+
+      for( Iterator it=begin( vec ); it!=end( vec ); ++it ) {
+         *it = value++;
+      }
+
+      if( array[0] != 1 || vec[0] != 7 || vec[1] != 8 || vec[2] != 9 || vec[3] != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 7 8 9 10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "CustomVector::nonZeros()";
+
+   blaze::AlignedArray<int,32UL> array;
+   for( size_t i=0UL; i<32UL; ++i )
+      array[i] = 1;
+
+   APVT vec( array.data(), 4UL, 32UL );
+   vec[0] = 0;
+   vec[2] = 0;
+
+   checkSize    ( vec, 4UL );
+   checkCapacity( vec, 32UL );
+   checkNonZeros( vec, 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   //=====================================================================================
+   // Resetting the elements
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector::reset()";
+
+      int array[5] = { 1, 2, 3, 4, 5 };
+      UUVT vec( array, 4UL );
+
+      reset( vec );
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 0UL );
+
+      if( array[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation modified elements beyond the vector\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Replacing the array of elements
+   //=====================================================================================
+
+   {
+      test_ = "CustomVector::reset( Type*, size_t )";
+
+      int array1[3] = { 1, 2, 3 };
+      int array2[5] = { 0, 4, 0, 5, 6 };
+      UUVT vec( array1, 3UL );
+
+      vec.reset( array2, 5UL );
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec.data() != array2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 4 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "CustomVector::clear()";
+
+   int array[3] = { 1, 2, 3 };
+   UUVT vec( array, 3UL );
+
+   clear( vec );
+
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+
+   if( array[0] != 1 || array[1] != 2 || array[2] != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clear operation modified the adapted array\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the CustomVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "CustomVector swap";
+
+   int array1[2] = { 1, 2 };
+   int array2[4] = { 0, 3, 4, 0 };
+   UUVT vec1( array1, 2UL );
+   UUVT vec2( array2, 4UL );
+
+   swap( vec1, vec2 );
+
+   checkSize    ( vec1, 4UL );
+   checkNonZeros( vec1, 2UL );
+   checkSize    ( vec2, 2UL );
+   checkNonZeros( vec2, 2UL );
+
+   if( vec1.data() != array2 || vec2.data() != array1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the vectors failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec1 << "\n" << vec2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the CustomVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the CustomVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with default vector
+   {
+      UUVT vec;
+
+      if( isDefault( vec ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-default vector
+   {
+      int array[3] = { 0, 0, 0 };
+      UUVT vec( array, 3UL );
+
+      if( isDefault( vec ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace customvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CustomVector class test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOMVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CustomVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -192,6 +192,42 @@ void ClassTest::testConstructors()
    }
 
 
+   //=====================================================================================
+   // Allocator constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicVector allocator constructor (size 0)";
+
+      const blaze::AlignedAllocator<int> alloc;
+      blaze::DynamicVector<int,blaze::rowVector> vec( alloc );
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "DynamicVector allocator constructor (size 3)";
+
+      const blaze::AlignedAllocator<int> alloc;
+      blaze::DynamicVector<int,blaze::rowVector> vec( 3UL, 2, alloc );
+
+      checkSize    ( vec, 3UL );
+      checkCapacity( vec, 3UL );
+      checkNonZeros( vec, 3UL );
+
+      if( vec[0] != 2 || vec[1] != 2 || vec[2] != 2 || vec.getAllocator() != alloc ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
    //=====================================================================================
    // Array initialization
    //=====================================================================================
@@ -0,0 +1,1164 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/hypersparsematrix/ClassTest.cpp
+//  \brief Source file for the HypersparseMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/hypersparsematrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace hypersparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the HypersparseMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testAppend();
+   testReset();
+   testClear();
+   testTranspose();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the HypersparseMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the HypersparseMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "HypersparseMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "HypersparseMatrix size constructor (0x4)";
+
+      MT mat( 0UL, 4UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "HypersparseMatrix size constructor (6x4)";
+
+      MT mat( 6UL, 4UL );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 5UL, 0UL );
+   }
+
+   {
+      test_ = "HypersparseMatrix size constructor (huge matrix)";
+
+      MT mat( 1000000000000UL, 1000000000000UL, 3UL );
+
+      checkRows    ( mat, 1000000000000UL );
+      checkColumns ( mat, 1000000000000UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 999999999999UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "HypersparseMatrix copy constructor";
+
+      MT mat1( 6UL, 4UL, 3UL );
+      mat1.append( 1UL, 0UL, 1 );
+      mat1.append( 1UL, 2UL, 2 );
+      mat1.append( 4UL, 1UL, 3 );
+
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 6UL );
+      checkColumns ( mat2, 4UL );
+      checkCapacity( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 1UL, 2UL );
+      checkNonZeros( mat2, 4UL, 1UL );
+
+      if( mat2 != mat1 || mat2.nonEmpty() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "HypersparseMatrix conversion constructor (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 6UL, 4UL );
+      sm(1,0) = 1;
+      sm(1,2) = 2;
+      sm(4,1) = 3;
+
+      MT mat( sm );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat != sm || mat.nonEmpty() != 2UL ||
+          mat.nonEmptyIndices()[0] != 1UL || mat.nonEmptyIndices()[1] != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> sm( 6UL, 4UL );
+      sm(1,0) = 1;
+      sm(1,2) = 2;
+      sm(4,1) = 3;
+      sm(5,1) = 4;
+
+      MT mat( sm );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 4UL, 1UL );
+      checkNonZeros( mat, 5UL, 1UL );
+
+      if( mat != sm || mat.nonEmpty() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix conversion constructor (column-major HypersparseMatrix)";
+
+      MT mat1( 6UL, 4UL, 3UL );
+      mat1.append( 1UL, 0UL, 1 );
+      mat1.append( 1UL, 2UL, 2 );
+      mat1.append( 4UL, 1UL, 3 );
+
+      const OMT mat2( mat1 );
+
+      checkRows    ( mat2, 6UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 1UL );
+      checkNonZeros( mat2, 3UL, 0UL );
+
+      const MT mat3( mat2 );
+
+      if( mat2 != mat1 || mat3 != mat1 || mat2.nonEmpty() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dm( 6UL, 4UL, 0 );
+      dm(1,0) = 1;
+      dm(1,2) = 2;
+      dm(4,1) = 3;
+
+      MT mat( dm );
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat != dm || mat.nonEmpty() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix conversion to CompressedMatrix";
+
+      MT mat( 6UL, 4UL, 3UL );
+      mat.append( 1UL, 0UL, 1 );
+      mat.append( 1UL, 2UL, 2 );
+      mat.append( 4UL, 1UL, 3 );
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor>    sm1( mat );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> sm2( mat );
+
+      if( sm1 != mat || sm2 != mat || nonZeros( sm1 ) != 3UL || nonZeros( sm2 ) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sm1 << "\n"
+             << "   Expected result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HypersparseMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the HypersparseMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "HypersparseMatrix copy assignment";
+
+      MT mat1( 6UL, 4UL, 3UL );
+      mat1.append( 1UL, 0UL, 1 );
+      mat1.append( 1UL, 2UL, 2 );
+      mat1.append( 4UL, 1UL, 3 );
+
+      MT mat2( 2UL, 2UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 6UL );
+      checkColumns ( mat2, 4UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> sm( 5UL, 7UL );
+      sm(0,6) = 1;
+      sm(3,0) = 2;
+      sm(3,6) = 3;
+
+      MT mat;
+      mat = sm;
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 7UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix sparse matrix expression assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 5UL, 7UL );
+      sm(0,6) = 1;
+      sm(3,0) = 2;
+      sm(3,6) = 3;
+
+      MT mat;
+      mat = 2 * trans( trans( sm ) );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 7UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat != 2 * sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ( 2 * sm ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dm( 3UL, 3UL, 0 );
+      dm(2,1) = 4;
+
+      MT mat( 6UL, 4UL );
+      mat = dm;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 1UL );
+
+      if( mat != dm || mat.nonEmpty() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HypersparseMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the read access via the function call operator of the
+// HypersparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "HypersparseMatrix::operator()";
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+   mat.append( 1UL, 2UL, 2 );
+   mat.append( 4UL, 1UL, 3 );
+
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j )
+      {
+         const int expected( ( i == 1UL && j == 0UL )?( 1 ):
+                             ( i == 1UL && j == 2UL )?( 2 ):
+                             ( i == 4UL && j == 1UL )?( 3 ):( 0 ) );
+
+         if( mat(i,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Access to element (" << i << "," << j << ") failed\n"
+                << " Details:\n"
+                << "   Result: " << mat(i,j) << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HypersparseMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the HypersparseMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+   mat.append( 1UL, 2UL, 2 );
+   mat.append( 4UL, 1UL, 3 );
+
+   // Counting the number of elements in row 0 and 1 via Iterator
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number0( end( mat, 0UL ) - begin( mat, 0UL ) );
+      const size_t number1( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number0 != 0UL || number1 != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number0 << " / " << number1 << "\n"
+             << "   Expected number of elements: 0 / 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it ( cbegin( mat, 1UL ) );
+      ConstIterator end( cend( mat, 1UL ) );
+
+      if( it == end || it->value() != 1 || it->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initial iterator detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it == end || it->value() != 2 || it->index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator pre-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator end detection failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      for( Iterator it=begin( mat, 1UL ); it!=end( mat, 1UL ); ++it ) {
+         it->value() *= 10;
+      }
+
+      if( mat(1,0) != 10 || mat(1,2) != 20 || mat(4,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 10 0 20 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 3 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Traversal of the non-empty rows
+   {
+      test_ = "Traversal of the non-empty rows";
+
+      int sum( 0 );
+      size_t rows( 0UL );
+
+      for( size_t k=0UL; k<mat.nonEmpty(); ++k ) {
+         rows += mat.nonEmptyIndices()[k];
+         for( ConstIterator it=mat.nonEmptyBegin(k); it!=mat.nonEmptyEnd(k); ++it ) {
+            sum += it->value();
+         }
+      }
+
+      if( mat.nonEmpty() != 2UL || rows != 5UL || sum != 33 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Traversal of the non-empty rows failed\n"
+             << " Details:\n"
+             << "   Number of non-empty rows: " << mat.nonEmpty() << " (expected 2)\n"
+             << "   Sum of the row indices  : " << rows << " (expected 5)\n"
+             << "   Sum of the elements     : " << sum << " (expected 33)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "HypersparseMatrix::nonZeros()";
+
+   OMT mat( 3UL, 1000000UL, 4UL );
+   mat.append( 0UL,      3UL, 1 );
+   mat.append( 2UL,      3UL, 2 );
+   mat.append( 1UL, 500000UL, 3 );
+   mat.append( 1UL, 999999UL, 0, true );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 1000000UL );
+   checkCapacity( mat, 4UL );
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat,      0UL, 0UL );
+   checkNonZeros( mat,      3UL, 2UL );
+   checkNonZeros( mat, 500000UL, 1UL );
+   checkNonZeros( mat, 999999UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() and \c reserve() member functions of the
+// HypersparseMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "HypersparseMatrix::append()";
+
+      MT mat( 1000000000UL, 1000000000UL );
+      mat.reserve( 2UL );
+      mat.append( 42UL, 7UL, 1 );
+      mat.append( 42UL, 999999UL, 2 );
+
+      mat.reserve( 4UL );
+      mat.append( 123456789UL, 0UL, 3 );
+      mat.append( 123456789UL, 1UL, 0, true );
+
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 42UL, 2UL );
+      checkNonZeros( mat, 123456789UL, 1UL );
+
+      if( mat.nonEmpty() != 2UL ||
+          mat(42,7) != 1 || mat(42,999999) != 2 || mat(123456789,0) != 3 || mat(123456789,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Append operation failed\n"
+             << " Details:\n"
+             << "   Number of non-empty rows: " << mat.nonEmpty() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "HypersparseMatrix::reset()";
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+   mat.append( 1UL, 2UL, 2 );
+   mat.append( 4UL, 1UL, 3 );
+
+   reset( mat );
+
+   checkRows    ( mat, 6UL );
+   checkColumns ( mat, 4UL );
+   checkCapacity( mat, 3UL );
+   checkNonZeros( mat, 0UL );
+   checkNonZeros( mat, 1UL, 0UL );
+
+   mat.append( 0UL, 3UL, 4 );
+
+   if( mat.nonEmpty() != 1UL || mat(0,3) != 4 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Append after reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "HypersparseMatrix::clear()";
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c transpose() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c transpose() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   {
+      test_ = "HypersparseMatrix::transpose()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 5UL, 3UL );
+      sm(0,2) = 1;
+      sm(3,0) = 2;
+      sm(3,1) = 3;
+      sm(4,2) = 4;
+
+      MT mat( sm );
+      mat.transpose();
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat != trans( sm ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << trans( sm ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "HypersparseMatrix::transpose() (huge matrix)";
+
+      MT mat( 1000000000UL, 10UL, 2UL );
+      mat.append( 999999999UL, 2UL, 1 );
+      mat.append( 999999999UL, 7UL, 2 );
+      mat.transpose();
+
+      checkRows    ( mat, 10UL );
+      checkColumns ( mat, 1000000000UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat.nonEmpty() != 2UL || mat(2,999999999) != 1 || mat(7,999999999) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the HypersparseMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "HypersparseMatrix swap";
+
+   MT mat1( 6UL, 4UL, 3UL );
+   mat1.append( 1UL, 0UL, 1 );
+   mat1.append( 1UL, 2UL, 2 );
+   mat1.append( 4UL, 1UL, 3 );
+
+   MT mat2( 2UL, 3UL, 1UL );
+   mat2.append( 0UL, 2UL, 4 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 2UL );
+   checkColumns ( mat1, 3UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 6UL );
+   checkColumns ( mat2, 4UL );
+   checkNonZeros( mat2, 3UL );
+
+   if( mat1(0,2) != 4 || mat2(1,0) != 1 || mat2(1,2) != 2 || mat2(4,1) != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the matrices failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "HypersparseMatrix::find()";
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+   mat.append( 1UL, 2UL, 2 );
+   mat.append( 4UL, 1UL, 3 );
+
+   const ConstIterator pos1( mat.find( 1UL, 2UL ) );
+   const ConstIterator pos2( mat.find( 1UL, 1UL ) );
+   const ConstIterator pos3( mat.find( 2UL, 1UL ) );
+   const ConstIterator pos4( mat.find( 5UL, 1UL ) );
+
+   if( pos1 == mat.end( 1UL ) || pos1->value() != 2 || pos1->index() != 2UL ||
+       pos2 != mat.end( 1UL ) || pos3 != mat.end( 2UL ) || pos4 != mat.end( 5UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element lookup failed\n"
+          << " Details:\n"
+          << "   Current matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "HypersparseMatrix::lowerBound()";
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+   mat.append( 1UL, 2UL, 2 );
+   mat.append( 4UL, 1UL, 3 );
+
+   const ConstIterator pos1( mat.lowerBound( 1UL, 1UL ) );
+   const ConstIterator pos2( mat.lowerBound( 1UL, 3UL ) );
+   const ConstIterator pos3( mat.lowerBound( 3UL, 0UL ) );
+
+   if( pos1 == mat.end( 1UL ) || pos1->index() != 2UL ||
+       pos2 != mat.end( 1UL ) || pos3 != mat.end( 3UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Lower bound failed\n"
+          << " Details:\n"
+          << "   Current matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the HypersparseMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "HypersparseMatrix::upperBound()";
+
+   MT mat( 6UL, 4UL, 3UL );
+   mat.append( 1UL, 0UL, 1 );
+   mat.append( 1UL, 2UL, 2 );
+   mat.append( 4UL, 1UL, 3 );
+
+   const ConstIterator pos1( mat.upperBound( 1UL, 0UL ) );
+   const ConstIterator pos2( mat.upperBound( 1UL, 2UL ) );
+   const ConstIterator pos3( mat.upperBound( 4UL, 0UL ) );
+
+   if( pos1 == mat.end( 1UL ) || pos1->index() != 2UL ||
+       pos2 != mat.end( 1UL ) || pos3 == mat.end( 4UL ) || pos3->index() != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Upper bound failed\n"
+          << " Details:\n"
+          << "   Current matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the HypersparseMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the HypersparseMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   const MT mat1;
+   const MT mat2( 6UL, 4UL );
+
+   if( !isDefault( mat1 ) || isDefault( mat2 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HypersparseMatrix/vector multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of row-major and column-major hypersparse
+// matrices with dense and sparse vectors. The results are compared to the results of the
+// according CompressedMatrix multiplications. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   // Preparation of a matrix with mostly empty rows
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 60UL, 40UL );
+   for( size_t i=0UL; i<sm.rows(); i+=7UL ) {
+      for( size_t j=i%5UL; j<sm.columns(); j+=3UL ) {
+         sm(i,j) = blaze::rand<int>( -10, 10 );
+      }
+   }
+
+   const MT  mat1( sm );
+   const OMT mat2( sm );
+
+   blaze::DynamicVector<int,blaze::columnVector> dv( 40UL );
+   blaze::randomize( dv, -10, 10 );
+
+   blaze::CompressedVector<int,blaze::columnVector> sv( 40UL );
+   blaze::randomize( sv, 12UL, -10, 10 );
+
+   // Matrix/dense vector multiplication
+   {
+      test_ = "HypersparseMatrix/dense vector multiplication";
+
+      const blaze::DynamicVector<int,blaze::columnVector> ref( sm * dv );
+      blaze::DynamicVector<int,blaze::columnVector> res1( mat1 * dv );
+      blaze::DynamicVector<int,blaze::columnVector> res2( mat2 * dv );
+
+      if( res1 != ref || res2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << res1 << "\n"
+             << "   Result (column-major):\n" << res2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      res1 += mat1 * dv;
+      res1 -= 2 * ( mat1 * dv );
+      res2 += mat2 * dv;
+      res2 -= 2 * ( mat2 * dv );
+
+      if( res1 != 0 * ref || res2 != 0 * ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition/subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << res1 << "\n"
+             << "   Result (column-major):\n" << res2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Matrix/sparse vector multiplication
+   {
+      test_ = "HypersparseMatrix/sparse vector multiplication";
+
+      const blaze::CompressedVector<int,blaze::columnVector> ref( sm * sv );
+      const blaze::CompressedVector<int,blaze::columnVector> res1( mat1 * sv );
+      const blaze::CompressedVector<int,blaze::columnVector> res2( mat2 * sv );
+
+      if( res1 != ref || res2 != ref || nonZeros( res1 ) != nonZeros( ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << res1 << "\n"
+             << "   Result (column-major):\n" << res2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicVector<int,blaze::columnVector> res3( mat1 * sv );
+      blaze::DynamicVector<int,blaze::columnVector> res4( mat2 * sv );
+      res3 += mat1 * sv;
+      res4 -= mat2 * sv;
+
+      if( res3 != 2 * ref || res4 != 0 * ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition/subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << res3 << "\n"
+             << "   Result (column-major):\n" << res4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Huge matrix/sparse vector multiplication
+   {
+      test_ = "HypersparseMatrix/sparse vector multiplication (huge matrix)";
+
+      const size_t N( 1000000000000UL );
+
+      MT mat( N, N, 3UL );
+      mat.append(      5UL,     3UL, 1 );
+      mat.append(      7UL, N-2UL, 2 );
+      mat.append( N-1UL,     3UL, 3 );
+
+      const OMT tmat( mat );
+
+      blaze::CompressedVector<int,blaze::columnVector> x( N, 2UL );
+      x[3UL]   = 2;
+      x[N-2UL] = 5;
+
+      const blaze::CompressedVector<int,blaze::columnVector> y1( mat  * x );
+      const blaze::CompressedVector<int,blaze::columnVector> y2( tmat * x );
+
+      if( nonZeros( y1 ) != 3UL || y1[5UL] != 2 || y1[7UL] != 10 || y1[N-1UL] != 6 || y2 != y1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << y1 << "\n"
+             << "   Result (column-major):\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace hypersparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running HypersparseMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_HYPERSPARSEMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during HypersparseMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
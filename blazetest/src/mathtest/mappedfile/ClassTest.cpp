@@ -0,0 +1,345 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedfile/ClassTest.cpp
+//  \brief Source file for the memory mapped file test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/mappedfile/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedfile {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the memory mapped file test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                       // Label of the currently performed test
+   , file_( "mappedfile.blaze" )   // The name of the temporary file
+{
+   try {
+      testVectors();
+      testMatrices();
+      testCopyOnWrite();
+      testFailures();
+   }
+   catch( ... ) {
+      std::remove( file_.c_str() );
+      throw;
+   }
+
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping test with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs mapping tests with empty and randomly initialized dense vectors of
+// various sizes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVectors()
+{
+   test_ = "Dense vectors";
+
+   const size_t sizes[] = { 0UL, 1UL, 7UL, 16UL, 31UL, 100UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      {
+         blaze::DynamicVector<int,blaze::columnVector> src( sizes[i] );
+         randomize( src );
+         runVectorTest( src );
+      }
+
+      {
+         blaze::DynamicVector<double,blaze::rowVector> src( sizes[i] );
+         randomize( src );
+         runVectorTest( src );
+      }
+
+      {
+         blaze::DynamicVector<blaze::complex<float>,blaze::columnVector> src( sizes[i] );
+         randomize( src );
+         runVectorTest( src );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping test with dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs mapping tests with empty and randomly initialized row-major and
+// column-major dense matrices of various sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrices()
+{
+   test_ = "Dense matrices";
+
+   const size_t sizes[] = { 0UL, 1UL, 7UL, 16UL, 33UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      for( size_t j=0UL; j<sizeof(sizes)/sizeof(size_t); ++j )
+      {
+         {
+            blaze::DynamicMatrix<float,blaze::rowMajor> src( sizes[i], sizes[j] );
+            randomize( src );
+            runMatrixTest( src );
+         }
+
+         {
+            blaze::DynamicMatrix<double,blaze::columnMajor> src( sizes[i], sizes[j] );
+            randomize( src );
+            runMatrixTest( src );
+         }
+
+         {
+            blaze::DynamicMatrix<blaze::complex<double>,blaze::rowMajor> src( sizes[i], sizes[j] );
+            randomize( src );
+            runMatrixTest( src );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of copy-on-write mappings.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the elements of a copy-on-write mapping can be modified and that
+// the modifications do not affect the mapped file. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCopyOnWrite()
+{
+   test_ = "Copy-on-write mapping";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> src( 13UL, 21UL );
+   randomize( src );
+
+   blaze::writeMappedFile( file_, src );
+
+   {
+      blaze::MemoryMap map( file_, blaze::copyOnWrite );
+
+      blaze::CustomMatrix<double,blaze::aligned,blaze::padded,blaze::rowMajor> dst;
+      blaze::mapMatrix( map, dst );
+
+      dst *= 2.0;
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( 2.0 * src );
+      compare( ref, dst );
+   }
+
+   {
+      blaze::MemoryMap map( file_, blaze::readOnly );
+
+      blaze::CustomMatrix<double,blaze::aligned,blaze::padded,blaze::rowMajor> dst;
+      blaze::mapMatrix( map, dst );
+
+      compare( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of mapping failures.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that files that do not match the adapting vector or matrix are rejected.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Mapping failures";
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> src( 5UL, 7UL );
+   randomize( src );
+
+   blaze::writeMappedFile( file_, src );
+
+   blaze::MemoryMap map( file_ );
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::CustomVector<int,blaze::aligned,blaze::padded,blaze::columnVector> dst;
+         blaze::mapVector( map, dst );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a matrix as vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::CustomMatrix<int,blaze::aligned,blaze::padded,blaze::columnMajor> dst;
+         blaze::mapMatrix( map, dst );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Storage order difference succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::CustomMatrix<float,blaze::aligned,blaze::padded,blaze::rowMajor> dst;
+         blaze::mapMatrix( map, dst );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Type difference succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::MemoryMap missing( "mappedfile.missing" );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping of a missing file succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace mappedfile
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running memory mapped file test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDFILE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during memory mapped file test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,335 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/outofcorematrix/ClassTest.cpp
+//  \brief Source file for the OutOfCoreMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/outofcorematrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace outofcorematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OutOfCoreMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                            // Label of the currently performed test
+   , file_( "outofcorematrix.blaze" )   // The name of the temporary file
+{
+   try {
+      testMatVecMult();
+      testMatMatMult();
+      testStream();
+      testFailures();
+   }
+   catch( ... ) {
+      std::remove( file_.c_str() );
+      throw;
+   }
+
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the out-of-core matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the out-of-core matrix/vector multiplication with row-major and
+// column-major matrices of various sizes and with various tile sizes. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatVecMult()
+{
+   test_ = "Out-of-core matrix/vector multiplication";
+
+   const size_t sizes[] = { 0UL, 1UL, 7UL, 16UL, 33UL };
+   const size_t tiles[] = { 0UL, 1UL, 3UL, 16UL, 100UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      for( size_t j=0UL; j<sizeof(sizes)/sizeof(size_t); ++j ) {
+         for( size_t k=0UL; k<sizeof(tiles)/sizeof(size_t); ++k )
+         {
+            {
+               DRMT A( sizes[i], sizes[j] );
+               randomize( A );
+               runMatVecTest( A, tiles[k] );
+            }
+
+            {
+               DCMT A( sizes[i], sizes[j] );
+               randomize( A );
+               runMatVecTest( A, tiles[k] );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the out-of-core matrix/matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the out-of-core matrix/matrix multiplication with row-major and
+// column-major matrices of various sizes and with various tile sizes. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatMatMult()
+{
+   test_ = "Out-of-core matrix/matrix multiplication";
+
+   const size_t sizes[] = { 0UL, 1UL, 7UL, 16UL, 33UL };
+   const size_t tiles[] = { 0UL, 1UL, 3UL, 16UL, 100UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      for( size_t j=0UL; j<sizeof(sizes)/sizeof(size_t); ++j ) {
+         for( size_t k=0UL; k<sizeof(tiles)/sizeof(size_t); ++k )
+         {
+            {
+               DRMT A( sizes[i], sizes[j] );
+               randomize( A );
+               runMatMatTest( A, tiles[k] );
+            }
+
+            {
+               DCMT A( sizes[i], sizes[j] );
+               randomize( A );
+               runMatMatTest( A, tiles[k] );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the streaming of tiles.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the stream() function passes all tiles of the out-of-core matrix
+// to the given operation. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testStream()
+{
+   test_ = "Streaming of tiles";
+
+   DRMT A( 257UL, 63UL );
+   randomize( A );
+
+   blaze::writeMappedFile( file_, A );
+
+   blaze::OutOfCoreMatrix<double,blaze::rowMajor> ooc( file_, 10UL );
+
+   if( ooc.rows() != 257UL || ooc.columns() != 63UL ||
+       ooc.tileSize() != 10UL || ooc.tiles() != 26UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid tiling detected\n"
+          << " Details:\n"
+          << "   Number of rows   : " << ooc.rows() << "\n"
+          << "   Number of columns: " << ooc.columns() << "\n"
+          << "   Tile size        : " << ooc.tileSize() << "\n"
+          << "   Number of tiles  : " << ooc.tiles() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   TileSum op;
+   ooc.stream( op );
+
+   double ref( 0.0 );
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         ref += A(i,j);
+
+   if( op.tiles_ != ooc.tiles() || std::fabs( op.sum_ - ref ) > 1E-8 * std::fabs( ref ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Streaming of tiles failed\n"
+          << " Details:\n"
+          << "   Processed tiles: " << op.tiles_ << "\n"
+          << "   Sum            : " << op.sum_ << "\n"
+          << "   Expected sum   : " << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of invalid out-of-core matrices and operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that mismatching files and operands are rejected. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Out-of-core failures";
+
+   DRMT A( 5UL, 7UL );
+   randomize( A );
+
+   blaze::writeMappedFile( file_, A );
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::OutOfCoreMatrix<double,blaze::columnMajor> ooc( file_ );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Storage order difference succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::OutOfCoreMatrix<float,blaze::rowMajor> ooc( file_ );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Type difference succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      try {
+         blaze::OutOfCoreMatrix<double,blaze::rowMajor> ooc( file_ );
+
+         DVT x( 5UL ), y;
+         multiply( ooc, x, y );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with mismatching vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace outofcorematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running OutOfCoreMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_OUTOFCOREMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during OutOfCoreMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
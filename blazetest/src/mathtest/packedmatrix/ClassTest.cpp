@@ -0,0 +1,618 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   testConstructors();
+   testElementAccess();
+   testAssignment();
+   testResize();
+   testMatVecMult();
+   testMatMatMult();
+   testBlockMatrix();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction of packed matrices of all structures and storage orders
+// from dense and sparse matrices and expressions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "PackedMatrix constructors";
+
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 16UL, 33UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      runConstructorTest<packedSymmetric,rowMajor   >( sizes[i] );
+      runConstructorTest<packedSymmetric,columnMajor>( sizes[i] );
+      runConstructorTest<packedLower    ,rowMajor   >( sizes[i] );
+      runConstructorTest<packedLower    ,columnMajor>( sizes[i] );
+      runConstructorTest<packedUpper    ,rowMajor   >( sizes[i] );
+      runConstructorTest<packedUpper    ,columnMajor>( sizes[i] );
+   }
+
+   {
+      const blaze::PackedMatrix<int,packedLower,rowMajor> P( 3UL, 2 );
+
+      if( P.capacity() != 6UL || P.nonZeros() != 6UL ||
+          P(0,0) != 2 || P(1,0) != 2 || P(0,1) != 0 || P(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Homogeneous initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << P << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix element access.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access via the function call operator and via iterators.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "PackedMatrix element access";
+
+   {
+      blaze::PackedMatrix<int,packedSymmetric,columnMajor> S( 3UL, 0 );
+      S(2,0) = 4;
+      S(1,2) += 5;
+      S(1,1) = 1;
+      S(0,2) *= 2;
+
+      if( S(0,2) != 8 || S(2,0) != 8 || S(2,1) != 5 || S(1,2) != 5 || S(1,1) != 1 ||
+          S.nonZeros() != 5UL || S.nonZeros( 2UL ) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric element access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << S << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::PackedMatrix<int,packedUpper,rowMajor> U( 3UL, 1 );
+      U(0,2) = 3;
+
+      int sum( 0 );
+      for( blaze::PackedMatrix<int,packedUpper,rowMajor>::ConstIterator it=U.cbegin( 0UL );
+           it!=U.cend( 0UL ); ++it ) {
+         sum += *it;
+      }
+
+      int diag( 0 );
+      for( blaze::PackedMatrix<int,packedUpper,rowMajor>::Iterator it=U.begin( 2UL );
+           it!=U.end( 2UL ); ++it ) {
+         diag += *it;
+      }
+
+      if( U(0,2) != 3 || U(2,0) != 0 || sum != 5 || diag != 1 ||
+          U.end( 1UL ) - U.begin( 1UL ) != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper element access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << U << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::PackedMatrix<int,packedLower,columnMajor> L( 3UL, 1 );
+
+      bool failed( false );
+
+      try {
+         L(0,1) = 2;
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed || L(0,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification of upper element of lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << L << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment and subtraction assignment of dense
+// and sparse matrices and expressions to packed matrices of all structures and storage orders.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "PackedMatrix assignment";
+
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 16UL, 33UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      runAssignmentTest<packedSymmetric,rowMajor   >( sizes[i] );
+      runAssignmentTest<packedSymmetric,columnMajor>( sizes[i] );
+      runAssignmentTest<packedLower    ,rowMajor   >( sizes[i] );
+      runAssignmentTest<packedLower    ,columnMajor>( sizes[i] );
+      runAssignmentTest<packedUpper    ,rowMajor   >( sizes[i] );
+      runAssignmentTest<packedUpper    ,columnMajor>( sizes[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix resize() and clear() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that resizing a packed matrix preserves the elements of the overlapping
+// part of the matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "PackedMatrix resize";
+
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 16UL, 33UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      runResizeTest<packedSymmetric,rowMajor   >( sizes[i] );
+      runResizeTest<packedSymmetric,columnMajor>( sizes[i] );
+      runResizeTest<packedLower    ,rowMajor   >( sizes[i] );
+      runResizeTest<packedLower    ,columnMajor>( sizes[i] );
+      runResizeTest<packedUpper    ,rowMajor   >( sizes[i] );
+      runResizeTest<packedUpper    ,columnMajor>( sizes[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed matrix/vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of packed matrices of all structures and storage
+// orders with dense vectors of various sizes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatVecMult()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Packed matrix/vector multiplication";
+
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 3UL, 7UL, 16UL, 33UL, 64UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      runMatVecTest<packedSymmetric,rowMajor   >( sizes[i] );
+      runMatVecTest<packedSymmetric,columnMajor>( sizes[i] );
+      runMatVecTest<packedLower    ,rowMajor   >( sizes[i] );
+      runMatVecTest<packedLower    ,columnMajor>( sizes[i] );
+      runMatVecTest<packedUpper    ,rowMajor   >( sizes[i] );
+      runMatVecTest<packedUpper    ,columnMajor>( sizes[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed matrix/matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of packed matrices of all structures and storage
+// orders with row-major and column-major dense matrices of various sizes. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatMatMult()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Packed matrix/matrix multiplication";
+
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 3UL, 7UL, 16UL, 33UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      runMatMatTest<packedSymmetric,rowMajor   >( sizes[i] );
+      runMatMatTest<packedSymmetric,columnMajor>( sizes[i] );
+      runMatMatTest<packedLower    ,rowMajor   >( sizes[i] );
+      runMatMatTest<packedLower    ,columnMajor>( sizes[i] );
+      runMatMatTest<packedUpper    ,rowMajor   >( sizes[i] );
+      runMatMatTest<packedUpper    ,columnMajor>( sizes[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of block-structured packed symmetric matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests packed symmetric matrices with non-numeric element types by comparing
+// them to block-structured SymmetricMatrix adaptors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBlockMatrix()
+{
+   using blaze::packedSymmetric;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Block-structured packed symmetric matrix";
+
+   typedef blaze::StaticMatrix<double,3UL,3UL>  SBT;
+   typedef blaze::StaticVector<double,3UL>      SVT;
+   typedef blaze::DynamicMatrix<double>         DBT;
+
+   {
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<SBT,rowMajor> > S( 7UL );
+      for( size_t i=0UL; i<S.rows(); ++i ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            SBT block;
+            randomize( block );
+            S(i,j) = block;
+         }
+      }
+
+      blaze::PackedMatrix<SBT,packedSymmetric,rowMajor> P( S );
+      compare( P, S );
+
+      P(2,5)(1,0) = 2.0;
+      if( P(5,2)(1,0) != 2.0 || P(2,5) != P(5,2) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification of a block failed\n"
+             << " Details:\n"
+             << "   Block (2,5):\n" << P(2,5) << "\n"
+             << "   Block (5,2):\n" << P(5,2) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      S(2,5)(1,0) = 2.0;
+
+      blaze::DynamicVector<SVT> x( 7UL );
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         randomize( x[i] );
+      }
+
+      blaze::DynamicVector<SVT> result( P * x );
+      blaze::DynamicVector<SVT> ref( S * x );
+      compare( result, ref );
+
+      result += P * x;
+      ref += S * x;
+      compare( result, ref );
+   }
+
+   {
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<DBT,columnMajor> > S( 5UL );
+      for( size_t i=0UL; i<S.rows(); ++i ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            DBT block( 2UL, 2UL );
+            randomize( block );
+            S(i,j) = block;
+         }
+      }
+
+      const blaze::PackedMatrix<DBT,packedSymmetric,columnMajor> P( S );
+      compare( P, S );
+
+      if( P.nonZeros() != 25UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero blocks\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << P.nonZeros() << "\n"
+             << "   Expected non-zeros : 25\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicVector<DVT> x( 5UL, DVT( 2UL ) );
+      for( size_t i=0UL; i<x.size(); ++i ) {
+         randomize( x[i] );
+      }
+
+      blaze::DynamicVector<DVT> result( P * x );
+      blaze::DynamicVector<DVT> ref( S * x );
+      compare( result, ref );
+
+      result -= P * x;
+      ref -= S * x;
+      compare( result, ref );
+
+      blaze::DynamicMatrix<DBT> C( P * S );
+      blaze::DynamicMatrix<DBT> D( S * S );
+      compare( C, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of invalid packed matrix setups and assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that non-square matrices and matrices without the according structure
+// are rejected. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   using blaze::packedSymmetric;
+   using blaze::packedLower;
+   using blaze::packedUpper;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "PackedMatrix failures";
+
+   {
+      bool failed( false );
+
+      try {
+         const DRMT A( 3UL, 4UL, 0.0 );
+         const blaze::PackedMatrix<double,packedSymmetric,rowMajor> P( A );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-square packed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      try {
+         DRMT A( 3UL, 3UL, 0.0 );
+         A(0,1) = 1.0;
+         const blaze::PackedMatrix<double,packedSymmetric,columnMajor> P( A );
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of symmetric matrix with non-symmetric matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      blaze::PackedMatrix<double,packedLower,rowMajor> P( 3UL, 1.0 );
+
+      try {
+         DCMT A( 3UL, 3UL, 0.0 );
+         A(0,2) = 1.0;
+         P = A;
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed || P.rows() != 3UL || P(2,0) != 1.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-lower matrix to lower matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      blaze::PackedMatrix<double,packedUpper,columnMajor> P( 3UL, 1.0 );
+
+      try {
+         DRMT A( 3UL, 3UL, 1.0 );
+         P += A;
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed || P(0,0) != 1.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-upper matrix to upper matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      bool failed( false );
+
+      blaze::PackedMatrix<double,packedUpper,rowMajor> P( 3UL, 1.0 );
+
+      try {
+         DRMT A( 4UL, 4UL, 0.0 );
+         P -= A;
+      }
+      catch( std::invalid_argument& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of matrix with different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1095 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/slicedellpackmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/slicedellpackmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllpackMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (0x4)";
+
+      MT mat( 0UL, 4UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (7x4)";
+
+      MT mat( 7UL, 4UL );
+
+      checkRows    ( mat, 7UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 6UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (row-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 5UL, 6UL );
+      sm(0,1) = 1;
+      sm(0,4) = 2;
+      sm(2,0) = 3;
+      sm(2,2) = 4;
+      sm(2,3) = 5;
+      sm(2,5) = 6;
+      sm(3,4) = 7;
+      sm(4,0) = 8;
+      sm(4,1) = 9;
+
+      MT mat( sm );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 6UL );
+      checkCapacity( mat, 9UL );
+      checkNonZeros( mat, 9UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 4UL );
+      checkNonZeros( mat, 3UL, 1UL );
+      checkNonZeros( mat, 4UL, 2UL );
+
+      if( mat != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (column-major CompressedMatrix, sorted)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> sm( 9UL, 5UL );
+      sm(0,1) = 1;
+      sm(3,0) = 2;
+      sm(3,2) = 3;
+      sm(3,4) = 4;
+      sm(5,3) = 5;
+      sm(6,0) = 6;
+      sm(6,1) = 7;
+      sm(8,4) = 8;
+
+      MT mat( sm, 8UL );
+
+      checkRows    ( mat, 9UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 8UL );
+      checkNonZeros( mat, 3UL, 3UL );
+      checkNonZeros( mat, 6UL, 2UL );
+      checkNonZeros( mat, 8UL, 1UL );
+
+      if( mat.sigma() != 8UL || mat != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Sorting window: " << mat.sigma() << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // The four longest rows of the first window must share the first chunk
+      if( mat.chunks() != 3UL || mat.chunkWidth( 0UL ) != 3UL || mat.chunkWidth( 1UL ) != 0UL ||
+          mat.chunkWidth( 2UL ) != 1UL || mat.permutation()[0] != 3UL || mat.permutation()[1] != 6UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid row sorting detected\n"
+             << " Details:\n"
+             << "   Number of chunks: " << mat.chunks() << "\n"
+             << "   Width of chunk 0: " << mat.chunkWidth( 0UL ) << "\n"
+             << "   Width of chunk 1: " << mat.chunkWidth( 1UL ) << "\n"
+             << "   Width of chunk 2: " << mat.chunkWidth( 2UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (DynamicMatrix)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dm( 3UL, 4UL, 0 );
+      dm(0,0) =  1;
+      dm(1,3) = -2;
+      dm(2,1) =  3;
+      dm(2,2) =  4;
+
+      MT mat( dm );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat != dm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix copy constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 5UL, 3UL );
+      sm(0,0) = 1;
+      sm(4,2) = 2;
+
+      MT mat1( sm, 4UL );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 5UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 2UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 4UL, 1UL );
+
+      if( mat2(0,0) != 1 || mat2(4,2) != 2 || mat2.sigma() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm( 3UL, 2UL );
+      sm(1,0) = 1;
+      sm(2,1) = 2;
+
+      MT mat1( sm );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 2UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2 != sm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << sm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix sparse matrix assignment (preserving the sorting window)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sm1( 2UL, 2UL );
+      sm1(0,0) = 1;
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> sm2( 6UL, 3UL );
+      sm2(0,2) = 2;
+      sm2(5,0) = 3;
+      sm2(5,1) = 4;
+
+      MT mat( sm1, 8UL );
+      mat = sm2;
+
+      checkRows    ( mat, 6UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 5UL, 2UL );
+
+      if( mat.sigma() != 8UL || mat != sm2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sm2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dm( 2UL, 3UL, 0 );
+      dm(0,2) = 1;
+      dm(1,1) = 2;
+
+      MT mat;
+      mat = dm;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat != dm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SlicedEllpackMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 6UL, 5UL );
+   sm(0,4) = 1;
+   sm(2,0) = 2;
+   sm(2,1) = 3;
+   sm(2,3) = 4;
+   sm(5,2) = 5;
+
+   const MT mat( sm, 6UL );
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      for( size_t j=0UL; j<sm.columns(); ++j ) {
+         if( mat(i,j) != sm(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << sm << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 5UL, 4UL );
+   sm(0,1) =  1;
+   sm(2,0) = -2;
+   sm(2,2) = -3;
+   sm(3,1) =  4;
+   sm(3,2) =  5;
+   sm(3,3) = -6;
+
+   const MT mat( sm, 4UL );
+
+   // Counting the number of elements in 0th row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( mat.end(0) - mat.begin(0) );
+
+      if( number != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in 1st row
+   {
+      test_ = "Iterator subtraction (empty row)";
+
+      const size_t number( mat.cend(1) - mat.cbegin(1) );
+
+      if( number != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Traversing the 3rd row
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it( mat.cbegin(3) );
+      const ConstIterator end( mat.cend(3) );
+
+      if( it == end || it->value() != 4 || it->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initial iterator detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it == end || (*it).value() != 5 || (*it).index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator pre-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      it++;
+
+      if( it == end || it->value() != -6 || it->index() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator post-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator end detection failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SlicedEllpackMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 11UL, 7UL );
+   blaze::randomize( sm, 30UL );
+
+   const MT mat( sm, 8UL );
+
+   checkRows    ( mat, 11UL );
+   checkColumns ( mat,  7UL );
+   checkNonZeros( mat, sm.nonZeros() );
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      checkNonZeros( mat, i, sm.nonZeros( i ) );
+   }
+
+   size_t capacity( 0UL );
+   for( size_t c=0UL; c<mat.chunks(); ++c ) {
+      capacity += mat.chunkWidth( c ) * MT::chunkSize;
+   }
+
+   if( mat.capacity() != capacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity         : " << mat.capacity() << "\n"
+          << "   Expected capacity: " << capacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "SlicedEllpackMatrix::reset()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 3UL, 4UL );
+   sm(0,0) = 1;
+   sm(2,3) = 2;
+
+   MT mat( sm, 4UL );
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 0UL );
+   checkNonZeros( mat, 0UL, 0UL );
+   checkNonZeros( mat, 2UL, 0UL );
+
+   if( mat.sigma() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Sorting window         : " << mat.sigma() << "\n"
+          << "   Expected sorting window: 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SlicedEllpackMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 3UL, 4UL );
+   sm(0,0) = 1;
+   sm(2,3) = 2;
+
+   MT mat( sm );
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SlicedEllpackMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm1( 2UL, 2UL );
+   sm1(0,0) = 1;
+   sm1(1,1) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm2( 3UL, 1UL );
+   sm2(2,0) = 3;
+
+   MT mat1( sm1 );
+   MT mat2( sm2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 1UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 2UL );
+
+   if( mat1 != sm2 || mat2 != sm1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n"
+          << "   Expected result:\n" << sm2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "SlicedEllpackMatrix::find()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 8UL, 6UL );
+   sm(1,2) = 1;
+   sm(2,3) = 2;
+   sm(6,1) = 3;
+   sm(6,5) = 4;
+
+   const MT mat( sm, 8UL );
+
+   for( size_t i=0UL; i<sm.rows(); ++i ) {
+      for( size_t j=0UL; j<sm.columns(); ++j )
+      {
+         const ConstIterator pos( mat.find( i, j ) );
+
+         if( ( sm(i,j) == 0 && pos != mat.end( i ) ) ||
+             ( sm(i,j) != 0 && ( pos == mat.end( i ) || pos->index() != j || pos->value() != sm(i,j) ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element search failed\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "SlicedEllpackMatrix::lowerBound()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 3UL, 6UL );
+   sm(1,1) = 1;
+   sm(1,3) = 2;
+
+   const MT mat( sm );
+
+   const size_t expected[6] = { 1UL, 1UL, 3UL, 3UL, 6UL, 6UL };
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 6UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound search failed\n"
+             << " Details:\n"
+             << "   Required position = (1," << j << ")\n"
+             << "   Found index       = " << index << "\n"
+             << "   Expected index    = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   test_ = "SlicedEllpackMatrix::upperBound()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> sm( 3UL, 6UL );
+   sm(1,1) = 1;
+   sm(1,3) = 2;
+
+   const MT mat( sm );
+
+   const size_t expected[6] = { 1UL, 3UL, 3UL, 6UL, 6UL, 6UL };
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 6UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound search failed\n"
+             << " Details:\n"
+             << "   Required position = (1," << j << ")\n"
+             << "   Found index       = " << index << "\n"
+             << "   Expected index    = " << expected[j] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   // isDefault with 0x0 matrix
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // isDefault with non-empty matrix
+   {
+      MT mat( 2UL, 3UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a SlicedEllpackMatrix with dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a SlicedEllpackMatrix with dense
+// vectors and matrices by comparing the results to the according multiplications with a
+// CompressedMatrix. Both the default and the vectorized multiplication kernels are tested
+// for various sorting windows and matrices with unevenly filled rows. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   const size_t sigmas[4] = { 1UL, 3UL, 8UL, 64UL };
+
+   for( size_t s=0UL; s<4UL; ++s )
+   {
+      // Integral matrix/dense vector multiplication
+      {
+         test_ = "SlicedEllpackMatrix/dense vector multiplication (int)";
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> sm( 67UL, 43UL );
+         blaze::randomize( sm, 400UL, -10, 10 );
+
+         const MT mat( sm, sigmas[s] );
+
+         blaze::DynamicVector<int,blaze::columnVector> x( 43UL );
+         blaze::randomize( x, -10, 10 );
+
+         const blaze::DynamicVector<int,blaze::columnVector> ref( sm * x );
+         blaze::DynamicVector<int,blaze::columnVector> y( mat * x );
+
+         if( y != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Sorting window: " << sigmas[s] << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         y += mat * x;
+         y -= mat * x;
+
+         if( y != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Addition/subtraction assignment failed\n"
+                << " Details:\n"
+                << "   Sorting window: " << sigmas[s] << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Floating point matrix/dense vector multiplication
+      {
+         test_ = "SlicedEllpackMatrix/dense vector multiplication (double)";
+
+         blaze::CompressedMatrix<double,blaze::rowMajor> sm( 131UL, 97UL );
+         for( size_t i=0UL; i<sm.rows(); ++i ) {
+            for( size_t j=0UL; j<( i*7UL ) % 23UL; ++j )
+               sm( i, ( i + j*13UL ) % sm.columns() ) = blaze::rand<double>( -1.0, 1.0 );
+         }
+
+         const blaze::SlicedEllpackMatrix<double> mat( sm, sigmas[s] );
+
+         blaze::DynamicVector<double,blaze::columnVector> x( 97UL );
+         blaze::randomize( x, -1.0, 1.0 );
+
+         const blaze::DynamicVector<double,blaze::columnVector> ref( sm * x );
+         blaze::DynamicVector<double,blaze::columnVector> y( 131UL, 1.0 );
+
+         y = mat * x;
+
+         if( y != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Sorting window: " << sigmas[s] << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         y += mat * x;
+
+         if( y != 2.0 * ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Addition assignment failed\n"
+                << " Details:\n"
+                << "   Sorting window: " << sigmas[s] << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n" << ( 2.0 * ref ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Matrix/dense vector multiplication with non-finite vector elements
+      {
+         test_ = "SlicedEllpackMatrix/dense vector multiplication (non-finite elements)";
+
+         blaze::CompressedMatrix<double,blaze::rowMajor> sm( 45UL, 20UL );
+         for( size_t i=0UL; i<sm.rows(); ++i ) {
+            if( i % 5UL == 0UL ) continue;
+            for( size_t j=0UL; j<( i*3UL ) % 7UL; ++j )
+               sm( i, 1UL + ( i + j*3UL ) % 19UL ) = 1.0 + j;
+         }
+         sm( 3UL, 0UL ) = 2.0;
+         sm( 7UL, 0UL ) = 1.0;
+         sm( 12UL, 0UL ) = -1.0;
+
+         blaze::DynamicVector<double,blaze::columnVector> x( 20UL );
+         blaze::randomize( x, -1.0, 1.0 );
+         x[0UL] = std::numeric_limits<double>::infinity();
+         x[9UL] = std::numeric_limits<double>::quiet_NaN();
+
+         const blaze::DynamicVector<double,blaze::columnVector> ref( sm * x );
+
+         const DMT mat1( sm, sigmas[s] );
+         const blaze::SlicedEllpackMatrix<double> mat2( sm, sigmas[s] );
+
+         const blaze::DynamicVector<double,blaze::columnVector> y1( mat1 * x );
+         const blaze::DynamicVector<double,blaze::columnVector> y2( mat2 * x );
+
+         for( size_t i=0UL; i<sm.rows(); ++i ) {
+            const bool nan( ref[i] != ref[i] );
+            if( nan != ( y1[i] != y1[i] ) || nan != ( y2[i] != y2[i] ) ||
+                ( !nan && ( y1[i] != ref[i] || y2[i] != ref[i] ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Sorting window: " << sigmas[s] << "\n"
+                   << "   Row           : " << i << "\n"
+                   << "   Result        : " << y1[i] << " / " << y2[i] << "\n"
+                   << "   Expected      : " << ref[i] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Matrix/dense matrix multiplication
+      {
+         test_ = "SlicedEllpackMatrix/dense matrix multiplication";
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> sm( 21UL, 17UL );
+         blaze::randomize( sm, 80UL, -10, 10 );
+
+         const MT mat( sm, sigmas[s] );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> dm( 17UL, 5UL );
+         blaze::randomize( dm, -10, 10 );
+
+         const blaze::DynamicMatrix<int,blaze::rowMajor> ref( sm * dm );
+         const blaze::DynamicMatrix<int,blaze::rowMajor> res( mat * dm );
+
+         if( res != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Sorting window: " << sigmas[s] << "\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllpackMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLPACKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllpackMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
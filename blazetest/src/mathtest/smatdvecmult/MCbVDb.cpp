@@ -83,6 +83,11 @@ int main()
       RUN_SMATDVECMULT_OPERATION_TEST( CMCb( 127UL,  67UL,  7UL ), CVDb(  67UL ) );
       RUN_SMATDVECMULT_OPERATION_TEST( CMCb(  64UL, 128UL, 16UL ), CVDb( 128UL ) );
       RUN_SMATDVECMULT_OPERATION_TEST( CMCb( 128UL,  64UL,  8UL ), CVDb(  64UL ) );
+
+      // Running tests with large matrices with many non-zero elements per row
+      RUN_SMATDVECMULT_OPERATION_TEST( CMCb(  67UL, 127UL, 2048UL ), CVDb( 127UL ) );
+      RUN_SMATDVECMULT_OPERATION_TEST( CMCb( 127UL,  67UL, 4096UL ), CVDb(  67UL ) );
+      RUN_SMATDVECMULT_OPERATION_TEST( CMCb(  64UL, 128UL, 8192UL ), CVDb( 128UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during sparse matrix/dense vector multiplication:\n"
@@ -94,6 +94,13 @@ int main()
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 32UL,  32UL,  8UL ), CMCa(  32UL, 32UL,  8UL ) );
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 64UL,  32UL, 16UL ), CMCa(  32UL, 16UL,  8UL ) );
       RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 64UL,  32UL, 16UL ), CMCa(  32UL, 64UL, 16UL ) );
+
+      // Running tests with matrices exceeding the SMP threshold
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 160UL, 40UL, 320UL ), CMCa(  40UL, 70UL, 280UL ) );
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 200UL, 90UL, 900UL ), CMCa(  90UL, 90UL,  90UL ) );
+
+      // Running tests with matrices exceeding the workspace limit
+      RUN_SMATSMATMULT_OPERATION_TEST( CMCa( 3UL, 8UL, 24UL ), CMCa( 8UL, 70000UL, 400UL ) );
    }
    catch( std::exception& ex ) {
       std::cerr << "\n\n ERROR DETECTED during sparse matrix/sparse matrix multiplication:\n"
@@ -39,13 +39,20 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/Reordering.h>
+#include <blaze/math/Semiring.h>
+#include <blaze/math/SparseSubmatrix.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
 #include <blaze/math/StrictlyUpperMatrix.h>
 #include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/TriangularSolver.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
 #include <blaze/math/UpperMatrix.h>
@@ -85,6 +92,12 @@ OperationTest::OperationTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testBandwidth();
+   testReverseCuthillMcKee();
+   testNestedDissection();
+   testPermute();
+   testTriangularSolve();
+   testSemiring();
 }
 //*************************************************************************************************
 
@@ -15665,6 +15678,1025 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c bandwidth() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c bandwidth() function for sparse matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testBandwidth()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major bandwidth()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 5UL, 4UL );
+      mat(0,0) = 1;
+      mat(1,3) = 2;
+      mat(4,2) = 3;
+
+      const size_t width = bandwidth( mat );
+
+      if( width != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << width << "\n"
+             << "   Expected result: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major bandwidth()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 5UL, 4UL );
+      mat(0,0) = 1;
+      mat(1,3) = 2;
+      mat(4,0) = 3;
+
+      const size_t width = bandwidth( mat );
+
+      if( width != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << width << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reverseCuthillMcKee() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reverseCuthillMcKee() function for sparse matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReverseCuthillMcKee()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reverseCuthillMcKee()";
+
+      // Reordering of a scrambled path graph (0-3-5-1-6-2-4)
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 7UL, 7UL );
+         const size_t path[7] = { 0UL, 3UL, 5UL, 1UL, 6UL, 2UL, 4UL };
+         for( size_t i=0UL; i<7UL; ++i ) {
+            mat(path[i],path[i]) = 2;
+            if( i > 0UL ) mat(path[i],path[i-1UL]) = -1;
+            if( i < 6UL ) mat(path[i],path[i+1UL]) = -1;
+         }
+
+         std::vector<size_t> perm;
+         reverseCuthillMcKee( mat, perm );
+
+         checkPermutation( perm, 7UL );
+
+         const blaze::CompressedMatrix<int,blaze::rowMajor> res( permute( mat, perm ) );
+
+         if( bandwidth( mat ) != 5UL || bandwidth( res ) != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bandwidth reduction failed\n"
+                << " Details:\n"
+                << "   Original bandwidth : " << bandwidth( mat ) << " (expected 5)\n"
+                << "   Reordered bandwidth: " << bandwidth( res ) << " (expected 1)\n"
+                << "   Reordered matrix:\n" << res << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Reordering of an unsymmetric matrix with two connected components
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 6UL, 6UL );
+         mat(0,4) = 1;
+         mat(4,2) = 2;
+         mat(1,5) = 3;
+         mat(3,3) = 4;
+
+         std::vector<size_t> perm;
+         reverseCuthillMcKee( mat, perm );
+
+         checkPermutation( perm, 6UL );
+
+         const blaze::CompressedMatrix<int,blaze::rowMajor> res( permute( mat, perm ) );
+
+         checkNonZeros( res, 4UL );
+
+         if( bandwidth( res ) != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bandwidth reduction failed\n"
+                << " Details:\n"
+                << "   Reordered bandwidth: " << bandwidth( res ) << " (expected 1)\n"
+                << "   Reordered matrix:\n" << res << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Reordering of a non-square matrix
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 3UL );
+
+         std::vector<size_t> perm;
+         reverseCuthillMcKee( mat, perm );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reverseCuthillMcKee()";
+
+      // Reordering of a scrambled path graph (0-3-5-1-6-2-4)
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 7UL, 7UL );
+         const size_t path[7] = { 0UL, 3UL, 5UL, 1UL, 6UL, 2UL, 4UL };
+         for( size_t i=0UL; i<7UL; ++i ) {
+            mat(path[i],path[i]) = 2;
+            if( i > 0UL ) mat(path[i],path[i-1UL]) = -1;
+            if( i < 6UL ) mat(path[i],path[i+1UL]) = -1;
+         }
+
+         std::vector<size_t> perm;
+         reverseCuthillMcKee( mat, perm );
+
+         checkPermutation( perm, 7UL );
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor> res( permute( mat, perm ) );
+
+         if( bandwidth( mat ) != 5UL || bandwidth( res ) != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bandwidth reduction failed\n"
+                << " Details:\n"
+                << "   Original bandwidth : " << bandwidth( mat ) << " (expected 5)\n"
+                << "   Reordered bandwidth: " << bandwidth( res ) << " (expected 1)\n"
+                << "   Reordered matrix:\n" << res << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Reordering of an unsymmetric matrix with two connected components
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 6UL, 6UL );
+         mat(0,4) = 1;
+         mat(4,2) = 2;
+         mat(1,5) = 3;
+         mat(3,3) = 4;
+
+         std::vector<size_t> perm;
+         reverseCuthillMcKee( mat, perm );
+
+         checkPermutation( perm, 6UL );
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor> res( permute( mat, perm ) );
+
+         checkNonZeros( res, 4UL );
+
+         if( bandwidth( res ) != 1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bandwidth reduction failed\n"
+                << " Details:\n"
+                << "   Reordered bandwidth: " << bandwidth( res ) << " (expected 1)\n"
+                << "   Reordered matrix:\n" << res << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nestedDissection() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nestedDissection() function for sparse matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testNestedDissection()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major nestedDissection()";
+
+      // Dissection of a tridiagonal matrix (path graph 0-1-...-9)
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 10UL, 10UL );
+         for( size_t i=0UL; i<10UL; ++i ) {
+            mat(i,i) = 2;
+            if( i > 0UL ) mat(i,i-1UL) = -1;
+            if( i < 9UL ) mat(i,i+1UL) = -1;
+         }
+
+         std::vector<size_t> perm;
+         nestedDissection( mat, perm, 3UL );
+
+         checkPermutation( perm, 10UL );
+
+         // The first separator splits the path into the vertices 0-3 and 5-9
+         const blaze::CompressedMatrix<int,blaze::rowMajor> res( permute( mat, perm ) );
+
+         if( perm[9] != 4UL || nonZeros( submatrix( res, 0UL, 4UL, 4UL, 5UL ) ) != 0UL ||
+             nonZeros( submatrix( res, 4UL, 0UL, 5UL, 4UL ) ) != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Nested dissection failed\n"
+                << " Details:\n"
+                << "   Last index: " << perm[9] << " (expected 4)\n"
+                << "   Reordered matrix:\n" << res << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Dissection of a diagonal matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 5UL, 5UL );
+         mat(1,1) = 1;
+         mat(3,3) = 2;
+
+         std::vector<size_t> perm;
+         nestedDissection( mat, perm, 1UL );
+
+         checkPermutation( perm, 5UL );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major nestedDissection()";
+
+      // Dissection of a tridiagonal matrix (path graph 0-1-...-9)
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 10UL, 10UL );
+         for( size_t i=0UL; i<10UL; ++i ) {
+            mat(i,i) = 2;
+            if( i > 0UL ) mat(i,i-1UL) = -1;
+            if( i < 9UL ) mat(i,i+1UL) = -1;
+         }
+
+         std::vector<size_t> perm;
+         nestedDissection( mat, perm, 3UL );
+
+         checkPermutation( perm, 10UL );
+
+         // The first separator splits the path into the vertices 0-3 and 5-9
+         const blaze::CompressedMatrix<int,blaze::columnMajor> res( permute( mat, perm ) );
+
+         if( perm[9] != 4UL || nonZeros( submatrix( res, 0UL, 4UL, 4UL, 5UL ) ) != 0UL ||
+             nonZeros( submatrix( res, 4UL, 0UL, 5UL, 4UL ) ) != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Nested dissection failed\n"
+                << " Details:\n"
+                << "   Last index: " << perm[9] << " (expected 4)\n"
+                << "   Reordered matrix:\n" << res << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c permute() and \c unpermute() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c permute() functions for sparse matrices and dense
+// vectors and of the \c unpermute() function for dense vectors. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPermute()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major permute()";
+
+      // Symmetric permutation
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+         mat(0,0) = 1;
+         mat(0,2) = 2;
+         mat(1,0) = 3;
+         mat(2,1) = 4;
+         mat(2,2) = 5;
+
+         std::vector<size_t> perm( 3UL );
+         perm[0] = 2UL;
+         perm[1] = 0UL;
+         perm[2] = 1UL;
+
+         const blaze::CompressedMatrix<int,blaze::rowMajor> res( permute( mat, perm ) );
+
+         checkRows    ( res, 3UL );
+         checkColumns ( res, 3UL );
+         checkNonZeros( res, 5UL );
+
+         if( res(0,0) != 5 || res(0,1) != 0 || res(0,2) != 4 ||
+             res(1,0) != 2 || res(1,1) != 1 || res(1,2) != 0 ||
+             res(2,0) != 0 || res(2,1) != 3 || res(2,2) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Symmetric permutation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n( 5 0 4 )\n( 2 1 0 )\n( 0 3 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row and column permutation of a non-square matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 3UL );
+         mat(0,0) = 1;
+         mat(0,2) = 2;
+         mat(1,1) = 3;
+
+         std::vector<size_t> rowPerm( 2UL );
+         rowPerm[0] = 1UL;
+         rowPerm[1] = 0UL;
+
+         std::vector<size_t> colPerm( 3UL );
+         colPerm[0] = 2UL;
+         colPerm[1] = 1UL;
+         colPerm[2] = 0UL;
+
+         const blaze::CompressedMatrix<int,blaze::rowMajor> res( permute( mat, rowPerm, colPerm ) );
+
+         checkRows    ( res, 2UL );
+         checkColumns ( res, 3UL );
+         checkNonZeros( res, 3UL );
+
+         if( res(0,0) != 0 || res(0,1) != 3 || res(0,2) != 0 ||
+             res(1,0) != 2 || res(1,1) != 0 || res(1,2) != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row and column permutation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n( 0 3 0 )\n( 2 0 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Permutation with an invalid permutation vector
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+
+         std::vector<size_t> perm( 3UL, 0UL );
+         permute( mat, perm );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with invalid permutation vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major permute()";
+
+      // Symmetric permutation
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+         mat(0,0) = 1;
+         mat(0,2) = 2;
+         mat(1,0) = 3;
+         mat(2,1) = 4;
+         mat(2,2) = 5;
+
+         std::vector<size_t> perm( 3UL );
+         perm[0] = 2UL;
+         perm[1] = 0UL;
+         perm[2] = 1UL;
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor> res( permute( mat, perm ) );
+
+         checkRows    ( res, 3UL );
+         checkColumns ( res, 3UL );
+         checkNonZeros( res, 5UL );
+
+         if( res(0,0) != 5 || res(0,1) != 0 || res(0,2) != 4 ||
+             res(1,0) != 2 || res(1,1) != 1 || res(1,2) != 0 ||
+             res(2,0) != 0 || res(2,1) != 3 || res(2,2) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Symmetric permutation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n( 5 0 4 )\n( 2 1 0 )\n( 0 3 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row and column permutation of a non-square matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 3UL );
+         mat(0,0) = 1;
+         mat(0,2) = 2;
+         mat(1,1) = 3;
+
+         std::vector<size_t> rowPerm( 2UL );
+         rowPerm[0] = 1UL;
+         rowPerm[1] = 0UL;
+
+         std::vector<size_t> colPerm( 3UL );
+         colPerm[0] = 2UL;
+         colPerm[1] = 1UL;
+         colPerm[2] = 0UL;
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor> res( permute( mat, rowPerm, colPerm ) );
+
+         checkRows    ( res, 2UL );
+         checkColumns ( res, 3UL );
+         checkNonZeros( res, 3UL );
+
+         if( res(0,0) != 0 || res(0,1) != 3 || res(0,2) != 0 ||
+             res(1,0) != 2 || res(1,1) != 0 || res(1,2) != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row and column permutation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n( 0 3 0 )\n( 2 0 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense vector tests
+   //=====================================================================================
+
+   {
+      test_ = "Dense vector permute()/unpermute()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 3UL );
+      mat(0,0) = 1;
+      mat(0,2) = 2;
+      mat(1,0) = 3;
+      mat(2,1) = 4;
+      mat(2,2) = 5;
+
+      blaze::DynamicVector<int,blaze::columnVector> vec( 3UL );
+      vec[0] = 1;
+      vec[1] = 2;
+      vec[2] = 3;
+
+      std::vector<size_t> perm( 3UL );
+      perm[0] = 2UL;
+      perm[1] = 0UL;
+      perm[2] = 1UL;
+
+      const blaze::DynamicVector<int,blaze::columnVector> pvec( permute( vec, perm ) );
+
+      if( pvec[0] != 3 || pvec[1] != 1 || pvec[2] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dense vector permutation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << pvec << "\n"
+             << "   Expected result:\n( 3 1 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicVector<int,blaze::columnVector> res( unpermute( permute( mat, perm ) * pvec, perm ) );
+      const blaze::DynamicVector<int,blaze::columnVector> ref( mat * vec );
+
+      if( res != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permuted multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TriangularSolver class template and the \c solve() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the level-scheduled TriangularSolver class template and of
+// the serial \c solve() function for lower, upper, unilower, and uniupper sparse matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testTriangularSolve()
+{
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  MT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+
+   VT ref( 3UL );
+   ref[0] = 1.0;
+   ref[1] = 2.0;
+   ref[2] = 3.0;
+
+
+   //=====================================================================================
+   // Lower matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Lower matrix triangular solve";
+
+      blaze::LowerMatrix<MT> lower( 3UL );
+      lower(0,0) = 2.0;
+      lower(1,0) = 1.0;
+      lower(1,1) = 4.0;
+      lower(2,1) = 2.0;
+      lower(2,2) = 1.0;
+
+      const blaze::TriangularSolver< blaze::LowerMatrix<MT> > solver( lower );
+
+      if( solver.rows() != 3UL || solver.levels() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid level schedule detected\n"
+             << " Details:\n"
+             << "   Number of rows  : " << solver.rows() << "\n"
+             << "   Number of levels: " << solver.levels() << "\n"
+             << "   Expected rows   : 3\n"
+             << "   Expected levels : 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolve( lower, VT( lower * ref ), ref );
+   }
+
+
+   //=====================================================================================
+   // Upper matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Upper matrix triangular solve";
+
+      blaze::UpperMatrix<MT> upper( 3UL );
+      upper(0,0) = 2.0;
+      upper(0,2) = 1.0;
+      upper(1,1) = 4.0;
+      upper(1,2) = 2.0;
+      upper(2,2) = 1.0;
+
+      const blaze::TriangularSolver< blaze::UpperMatrix<MT> > solver( upper );
+
+      if( solver.rows() != 3UL || solver.levels() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid level schedule detected\n"
+             << " Details:\n"
+             << "   Number of rows  : " << solver.rows() << "\n"
+             << "   Number of levels: " << solver.levels() << "\n"
+             << "   Expected rows   : 3\n"
+             << "   Expected levels : 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolve( upper, VT( upper * ref ), ref );
+   }
+
+
+   //=====================================================================================
+   // Unilower matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Unilower matrix triangular solve";
+
+      blaze::UniLowerMatrix<MT> lower( 3UL );
+      lower(1,0) = 2.0;
+      lower(2,1) = 3.0;
+
+      checkSolve( lower, VT( lower * ref ), ref );
+   }
+
+
+   //=====================================================================================
+   // Uniupper matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Uniupper matrix triangular solve";
+
+      blaze::UniUpperMatrix<MT> upper( 3UL );
+      upper(0,1) = 2.0;
+      upper(1,2) = 3.0;
+
+      checkSolve( upper, VT( upper * ref ), ref );
+   }
+
+
+   //=====================================================================================
+   // Singular matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Singular matrix triangular solve";
+
+      blaze::LowerMatrix<MT> lower( 3UL );
+      lower(0,0) = 2.0;
+      lower(2,0) = 1.0;
+      lower(2,2) = 1.0;
+
+      try {
+         const blaze::TriangularSolver< blaze::LowerMatrix<MT> > solver( lower );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Level analysis of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << lower << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         VT x( 3UL );
+         solve( lower, x, ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular system succeeded\n"
+             << " Details:\n"
+             << "   Matrix:\n" << lower << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring-generic \c mxv() and \c mxm() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the semiring-generic sparse matrix/vector and sparse
+// matrix/sparse matrix multiplications for several semirings, both storage orders, dense
+// and sparse operands, and masked results. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSemiring()
+{
+   typedef blaze::CompressedMatrix<int,blaze::rowMajor>     MT;
+   typedef blaze::CompressedMatrix<int,blaze::columnMajor>  OMT;
+   typedef blaze::DynamicVector<int,blaze::columnVector>     DVT;
+   typedef blaze::CompressedVector<int,blaze::columnVector>  SVT;
+
+   // Directed graph with the edges 0->1 (4), 0->2 (1), 2->1 (2), 1->3 (1), 2->3 (5), and
+   // 4->0 (3), stored as transposed weight matrix (W(i,j) for an edge j->i)
+   MT W( 5UL, 5UL );
+   W(1,0) = 4;
+   W(2,0) = 1;
+   W(1,2) = 2;
+   W(3,1) = 1;
+   W(3,2) = 5;
+   W(0,4) = 3;
+
+   const OMT TW( W );
+
+
+   //=====================================================================================
+   // Plus-times semiring tests
+   //=====================================================================================
+
+   {
+      test_ = "Plus-times semiring matrix/vector multiplication";
+
+      DVT x( 5UL );
+      for( size_t i=0UL; i<5UL; ++i )
+         x[i] = int( i ) + 1;
+
+      SVT sx( 5UL );
+      sx[1] = 2;
+      sx[2] = 3;
+
+      const DVT ref1( W * x  );
+      const DVT ref2( W * sx );
+
+      DVT y1( 5UL ), y2( 5UL ), y3( 5UL );
+      SVT y4( 5UL );
+
+      blaze::mxv( y1, W , x , blaze::PlusTimes<int>() );
+      blaze::mxv( y2, TW, x , blaze::PlusTimes<int>() );
+      blaze::mxv( y3, W , sx, blaze::PlusTimes<int>() );
+      blaze::mxv( y4, TW, sx, blaze::PlusTimes<int>() );
+
+      if( y1 != ref1 || y2 != ref1 || y3 != ref2 || y4 != ref2 || nonZeros( y4 ) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Semiring multiplication failed\n"
+             << " Details:\n"
+             << "   Result (row-major, dense):\n" << y1 << "\n"
+             << "   Result (column-major, dense):\n" << y2 << "\n"
+             << "   Result (row-major, sparse):\n" << y3 << "\n"
+             << "   Result (column-major, sparse):\n" << y4 << "\n"
+             << "   Expected result (dense):\n" << ref1 << "\n"
+             << "   Expected result (sparse):\n" << ref2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Plus-times semiring matrix/matrix multiplication";
+
+      MT C;
+      blaze::mxm( C, W, W, blaze::PlusTimes<int>() );
+
+      const MT ref( W * W );
+
+      if( C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Semiring multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Min-plus semiring tests
+   //=====================================================================================
+
+   {
+      test_ = "Min-plus semiring shortest paths (Bellman-Ford)";
+
+      const int inf( blaze::Limits<int>::inf() );
+
+      // Adding zero-weight self loops to preserve the current distances
+      MT A( W );
+      for( size_t i=0UL; i<5UL; ++i )
+         A.insert( i, i, 0 );
+      const OMT TA( A );
+
+      DVT d1( 5UL, inf ), d2( 5UL, inf );
+      d1[0] = 0;
+      d2[0] = 0;
+
+      for( size_t k=0UL; k<4UL; ++k ) {
+         blaze::mxv( d1, A , d1, blaze::MinPlus<int>() );
+         blaze::mxv( d2, TA, d2, blaze::MinPlus<int>() );
+      }
+
+      if( d1[0] != 0 || d1[1] != 3 || d1[2] != 1 || d1[3] != 4 || d1[4] != inf || d2 != d1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shortest path computation failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << d1 << "\n"
+             << "   Result (column-major):\n" << d2 << "\n"
+             << "   Expected result:\n( 0 3 1 4 inf )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Min-plus semiring matrix/matrix multiplication";
+
+      MT C( W );
+      blaze::mxm( C, C, C, blaze::MinPlus<int>() );
+
+      // Two-hop paths: 0->2->1 (3), 0->1->3 (5), 0->2->3 (6), 2->1->3 (3), 4->0->1 (7),
+      // and 4->0->2 (4)
+      if( C.nonZeros() != 5UL || C(1,0) != 3 || C(3,0) != 5 || C(3,2) != 3 ||
+          C(1,4) != 7 || C(2,4) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Semiring multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Max-times and max-min semiring tests
+   //=====================================================================================
+
+   {
+      test_ = "Max-times and max-min semiring matrix/vector multiplication";
+
+      SVT x( 5UL );
+      x[0] = 2;
+      x[2] = 3;
+
+      SVT y1( 5UL ), y2( 5UL );
+      blaze::mxv( y1, W, x, blaze::MaxTimes<int>() );
+      blaze::mxv( y2, W, x, blaze::MaxMin<int>() );
+
+      // Row 1: max( 4*2, 2*3 ) and max( min(4,2), min(2,3) ); row 2: 1*2 and min(1,2);
+      // row 3: 5*3 and min(5,3)
+      if( nonZeros( y1 ) != 3UL || y1[1] != 8 || y1[2] != 2 || y1[3] != 15 ||
+          nonZeros( y2 ) != 3UL || y2[1] != 2 || y2[2] != 1 || y2[3] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Semiring multiplication failed\n"
+             << " Details:\n"
+             << "   Result (max-times):\n" << y1 << "\n"
+             << "   Result (max-min):\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Or-and semiring tests
+   //=====================================================================================
+
+   {
+      test_ = "Or-and semiring breadth-first search with complemented mask";
+
+      blaze::DynamicVector<size_t,blaze::columnVector> levels( 5UL, 0UL );
+      blaze::DynamicVector<int,blaze::columnVector> visited( 5UL, 0 );
+      SVT frontier( 5UL ), next( 5UL );
+
+      frontier[4] = 1;
+      visited[4]  = 1;
+
+      for( size_t level=1UL; nonZeros( frontier ) > 0UL; ++level ) {
+         blaze::mxv( next, visited, TW, frontier, blaze::OrAnd<int>(), true );
+         for( SVT::ConstIterator element=next.begin(); element!=next.end(); ++element ) {
+            levels[element->index()]  = level;
+            visited[element->index()] = 1;
+         }
+         swap( frontier, next );
+      }
+
+      if( levels[0] != 1UL || levels[1] != 2UL || levels[2] != 2UL || levels[3] != 3UL ||
+          levels[4] != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Breadth-first search failed\n"
+             << " Details:\n"
+             << "   Result:\n" << levels << "\n"
+             << "   Expected result:\n( 1 2 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Or-and semiring matrix/vector multiplication with mask";
+
+      SVT frontier( 5UL );
+      frontier[0] = 1;
+
+      SVT mask( 5UL );
+      mask[1] = 1;
+      mask[3] = 1;
+
+      SVT y1( 5UL );
+      DVT y2( 5UL, 7 );
+      blaze::mxv( y1, mask, W , frontier, blaze::OrAnd<int>() );
+      blaze::mxv( y2, mask, TW, frontier, blaze::OrAnd<int>() );
+
+      if( nonZeros( y1 ) != 1UL || y1[1] != 1 ||
+          y2[0] != 0 || y2[1] != 1 || y2[2] != 0 || y2[3] != 0 || y2[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked semiring multiplication failed\n"
+             << " Details:\n"
+             << "   Result (sparse):\n" << y1 << "\n"
+             << "   Result (dense):\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Masked matrix/matrix multiplication tests
+   //=====================================================================================
+
+   {
+      test_ = "Masked plus-times semiring matrix/matrix multiplication (triangle counting)";
+
+      // Strictly lower adjacency matrix of an undirected graph with the triangles (0,1,2)
+      // and (1,2,3) and the additional edge (3,4)
+      MT L( 5UL, 5UL );
+      L(1,0) = 1;
+      L(2,0) = 1;
+      L(2,1) = 1;
+      L(3,1) = 1;
+      L(3,2) = 1;
+      L(4,3) = 1;
+
+      MT C, D;
+      blaze::mxm( C, L, L, L, blaze::PlusTimes<int>() );
+      blaze::mxm( D, L, L, L, blaze::PlusTimes<int>(), true );
+
+      int triangles( 0 );
+      for( size_t i=0UL; i<C.rows(); ++i ) {
+         for( MT::ConstIterator element=C.begin(i); element!=C.end(i); ++element )
+            triangles += element->value();
+      }
+
+      const MT ref( L * L );
+
+      if( triangles != 2 || C.nonZeros() != 2UL || D.nonZeros() + C.nonZeros() != ref.nonZeros() ||
+          D(4,2) != 1 || D(4,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Masked semiring multiplication failed\n"
+             << " Details:\n"
+             << "   Number of triangles: " << triangles << " (expected 2)\n"
+             << "   Result (mask):\n" << C << "\n"
+             << "   Result (complemented mask):\n" << D << "\n"
+             << "   Unmasked result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Size mismatch tests
+   //=====================================================================================
+
+   {
+      test_ = "Semiring multiplication with mismatching sizes";
+
+      try {
+         DVT x( 4UL ), y( 5UL );
+         blaze::mxv( y, W, x, blaze::PlusTimes<int>() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with mismatching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace sparsematrix
 
 } // namespace mathtest
@@ -41,6 +41,8 @@
 #include <iostream>
 #include <blaze/math/sparse/SparseVector.h>
 #include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
 #include <blazetest/mathtest/sparsevector/OperationTest.h>
 
 
@@ -69,6 +71,7 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testIntersection();
 }
 //*************************************************************************************************
 
@@ -577,6 +580,74 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the intersection and union of the index sets of two sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the inner product, the componentwise product, and the
+// addition of two sparse vectors with both balanced and very skewed numbers of non-zero
+// elements. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testIntersection()
+{
+   test_ = "Sparse vector index intersection";
+
+   const size_t size( 1000UL );
+   const size_t nonzeros[3] = { 3UL, 40UL, 700UL };
+
+   for( size_t k1=0UL; k1<3UL; ++k1 ) {
+      for( size_t k2=0UL; k2<3UL; ++k2 )
+      {
+         blaze::CompressedVector<int,blaze::columnVector> a( size ), b( size );
+         blaze::DynamicVector<int,blaze::columnVector> da( size, 0 ), db( size, 0 );
+
+         for( size_t i=0UL; i<nonzeros[k1]; ++i ) {
+            const size_t index( blaze::rand<size_t>( 0UL, size-1UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            a[index]  = value;
+            da[index] = value;
+         }
+         for( size_t i=0UL; i<nonzeros[k2]; ++i ) {
+            const size_t index( blaze::rand<size_t>( 0UL, size-1UL ) );
+            const int value( blaze::rand<int>( 1, 10 ) );
+            b[index]  = value;
+            db[index] = value;
+         }
+
+         const int dot( trans( a ) * b );
+         const int ref( trans( da ) * db );
+
+         if( dot != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product failed\n"
+                << " Details:\n"
+                << "   Non-zeros: " << a.nonZeros() << " / " << b.nonZeros() << "\n"
+                << "   Result: " << dot << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::CompressedVector<int,blaze::columnVector> prod( a * b );
+         const blaze::CompressedVector<int,blaze::columnVector> sum ( a + b );
+
+         if( prod != da * db || sum != da + db ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Componentwise operation failed\n"
+                << " Details:\n"
+                << "   Non-zeros: " << a.nonZeros() << " / " << b.nonZeros() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace sparsevector
 
 } // namespace mathtest
@@ -0,0 +1,1480 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/splitcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the SplitCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/splitcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace splitcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SplitCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testInsert();
+   testErase();
+   testResize();
+   testReserve();
+   testTrim();
+   testAppend();
+   testDataAccess();
+   testTranspose();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+   testIndexType();
+   testIndexRange();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SplitCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SplitCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SplitCompressedMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major SplitCompressedMatrix size constructor (3x4, 5)";
+
+      MT mat( 3UL, 4UL, 5UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major SplitCompressedMatrix size constructor (3x4, {2,0,3})";
+
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 2UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 3UL;
+      MT mat( 3UL, 4UL, nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 2UL, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major copy and conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major SplitCompressedMatrix copy/conversion constructors";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 5UL, 7UL );
+      blaze::randomize( ref, 12UL, -9, 9 );
+
+      const MT mat1( ref );
+      checkMatrix( mat1, ref );
+
+      const MT mat2( mat1 );
+      checkMatrix( mat2, ref );
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> dense( ref );
+      const MT mat3( dense );
+      checkMatrix( mat3, ref );
+
+      const OMT mat4( mat1 );
+      checkMatrix( mat4, ref );
+
+      const MT mat5( mat4 );
+      checkMatrix( mat5, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major SplitCompressedMatrix size constructor (3x4, {2,0,3,1})";
+
+      std::vector<size_t> nonzeros( 4UL );
+      nonzeros[0] = 2UL;
+      nonzeros[1] = 0UL;
+      nonzeros[2] = 3UL;
+      nonzeros[3] = 1UL;
+      OMT mat( 3UL, 4UL, nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 6UL );
+      checkCapacity( mat, 2UL, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix copy/conversion constructors";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 7UL, 5UL );
+      blaze::randomize( ref, 12UL, -9, 9 );
+
+      const OMT mat1( ref );
+      checkMatrix( mat1, ref );
+
+      const OMT mat2( mat1 );
+      checkMatrix( mat2, ref );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> dense( ref );
+      const OMT mat3( dense );
+      checkMatrix( mat3, ref );
+
+      const MT mat4( mat1 );
+      checkMatrix( mat4, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SplitCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 5UL );
+      blaze::randomize( ref, 10UL, -9, 9 );
+
+      const MT mat1( ref );
+      MT mat2( 2UL, 2UL, 1UL );
+      mat2(0,1) = 3;
+      mat2 = mat1;
+      checkMatrix( mat2, ref );
+
+      MT mat3( 9UL, 9UL, 40UL );
+      mat3(8,8) = 1;
+      mat3 = mat1;
+      checkMatrix( mat3, ref );
+   }
+
+   {
+      test_ = "Row-major SplitCompressedMatrix dense/sparse assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 5UL );
+      blaze::randomize( ref, 10UL, -9, 9 );
+
+      MT mat;
+      mat = blaze::DynamicMatrix<int,blaze::rowMajor>( ref );
+      checkMatrix( mat, ref );
+
+      mat = blaze::CompressedMatrix<int,blaze::columnMajor>( ref );
+      checkMatrix( mat, ref );
+
+      mat = ref;
+      checkMatrix( mat, ref );
+   }
+
+   {
+      test_ = "Row-major SplitCompressedMatrix addition/subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref1( 6UL, 5UL ), ref2( 6UL, 5UL );
+      blaze::randomize( ref1, 10UL, -9, 9 );
+      blaze::randomize( ref2, 10UL, -9, 9 );
+
+      MT mat( ref1 );
+      mat += ref2;
+      checkMatrix( mat, ref1 + ref2 );
+
+      mat -= OMT( ref2 );
+      checkMatrix( mat, ref1 );
+
+      mat += blaze::DynamicMatrix<int,blaze::rowMajor>( ref2 );
+      checkMatrix( mat, ref1 + ref2 );
+
+      mat -= blaze::DynamicMatrix<int,blaze::columnMajor>( ref1 );
+      checkMatrix( mat, ref2 );
+   }
+
+   {
+      test_ = "Row-major SplitCompressedMatrix scaling assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 5UL );
+      blaze::randomize( ref, 10UL, -9, 9 );
+
+      MT mat( ref );
+      mat *= 3;
+      checkMatrix( mat, ref * 3 );
+
+      mat /= 3;
+      checkMatrix( mat, ref );
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref1( 6UL, 5UL ), ref2( 6UL, 5UL );
+      blaze::randomize( ref1, 10UL, -9, 9 );
+      blaze::randomize( ref2, 10UL, -9, 9 );
+
+      OMT mat;
+      mat = ref1;
+      checkMatrix( mat, ref1 );
+
+      mat = MT( ref2 );
+      checkMatrix( mat, ref2 );
+
+      mat += ref1;
+      checkMatrix( mat, ref1 + ref2 );
+
+      mat -= blaze::DynamicMatrix<int,blaze::rowMajor>( ref2 );
+      checkMatrix( mat, ref1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the SplitCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix::operator()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 5UL );
+      MT mat( 3UL, 5UL );
+
+      ref(2,1) = 1;  mat(2,1) = 1;
+      ref(1,4) = 2;  mat(1,4) = 2;
+      ref(0,3) = 3;  mat(0,3) = 3;
+      ref(2,2) = 4;  mat(2,2) = 4;
+      ref(2,1) += 5; mat(2,1) += 5;
+      ref(2,0) = 6;  mat(2,0) = 6;
+      ref(0,3) -= 3; mat(0,3) -= 3;
+      checkMatrix( mat, ref );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix::operator()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 3UL, 5UL );
+      OMT mat( 3UL, 5UL );
+
+      ref(2,1) = 1;  mat(2,1) = 1;
+      ref(1,4) = 2;  mat(1,4) = 2;
+      ref(0,1) = 3;  mat(0,1) = 3;
+      ref(2,2) = 4;  mat(2,2) = 4;
+      ref(0,1) *= 5; mat(0,1) *= 5;
+      checkMatrix( mat, ref );
+      checkNonZeros( mat, 1UL, 2UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   test_ = "SplitCompressedMatrix iterator";
+
+   MT mat( 3UL, 6UL );
+   mat(0,1) = 1;
+   mat(0,4) = 2;
+   mat(0,5) = 3;
+   mat(2,0) = 4;
+
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   // Counting the number of elements in row 0 via Iterator and ConstIterator
+   {
+      const ptrdiff_t number( mat.end(0) - mat.begin(0) );
+      const ptrdiff_t cnumber( mat.cend(0) - mat.cbegin(0) );
+
+      if( number != 3L || cnumber != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << " / " << cnumber << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Traversal and modification via Iterator, conversion to ConstIterator
+   {
+      size_t sum( 0UL );
+      for( Iterator it=mat.begin(0); it!=mat.end(0); ++it ) {
+         it->value() *= 2;
+         sum += it->index();
+      }
+
+      ConstIterator it( mat.begin(0) );
+      ++it;
+
+      if( sum != 10UL || it->value() != 4 || it->index() != 4UL ||
+          (*it).value() != 4 || it == mat.cbegin(0) || mat.cend(1) != mat.cbegin(1) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator traversal failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SplitCompressedMatrix::nonZeros()";
+
+   MT mat( 2UL, 3UL, 6UL );
+   checkNonZeros( mat, 0UL );
+
+   mat(0,0) = 1;
+   mat(0,2) = 2;
+   mat(1,1) = 3;
+
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 1UL );
+
+   mat.reset( 0UL );
+   checkNonZeros( mat, 1UL );
+   checkNonZeros( mat, 0UL, 0UL );
+
+   reset( mat );
+   checkRows    ( mat, 2UL );
+   checkColumns ( mat, 3UL );
+   checkNonZeros( mat, 0UL );
+
+   clear( mat );
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() and \c insert() member functions of the SplitCompressedMatrix class
+//        template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() and \c insert() member functions of the
+// SplitCompressedMatrix class template. Elements are inserted in random order into matrices
+// with and without free capacity. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix::set()/insert()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 9UL, 11UL );
+      MT mat( 9UL, 11UL );
+
+      for( size_t k=0UL; k<60UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 8UL  ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 10UL ) );
+         const int value( blaze::rand<int>( 1, 9 ) );
+         ref.set( i, j, value );
+         mat.set( i, j, value );
+      }
+
+      checkMatrix( mat, ref );
+
+      try {
+         const size_t i( ref.begin(0) != ref.end(0) ? 0UL : 1UL );
+         mat.insert( i, ref.begin(i)->index(), 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix::set()/insert()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 11UL, 9UL );
+      OMT mat( 11UL, 9UL, 100UL );
+
+      for( size_t k=0UL; k<60UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 10UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 8UL  ) );
+         if( ref.find( i, j ) == ref.end( j ) ) {
+            const int value( blaze::rand<int>( 1, 9 ) );
+            ref.insert( i, j, value );
+            mat.insert( i, j, value );
+         }
+      }
+
+      checkMatrix( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix::erase( size_t, size_t )";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 8UL );
+      blaze::randomize( ref, 25UL, 1, 9 );
+      MT mat( ref );
+
+      for( size_t k=0UL; k<30UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 5UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 7UL ) );
+         ref.erase( i, j );
+         mat.erase( i, j );
+      }
+
+      checkMatrix( mat, ref );
+   }
+
+   {
+      test_ = "Row-major SplitCompressedMatrix::erase( size_t, Iterator )";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 8UL );
+      blaze::randomize( ref, 25UL, 1, 9 );
+      MT mat( ref );
+
+      for( size_t i=0UL; i<6UL; ++i ) {
+         MT::Iterator pos( mat.lowerBound( i, 3UL ) );
+         if( pos != mat.end(i) ) {
+            pos = mat.erase( i, pos );
+            ref.erase( i, ref.lowerBound( i, 3UL ) );
+         }
+         if( pos != mat.end(i) && pos->index() != ref.lowerBound( i, 3UL )->index() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator returned\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkMatrix( mat, ref );
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix::erase( size_t, Iterator, Iterator )";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 8UL, 6UL );
+      blaze::randomize( ref, 25UL, 1, 9 );
+      OMT mat( ref );
+
+      for( size_t j=0UL; j<6UL; ++j ) {
+         mat.erase( j, mat.lowerBound( 2UL, j ), mat.upperBound( 5UL, j ) );
+         ref.erase( j, ref.lowerBound( 2UL, j ), ref.upperBound( 5UL, j ) );
+      }
+
+      checkMatrix( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix::resize()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 8UL );
+      blaze::randomize( ref, 25UL, 1, 9 );
+      MT mat( ref );
+
+      mat.resize( 9UL, 10UL );
+      ref.resize( 9UL, 10UL );
+      checkMatrix( mat, ref );
+
+      mat.resize( 4UL, 5UL );
+      ref.resize( 4UL, 5UL );
+      checkMatrix( mat, ref );
+
+      mat.resize( 2UL, 7UL, false );
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 7UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix::resize()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 6UL, 8UL );
+      blaze::randomize( ref, 25UL, 1, 9 );
+      OMT mat( ref );
+
+      mat.resize( 3UL, 11UL );
+      ref.resize( 3UL, 11UL );
+      checkMatrix( mat, ref );
+
+      mat.resize( 7UL, 2UL );
+      ref.resize( 7UL, 2UL );
+      checkMatrix( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member functions of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() member functions of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "SplitCompressedMatrix::reserve()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 5UL, 6UL );
+   blaze::randomize( ref, 12UL, 1, 9 );
+   MT mat( ref );
+
+   mat.reserve( 30UL );
+   checkCapacity( mat, 30UL );
+   checkMatrix( mat, ref );
+
+   mat.reserve( 2UL, 10UL );
+   checkCapacity( mat, 2UL, 10UL );
+   checkMatrix( mat, ref );
+
+   mat.reserve( 4UL, 50UL );
+   checkCapacity( mat, 4UL, 50UL );
+   checkMatrix( mat, ref );
+
+   for( size_t j=0UL; j<6UL; ++j ) {
+      mat.set( 2UL, j, 1 );
+      ref.set( 2UL, j, 1 );
+   }
+   checkMatrix( mat, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c trim() member functions of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c trim() member functions of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTrim()
+{
+   test_ = "SplitCompressedMatrix::trim()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 5UL, 6UL );
+   blaze::randomize( ref, 12UL, 1, 9 );
+   MT mat( ref );
+
+   mat.reserve( 1UL, 10UL );
+   mat.reserve( 3UL, 10UL );
+
+   mat.trim( 1UL );
+   checkCapacity( mat, 1UL, mat.nonZeros( 1UL ) );
+   checkMatrix( mat, ref );
+
+   if( mat.capacity( 1UL ) != mat.nonZeros( 1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Trimming row 1 failed\n"
+          << " Details:\n"
+          << "   Capacity: " << mat.capacity( 1UL ) << "\n"
+          << "   Expected: " << mat.nonZeros( 1UL ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.trim();
+   checkMatrix( mat, ref );
+
+   for( size_t i=0UL; i<5UL; ++i ) {
+      if( mat.capacity( i ) != mat.nonZeros( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Trimming the matrix failed\n"
+             << " Details:\n"
+             << "   Row     : " << i << "\n"
+             << "   Capacity: " << mat.capacity( i ) << "\n"
+             << "   Expected: " << mat.nonZeros( i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() and \c finalize() member functions of the SplitCompressedMatrix
+//        class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() and \c finalize() member functions of the
+// SplitCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix::append()";
+
+      MT mat( 4UL, 5UL, 6UL );
+      mat.append( 0UL, 1UL, 1 );
+      mat.append( 0UL, 3UL, 2 );
+      mat.finalize( 0UL );
+      mat.finalize( 1UL );
+      mat.append( 2UL, 0UL, 3 );
+      mat.append( 2UL, 2UL, 0, true );
+      mat.append( 2UL, 4UL, 4 );
+      mat.finalize( 2UL );
+      mat.append( 3UL, 4UL, 5 );
+      mat.finalize( 3UL );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 4UL, 5UL );
+      ref(0,1) = 1;
+      ref(0,3) = 2;
+      ref(2,0) = 3;
+      ref(2,4) = 4;
+      ref(3,4) = 5;
+
+      checkMatrix( mat, ref );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix::append()";
+
+      OMT mat( 5UL, 3UL, 4UL );
+      mat.append( 1UL, 0UL, 1 );
+      mat.append( 4UL, 0UL, 2 );
+      mat.finalize( 0UL );
+      mat.append( 0UL, 1UL, 3 );
+      mat.finalize( 1UL );
+      mat.append( 2UL, 2UL, 4 );
+      mat.finalize( 2UL );
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 5UL, 3UL );
+      ref(1,0) = 1;
+      ref(4,0) = 2;
+      ref(0,1) = 3;
+      ref(2,2) = 4;
+
+      checkMatrix( mat, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the low-level data access functions of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c values() and \c indices() member functions of the
+// SplitCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDataAccess()
+{
+   test_ = "SplitCompressedMatrix::values()/indices()";
+
+   blaze::CompressedMatrix<int,blaze::columnMajor> ref( 7UL, 6UL );
+   blaze::randomize( ref, 20UL, 1, 9 );
+   OMT mat( ref );
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const int*    values ( mat.values( j ) );
+      const size_t* indices( mat.indices( j ) );
+
+      size_t k( 0UL );
+      for( blaze::CompressedMatrix<int,blaze::columnMajor>::ConstIterator element=ref.begin(j);
+           element!=ref.end(j); ++element, ++k )
+      {
+         if( k >= mat.nonZeros( j ) || values[k] != element->value() || indices[k] != element->index() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid data access\n"
+                << " Details:\n"
+                << "   Column : " << j << "\n"
+                << "   Element: " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      checkNonZeros( mat, j, k );
+   }
+
+   mat.values( 0UL )[0] = 42;
+   if( mat.begin( 0UL ) != mat.end( 0UL ) && mat.begin( 0UL )->value() != 42 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Writing via values() failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c transpose() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c transpose() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   test_ = "SplitCompressedMatrix::transpose()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 5UL, 8UL );
+   blaze::randomize( ref, 15UL, 1, 9 );
+
+   MT mat( ref );
+   mat.transpose();
+   checkMatrix( mat, blaze::CompressedMatrix<int,blaze::rowMajor>( trans( ref ) ) );
+
+   const TMT tmat( trans( ref ) );
+   checkMatrix( tmat, blaze::CompressedMatrix<int,blaze::rowMajor>( trans( ref ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SplitCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SplitCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref1( 3UL, 4UL ), ref2( 5UL, 2UL );
+   blaze::randomize( ref1, 6UL, 1, 9 );
+   blaze::randomize( ref2, 4UL, 1, 9 );
+
+   MT mat1( ref1 );
+   MT mat2( ref2 );
+
+   swap( mat1, mat2 );
+
+   checkMatrix( mat1, ref2 );
+   checkMatrix( mat2, ref1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SplitCompressedMatrix::find()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 7UL );
+   blaze::randomize( ref, 15UL, 1, 9 );
+   const MT mat( ref );
+
+   for( size_t i=0UL; i<6UL; ++i ) {
+      for( size_t j=0UL; j<7UL; ++j )
+      {
+         const MT::ConstIterator pos( mat.find( i, j ) );
+         const bool found( ref.find( i, j ) != ref.end( i ) );
+
+         if( ( pos != mat.end( i ) ) != found ||
+             ( found && ( pos->index() != j || pos->value() != ref(i,j) ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element (" << i << "," << j << ") could not be found\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SplitCompressedMatrix::lowerBound()";
+
+   blaze::CompressedMatrix<int,blaze::columnMajor> ref( 7UL, 6UL );
+   blaze::randomize( ref, 15UL, 1, 9 );
+   const OMT mat( ref );
+
+   for( size_t j=0UL; j<6UL; ++j ) {
+      for( size_t i=0UL; i<7UL; ++i ) {
+         if( mat.lowerBound( i, j ) - mat.begin( j ) != ref.lowerBound( i, j ) - ref.begin( j ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lower bound for element (" << i << "," << j << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SplitCompressedMatrix::upperBound()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 7UL );
+   blaze::randomize( ref, 15UL, 1, 9 );
+   const MT mat( ref );
+
+   for( size_t i=0UL; i<6UL; ++i ) {
+      for( size_t j=0UL; j<7UL; ++j ) {
+         if( mat.upperBound( i, j ) - mat.begin( i ) != ref.upperBound( i, j ) - ref.begin( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid upper bound for element (" << i << "," << j << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SplitCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SplitCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   MT mat1;
+   MT mat2( 2UL, 3UL );
+
+   if( isDefault( mat1 ) != true || isDefault( mat2 ) != false ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplications with SplitCompressedMatrix operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of sparse matrix/dense vector multiplications, which use the
+// vectorized split kernel for row-major matrices with floating point elements, as well as of
+// sparse matrix/sparse matrix multiplications. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix/dense vector multiplication";
+
+      const size_t M( 40UL );
+      const size_t N( 70UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> ref( M, N );
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; j+=blaze::rand<size_t>( 1UL, M-i ) ) {
+            ref(i,j) = blaze::rand<int>( -9, 9 );
+         }
+      }
+
+      const DMT mat( ref );
+
+      blaze::DynamicVector<double,blaze::columnVector> vec( N );
+      for( size_t j=0UL; j<N; ++j ) {
+         vec[j] = blaze::rand<int>( -9, 9 );
+      }
+
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * vec );
+      const blaze::DynamicVector<double,blaze::columnVector> exp( ref * vec );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major SplitCompressedMatrix/dense vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> ref( 20UL, 15UL );
+      blaze::randomize( ref, 60UL, -9.0, 9.0 );
+
+      const blaze::SplitCompressedMatrix<double,blaze::columnMajor> mat( ref );
+
+      blaze::DynamicVector<double,blaze::columnVector> vec( 15UL );
+      blaze::randomize( vec );
+
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * vec );
+      const blaze::DynamicVector<double,blaze::columnVector> exp( ref * vec );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SplitCompressedMatrix/SplitCompressedMatrix multiplication";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref1( 6UL, 8UL ), ref2( 8UL, 5UL );
+      blaze::randomize( ref1, 15UL, -9, 9 );
+      blaze::randomize( ref2, 15UL, -9, 9 );
+
+      const MT mat1( ref1 );
+      const MT mat2( ref2 );
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> res( mat1 * mat2 );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> exp( ref1 * ref2 );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedMatrix class template with 32-bit indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SplitCompressedMatrix class template with \c uint32_t
+// as index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   {
+      test_ = "Row-major SplitCompressedMatrix with 32-bit indices";
+
+      typedef blaze::SplitCompressedMatrix<int,blaze::rowMajor,blaze::uint32_t>  IMT;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 9UL, 13UL );
+      blaze::randomize( ref, 30UL, -9, 9 );
+
+      IMT mat( ref );
+      checkMatrix( mat, ref );
+
+      for( size_t k=0UL; k<20UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 8UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 12UL ) );
+         if( k % 3UL == 0UL ) {
+            mat.erase( i, j );
+            ref.erase( i, j );
+         }
+         else {
+            mat.set( i, j, static_cast<int>( k ) );
+            ref.set( i, j, static_cast<int>( k ) );
+         }
+      }
+      checkMatrix  ( mat, ref );
+      checkNonZeros( mat, ref.nonZeros() );
+
+      const blaze::uint32_t* indices( mat.indices( 4UL ) );
+      for( size_t k=0UL; k<mat.nonZeros( 4UL ); ++k ) {
+         if( mat.values( 4UL )[k] != ref( 4UL, indices[k] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid data access\n"
+                << " Details:\n"
+                << "   Element: " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      const blaze::SplitCompressedMatrix<int,blaze::columnMajor,blaze::uint32_t> tmat( mat );
+      checkMatrix( tmat, ref );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix with 32-bit indices/dense vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> ref( 30UL, 50UL );
+      for( size_t i=0UL; i<30UL; ++i ) {
+         for( size_t j=0UL; j<50UL; j+=blaze::rand<size_t>( 1UL, 30UL-i ) ) {
+            ref(i,j) = blaze::rand<int>( -9, 9 );
+         }
+      }
+
+      const blaze::SplitCompressedMatrix<double,blaze::rowMajor,blaze::uint32_t> mat( ref );
+
+      blaze::DynamicVector<double,blaze::columnVector> vec( 50UL );
+      for( size_t j=0UL; j<50UL; ++j ) {
+         vec[j] = blaze::rand<int>( -9, 9 );
+      }
+
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * vec );
+      const blaze::DynamicVector<double,blaze::columnVector> exp( ref * vec );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!rief Test of the range checks of the SplitCompressedMatrix index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the range checks for the dimensions and the capacity of a
+// SplitCompressedMatrix with 8-bit indices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   typedef blaze::SplitCompressedMatrix<int,blaze::rowMajor,blaze::uint8_t>     SmallIndexRMT;
+   typedef blaze::SplitCompressedMatrix<int,blaze::columnMajor,blaze::uint8_t>  SmallIndexCMT;
+
+   {
+      test_ = "SplitCompressedMatrix with 8-bit indices size constructor";
+
+      try {
+         SmallIndexRMT mat( 256UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a 256x3 matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         SmallIndexCMT mat( 3UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a 3x256 matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         SmallIndexRMT mat( 3UL, 3UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with capacity 256 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+
+      try {
+         std::vector<size_t> nonzeros( 2UL, 128UL );
+         SmallIndexRMT mat( 2UL, 200UL, nonzeros );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a matrix with capacity 256 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+
+      SmallIndexRMT mat( 255UL, 255UL, 255UL );
+
+      checkRows    ( mat, 255UL );
+      checkColumns ( mat, 255UL );
+      checkCapacity( mat, 255UL );
+   }
+
+   {
+      test_ = "SplitCompressedMatrix with 8-bit indices conversion constructor";
+
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 300UL );
+         SmallIndexRMT mat( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of a 3x300 matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> ref( 16UL, 16UL );
+         for( size_t i=0UL; i<16UL; ++i )
+            for( size_t j=0UL; j<16UL; ++j )
+               ref(i,j) = 1;
+         SmallIndexRMT mat( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of a matrix with 256 non-zero elements succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+   }
+
+   {
+      test_ = "SplitCompressedMatrix with 8-bit indices resize() and reserve()";
+
+      SmallIndexRMT mat( 2UL, 3UL );
+      mat(1,2) = 5;
+
+      try {
+         mat.resize( 256UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to a 256x3 matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         mat.reserve( 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving 256 elements succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+
+      try {
+         mat.reserve( 0UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving 256 elements in row 0 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 1UL );
+
+      if( mat(1,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix modified by failed operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SplitCompressedMatrix with 8-bit indices insert()";
+
+      SmallIndexRMT mat( 16UL, 16UL );
+
+      for( size_t i=0UL; i<16UL; ++i ) {
+         for( size_t j=0UL; j<16UL; ++j ) {
+            if( i == 15UL && j == 15UL ) break;
+            mat.insert( i, j, static_cast<int>( i*16UL+j ) );
+         }
+      }
+
+      try {
+         mat.insert( 15UL, 15UL, 255 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insertion of the 256th element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::length_error& ) {}
+
+      checkCapacity( mat, 255UL );
+      checkNonZeros( mat, 255UL );
+
+      const SmallIndexRMT& cmat( mat );
+
+      for( size_t i=0UL; i<16UL; ++i ) {
+         for( size_t j=0UL; j<16UL; ++j ) {
+            const int exp( ( i == 15UL && j == 15UL )?( 0 ):( static_cast<int>( i*16UL+j ) ) );
+            if( cmat(i,j) != exp ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Matrix modified by failed insertion\n"
+                   << " Details:\n"
+                   << "   Element: (" << i << "," << j << ")\n"
+                   << "   Result: " << cmat(i,j) << "\n"
+                   << "   Expected result: " << exp << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace splitcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SplitCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SPLITCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SplitCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,966 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/splitcompressedvector/ClassTest.cpp
+//  \brief Source file for the SplitCompressedVector class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SplitCompressedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/splitcompressedvector/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace splitcompressedvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SplitCompressedVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testSubscript();
+   testIterator();
+   testNonZeros();
+   testInsert();
+   testAppend();
+   testErase();
+   testResize();
+   testReserve();
+   testDataAccess();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testMultiplication();
+   testIntersection();
+   testIndexType();
+   testIndexRange();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SplitCompressedVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "SplitCompressedVector default constructor";
+
+      VT vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "SplitCompressedVector size constructor";
+
+      VT vec( 5UL );
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "SplitCompressedVector size/capacity constructor";
+
+      VT vec( 5UL, 3UL );
+
+      checkSize    ( vec, 5UL );
+      checkCapacity( vec, 3UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "SplitCompressedVector copy/conversion constructors";
+
+      blaze::CompressedVector<int,blaze::rowVector> ref( 12UL );
+      blaze::randomize( ref, 5UL, -9, 9 );
+
+      const VT vec1( ref );
+      checkVector( vec1, ref );
+
+      const VT vec2( vec1 );
+      checkVector( vec2, ref );
+
+      const blaze::DynamicVector<int,blaze::rowVector> dense( ref );
+      const VT vec3( dense );
+      checkVector( vec3, ref );
+      checkNonZeros( vec3, ref.nonZeros() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SplitCompressedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SplitCompressedVector copy/dense/sparse assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> ref( 15UL );
+      blaze::randomize( ref, 6UL, -9, 9 );
+
+      VT vec1( 3UL, 1UL );
+      vec1[1] = 4;
+      vec1 = VT( ref );
+      checkVector( vec1, ref );
+
+      VT vec2( 20UL, 20UL );
+      vec2[17] = 1;
+      vec2 = vec1;
+      checkVector( vec2, ref );
+
+      VT vec3;
+      vec3 = blaze::DynamicVector<int,blaze::rowVector>( ref );
+      checkVector( vec3, ref );
+
+      vec3 = ref;
+      checkVector( vec3, ref );
+   }
+
+   {
+      test_ = "SplitCompressedVector addition/subtraction/multiplication assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> ref1( 15UL ), ref2( 15UL );
+      blaze::randomize( ref1, 6UL, -9, 9 );
+      blaze::randomize( ref2, 6UL, -9, 9 );
+
+      VT vec( ref1 );
+      vec += ref2;
+      checkVector( vec, ref1 + ref2 );
+
+      vec -= blaze::DynamicVector<int,blaze::rowVector>( ref2 );
+      checkVector( vec, ref1 );
+
+      vec *= VT( ref2 );
+      checkVector( vec, ref1 * ref2 );
+
+      vec = ref1;
+      vec *= 3;
+      checkVector( vec, ref1 * 3 );
+
+      vec /= 3;
+      checkVector( vec, ref1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector subscript operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the subscript operator
+// of the SplitCompressedVector class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubscript()
+{
+   test_ = "SplitCompressedVector::operator[]";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 7UL );
+   VT vec( 7UL );
+
+   ref[2] = 1;  vec[2] = 1;
+   ref[5] = 2;  vec[5] = 2;
+   ref[0] = 3;  vec[0] = 3;
+   ref[2] += 4; vec[2] += 4;
+   ref[6] = 5;  vec[6] = 5;
+   ref[5] -= 2; vec[5] -= 2;
+
+   checkVector  ( vec, ref );
+   checkNonZeros( vec, 3UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   test_ = "SplitCompressedVector iterator";
+
+   VT vec( 8UL );
+   vec[1] = 1;
+   vec[4] = 2;
+   vec[7] = 3;
+
+   typedef VT::Iterator       Iterator;
+   typedef VT::ConstIterator  ConstIterator;
+
+   size_t sum( 0UL );
+   for( Iterator it=vec.begin(); it!=vec.end(); ++it ) {
+      it->value() *= 2;
+      sum += it->index();
+   }
+
+   ConstIterator it( vec.begin() );
+   it += 2;
+
+   if( sum != 12UL || vec.cend() - vec.cbegin() != 3L || it->value() != 6 || it->index() != 7UL ||
+       (*--it).value() != 4 || it <= vec.cbegin() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Iterator traversal failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SplitCompressedVector::nonZeros()";
+
+   VT vec( 6UL, 4UL );
+   checkNonZeros( vec, 0UL );
+
+   vec[1] = 1;
+   vec[3] = 2;
+   checkNonZeros( vec, 2UL );
+
+   reset( vec );
+   checkSize    ( vec, 6UL );
+   checkNonZeros( vec, 0UL );
+
+   vec[2] = 5;
+   clear( vec );
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() and \c insert() member functions of the SplitCompressedVector class
+//        template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() and \c insert() member functions of the
+// SplitCompressedVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   test_ = "SplitCompressedVector::set()/insert()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 40UL );
+   VT vec( 40UL );
+
+   for( size_t k=0UL; k<40UL; ++k ) {
+      const size_t index( blaze::rand<size_t>( 0UL, 39UL ) );
+      const int value( blaze::rand<int>( 1, 9 ) );
+      if( k % 2UL == 0UL ) {
+         ref.set( index, value );
+         vec.set( index, value );
+      }
+      else if( ref.find( index ) == ref.end() ) {
+         ref.insert( index, value );
+         vec.insert( index, value );
+      }
+   }
+
+   checkVector  ( vec, ref );
+   checkNonZeros( vec, ref.nonZeros() );
+
+   try {
+      vec.insert( vec.begin()->index(), 1 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inserting an existing element succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "SplitCompressedVector::append()";
+
+   VT vec( 9UL, 4UL );
+   vec.append( 1UL, 1 );
+   vec.append( 3UL, 0, true );
+   vec.append( 4UL, 2 );
+   vec.append( 8UL, 3 );
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 9UL );
+   ref[1] = 1;
+   ref[4] = 2;
+   ref[8] = 3;
+
+   checkVector  ( vec, ref );
+   checkNonZeros( vec, 3UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   test_ = "SplitCompressedVector::erase()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 30UL );
+   blaze::randomize( ref, 20UL, 1, 9 );
+   VT vec( ref );
+
+   for( size_t k=0UL; k<5UL; ++k ) {
+      const size_t index( blaze::rand<size_t>( 0UL, 29UL ) );
+      ref.erase( index );
+      vec.erase( index );
+   }
+   checkVector( vec, ref );
+
+   ref.erase( ref.lowerBound( 4UL ) );
+   vec.erase( vec.lowerBound( 4UL ) );
+   checkVector( vec, ref );
+
+   ref.erase( ref.lowerBound( 10UL ), ref.upperBound( 20UL ) );
+   vec.erase( vec.lowerBound( 10UL ), vec.upperBound( 20UL ) );
+   checkVector  ( vec, ref );
+   checkNonZeros( vec, ref.nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "SplitCompressedVector::resize()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 20UL );
+   blaze::randomize( ref, 10UL, 1, 9 );
+   VT vec( ref );
+
+   vec.resize( 30UL );
+   ref.resize( 30UL );
+   checkVector( vec, ref );
+
+   vec.resize( 8UL );
+   ref.resize( 8UL );
+   checkVector  ( vec, ref );
+   checkNonZeros( vec, ref.nonZeros() );
+
+   vec.resize( 12UL, false );
+   checkSize    ( vec, 12UL );
+   checkNonZeros( vec, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   test_ = "SplitCompressedVector::reserve()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 20UL );
+   blaze::randomize( ref, 6UL, 1, 9 );
+   VT vec( ref );
+
+   vec.reserve( 15UL );
+   checkCapacity( vec, 15UL );
+   checkVector  ( vec, ref );
+
+   vec.reserve( 5UL );
+   checkCapacity( vec, 15UL );
+   checkVector  ( vec, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the low-level data access functions of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c values() and \c indices() member functions of the
+// SplitCompressedVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDataAccess()
+{
+   test_ = "SplitCompressedVector::values()/indices()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 25UL );
+   blaze::randomize( ref, 9UL, 1, 9 );
+   VT vec( ref );
+
+   const int*    values ( vec.values()  );
+   const size_t* indices( vec.indices() );
+
+   size_t k( 0UL );
+   for( blaze::CompressedVector<int,blaze::rowVector>::ConstIterator element=ref.begin();
+        element!=ref.end(); ++element, ++k )
+   {
+      if( values[k] != element->value() || indices[k] != element->index() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid data access\n"
+             << " Details:\n"
+             << "   Element: " << k << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkNonZeros( vec, k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SplitCompressedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SplitCompressedVector swap";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref1( 10UL ), ref2( 6UL );
+   blaze::randomize( ref1, 4UL, 1, 9 );
+   blaze::randomize( ref2, 2UL, 1, 9 );
+
+   VT vec1( ref1 );
+   VT vec2( ref2 );
+
+   swap( vec1, vec2 );
+
+   checkVector( vec1, ref2 );
+   checkVector( vec2, ref1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SplitCompressedVector::find()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 20UL );
+   blaze::randomize( ref, 8UL, 1, 9 );
+   const VT vec( ref );
+
+   for( size_t i=0UL; i<20UL; ++i )
+   {
+      const VT::ConstIterator pos( vec.find( i ) );
+      const bool found( ref.find( i ) != ref.end() );
+
+      if( ( pos != vec.end() ) != found || ( found && ( pos->index() != i || pos->value() != ref[i] ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element " << i << " could not be found\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SplitCompressedVector::lowerBound()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 20UL );
+   blaze::randomize( ref, 8UL, 1, 9 );
+   const VT vec( ref );
+
+   for( size_t i=0UL; i<20UL; ++i ) {
+      if( vec.lowerBound( i ) - vec.begin() != ref.lowerBound( i ) - ref.begin() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound for index " << i << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SplitCompressedVector::upperBound()";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 20UL );
+   blaze::randomize( ref, 8UL, 1, 9 );
+   const VT vec( ref );
+
+   for( size_t i=0UL; i<20UL; ++i ) {
+      if( vec.upperBound( i ) - vec.begin() != ref.upperBound( i ) - ref.begin() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound for index " << i << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   VT vec1;
+   VT vec2( 3UL );
+
+   if( isDefault( vec1 ) != true || isDefault( vec2 ) != false ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplications with SplitCompressedVector operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the inner product and of the multiplication of a sparse
+// matrix with a SplitCompressedVector. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "SplitCompressedVector multiplication";
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 12UL );
+   blaze::randomize( ref, 6UL, -9, 9 );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> mat( 12UL, 5UL );
+   blaze::randomize( mat, 20UL, -9, 9 );
+
+   const VT vec( ref );
+   const blaze::DynamicVector<int,blaze::columnVector> dense( trans( ref ) );
+
+   const int dot1( vec * dense );
+   const int dot2( ref * dense );
+
+   const blaze::CompressedVector<int,blaze::rowVector> res( vec * mat );
+   const blaze::CompressedVector<int,blaze::rowVector> exp( ref * mat );
+
+   if( dot1 != dot2 || res != exp ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Inner product         : " << dot1 << "\n"
+          << "   Expected inner product: " << dot2 << "\n"
+          << "   Result:\n" << res << "\n"
+          << "   Expected result:\n" << exp << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the intersection of the index sets of two SplitCompressedVector operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the inner product and the componentwise product of two
+// SplitCompressedVector operands with 64-bit and 32-bit indices. The tests cover balanced
+// numbers of non-zero elements of sparse operands (block-wise comparison of the index arrays)
+// and of dense operands (element-wise merge) as well as very skewed numbers of non-zero elements
+// (galloping search). In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIntersection()
+{
+   test_ = "SplitCompressedVector index intersection";
+
+   typedef blaze::SplitCompressedVector<int,blaze::columnVector>                   LVT;
+   typedef blaze::SplitCompressedVector<int,blaze::columnVector,blaze::uint32_t>  IVT;
+
+   const size_t size( 1000UL );
+   const size_t nonzeros[4] = { 3UL, 40UL, 300UL, 900UL };
+
+   for( size_t k1=0UL; k1<4UL; ++k1 ) {
+      for( size_t k2=0UL; k2<4UL; ++k2 )
+      {
+         blaze::CompressedVector<int,blaze::columnVector> a( size ), b( size );
+         blaze::randomize( a, nonzeros[k1], 1, 9 );
+         blaze::randomize( b, nonzeros[k2], 1, 9 );
+
+         const blaze::DynamicVector<int,blaze::columnVector> da( a ), db( b );
+
+         const LVT la( a ), lb( b );
+         const IVT ia( a ), ib( b );
+
+         const int ref( trans( da ) * db );
+         const int dot1( trans( la ) * lb );
+         const int dot2( trans( ia ) * ib );
+
+         const blaze::DynamicVector<int,blaze::columnVector> exp( da * db );
+         const LVT res1( la * lb );
+         const IVT res2( ia * ib );
+
+         if( dot1 != ref || dot2 != ref || res1 != exp || res2 != exp ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Intersection failed\n"
+                << " Details:\n"
+                << "   Non-zeros             : " << a.nonZeros() << " / " << b.nonZeros() << "\n"
+                << "   Inner products        : " << dot1 << " / " << dot2 << "\n"
+                << "   Expected inner product: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector class template with 32-bit indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SplitCompressedVector class template with \c uint32_t
+// as index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   test_ = "SplitCompressedVector with 32-bit indices";
+
+   typedef blaze::SplitCompressedVector<int,blaze::rowVector,blaze::uint32_t>  IVT;
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 40UL );
+   blaze::randomize( ref, 12UL, -9, 9 );
+
+   IVT vec( ref );
+   checkVector( vec, ref );
+
+   for( size_t k=0UL; k<20UL; ++k ) {
+      const size_t index( blaze::rand<size_t>( 0UL, 39UL ) );
+      if( k % 3UL == 0UL ) {
+         vec.erase( index );
+         ref.erase( index );
+      }
+      else {
+         vec.set( index, static_cast<int>( k ) );
+         ref.set( index, static_cast<int>( k ) );
+      }
+   }
+   checkVector  ( vec, ref );
+   checkNonZeros( vec, ref.nonZeros() );
+
+   const blaze::uint32_t* indices( vec.indices() );
+   for( size_t k=0UL; k<vec.nonZeros(); ++k ) {
+      if( vec.values()[k] != ref[indices[k]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid data access\n"
+             << " Details:\n"
+             << "   Element: " << k << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   vec.resize( 25UL );
+   ref.resize( 25UL );
+   checkVector( vec, ref );
+
+   const IVT sum( vec + VT( ref ) );
+   checkVector( sum, ref * 2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the range checks of the SplitCompressedVector index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the range checks for the size of a SplitCompressedVector with
+// 8-bit indices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   typedef blaze::SplitCompressedVector<int,blaze::rowVector,blaze::uint8_t>  IVT;
+
+   {
+      test_ = "SplitCompressedVector with 8-bit indices size constructor";
+
+      try {
+         IVT vec( 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a vector of size 256 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         IVT vec( 300UL, 5UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of a vector of size 300 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CompressedVector<int,blaze::rowVector> ref( 256UL );
+         ref[255] = 1;
+         IVT vec( ref );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of a vector of size 256 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      IVT vec( 255UL );
+      vec[254] = 1;
+
+      checkSize    ( vec, 255UL );
+      checkNonZeros( vec, 1UL );
+   }
+
+   {
+      test_ = "SplitCompressedVector with 8-bit indices resize()";
+
+      IVT vec( 5UL );
+      vec[3] = 7;
+
+      try {
+         vec.resize( 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to a vector of size 256 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 1UL );
+
+      if( vec[3] != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Vector modified by failed resize operation\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace splitcompressedvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SplitCompressedVector class test..." << std::endl;
+
+   try
+   {
+      RUN_SPLITCOMPRESSEDVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SplitCompressedVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
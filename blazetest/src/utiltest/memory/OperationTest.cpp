@@ -42,6 +42,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <blaze/math/StaticVector.h>
+#include <blaze/system/HugePages.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Null.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
@@ -72,6 +73,7 @@ OperationTest::OperationTest()
    testBuiltinTypes();
    testClassTypes();
    testNullPointer();
+   testHugePages();
 }
 //*************************************************************************************************
 
@@ -287,6 +289,91 @@ void OperationTest::testNullPointer()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the huge page allocation mode.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the huge page backed allocation of large arrays. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testHugePages()
+{
+   // Small array
+   {
+      test_ = "Huge pages (small array)";
+
+      double* array = blaze::allocate<double>( number );
+
+      if( blaze::hugePageStatus( array ) != blaze::noHugePages ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Huge page backing of small array detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( array );
+   }
+
+   // Large array
+   {
+      test_ = "Huge pages (large array)";
+
+      const size_t size( blaze::hugePageThreshold / sizeof(double) + 1UL );
+
+      double* array = blaze::allocate<double>( size );
+
+      const size_t alignment( blaze::AlignmentOf<double>::value );
+      const size_t deviation( reinterpret_cast<size_t>( array ) % alignment );
+
+      if( deviation != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Expected alignment: " << alignment << "\n"
+             << "   Deviation         : " << deviation << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::HugePageStatus status( blaze::hugePageStatus( array ) );
+
+      if( ( !BLAZE_HUGE_PAGE_MODE && status != blaze::noHugePages ) ||
+          ( status != blaze::noHugePages && status != blaze::transparentHugePages &&
+            status != blaze::hugetlbPages ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid huge page status detected\n"
+             << " Details:\n"
+             << "   Status: " << status << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( BLAZE_HUGE_PAGE_MODE &&
+          ( reinterpret_cast<size_t>( array ) & ( blaze::hugePageSize - 1UL ) ) > 4096UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Array is not placed at the beginning of a huge page\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<size; ++i )
+         array[i] = static_cast<double>( i );
+
+      if( array[size-1UL] != static_cast<double>( size-1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array content detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( array );
+   }
+}
+//*************************************************************************************************
+
 } // namespace memory
 
 } // namespace utiltest
@@ -0,0 +1,445 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/memorypool/ClassTest.cpp
+//  \brief Source file for the MemoryPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <boost/bind.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/AlignmentCheck.h>
+#include <blazetest/utiltest/memorypool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace memorypool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MemoryPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testSingleThread();
+   testMultiThread();
+   testReusedAddress();
+   testAlignment();
+   testAllocator();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the memory pool within a single thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the allocation, deallocation, and recycling of objects by a single
+// thread. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSingleThread()
+{
+   test_ = "Single-threaded allocation";
+
+   Pool pool;
+   Pointers pointers( 1000UL );
+
+   allocateObjects( &pool, &pointers, 0UL, pointers.size() );
+
+   std::vector<void*> sorted( pointers );
+   std::sort( sorted.begin(), sorted.end() );
+
+   if( std::adjacent_find( sorted.begin(), sorted.end() ) != sorted.end() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Duplicate allocation detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   void* const last( pointers.back() );
+   pool.free( last );
+
+   if( pool.malloc() != last ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Released object has not been recycled\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   releaseObjects( &pool, &pointers, 0UL, pointers.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent use of the memory pool by several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent allocation and deallocation of objects by several threads,
+// including the release of objects that have been allocated by a different thread. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiThread()
+{
+   test_ = "Multi-threaded allocation";
+
+   const size_t threads( 4UL );
+   const size_t chunk  ( 5000UL );
+
+   Pool pool;
+   Pointers pointers( threads*chunk );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      boost::thread_group allocators;
+      for( size_t i=0UL; i<threads; ++i ) {
+         allocators.create_thread( boost::bind( &ClassTest::allocateObjects, &pool, &pointers,
+                                                i*chunk, (i+1UL)*chunk ) );
+      }
+      allocators.join_all();
+
+      std::vector<void*> sorted( pointers );
+      std::sort( sorted.begin(), sorted.end() );
+
+      if( std::adjacent_find( sorted.begin(), sorted.end() ) != sorted.end() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Duplicate allocation detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Releasing the objects allocated by the neighboring thread
+      boost::thread_group releasers;
+      for( size_t i=0UL; i<threads; ++i ) {
+         const size_t j( ( i+1UL ) % threads );
+         releasers.create_thread( boost::bind( &ClassTest::releaseObjects, &pool, &pointers,
+                                               j*chunk, (j+1UL)*chunk ) );
+      }
+      releasers.join_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a memory pool that reuses the address of a destroyed memory pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a thread, which still owns a cache of a destroyed memory pool, does
+// not use this cache for a new memory pool at the same address. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReusedAddress()
+{
+   test_ = "Memory pool at a reused address";
+
+   void* const raw( ::operator new( sizeof(Pool) ) );
+   Pool* pool( new( raw ) Pool() );
+   Pointers pointers( 3UL );
+   boost::barrier barrier( 2U );
+
+   boost::thread worker( boost::bind( &ClassTest::reuseObjects, pool, &pointers, &barrier ) );
+
+   barrier.wait();
+   pool->~Pool();
+   pool = new( raw ) Pool();
+   barrier.wait();
+
+   worker.join();
+
+   if( pointers[2] == pointers[1] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Object of the destroyed memory pool has been allocated\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   pool->free( pointers[2] );
+   pool->~Pool();
+   ::operator delete( raw );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the alignment and size of the objects of the memory pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all objects of a memory pool for an over-aligned type are properly
+// aligned and that the objects of a memory pool for small objects are densely packed. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAlignment()
+{
+   test_ = "Alignment of the objects";
+
+   {
+      blaze::MemoryPool<AlignedType,64UL> pool;
+      std::vector<void*> pointers( 200UL );
+
+      for( size_t i=0UL; i<pointers.size(); ++i ) {
+         pointers[i] = pool.malloc();
+
+         if( reinterpret_cast<size_t>( pointers[i] ) % 16UL != 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Misaligned object detected\n"
+                << " Details:\n"
+                << "   Object  = " << i << "\n"
+                << "   Address = " << pointers[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      const size_t stride( static_cast<char*>( pointers[1] ) - static_cast<char*>( pointers[0] ) );
+
+      if( stride != sizeof(AlignedType) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid object size detected\n"
+             << " Details:\n"
+             << "   Result   = " << stride << "\n"
+             << "   Expected = " << sizeof(AlignedType) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<pointers.size(); ++i )
+         pool.free( pointers[i] );
+   }
+
+   {
+      blaze::MemoryPool<SmallType,64UL> pool;
+
+      void* const ptr1( pool.malloc() );
+      void* const ptr2( pool.malloc() );
+
+      const size_t stride( static_cast<char*>( ptr2 ) - static_cast<char*>( ptr1 ) );
+
+      if( stride != sizeof(SmallType) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid object size detected\n"
+             << " Details:\n"
+             << "   Result   = " << stride << "\n"
+             << "   Expected = " << sizeof(SmallType) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pool.free( ptr1 );
+      pool.free( ptr2 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PoolAllocator class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the use of the PoolAllocator class template as allocator of the dynamic
+// Blaze containers. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocator()
+{
+   test_ = "PoolAllocator";
+
+   typedef blaze::DynamicVector<double,blaze::columnVector,blaze::PoolAllocator<double> >  VT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor,blaze::PoolAllocator<double> >      MT;
+
+   VT x( 6UL, 1.0 );
+   MT A( 6UL, 6UL, 2.0 );
+   VT y;
+   MT B( 100UL, 100UL, 1.0 );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      y = A * x;
+   }
+
+   if( !blaze::checkAlignment( x.data() ) || !blaze::checkAlignment( A.data() ) ||
+       !blaze::checkAlignment( B.data() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( y.size() != 6UL || y[0] != 12.0 || y[5] != 12.0 || B(99,99) != 1.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid results detected\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n( 12 12 12 12 12 12 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of the objects in the range \f$ [first..last) \f$.
+//
+// \param pool The memory pool to allocate from.
+// \param pointers The vector of allocated objects.
+// \param first The index of the first object to be allocated.
+// \param last The index one past the last object to be allocated.
+// \return void
+*/
+void ClassTest::allocateObjects( Pool* pool, Pointers* pointers, size_t first, size_t last )
+{
+   for( size_t i=first; i<last; ++i ) {
+      (*pointers)[i] = pool->malloc();
+      *static_cast<double*>( (*pointers)[i] ) = static_cast<double>( i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of the objects in the range \f$ [first..last) \f$.
+//
+// \param pool The memory pool to release to.
+// \param pointers The vector of allocated objects.
+// \param first The index of the first object to be released.
+// \param last The index one past the last object to be released.
+// \return void
+*/
+void ClassTest::releaseObjects( Pool* pool, Pointers* pointers, size_t first, size_t last )
+{
+   for( size_t i=first; i<last; ++i ) {
+      pool->free( (*pointers)[i] );
+      (*pointers)[i] = NULL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation from a memory pool that is replaced by a new memory pool at the same address.
+//
+// \param pool The memory pool to allocate from.
+// \param pointers The vector of allocated objects (with at least three elements).
+// \param barrier The barrier for the synchronization with the replacing thread.
+// \return void
+//
+// This function allocates two objects from the given memory pool and releases the second one.
+// After the memory pool has been replaced, a third object is allocated from the new pool.
+*/
+void ClassTest::reuseObjects( Pool* pool, Pointers* pointers, boost::barrier* barrier )
+{
+   (*pointers)[0] = pool->malloc();
+   (*pointers)[1] = pool->malloc();
+   pool->free( (*pointers)[1] );
+
+   barrier->wait();  // The memory pool is replaced by the calling thread
+   barrier->wait();
+
+   (*pointers)[2] = pool->malloc();
+}
+//*************************************************************************************************
+
+} // namespace memorypool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MemoryPool class test..." << std::endl;
+
+   try
+   {
+      RUN_MEMORYPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MemoryPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
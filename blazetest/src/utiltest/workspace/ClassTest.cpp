@@ -0,0 +1,431 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workspace/ClassTest.cpp
+//  \brief Source file for the Workspace class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/AlignmentCheck.h>
+#include <blazetest/utiltest/workspace/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workspace {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Workspace class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testInactive();
+   testRecycling();
+   testNesting();
+   testCapacity();
+   testOverhead();
+   testExpression();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the memory allocation without active workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the allocation and deallocation of memory in case no workspace is active
+// on the current thread. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testInactive()
+{
+   test_ = "Allocation without active workspace";
+
+   if( blaze::Workspace::current() != NULL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Active workspace detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   double* const ptr( blaze::allocate<double>( 100UL ) );
+
+   if( !blaze::checkAlignment( ptr ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::deallocate( ptr );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the recycling of memory blocks within a workspace scope.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the caching and recycling of memory blocks by an active workspace. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRecycling()
+{
+   test_ = "Recycling of memory blocks";
+
+   blaze::WorkspaceScope scope;
+   blaze::Workspace& workspace( scope.workspace() );
+
+   if( blaze::Workspace::current() != &workspace ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Workspace is not active\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkSize( workspace, 0UL );
+
+   double* const ptr1( blaze::allocate<double>( 100UL ) );
+   blaze::deallocate( ptr1 );
+
+   checkSize( workspace, 1UL );
+
+   double* const ptr2( blaze::allocate<double>( 99UL ) );
+
+   checkSize( workspace, 0UL );
+
+   if( ptr1 != ptr2 || !blaze::checkAlignment( ptr2 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Memory block has not been recycled\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   double* const ptr3( blaze::allocate<double>( 1000UL ) );
+
+   blaze::deallocate( ptr2 );
+   blaze::deallocate( ptr3 );
+
+   checkSize( workspace, 2UL );
+
+   workspace.clear();
+
+   checkSize( workspace, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested workspace scopes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a nested workspace scope continues to use the active workspace.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNesting()
+{
+   test_ = "Nested workspace scopes";
+
+   blaze::WorkspaceScope outer;
+
+   {
+      blaze::WorkspaceScope inner;
+
+      if( &inner.workspace() != &outer.workspace() ||
+          blaze::Workspace::current() != &outer.workspace() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Nested scope activated a new workspace\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( blaze::allocate<float>( 100UL ) );
+   }
+
+   if( blaze::Workspace::current() != &outer.workspace() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Workspace has been deactivated by the nested scope\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkSize( outer.workspace(), 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the capacity of a workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the total size of the cached memory blocks never exceeds the capacity
+// of the workspace. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCapacity()
+{
+   test_ = "Capacity of a workspace";
+
+   blaze::WorkspaceScope scope( 4096UL );
+   blaze::Workspace& workspace( scope.workspace() );
+
+   double* const ptr1( blaze::allocate<double>(   50UL ) );
+   double* const ptr2( blaze::allocate<double>( 1000UL ) );
+
+   blaze::deallocate( ptr1 );
+   blaze::deallocate( ptr2 );
+
+   checkSize( workspace, 1UL );
+
+   double* const ptr3( blaze::allocate<double>( 250UL ) );
+   double* const ptr4( blaze::allocate<double>( 250UL ) );
+   double* const ptr5( blaze::allocate<double>( 250UL ) );
+
+   blaze::deallocate( ptr3 );
+   blaze::deallocate( ptr4 );
+   blaze::deallocate( ptr5 );
+
+   if( workspace.bytes() > workspace.capacity() || workspace.size() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Capacity of the workspace exceeded\n"
+          << " Details:\n"
+          << "   Cached blocks = " << workspace.size() << " (expected 2)\n"
+          << "   Cached bytes  = " << workspace.bytes() << "\n"
+          << "   Capacity      = " << workspace.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   workspace.setCapacity( 0UL );
+
+   checkSize( workspace, 0UL );
+
+   if( workspace.bytes() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cached memory blocks have not been released\n"
+          << " Details:\n"
+          << "   Cached bytes = " << workspace.bytes() << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the memory overhead of a workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that memory blocks requested within an active workspace are rounded up by
+// at most 12.5% (and to at least 64 bytes) and that memory blocks exceeding the capacity of the
+// workspace are not rounded at all. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testOverhead()
+{
+   test_ = "Memory overhead of a workspace";
+
+   blaze::WorkspaceScope scope( 4194304UL );
+   blaze::Workspace& workspace( scope.workspace() );
+
+   const size_t sizes[] = { 1UL, 9UL, 17UL, 100UL, 129UL, 1000UL, 1025UL, 12345UL, 131073UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(sizes[0]); ++i )
+   {
+      const size_t bytes( sizes[i]*sizeof(double) );
+      const size_t limit( std::max<size_t>( 64UL, bytes + bytes/8UL ) );
+
+      blaze::deallocate( blaze::allocate<double>( sizes[i] ) );
+
+      if( workspace.size() != 1UL || workspace.bytes() < bytes || workspace.bytes() > limit ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid memory overhead detected\n"
+             << " Details:\n"
+             << "   Requested bytes = " << bytes << "\n"
+             << "   Cached bytes    = " << workspace.bytes() << " (expected at most " << limit << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      workspace.clear();
+   }
+
+   double* const ptr( blaze::allocate<double>( 600000UL ) );
+   blaze::deallocate( ptr );
+
+   checkSize( workspace, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the recycling of expression temporaries.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the temporaries of repeatedly evaluated expressions are served by
+// the workspace after the first evaluation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExpression()
+{
+   test_ = "Recycling of expression temporaries";
+
+   blaze::DynamicMatrix<double> A( 20UL, 20UL, 1.0 );
+   blaze::DynamicMatrix<double> B( 20UL, 20UL, 2.0 );
+   blaze::DynamicMatrix<double> C( 20UL, 20UL, 3.0 );
+   blaze::DynamicVector<double> x( 20UL, 1.0 );
+   blaze::DynamicMatrix<double> D( 20UL, 20UL );
+   blaze::DynamicVector<double> y( 20UL );
+
+   blaze::WorkspaceScope scope;
+   size_t cached( 0UL );
+
+   for( size_t step=0UL; step<10UL; ++step )
+   {
+      D = A * ( B + C );
+      y = ( A * B ) * x;
+
+      if( step == 0UL ) {
+         cached = scope.workspace().size();
+      }
+      else checkSize( scope.workspace(), cached );
+   }
+
+   if( cached == 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: No temporaries have been cached\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( D(0,0) != 100.0 || y[0] != 800.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid results detected\n"
+          << " Details:\n"
+          << "   D(0,0) = " << D(0,0) << " (expected 100)\n"
+          << "   y[0]   = " << y[0] << " (expected 800)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of cached memory blocks of the given workspace.
+//
+// \param workspace The workspace to be checked.
+// \param expectedSize The expected number of cached memory blocks.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkSize( const blaze::Workspace& workspace, size_t expectedSize ) const
+{
+   if( workspace.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of cached memory blocks detected\n"
+          << " Details:\n"
+          << "   Number of cached blocks         : " << workspace.size() << "\n"
+          << "   Expected number of cached blocks: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace workspace
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Workspace class test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSPACE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Workspace class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************